@@ -0,0 +1,150 @@
+/**
+ * @file   bench_sparse_rtree_packing.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Benchmark sparse 2D multi-range read performance on a fragment with poorly
+ * clustered data tiles, for the R-tree packing given by the
+ * `TILEDB_BENCH_RTREE_PACKING` environment variable (`sequential`, `str` or
+ * `hilbert`, see `sm.rtree_packing`). The run phase also dumps the TileDB
+ * statistics to stderr, which report the number of R-tree nodes visited
+ * (`rtree_visited_node_num`).
+ */
+
+#include <cstdlib>
+#include <random>
+
+#include <tiledb/tiledb>
+
+#include "benchmark.h"
+
+using namespace tiledb;
+
+class Benchmark : public BenchmarkBase {
+ public:
+  Benchmark()
+      : ctx_(config()) {
+  }
+
+ protected:
+  virtual void setup() {
+    // A single space tile makes data tiles long thin strips in row-major
+    // order, which group poorly into R-tree nodes.
+    ArraySchema schema(ctx_, TILEDB_SPARSE);
+    Domain domain(ctx_);
+    domain.add_dimension(
+        Dimension::create<uint32_t>(ctx_, "d1", {{1, max_coord}}, max_coord));
+    domain.add_dimension(
+        Dimension::create<uint32_t>(ctx_, "d2", {{1, max_coord}}, max_coord));
+    schema.set_domain(domain);
+    schema.set_capacity(capacity);
+    schema.add_attribute(Attribute::create<int32_t>(ctx_, "a"));
+    Array::create(array_uri_, schema);
+
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<uint32_t> dis(1, max_coord);
+    std::vector<uint32_t> d1(cell_num), d2(cell_num);
+    std::vector<int32_t> a(cell_num);
+    for (uint64_t i = 0; i < cell_num; i++) {
+      d1[i] = dis(gen);
+      d2[i] = dis(gen);
+      a[i] = (int32_t)i;
+    }
+
+    Array array(ctx_, array_uri_, TILEDB_WRITE);
+    Query query(ctx_, array);
+    query.set_layout(TILEDB_UNORDERED)
+        .set_data_buffer("d1", d1)
+        .set_data_buffer("d2", d2)
+        .set_data_buffer("a", a);
+    query.submit();
+    array.close();
+  }
+
+  virtual void teardown() {
+    VFS vfs(ctx_);
+    if (vfs.is_dir(array_uri_))
+      vfs.remove_dir(array_uri_);
+  }
+
+  virtual void pre_run() {
+    d1_.resize(cell_num);
+    d2_.resize(cell_num);
+    a_.resize(cell_num);
+    Stats::enable();
+    Stats::reset();
+  }
+
+  virtual void run() {
+    Array array(ctx_, array_uri_, TILEDB_READ);
+
+    // Many small ranges per dimension, forming a grid of small ND ranges
+    Subarray subarray(ctx_, array);
+    const uint32_t step = max_coord / range_num;
+    for (uint32_t r = 0; r < range_num; r++) {
+      subarray.add_range<uint32_t>(0, r * step + 1, r * step + range_size);
+      subarray.add_range<uint32_t>(1, r * step + 1, r * step + range_size);
+    }
+
+    Query query(ctx_, array);
+    query.set_subarray(subarray)
+        .set_layout(TILEDB_UNORDERED)
+        .set_data_buffer("d1", d1_)
+        .set_data_buffer("d2", d2_)
+        .set_data_buffer("a", a_);
+    do {
+      query.submit();
+    } while (query.query_status() == Query::Status::INCOMPLETE);
+    array.close();
+
+    Stats::dump(stderr);
+  }
+
+ private:
+  const std::string array_uri_ = "bench_array";
+  const uint32_t max_coord = 100000;
+  const uint64_t cell_num = 10000000;
+  const uint64_t capacity = 100;
+  const uint32_t range_num = 100, range_size = 100;
+
+  Context ctx_;
+  std::vector<uint32_t> d1_, d2_;
+  std::vector<int32_t> a_;
+
+  static Config config() {
+    Config config;
+    const char* packing = std::getenv("TILEDB_BENCH_RTREE_PACKING");
+    if (packing != nullptr)
+      config["sm.rtree_packing"] = packing;
+    return config;
+  }
+};
+
+int main(int argc, char** argv) {
+  Benchmark bench;
+  return bench.main(argc, argv);
+}
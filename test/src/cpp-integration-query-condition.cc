@@ -1769,4 +1769,120 @@ TEST_CASE(
   if (vfs.is_dir(array_name)) {
     vfs.remove_dir(array_name);
   }
-}
\ No newline at end of file
+}
+/**
+ * Reads the rows of the set membership test array matching a query
+ * condition, with the sparse reader selected by `reader`.
+ */
+static std::vector<int> read_set_membership_rows(
+    const std::string& reader, const QueryCondition& qc) {
+  Config config;
+  if (reader == "legacy") {
+    config.set("sm.query.sparse_global_order.reader", "legacy");
+    config.set("sm.query.sparse_unordered_with_dups.reader", "legacy");
+  }
+  Context ctx(config);
+  Array array(ctx, array_name, TILEDB_READ);
+  Query query(ctx, array);
+
+  std::vector<int> rows(8);
+  std::vector<int> a(8);
+  std::vector<uint8_t> a_validity(8);
+  std::string s(16, '\0');
+  std::vector<uint64_t> s_offsets(8);
+  auto layout = reader == "legacy" ? TILEDB_GLOBAL_ORDER : TILEDB_UNORDERED;
+  query.set_layout(layout)
+      .set_data_buffer("rows", rows)
+      .set_data_buffer("a", a)
+      .set_validity_buffer("a", a_validity)
+      .set_data_buffer("s", s)
+      .set_offsets_buffer("s", s_offsets)
+      .set_condition(qc);
+  query.submit();
+  REQUIRE(query.query_status() == Query::Status::COMPLETE);
+
+  rows.resize(query.result_buffer_elements()["rows"].second);
+  std::sort(rows.begin(), rows.end());
+  array.close();
+  return rows;
+}
+
+TEST_CASE(
+    "Testing read query with set membership QC",
+    "[query][query-condition][set-membership]") {
+  Context ctx;
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name)) {
+    vfs.remove_dir(array_name);
+  }
+
+  // Sparse array with a nullable int attribute and a string attribute.
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int>(ctx, "rows", {{1, 8}}, 4));
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain).set_capacity(4).set_allows_dups(true);
+  Attribute attr_a = Attribute::create<int>(ctx, "a");
+  attr_a.set_nullable(true);
+  schema.add_attribute(attr_a);
+  schema.add_attribute(Attribute::create<std::string>(ctx, "s"));
+  Array::create(array_name, schema);
+
+  // Rows 4 and 7 are null on attribute a.
+  std::vector<int> rows = {1, 2, 3, 4, 5, 6, 7, 8};
+  std::vector<int> a = {1, 2, 3, 0, 5, 6, 0, 8};
+  std::vector<uint8_t> a_validity = {1, 1, 1, 0, 1, 1, 0, 1};
+  std::string s = "xyzxwyvx";
+  std::vector<uint64_t> s_offsets = {0, 1, 2, 3, 4, 5, 6, 7};
+
+  Array array_w(ctx, array_name, TILEDB_WRITE);
+  Query query_w(ctx, array_w);
+  query_w.set_layout(TILEDB_UNORDERED)
+      .set_data_buffer("rows", rows)
+      .set_data_buffer("a", a)
+      .set_validity_buffer("a", a_validity)
+      .set_data_buffer("s", s)
+      .set_offsets_buffer("s", s_offsets);
+  query_w.submit();
+  query_w.finalize();
+  array_w.close();
+
+  std::string reader = GENERATE("legacy", "refactored");
+
+  // Fixed-size members.
+  std::vector<int> members = {2, 5, 8, 42};
+  auto in = QueryCondition::create(ctx, "a", members, TILEDB_IN);
+  CHECK(read_set_membership_rows(reader, in) == std::vector<int>{2, 5, 8});
+
+  // Null cells are selected by neither IN nor NOT_IN, as for NE.
+  auto not_in = QueryCondition::create(ctx, "a", members, TILEDB_NOT_IN);
+  CHECK(read_set_membership_rows(reader, not_in) == std::vector<int>{1, 3, 6});
+  auto ne = QueryCondition::create<int>(ctx, "a", 2, TILEDB_NE);
+  CHECK(
+      read_set_membership_rows(reader, ne) ==
+      std::vector<int>{1, 3, 5, 6, 8});
+
+  // Var-sized members.
+  std::vector<std::string> str_members = {"x", "y"};
+  auto str_in = QueryCondition::create(ctx, "s", str_members, TILEDB_IN);
+  CHECK(
+      read_set_membership_rows(reader, str_in) ==
+      std::vector<int>{1, 2, 4, 6, 8});
+  auto str_not_in =
+      QueryCondition::create(ctx, "s", str_members, TILEDB_NOT_IN);
+  CHECK(
+      read_set_membership_rows(reader, str_not_in) ==
+      std::vector<int>{3, 5, 7});
+
+  // Combined with other conditions.
+  CHECK(
+      read_set_membership_rows(reader, in.combine(str_in, TILEDB_AND)) ==
+      std::vector<int>{2, 8});
+  CHECK(
+      read_set_membership_rows(reader, not_in.combine(str_not_in, TILEDB_OR)) ==
+      std::vector<int>{1, 3, 5, 6, 7});
+
+  if (vfs.is_dir(array_name)) {
+    vfs.remove_dir(array_name);
+  }
+}
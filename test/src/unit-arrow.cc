@@ -437,3 +437,139 @@ TEST_CASE("Arrow IO integration tests", "[arrow]") {
     test_for_column_size(sz);
   }
 }
+
+TEST_CASE("Arrow IO stream reader", "[arrow][stream]") {
+  std::string uri("test_arrow_io_stream");
+  Context ctx;
+  VFS vfs(ctx);
+  if (vfs.is_dir(uri))
+    vfs.remove_dir(uri);
+
+  // Create a dense array with a fixed, a nullable and a string attribute
+  const int32_t ncells = 100;
+  Domain domain(ctx);
+  domain.add_dimension(
+      Dimension::create<int32_t>(ctx, "d1", {{0, ncells - 1}}, 10));
+  ArraySchema schema(ctx, TILEDB_DENSE);
+  schema.set_domain(domain);
+  schema.add_attribute(Attribute::create<int32_t>(ctx, "a1"));
+  auto a2 = Attribute::create<int64_t>(ctx, "a2");
+  a2.set_nullable(true);
+  schema.add_attribute(a2);
+  auto a3 = Attribute(ctx, "a3", TILEDB_STRING_UTF8);
+  a3.set_cell_val_num(TILEDB_VAR_NUM);
+  schema.add_attribute(a3);
+  Array::create(uri, schema);
+
+  // Write the data
+  std::vector<int32_t> a1_data(ncells);
+  std::vector<int64_t> a2_data(ncells);
+  std::vector<uint8_t> a2_validity(ncells);
+  std::string a3_data;
+  std::vector<uint64_t> a3_offsets(ncells);
+  for (int32_t i = 0; i < ncells; i++) {
+    a1_data[i] = i;
+    a2_data[i] = 2 * i;
+    a2_validity[i] = i % 3 != 0;
+    a3_offsets[i] = a3_data.size();
+    a3_data += std::to_string(i);
+  }
+  {
+    Array array(ctx, uri, TILEDB_WRITE);
+    Query query(ctx, array);
+    query.set_layout(TILEDB_ROW_MAJOR)
+        .set_data_buffer("a1", a1_data)
+        .set_data_buffer("a2", a2_data)
+        .set_validity_buffer("a2", a2_validity)
+        .set_data_buffer("a3", a3_data)
+        .set_offsets_buffer("a3", a3_offsets);
+    REQUIRE(query.submit() == Query::Status::COMPLETE);
+    array.close();
+  }
+
+  bool read_ahead = GENERATE(true, false);
+  auto bitsize = GENERATE("32", "64");
+
+  Config config;
+  config["sm.var_offsets.bitsize"] = bitsize;
+  Context read_ctx(config);
+  Array array(read_ctx, uri, TILEDB_READ);
+  Query query(read_ctx, array);
+  query.set_layout(TILEDB_ROW_MAJOR);
+  query.add_range(0, (int32_t)0, ncells - 1);
+
+  ArrowArrayStream stream;
+  tiledb::arrow::query_export_arrow_stream(
+      &read_ctx, &query, {"a1", "a2", "a3"}, &stream, 16, read_ahead);
+
+  ArrowSchema arw_schema;
+  REQUIRE(stream.get_schema(&stream, &arw_schema) == 0);
+  CHECK(std::string(arw_schema.format) == "+s");
+  REQUIRE(arw_schema.n_children == 3);
+  CHECK(std::string(arw_schema.children[0]->format) == "i");
+  CHECK(std::string(arw_schema.children[1]->format) == "l");
+  CHECK(arw_schema.children[1]->flags == ARROW_FLAG_NULLABLE);
+  CHECK(
+      std::string(arw_schema.children[2]->format) ==
+      (std::string(bitsize) == "32" ? "u" : "U"));
+  arw_schema.release(&arw_schema);
+  CHECK(arw_schema.release == nullptr);
+
+  // Consume all batches and check the data
+  int64_t cell = 0;
+  uint64_t batch_num = 0;
+  while (true) {
+    ArrowArray batch;
+    REQUIRE(stream.get_next(&stream, &batch) == 0);
+    if (batch.release == nullptr)
+      break;
+    batch_num++;
+    REQUIRE(batch.n_children == 3);
+    CHECK(batch.length <= 16);
+
+    auto a1_arw = batch.children[0];
+    auto a1_values = static_cast<const int32_t*>(a1_arw->buffers[1]);
+    CHECK(reinterpret_cast<uintptr_t>(a1_values) % 64 == 0);
+
+    auto a2_arw = batch.children[1];
+    auto a2_values = static_cast<const int64_t*>(a2_arw->buffers[1]);
+    auto a2_bitmap = static_cast<const uint8_t*>(a2_arw->buffers[0]);
+    CHECK((a2_bitmap == nullptr) == (a2_arw->null_count == 0));
+
+    auto a3_arw = batch.children[2];
+    auto a3_chars = static_cast<const char*>(a3_arw->buffers[2]);
+    for (int64_t i = 0; i < batch.length; i++, cell++) {
+      CHECK(a1_values[i] == cell);
+
+      bool valid = a2_bitmap == nullptr || (a2_bitmap[i / 8] >> (i % 8)) & 1;
+      CHECK(valid == (cell % 3 != 0));
+      if (valid)
+        CHECK(a2_values[i] == 2 * cell);
+
+      uint64_t begin, end;
+      if (std::string(bitsize) == "32") {
+        auto offsets = static_cast<const int32_t*>(a3_arw->buffers[1]);
+        begin = offsets[i];
+        end = offsets[i + 1];
+      } else {
+        auto offsets = static_cast<const int64_t*>(a3_arw->buffers[1]);
+        begin = offsets[i];
+        end = offsets[i + 1];
+      }
+      CHECK(
+          std::string(a3_chars + begin, end - begin) == std::to_string(cell));
+    }
+
+    batch.release(&batch);
+    CHECK(batch.release == nullptr);
+  }
+  CHECK(cell == ncells);
+  CHECK(batch_num >= ncells / 16);
+
+  stream.release(&stream);
+  CHECK(stream.release == nullptr);
+
+  array.close();
+  if (vfs.is_dir(uri))
+    vfs.remove_dir(uri);
+}
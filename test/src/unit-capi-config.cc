@@ -227,6 +227,8 @@ void check_save_to_file() {
 #endif
   ss << "filestore.buffer_size 104857600\n";
   ss << "rest.curl.buffer_size 524288\n";
+  ss << "rest.curl.http2 false\n";
+  ss << "rest.curl.pool_size 16\n";
   ss << "rest.curl.verbose false\n";
   ss << "rest.http_compressor any\n";
   ss << "rest.load_metadata_on_array_open true\n";
@@ -238,6 +240,7 @@ void check_save_to_file() {
   ss << "rest.server_address https://api.tiledb.com\n";
   ss << "rest.server_serialization_format CAPNP\n";
   ss << "rest.use_refactored_array_open false\n";
+  ss << "sm.bloom_filter_bits_per_cell 0\n";
   ss << "sm.check_coord_dups true\n";
   ss << "sm.check_coord_oob true\n";
   ss << "sm.check_global_order true\n";
@@ -258,8 +261,10 @@ void check_save_to_file() {
   ss << "sm.encryption_type NO_ENCRYPTION\n";
   ss << "sm.group.timestamp_end 18446744073709551615\n";
   ss << "sm.group.timestamp_start 0\n";
+  ss << "sm.io_concurrency_adaptive false\n";
   ss << "sm.io_concurrency_level " << std::thread::hardware_concurrency()
      << "\n";
+  ss << "sm.io_concurrency_level_min 1\n";
   ss << "sm.max_tile_overlap_size 314572800\n";
   ss << "sm.mem.malloc_trim true\n";
   ss << "sm.mem.reader.sparse_global_order.ratio_array_data 0.1\n";
@@ -274,10 +279,13 @@ void check_save_to_file() {
   ss << "sm.mem.total_budget 10737418240\n";
   ss << "sm.memory_budget 5368709120\n";
   ss << "sm.memory_budget_var 10737418240\n";
+  ss << "sm.persist_hilbert_values false\n";
   ss << "sm.query.dense.reader refactored\n";
   ss << "sm.query.sparse_global_order.reader refactored\n";
   ss << "sm.query.sparse_unordered_with_dups.reader refactored\n";
   ss << "sm.read_range_oob warn\n";
+  ss << "sm.rtree_packing sequential\n";
+  ss << "sm.rtree_page_cache_size 100000000\n";
   ss << "sm.skip_checksum_validation false\n";
   ss << "sm.skip_est_size_partitioning false\n";
   ss << "sm.tile_cache_size 10000000\n";
@@ -305,6 +313,7 @@ void check_save_to_file() {
   ss << "vfs.min_batch_size 20971520\n";
   ss << "vfs.min_parallel_size 10485760\n";
   ss << "vfs.read_ahead_cache_size 10485760\n";
+  ss << "vfs.read_ahead_max_size 1638400\n";
   ss << "vfs.read_ahead_size 102400\n";
   ss << "vfs.s3.bucket_canned_acl NOT_SET\n";
   ss << "vfs.s3.connect_max_tries 5\n";
@@ -578,6 +587,8 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["rest.retry_http_codes"] = "503";
   all_param_values["rest.curl.buffer_size"] = "524288";
   all_param_values["rest.curl.verbose"] = "false";
+  all_param_values["rest.curl.http2"] = "false";
+  all_param_values["rest.curl.pool_size"] = "16";
   all_param_values["rest.load_metadata_on_array_open"] = "false";
   all_param_values["rest.load_non_empty_domain_on_array_open"] = "false";
   all_param_values["rest.use_refactored_array_open"] = "true";
@@ -587,7 +598,11 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["sm.check_coord_dups"] = "true";
   all_param_values["sm.check_coord_oob"] = "true";
   all_param_values["sm.check_global_order"] = "true";
+  all_param_values["sm.persist_hilbert_values"] = "false";
   all_param_values["sm.tile_cache_size"] = "100";
+  all_param_values["sm.rtree_page_cache_size"] = "100000000";
+  all_param_values["sm.rtree_packing"] = "sequential";
+  all_param_values["sm.bloom_filter_bits_per_cell"] = "0";
   all_param_values["sm.skip_est_size_partitioning"] = "false";
   all_param_values["sm.memory_budget"] = "5368709120";
   all_param_values["sm.memory_budget_var"] = "10737418240";
@@ -619,6 +634,8 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
       std::to_string(std::thread::hardware_concurrency());
   all_param_values["sm.io_concurrency_level"] =
       std::to_string(std::thread::hardware_concurrency());
+  all_param_values["sm.io_concurrency_adaptive"] = "false";
+  all_param_values["sm.io_concurrency_level_min"] = "1";
   all_param_values["sm.skip_checksum_validation"] = "false";
   all_param_values["sm.consolidation.amplification"] = "1.0";
   all_param_values["sm.consolidation.steps"] = "4294967295";
@@ -645,6 +662,7 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["vfs.min_parallel_size"] = "10485760";
   all_param_values["vfs.read_ahead_size"] = "102400";
   all_param_values["vfs.read_ahead_cache_size"] = "10485760";
+  all_param_values["vfs.read_ahead_max_size"] = "1638400";
   all_param_values["vfs.gcs.project_id"] = "";
   all_param_values["vfs.gcs.max_parallel_ops"] =
       std::to_string(std::thread::hardware_concurrency());
@@ -710,6 +728,7 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   vfs_param_values["disable_batching"] = "false";
   vfs_param_values["read_ahead_size"] = "102400";
   vfs_param_values["read_ahead_cache_size"] = "10485760";
+  vfs_param_values["read_ahead_max_size"] = "1638400";
   vfs_param_values["gcs.project_id"] = "";
   vfs_param_values["gcs.max_parallel_ops"] =
       std::to_string(std::thread::hardware_concurrency());
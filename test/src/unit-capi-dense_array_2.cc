@@ -34,6 +34,7 @@
 #include "test/src/vfs_helpers.h"
 #include "tiledb/sm/c_api/tiledb.h"
 #include "tiledb/sm/c_api/tiledb_struct_def.h"
+#include "tiledb/sm/query/readers/dense_reader.h"
 
 #ifdef _WIN32
 #include "tiledb/sm/filesystem/win.h"
@@ -493,3 +494,128 @@ TEST_CASE_METHOD(
   // Clean up
   close_array(ctx_, array_);
 }
+
+TEST_CASE_METHOD(
+    CDenseArrayFx,
+    "Dense array: 1D, var overflow reuses the tiles of the split partition",
+    "[capi][dense2][1D][overflow]") {
+  // Create an array with a single var sized attribute.
+  uint64_t domain[] = {1, 10};
+  uint64_t tile_extent = 5;
+  create_array(
+      ctx_,
+      array_name_,
+      TILEDB_DENSE,
+      {"d"},
+      {TILEDB_UINT64},
+      {domain},
+      {&tile_extent},
+      {"b"},
+      {TILEDB_CHAR},
+      {TILEDB_VAR_NUM},
+      {tiledb::test::Compressor(TILEDB_FILTER_NONE, -1)},
+      TILEDB_ROW_MAJOR,
+      TILEDB_ROW_MAJOR,
+      2);
+
+  // The first cell holds most of the var data of the first tile, so the
+  // estimated size of cells 1-2 fits in the buffer but the actual one does
+  // not.
+  std::vector<uint64_t> w_off(10);
+  std::string w_val(100, 'a');
+  for (uint64_t i = 1; i < 10; i++) {
+    w_off[i] = w_val.size();
+    w_val.push_back('a' + static_cast<char>(i));
+  }
+  tiledb::test::QueryBuffers buffers;
+  buffers["b"] = tiledb::test::QueryBuffer(
+      {&w_off[0], w_off.size() * sizeof(uint64_t), &w_val[0], w_val.size()});
+  write_array(ctx_, array_name_, TILEDB_GLOBAL_ORDER, buffers);
+
+  // Tiles that do not fit in the memory budget are dropped on overflow.
+  std::string total_budget = "10737418240";
+  uint64_t expected_reused = 1;
+  uint64_t expected_dropped = 0;
+  SECTION("Within budget") {
+  }
+  SECTION("Over budget") {
+    total_budget = "100";
+    expected_reused = 0;
+    expected_dropped = 1;
+  }
+
+  open_array(ctx_, array_, TILEDB_READ);
+  tiledb_query_t* query;
+  int rc = tiledb_query_alloc(ctx_, array_, TILEDB_READ, &query);
+  REQUIRE(rc == TILEDB_OK);
+
+  tiledb_config_t* config;
+  tiledb_error_t* error = nullptr;
+  REQUIRE(tiledb_config_alloc(&config, &error) == TILEDB_OK);
+  REQUIRE(error == nullptr);
+  rc = tiledb_config_set(
+      config, "sm.mem.total_budget", total_budget.c_str(), &error);
+  REQUIRE(rc == TILEDB_OK);
+  REQUIRE(error == nullptr);
+  rc = tiledb_query_set_config(ctx_, query, config);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_config_free(&config);
+
+  rc = tiledb_query_set_layout(ctx_, query, TILEDB_ROW_MAJOR);
+  REQUIRE(rc == TILEDB_OK);
+  uint64_t start = 1, end = 2;
+  rc = tiledb_query_add_range(ctx_, query, 0, &start, &end, nullptr);
+  REQUIRE(rc == TILEDB_OK);
+
+  std::vector<uint64_t> b_off(2);
+  std::vector<char> b_val(100);
+  uint64_t b_off_size = b_off.size() * sizeof(uint64_t);
+  uint64_t b_val_size = b_val.size();
+  rc = tiledb_query_set_offsets_buffer(
+      ctx_, query, "b", b_off.data(), &b_off_size);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_data_buffer(
+      ctx_, query, "b", b_val.data(), &b_val_size);
+  REQUIRE(rc == TILEDB_OK);
+
+  // Cells 1-2 overflow, the split partition returns cell 1 only.
+  rc = tiledb_query_submit(ctx_, query);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_query_status_t status;
+  rc = tiledb_query_get_status(ctx_, query, &status);
+  REQUIRE(rc == TILEDB_OK);
+  CHECK(status == TILEDB_INCOMPLETE);
+  CHECK(b_off_size == sizeof(uint64_t));
+  CHECK(b_off[0] == 0);
+  REQUIRE(b_val_size == 100);
+  CHECK(std::string(b_val.data(), b_val_size) == std::string(100, 'a'));
+
+  // Check that the tiles of the overflowed read were reused, or dropped.
+  auto stats = ((DenseReader*)query->query_->strategy())->stats();
+  REQUIRE(stats != nullptr);
+  auto counters = stats->counters();
+  REQUIRE(counters != nullptr);
+  auto counter = [&](const std::string& name) -> uint64_t {
+    auto it = counters->find("Context.StorageManager.Query.Reader." + name);
+    return it == counters->end() ? 0 : it->second;
+  };
+  CHECK(counter("overflow_tiles_reused") == expected_reused);
+  CHECK(counter("overflow_tiles_dropped") == expected_dropped);
+
+  // The next submission returns cell 2.
+  b_off_size = b_off.size() * sizeof(uint64_t);
+  b_val_size = b_val.size();
+  rc = tiledb_query_submit(ctx_, query);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_get_status(ctx_, query, &status);
+  REQUIRE(rc == TILEDB_OK);
+  CHECK(status == TILEDB_COMPLETED);
+  CHECK(b_off_size == sizeof(uint64_t));
+  CHECK(b_off[0] == 0);
+  REQUIRE(b_val_size == 1);
+  CHECK(b_val[0] == 'b');
+
+  // Clean up
+  tiledb_query_free(&query);
+  close_array(ctx_, array_);
+}
@@ -288,7 +288,7 @@ TEST_CASE(
   uint64_t size;
   rc = tiledb_fragment_info_get_fragment_size(ctx, fragment_info, 1, &size);
   CHECK(rc == TILEDB_OK);
-  CHECK(size == 3193);
+  CHECK(size == 3194);
 
   // Get dense / sparse
   int32_t dense;
@@ -539,7 +539,7 @@ TEST_CASE(
   uint64_t size;
   rc = tiledb_fragment_info_get_fragment_size(ctx, fragment_info, 1, &size);
   CHECK(rc == TILEDB_OK);
-  CHECK(size == 5576);
+  CHECK(size == 5577);
 
   // Get dense / sparse
   int32_t dense;
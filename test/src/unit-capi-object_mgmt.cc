@@ -68,6 +68,7 @@ struct ObjectMgmtFx {
   void check_move(const std::string& path);
   void check_ls_1000(const std::string& path);
   void create_array(const std::string& path);
+  void write_array(const std::string& path);
   void create_temp_dir(const std::string& path);
   void remove_temp_dir(const std::string& path);
   void create_hierarchy(const std::string& path);
@@ -139,6 +140,26 @@ void ObjectMgmtFx::create_array(const std::string& path) {
   tiledb_array_schema_free(&array_schema);
 }
 
+void ObjectMgmtFx::write_array(const std::string& path) {
+  tiledb_array_t* array;
+  REQUIRE(tiledb_array_alloc(ctx_, path.c_str(), &array) == TILEDB_OK);
+  REQUIRE(tiledb_array_open(ctx_, array, TILEDB_WRITE) == TILEDB_OK);
+
+  float a1[] = {1.0f};
+  uint64_t a1_size = sizeof(a1);
+  tiledb_query_t* query;
+  REQUIRE(tiledb_query_alloc(ctx_, array, TILEDB_WRITE, &query) == TILEDB_OK);
+  REQUIRE(tiledb_query_set_layout(ctx_, query, TILEDB_ROW_MAJOR) == TILEDB_OK);
+  REQUIRE(
+      tiledb_query_set_data_buffer(ctx_, query, "a1", a1, &a1_size) ==
+      TILEDB_OK);
+  REQUIRE(tiledb_query_submit(ctx_, query) == TILEDB_OK);
+
+  REQUIRE(tiledb_array_close(ctx_, array) == TILEDB_OK);
+  tiledb_query_free(&query);
+  tiledb_array_free(&array);
+}
+
 void ObjectMgmtFx::check_object_type(const std::string& path) {
   std::string group, array;
   tiledb_object_t type;
@@ -460,6 +481,71 @@ TEST_CASE_METHOD(
   }
 }
 
+TEST_CASE_METHOD(
+    ObjectMgmtFx,
+    "C API: Test object management methods: walk arrays with fragments",
+    "[capi][object][walk][fragments]") {
+  SupportedFs* const fs = fs_vec_[0].get();
+  if (dynamic_cast<SupportedFsLocal*>(fs) == nullptr)
+    return;
+
+  SupportedFsLocal local_fs;
+  std::string local_dir = local_fs.file_prefix() + local_fs.temp_dir();
+  remove_temp_dir(local_dir);
+  create_temp_dir(local_dir);
+#ifdef _WIN32
+  // `VFS::ls(...)` returns `file:///` URIs instead of Windows paths.
+  std::string temp_dir = tiledb::sm::path_win::uri_from_path(local_dir);
+#else
+  std::string temp_dir = local_dir;
+#endif
+
+  // A group holding an array with fragments and commits, which itself
+  // holds a nested array. The internal directories of the arrays are not
+  // TileDB objects, the nested array is.
+  std::string group = temp_dir + "group";
+  std::string array = group + "/array";
+  std::string nested = array + "/nested";
+  REQUIRE(tiledb_group_create(ctx_, group.c_str()) == TILEDB_OK);
+  create_array(array);
+  write_array(array);
+  write_array(array);
+  create_array(nested);
+  write_array(nested);
+
+  std::string golden_walk;
+  golden_walk += group + " GROUP\n";
+  golden_walk += array + " ARRAY\n";
+  golden_walk += nested + " ARRAY\n";
+  golden_walk += nested + " ARRAY\n";
+  golden_walk += array + " ARRAY\n";
+  golden_walk += group + " GROUP\n";
+
+  std::string walk_str;
+  int rc = tiledb_object_walk(
+      ctx_, temp_dir.c_str(), TILEDB_PREORDER, write_path, &walk_str);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_object_walk(
+      ctx_, temp_dir.c_str(), TILEDB_POSTORDER, write_path, &walk_str);
+  CHECK(rc == TILEDB_OK);
+  CHECK_THAT(golden_walk, Catch::Equals(walk_str));
+
+  // Walking from inside an array skips its internal directories too.
+  walk_str.clear();
+  rc = tiledb_object_walk(
+      ctx_, array.c_str(), TILEDB_PREORDER, write_path, &walk_str);
+  CHECK(rc == TILEDB_OK);
+  CHECK_THAT(nested + " ARRAY\n", Catch::Equals(walk_str));
+
+  // Listing the array only reports the nested array.
+  std::string ls_str;
+  rc = tiledb_object_ls(ctx_, array.c_str(), write_path, &ls_str);
+  CHECK(rc == TILEDB_OK);
+  CHECK_THAT(nested + " ARRAY\n", Catch::Equals(ls_str));
+
+  remove_temp_dir(local_dir);
+}
+
 TEST_CASE_METHOD(
     ObjectMgmtFx,
     "C API: Test listing directory with >1000 objects on S3",
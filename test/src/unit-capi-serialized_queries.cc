@@ -49,6 +49,7 @@
 
 #include <any>
 #include <cassert>
+#include <cstring>
 #include <map>
 
 using namespace tiledb;
@@ -427,13 +428,23 @@ struct SerializationFx {
 
   /**
    * Helper function that deserializes a query from the "client" or "server"
-   * perspective.
+   * perspective. If 'misalignment' is non-zero, the query is deserialized from
+   * a copy of 'serialized' at an address that is not 8-byte aligned.
    */
   static void deserialize_query(
       const Context& ctx,
       std::vector<uint8_t>& serialized,
       Query* query,
-      bool clientside) {
+      bool clientside,
+      uint64_t misalignment = 0) {
+    std::vector<uint8_t> unaligned;
+    uint8_t* data = &serialized[0];
+    if (misalignment != 0) {
+      unaligned.resize(serialized.size() + misalignment);
+      data = &unaligned[misalignment];
+      std::memcpy(data, &serialized[0], serialized.size());
+    }
+
     tiledb_buffer_t* c_buff;
     ctx.handle_error(tiledb_buffer_alloc(ctx.ptr().get(), &c_buff));
 
@@ -445,7 +456,7 @@ struct SerializationFx {
     ctx.handle_error(tiledb_buffer_set_data(
         ctx.ptr().get(),
         c_buff,
-        reinterpret_cast<void*>(&serialized[0]),
+        reinterpret_cast<void*>(data),
         static_cast<uint64_t>(serialized.size())));
 
     // Deserialize
@@ -606,6 +617,59 @@ TEST_CASE_METHOD(
       std::free(b);
   }
 
+  SECTION("- Read all, unaligned response") {
+    Array array(ctx, array_uri, TILEDB_READ);
+    Query query(ctx, array);
+    std::vector<uint32_t> a1(1000);
+    std::vector<uint32_t> a2(1000);
+    std::vector<uint8_t> a2_nullable(500);
+    std::vector<char> a3_data(1000 * 100);
+    std::vector<uint64_t> a3_offsets(1000);
+    std::vector<int32_t> subarray = {1, 10, 1, 10};
+
+    query.set_subarray(subarray);
+    query.set_data_buffer("a1", a1);
+    query.set_data_buffer("a2", a2);
+    query.set_validity_buffer("a2", a2_nullable);
+    query.set_data_buffer("a3", a3_data);
+    query.set_offsets_buffer("a3", a3_offsets);
+
+    // Serialize into a copy (client side).
+    std::vector<uint8_t> serialized;
+    serialize_query(ctx, query, &serialized, true);
+
+    // Deserialize into a new query and allocate buffers (server side).
+    Array array2(ctx, array_uri, TILEDB_READ);
+    Query query2(ctx, array2);
+    deserialize_query(ctx, serialized, &query2, false);
+    auto to_free = allocate_query_buffers(ctx, array2, &query2);
+
+    // Submit and serialize results (server side).
+    query2.submit();
+    serialize_query(ctx, query2, &serialized, false);
+
+    // Deserialize into original query (client side), from a response that
+    // is not 8-byte aligned, as when received after another response.
+    deserialize_query(ctx, serialized, &query, true, 3);
+    REQUIRE(query.query_status() == Query::Status::COMPLETE);
+
+    auto result_el = query.result_buffer_elements_nullable();
+    REQUIRE(std::get<1>(result_el["a1"]) == 100);
+    REQUIRE(std::get<1>(result_el["a2"]) == 200);
+    REQUIRE(std::get<2>(result_el["a2"]) == 100);
+    REQUIRE(std::get<0>(result_el["a3"]) == 100);
+    REQUIRE(std::get<1>(result_el["a3"]) == 5050);
+
+    REQUIRE(check_result(a1, expected_results["a1"]));
+    REQUIRE(check_result(a2, expected_results["a2"]));
+    REQUIRE(check_result(a2_nullable, expected_results["a2_nullable"]));
+    REQUIRE(check_result(a3_data, expected_results["a3_data"]));
+    REQUIRE(check_result(a3_offsets, expected_results["a3_offsets"]));
+
+    for (void* b : to_free)
+      std::free(b);
+  }
+
   SECTION("- Read all, with condition") {
     Array array(ctx, array_uri, TILEDB_READ);
     Query query(ctx, array);
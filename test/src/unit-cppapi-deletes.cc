@@ -37,6 +37,7 @@
 #include "tiledb/sm/array/array_directory.h"
 #include "tiledb/sm/c_api/tiledb_struct_def.h"
 #include "tiledb/sm/cpp_api/tiledb"
+#include "tiledb/sm/misc/constants.h"
 
 #ifdef _WIN32
 #include "tiledb/sm/filesystem/win.h"
@@ -66,7 +67,8 @@ struct DeletesFx {
 
   // Functions.
   void set_legacy();
-  void create_sparse_array(bool allows_dups = false, bool encrypt = false);
+  void create_sparse_array(
+      bool allows_dups = false, bool encrypt = false, uint64_t capacity = 20);
   void write_sparse(
       std::vector<int> a1,
       std::vector<uint64_t> dim1,
@@ -83,6 +85,8 @@ struct DeletesFx {
       bool encrypt = false);
   void consolidate_sparse(bool vacuum = false);
   void consolidate_commits_sparse(bool vacuum);
+  void consolidate_delete_vectors_sparse(bool vacuum);
+  uint64_t delete_vector_num();
   void write_delete_condition(
       QueryCondition& qc,
       uint64_t timestamp,
@@ -120,7 +124,8 @@ void DeletesFx::set_legacy() {
   vfs_ = VFS(ctx_);
 }
 
-void DeletesFx::create_sparse_array(bool allows_dups, bool encrypt) {
+void DeletesFx::create_sparse_array(
+    bool allows_dups, bool encrypt, uint64_t capacity) {
   // Create dimensions.
   auto d1 = Dimension::create<uint64_t>(ctx_, "d1", {{1, 4}}, 2);
   auto d2 = Dimension::create<uint64_t>(ctx_, "d2", {{1, 4}}, 2);
@@ -136,7 +141,7 @@ void DeletesFx::create_sparse_array(bool allows_dups, bool encrypt) {
   // Create array schmea.
   ArraySchema schema(ctx_, TILEDB_SPARSE);
   schema.set_domain(domain);
-  schema.set_capacity(20);
+  schema.set_capacity(capacity);
   schema.add_attributes(a1);
 
   if (allows_dups) {
@@ -253,6 +258,34 @@ void DeletesFx::consolidate_commits_sparse(bool vacuum) {
   }
 }
 
+void DeletesFx::consolidate_delete_vectors_sparse(bool vacuum) {
+  auto config = ctx_.config();
+  config["sm.consolidation.mode"] = "delete_vectors";
+  Array::consolidate(ctx_, SPARSE_ARRAY_NAME, &config);
+
+  if (vacuum) {
+    config["sm.vacuum.mode"] = "delete_vectors";
+    REQUIRE_NOTHROW(Array::vacuum(ctx_, SPARSE_ARRAY_NAME, &config));
+  }
+}
+
+uint64_t DeletesFx::delete_vector_num() {
+  uint64_t num = 0;
+  auto commits_dir = std::string(SPARSE_ARRAY_NAME) + "/" +
+                     sm::constants::array_commits_dir_name;
+  for (auto& uri : vfs_.ls(commits_dir)) {
+    if (uri.size() >= sm::constants::delete_vector_file_suffix.size() &&
+        uri.compare(
+            uri.size() - sm::constants::delete_vector_file_suffix.size(),
+            std::string::npos,
+            sm::constants::delete_vector_file_suffix) == 0) {
+      num++;
+    }
+  }
+
+  return num;
+}
+
 void DeletesFx::write_delete_condition(
     QueryCondition& qc, uint64_t timestamp, bool encrypt, bool error_expected) {
   // Open array.
@@ -921,4 +954,199 @@ TEST_CASE_METHOD(
       c_dim2_3.data(), dim2_3.data(), c_dim2_3.size() * sizeof(uint64_t)));
 
   remove_sparse_array();
-}
\ No newline at end of file
+}
+TEST_CASE_METHOD(
+    DeletesFx,
+    "CPP API: Test deletes, delete vectors",
+    "[cppapi][deletes][delete-vectors]") {
+  remove_sparse_array();
+
+  bool allows_dups = GENERATE(true, false);
+  tiledb_layout_t read_layout = GENERATE(TILEDB_UNORDERED, TILEDB_GLOBAL_ORDER);
+
+  create_sparse_array(allows_dups);
+  const uint64_t now = std::numeric_limits<uint64_t>::max();
+  const std::string vectors_used =
+      "\"Context.StorageManager.Query.Reader.delete_vectors_num\": ";
+
+  // Write fragment.
+  write_sparse({0, 1, 2, 3}, {1, 1, 1, 2}, {1, 2, 4, 3}, 1);
+
+  // Define query condition (a1 < 2).
+  QueryCondition qc(ctx_);
+  int32_t val = 2;
+  qc.init("a1", &val, sizeof(int32_t), TILEDB_LT);
+
+  // Write condition.
+  write_delete_condition(qc, 3);
+
+  // Write another fragment that will not be affected by the condition.
+  write_sparse({1}, {4}, {4}, 5);
+
+  // Read by evaluating the delete condition.
+  std::string stats;
+  std::vector<int> a1_cond(3);
+  std::vector<uint64_t> dim1_cond(3);
+  std::vector<uint64_t> dim2_cond(3);
+  read_sparse(a1_cond, dim1_cond, dim2_cond, stats, read_layout, now);
+  CHECK(stats.find(vectors_used) == std::string::npos);
+
+  std::vector<int> c_a1 = {2, 3, 1};
+  std::vector<uint64_t> c_dim1 = {1, 2, 4};
+  std::vector<uint64_t> c_dim2 = {4, 3, 4};
+  CHECK(a1_cond == c_a1);
+  CHECK(dim1_cond == c_dim1);
+  CHECK(dim2_cond == c_dim2);
+
+  // Materialize the delete vectors. Only the first fragment is affected by
+  // the condition.
+  consolidate_delete_vectors_sparse(false);
+  CHECK(delete_vector_num() == 1);
+
+  // Consolidating again does not rewrite the up to date delete vector.
+  consolidate_delete_vectors_sparse(false);
+  CHECK(delete_vector_num() == 1);
+
+  // Read using the delete vector, the results match condition evaluation.
+  std::vector<int> a1(3);
+  std::vector<uint64_t> dim1(3);
+  std::vector<uint64_t> dim2(3);
+  read_sparse(a1, dim1, dim2, stats, read_layout, now);
+  CHECK(stats.find(vectors_used + "1") != std::string::npos);
+  CHECK(a1 == a1_cond);
+  CHECK(dim1 == dim1_cond);
+  CHECK(dim2 == dim2_cond);
+
+  // The delete vector was written after the condition, at the current time.
+  // Time travelling before it ignores the vector and evaluates the condition.
+  std::vector<int> a1_2(2);
+  std::vector<uint64_t> dim1_2(2);
+  std::vector<uint64_t> dim2_2(2);
+  read_sparse(a1_2, dim1_2, dim2_2, stats, read_layout, 4);
+  CHECK(stats.find(vectors_used) == std::string::npos);
+
+  std::vector<int> c_a1_2 = {2, 3};
+  std::vector<uint64_t> c_dim1_2 = {1, 2};
+  std::vector<uint64_t> c_dim2_2 = {4, 3};
+  CHECK(a1_2 == c_a1_2);
+  CHECK(dim1_2 == c_dim1_2);
+  CHECK(dim2_2 == c_dim2_2);
+
+  // Reading before the delete condition timestamp returns all cells.
+  std::vector<int> a1_3(4);
+  std::vector<uint64_t> dim1_3(4);
+  std::vector<uint64_t> dim2_3(4);
+  read_sparse(a1_3, dim1_3, dim2_3, stats, read_layout, 2);
+  CHECK(stats.find(vectors_used) == std::string::npos);
+
+  std::vector<int> c_a1_3 = {0, 1, 2, 3};
+  std::vector<uint64_t> c_dim1_3 = {1, 1, 1, 2};
+  std::vector<uint64_t> c_dim2_3 = {1, 2, 4, 3};
+  CHECK(a1_3 == c_a1_3);
+  CHECK(dim1_3 == c_dim1_3);
+  CHECK(dim2_3 == c_dim2_3);
+
+  // Define query condition (a1 > 2), affecting both fragments.
+  QueryCondition qc2(ctx_);
+  int32_t val2 = 2;
+  qc2.init("a1", &val2, sizeof(int32_t), TILEDB_GT);
+  write_delete_condition(qc2, 7);
+
+  // The vector of the first fragment is superseded by a new one, the second
+  // fragment gets its first vector. Vacuuming removes the superseded one.
+  consolidate_delete_vectors_sparse(false);
+  CHECK(delete_vector_num() == 3);
+  consolidate_delete_vectors_sparse(true);
+  CHECK(delete_vector_num() == 2);
+
+  // Read using both delete vectors.
+  std::vector<int> a1_4(2);
+  std::vector<uint64_t> dim1_4(2);
+  std::vector<uint64_t> dim2_4(2);
+  read_sparse(a1_4, dim1_4, dim2_4, stats, read_layout, now);
+  CHECK(stats.find(vectors_used + "2") != std::string::npos);
+
+  std::vector<int> c_a1_4 = {2, 1};
+  std::vector<uint64_t> c_dim1_4 = {1, 4};
+  std::vector<uint64_t> c_dim2_4 = {4, 4};
+  CHECK(a1_4 == c_a1_4);
+  CHECK(dim1_4 == c_dim1_4);
+  CHECK(dim2_4 == c_dim2_4);
+
+  // Time travelling between the two conditions only evaluates the first one.
+  std::vector<int> a1_5(3);
+  std::vector<uint64_t> dim1_5(3);
+  std::vector<uint64_t> dim2_5(3);
+  read_sparse(a1_5, dim1_5, dim2_5, stats, read_layout, 6);
+  CHECK(stats.find(vectors_used) == std::string::npos);
+  CHECK(a1_5 == c_a1);
+  CHECK(dim1_5 == c_dim1);
+  CHECK(dim2_5 == c_dim2);
+
+  remove_sparse_array();
+}
+
+TEST_CASE_METHOD(
+    DeletesFx,
+    "CPP API: Test deletes, skipping tiles with tile min/max",
+    "[cppapi][deletes][read][min-max]") {
+  remove_sparse_array();
+
+  bool allows_dups = GENERATE(true, false);
+  tiledb_layout_t read_layout = GENERATE(TILEDB_UNORDERED, TILEDB_GLOBAL_ORDER);
+
+  // Two cells per tile.
+  create_sparse_array(allows_dups, false, 2);
+
+  // Write fragment, the tiles hold a1 values {0, 1} and {2, 3}.
+  write_sparse({0, 1, 2, 3}, {1, 1, 1, 2}, {1, 2, 4, 3}, 1);
+
+  // Define query condition (a1 < 2), it can only delete cells in the first
+  // tile.
+  QueryCondition qc(ctx_);
+  int32_t val = 2;
+  qc.init("a1", &val, sizeof(int32_t), TILEDB_LT);
+  write_delete_condition(qc, 3);
+
+  // The condition is not evaluated on the second tile, and the results are
+  // the same as evaluating it on every tile.
+  std::string stats;
+  std::vector<int> a1(2);
+  std::vector<uint64_t> dim1(2);
+  std::vector<uint64_t> dim2(2);
+  read_sparse(a1, dim1, dim2, stats, read_layout, 4);
+  CHECK(
+      stats.find("\"Context.StorageManager.Query.Reader.delete_condition_"
+                 "skipped_tile_num\": 1") != std::string::npos);
+
+  std::vector<int> c_a1 = {2, 3};
+  std::vector<uint64_t> c_dim1 = {1, 2};
+  std::vector<uint64_t> c_dim2 = {4, 3};
+  CHECK(a1 == c_a1);
+  CHECK(dim1 == c_dim1);
+  CHECK(dim2 == c_dim2);
+
+  // Define query condition (a1 > 2), it can only delete cells in the second
+  // tile.
+  QueryCondition qc2(ctx_);
+  int32_t val2 = 2;
+  qc2.init("a1", &val2, sizeof(int32_t), TILEDB_GT);
+  write_delete_condition(qc2, 5);
+
+  std::vector<int> a1_2(1);
+  std::vector<uint64_t> dim1_2(1);
+  std::vector<uint64_t> dim2_2(1);
+  read_sparse(a1_2, dim1_2, dim2_2, stats, read_layout, 6);
+  CHECK(
+      stats.find("\"Context.StorageManager.Query.Reader.delete_condition_"
+                 "skipped_tile_num\": 2") != std::string::npos);
+
+  std::vector<int> c_a1_2 = {2};
+  std::vector<uint64_t> c_dim1_2 = {1};
+  std::vector<uint64_t> c_dim2_2 = {4};
+  CHECK(a1_2 == c_a1_2);
+  CHECK(dim1_2 == c_dim1_2);
+  CHECK(dim2_2 == c_dim2_2);
+
+  remove_sparse_array();
+}
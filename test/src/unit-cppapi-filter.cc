@@ -477,3 +477,86 @@ TEST_CASE(
   if (vfs.is_dir(array_name))
     vfs.remove_dir(array_name);
 }
+
+TEST_CASE(
+    "C++ API: Filter chunks partially unfiltered, sparse array",
+    "[cppapi][filter][chunks][sparse]") {
+  using namespace tiledb;
+  Context ctx;
+  VFS vfs(ctx);
+  std::string array_name = "cpp_unit_array";
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+
+  // Small chunks of four cells, so that a read touches only a few of them.
+  FilterList filters(ctx);
+  filters.add_filter({ctx, TILEDB_FILTER_ZSTD});
+  filters.set_max_chunk_size(16);
+
+  auto a = Attribute::create<int32_t>(ctx, "a");
+  a.set_filter_list(filters);
+  auto b = Attribute::create<int32_t>(ctx, "b");
+  b.set_filter_list(filters);
+
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int64_t>(ctx, "d", {{1, 100}}, 100));
+
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain);
+  schema.set_capacity(100);
+  schema.add_attribute(a);
+  schema.add_attribute(b);
+  schema.set_allows_dups(GENERATE(true, false));
+  Array::create(array_name, schema);
+
+  // Write one tile.
+  std::vector<int64_t> d_data(100);
+  std::vector<int32_t> a_data(100), b_data(100);
+  for (int32_t i = 0; i < 100; i++) {
+    d_data[i] = i + 1;
+    a_data[i] = i + 1;
+    b_data[i] = 2 * (i + 1);
+  }
+
+  Array array_w(ctx, array_name, TILEDB_WRITE);
+  Query query_w(ctx, array_w, TILEDB_WRITE);
+  query_w.set_layout(TILEDB_GLOBAL_ORDER)
+      .set_data_buffer("d", d_data)
+      .set_data_buffer("a", a_data)
+      .set_data_buffer("b", b_data);
+  CHECK_NOTHROW(query_w.submit());
+  query_w.finalize();
+  array_w.close();
+
+  // Read cells 41 to 50, filtered down to 45 to 50 by a query condition.
+  auto layout = GENERATE(TILEDB_UNORDERED, TILEDB_GLOBAL_ORDER);
+  Array array(ctx, array_name, TILEDB_READ);
+  Subarray subarray(ctx, array);
+  subarray.add_range<int64_t>(0, 41, 50);
+  std::vector<int64_t> d_read(10);
+  std::vector<int32_t> a_read(10), b_read(10);
+  Query query(ctx, array, TILEDB_READ);
+  query.set_layout(layout)
+      .set_subarray(subarray)
+      .set_condition(QueryCondition::create<int32_t>(ctx, "a", 45, TILEDB_GE))
+      .set_data_buffer("d", d_read)
+      .set_data_buffer("a", a_read)
+      .set_data_buffer("b", b_read);
+  CHECK_NOTHROW(query.submit());
+  CHECK(query.query_status() == Query::Status::COMPLETE);
+
+  auto result_num = query.result_buffer_elements()["a"].second;
+  REQUIRE(result_num == 6);
+  for (uint64_t i = 0; i < result_num; i++) {
+    CHECK(d_read[i] == (int64_t)(45 + i));
+    CHECK(a_read[i] == (int32_t)(45 + i));
+    CHECK(b_read[i] == (int32_t)(2 * (45 + i)));
+  }
+
+  array.close();
+
+  // Clean up
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
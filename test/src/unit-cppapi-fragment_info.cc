@@ -227,7 +227,7 @@ TEST_CASE(
 
     // Get fragment size
     auto size = fragment_info.fragment_size(1);
-    CHECK(size == 3193);
+    CHECK(size == 3194);
 
     // Get dense / sparse
     auto dense = fragment_info.dense(0);
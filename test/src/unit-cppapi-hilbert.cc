@@ -2316,3 +2316,98 @@ TEST_CASE(
   if (vfs.is_dir(array_name))
     CHECK_NOTHROW(vfs.remove_dir(array_name));
 }
+
+TEST_CASE(
+    "C++ API: Test Hilbert, persisted Hilbert values",
+    "[cppapi][hilbert][read][persist]") {
+  Context ctx;
+  VFS vfs(ctx);
+  std::string array_name = "hilbert_array";
+
+  // Remove array
+  if (vfs.is_dir(array_name))
+    CHECK_NOTHROW(vfs.remove_dir(array_name));
+
+  // Create array
+  create_int32_array(array_name);
+
+  // Write a first fragment with persisted Hilbert values.
+  Config config;
+  config["sm.persist_hilbert_values"] = "true";
+  Context ctx_persist(config);
+  std::vector<int32_t> buff_d1 = {1, 1, 4, 5};
+  std::vector<int32_t> buff_d2 = {1, 3, 2, 4};
+  std::vector<int32_t> buff_a = {3, 2, 1, 4};
+  Array array_w(ctx_persist, array_name, TILEDB_WRITE);
+  Query query_w(ctx_persist, array_w, TILEDB_WRITE);
+  query_w.set_data_buffer("a", buff_a);
+  query_w.set_data_buffer("d1", buff_d1);
+  query_w.set_data_buffer("d2", buff_d2);
+  query_w.set_layout(TILEDB_UNORDERED);
+  CHECK_NOTHROW(query_w.submit());
+  array_w.close();
+
+  // Write a second fragment without Hilbert values.
+  std::vector<int32_t> buff_d1_2 = {2, 50};
+  std::vector<int32_t> buff_d2_2 = {2, 100};
+  std::vector<int32_t> buff_a_2 = {5, 6};
+  write_2d_array<int32_t, int32_t>(
+      array_name, buff_d1_2, buff_d2_2, buff_a_2, TILEDB_UNORDERED);
+
+  // Only the first fragment stores the Hilbert values.
+  FragmentInfo fragment_info(ctx, array_name);
+  fragment_info.load();
+  REQUIRE(fragment_info.fragment_num() == 2);
+  CHECK(vfs.is_file(fragment_info.fragment_uri(0) + "/hv.tdb"));
+  CHECK(!vfs.is_file(fragment_info.fragment_uri(1) + "/hv.tdb"));
+
+  // Read in global order, merging both fragments.
+  Array array_r(ctx, array_name, TILEDB_READ);
+  Query query_r(ctx, array_r, TILEDB_READ);
+  std::vector<int32_t> r_buff_a(6);
+  std::vector<int32_t> r_buff_d1(6);
+  std::vector<int32_t> r_buff_d2(6);
+  query_r.set_data_buffer("a", r_buff_a);
+  query_r.set_data_buffer("d1", r_buff_d1);
+  query_r.set_data_buffer("d2", r_buff_d2);
+  query_r.set_layout(TILEDB_GLOBAL_ORDER);
+  CHECK_NOTHROW(query_r.submit());
+  CHECK(query_r.query_status() == Query::Status::COMPLETE);
+  CHECK(query_r.result_buffer_elements()["a"].second == 6);
+  array_r.close();
+
+  // The cells must come back in the same order as when the Hilbert values
+  // are computed at read time.
+  std::vector<int32_t> buff_d1_all = {1, 1, 4, 5, 2, 50};
+  std::vector<int32_t> buff_d2_all = {1, 3, 2, 4, 2, 100};
+  std::vector<int32_t> buff_a_all = {3, 2, 1, 4, 5, 6};
+  std::string array_name_c = "hilbert_array_computed";
+  if (vfs.is_dir(array_name_c))
+    CHECK_NOTHROW(vfs.remove_dir(array_name_c));
+  create_int32_array(array_name_c);
+  write_2d_array<int32_t, int32_t>(
+      array_name_c, buff_d1_all, buff_d2_all, buff_a_all, TILEDB_UNORDERED);
+
+  Array array_e(ctx, array_name_c, TILEDB_READ);
+  Query query_e(ctx, array_e, TILEDB_READ);
+  std::vector<int32_t> e_buff_a(6);
+  std::vector<int32_t> e_buff_d1(6);
+  std::vector<int32_t> e_buff_d2(6);
+  query_e.set_data_buffer("a", e_buff_a);
+  query_e.set_data_buffer("d1", e_buff_d1);
+  query_e.set_data_buffer("d2", e_buff_d2);
+  query_e.set_layout(TILEDB_GLOBAL_ORDER);
+  CHECK_NOTHROW(query_e.submit());
+  CHECK(query_e.query_status() == Query::Status::COMPLETE);
+  array_e.close();
+
+  CHECK(r_buff_a == e_buff_a);
+  CHECK(r_buff_d1 == e_buff_d1);
+  CHECK(r_buff_d2 == e_buff_d2);
+
+  // Remove arrays
+  if (vfs.is_dir(array_name))
+    CHECK_NOTHROW(vfs.remove_dir(array_name));
+  if (vfs.is_dir(array_name_c))
+    CHECK_NOTHROW(vfs.remove_dir(array_name_c));
+}
@@ -344,3 +344,97 @@ TEST_CASE(
   if (vfs.is_dir(array_name))
     vfs.remove_dir(array_name);
 }
+
+TEST_CASE(
+    "C++ API: Read with paged tile offsets",
+    "[cppapi][query][paged-tile-offsets]") {
+  const std::string array_name = "paged_tile_offsets_array";
+  Context ctx;
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+
+  // One tile per cell, so that the tile offsets and sizes span several pages
+  const int64_t cell_num = 20000;
+  Domain domain(ctx);
+  domain.add_dimension(
+      Dimension::create<int64_t>(ctx, "d", {{1, cell_num}}, cell_num));
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain).set_capacity(1);
+  schema.add_attribute(Attribute::create<int32_t>(ctx, "a"));
+  auto b = Attribute::create<std::string>(ctx, "b");
+  b.set_nullable(true);
+  schema.add_attribute(b);
+  Array::create(array_name, schema);
+
+  // Write
+  std::vector<int64_t> d_w(cell_num);
+  std::vector<int32_t> a_w(cell_num);
+  std::string b_w;
+  std::vector<uint64_t> b_w_offsets(cell_num);
+  std::vector<uint8_t> b_w_validity(cell_num);
+  for (int64_t i = 0; i < cell_num; ++i) {
+    d_w[i] = i + 1;
+    a_w[i] = static_cast<int32_t>(i);
+    b_w_offsets[i] = b_w.size();
+    b_w += std::to_string(i);
+    b_w_validity[i] = i % 3 != 0;
+  }
+  Array array_w(ctx, array_name, TILEDB_WRITE);
+  Query query_w(ctx, array_w, TILEDB_WRITE);
+  query_w.set_layout(TILEDB_GLOBAL_ORDER)
+      .set_data_buffer("d", d_w)
+      .set_data_buffer("a", a_w)
+      .set_data_buffer("b", b_w)
+      .set_offsets_buffer("b", b_w_offsets)
+      .set_validity_buffer("b", b_w_validity);
+  query_w.submit();
+  query_w.finalize();
+  array_w.close();
+
+  // Read ranges on the first and last pages
+  std::vector<std::array<int64_t, 2>> ranges = {{1, 10}, {19990, 20000}};
+  for (const auto& range : ranges) {
+    Array array_r(ctx, array_name, TILEDB_READ);
+    Subarray subarray(ctx, array_r);
+    subarray.add_range<int64_t>(0, range[0], range[1]);
+    std::vector<int64_t> d_r(16);
+    std::vector<int32_t> a_r(16);
+    std::string b_r(128, '\0');
+    std::vector<uint64_t> b_r_offsets(16);
+    std::vector<uint8_t> b_r_validity(16);
+    Query query_r(ctx, array_r, TILEDB_READ);
+    query_r.set_layout(TILEDB_GLOBAL_ORDER)
+        .set_subarray(subarray)
+        .set_data_buffer("d", d_r)
+        .set_data_buffer("a", a_r)
+        .set_data_buffer("b", b_r)
+        .set_offsets_buffer("b", b_r_offsets)
+        .set_validity_buffer("b", b_r_validity);
+    query_r.submit();
+    CHECK(query_r.query_status() == Query::Status::COMPLETE);
+
+    auto result_num = static_cast<uint64_t>(range[1] - range[0] + 1);
+    auto result_elements = query_r.result_buffer_elements_nullable();
+    CHECK(std::get<1>(result_elements["d"]) == result_num);
+    CHECK(std::get<0>(result_elements["b"]) == result_num);
+    auto b_r_size = std::get<1>(result_elements["b"]);
+    for (uint64_t i = 0; i < result_num; ++i) {
+      auto cell = range[0] - 1 + static_cast<int64_t>(i);
+      CHECK(d_r[i] == cell + 1);
+      CHECK(a_r[i] == cell);
+      CHECK(b_r_validity[i] == (cell % 3 != 0));
+      if (b_r_validity[i]) {
+        auto end = (i == result_num - 1) ? b_r_size : b_r_offsets[i + 1];
+        CHECK(
+            b_r.substr(b_r_offsets[i], end - b_r_offsets[i]) ==
+            std::to_string(cell));
+      }
+    }
+    array_r.close();
+  }
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
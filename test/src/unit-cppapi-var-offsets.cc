@@ -34,6 +34,7 @@
 #include <test/support/tdb_catch.h>
 #include "test/src/helpers.h"
 #include "tiledb/sm/cpp_api/tiledb"
+#include "tiledb/sm/cpp_api/tiledb_experimental"
 
 using namespace tiledb;
 
@@ -1783,4 +1784,171 @@ TEST_CASE(
   VFS vfs(ctx);
   if (vfs.is_dir(array_name))
     vfs.remove_dir(array_name);
-}
\ No newline at end of file
+}
+void check_views(
+    Context& ctx,
+    Query& query,
+    const std::vector<uint64_t>& attr_views,
+    const std::vector<std::vector<int32_t>>& expected_cells) {
+  auto result_el = query.result_buffer_elements()["attr"];
+  CHECK(result_el.first == expected_cells.size() * 2);
+  CHECK(result_el.second == 0);
+
+  // Views longer than 12 bytes point into the view buffers.
+  auto buffers = QueryExperimental::get_view_buffers(ctx, query, "attr");
+  for (uint64_t i = 0; i < expected_cells.size(); i++) {
+    int32_t view[4];
+    std::memcpy(view, &attr_views[2 * i], sizeof(view));
+    const auto size = (uint64_t)view[0];
+    REQUIRE(size == expected_cells[i].size() * sizeof(int32_t));
+
+    std::vector<int32_t> cell(expected_cells[i].size());
+    if (size <= 12) {
+      std::memcpy(cell.data(), &view[1], size);
+    } else {
+      CHECK(view[1] == expected_cells[i][0]);
+      REQUIRE((uint64_t)view[2] < buffers.size());
+      const auto& buffer = buffers[view[2]];
+      REQUIRE((uint64_t)view[3] + size <= buffer.second);
+      std::memcpy(cell.data(), (const uint8_t*)buffer.first + view[3], size);
+    }
+    CHECK(cell == expected_cells[i]);
+  }
+}
+
+TEST_CASE(
+    "C++ API: Test views offsets: dense array",
+    "[var-offsets][views][dense]") {
+  std::string array_name = "test_views_offset";
+  create_dense_array(array_name);
+
+  // Cells 1 and 3 do not fit in their views.
+  Context ctx;
+  std::vector<int32_t> data = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+  std::vector<uint64_t> data_offsets = {0, 4, 24, 32};
+  write_dense_array(ctx, array_name, data, data_offsets, TILEDB_ROW_MAJOR);
+
+  Config config;
+  config["sm.var_offsets.mode"] = "views";
+
+  SECTION("Full read") {
+    Context ctx_views(config);
+    Array array(ctx_views, array_name, TILEDB_READ);
+    Query query(ctx_views, array, TILEDB_READ);
+
+    // Each view takes two 64-bit offsets.
+    std::vector<int32_t> attr_val(data.size());
+    std::vector<uint64_t> attr_views(4 * 2);
+    query.set_subarray<int64_t>({1, 2, 1, 2});
+    query.set_layout(TILEDB_ROW_MAJOR);
+    query.set_data_buffer("attr", attr_val);
+    query.set_offsets_buffer("attr", attr_views);
+    CHECK_NOTHROW(query.submit());
+    CHECK(query.query_status() == Query::Status::COMPLETE);
+
+    // No data is copied to the var buffer.
+    check_views(
+        ctx_views,
+        query,
+        attr_views,
+        {{1}, {2, 3, 4, 5, 6}, {7, 8}, {9, 10, 11, 12}});
+
+    array.close();
+  }
+
+  SECTION("Extra element") {
+    config["sm.var_offsets.extra_element"] = "true";
+    Context ctx_views(config);
+    Array array(ctx_views, array_name, TILEDB_READ);
+    Query query(ctx_views, array, TILEDB_READ);
+
+    std::vector<int32_t> attr_val(data.size());
+    std::vector<uint64_t> attr_views(4 * 2);
+    query.set_subarray<int64_t>({1, 2, 1, 2});
+    query.set_layout(TILEDB_ROW_MAJOR);
+    query.set_data_buffer("attr", attr_val);
+    query.set_offsets_buffer("attr", attr_views);
+    CHECK_THROWS(query.submit());
+
+    array.close();
+  }
+
+  VFS vfs(ctx);
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
+
+TEST_CASE(
+    "C++ API: Test views offsets: sparse array",
+    "[var-offsets][views][sparse]") {
+  std::string array_name = "test_views_offset";
+  create_sparse_array(array_name);
+
+  // Cells 1 and 3 do not fit in their views.
+  Context ctx;
+  std::vector<int32_t> data = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+  std::vector<uint64_t> data_offsets = {0, 4, 20, 28};
+  write_sparse_array(ctx, array_name, data, data_offsets, TILEDB_UNORDERED);
+
+  auto layout = GENERATE(TILEDB_UNORDERED, TILEDB_GLOBAL_ORDER);
+  Config config;
+  config["sm.var_offsets.mode"] = "views";
+  Context ctx_views(config);
+  Array array(ctx_views, array_name, TILEDB_READ);
+  Query query(ctx_views, array, TILEDB_READ);
+  query.set_layout(layout);
+
+  std::vector<int32_t> attr_val(data.size());
+  std::vector<int64_t> d1(4);
+
+  SECTION("Full read") {
+    std::vector<uint64_t> attr_views(4 * 2);
+    query.set_data_buffer("d1", d1);
+    query.set_data_buffer("attr", attr_val);
+    query.set_offsets_buffer("attr", attr_views);
+    CHECK_NOTHROW(query.submit());
+    CHECK(query.query_status() == Query::Status::COMPLETE);
+
+    check_views(
+        ctx_views,
+        query,
+        attr_views,
+        {{1}, {2, 3, 4, 5}, {6, 7}, {8, 9, 10, 11}});
+  }
+
+  SECTION("Incomplete read") {
+    // The views of each submit point into the tiles kept for it.
+    std::vector<uint64_t> attr_views(2 * 2);
+    query.set_data_buffer("d1", d1);
+    query.set_data_buffer("attr", attr_val);
+    query.set_offsets_buffer("attr", attr_views);
+    CHECK_NOTHROW(query.submit());
+    CHECK(query.query_status() == Query::Status::INCOMPLETE);
+    check_views(ctx_views, query, attr_views, {{1}, {2, 3, 4, 5}});
+
+    CHECK_NOTHROW(query.submit());
+    CHECK(query.query_status() == Query::Status::COMPLETE);
+    check_views(ctx_views, query, attr_views, {{6, 7}, {8, 9, 10, 11}});
+  }
+
+  SECTION("Extra element") {
+    Config config_extra = config;
+    config_extra["sm.var_offsets.extra_element"] = "true";
+    Context ctx_extra(config_extra);
+    Array array_extra(ctx_extra, array_name, TILEDB_READ);
+    Query query_extra(ctx_extra, array_extra, TILEDB_READ);
+    query_extra.set_layout(layout);
+
+    std::vector<uint64_t> attr_views(4 * 2);
+    query_extra.set_data_buffer("attr", attr_val);
+    query_extra.set_offsets_buffer("attr", attr_views);
+    CHECK_THROWS(query_extra.submit());
+    array_extra.close();
+  }
+
+  array.close();
+
+  VFS vfs(ctx);
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
@@ -31,6 +31,7 @@
  */
 
 #include <test/support/tdb_catch.h>
+#include "tiledb/common/logger.h"
 #include "tiledb/sm/rest/curl.h"
 
 #ifdef _WIN32
@@ -90,3 +91,59 @@ TEST_CASE("CURL: Test curl's header parsing callback", "[curl]") {
       userdata.redirect_uri_map->find(ns_array)->second ==
       "tiledb://my_username");
 }
+
+TEST_CASE("CURL: Test curl handle pool", "[curl]") {
+  CurlHandlePool pool(2);
+  CHECK(pool.idle_handle_num() == 0);
+
+  // Released handles are handed out again before new handles are created
+  CURL* curl1 = pool.acquire();
+  CURL* curl2 = pool.acquire();
+  REQUIRE(curl1 != nullptr);
+  REQUIRE(curl2 != nullptr);
+  CHECK(curl1 != curl2);
+  pool.release(curl1);
+  CHECK(pool.idle_handle_num() == 1);
+  CHECK(pool.acquire() == curl1);
+  CHECK(pool.idle_handle_num() == 0);
+
+  // Handles released when the pool is full are cleaned up
+  CURL* curl3 = pool.acquire();
+  REQUIRE(curl3 != nullptr);
+  pool.release(curl1);
+  pool.release(curl2);
+  pool.release(curl3);
+  CHECK(pool.idle_handle_num() == 2);
+
+  // A pool of size zero keeps no handles
+  CurlHandlePool empty_pool(0);
+  CURL* curl4 = empty_pool.acquire();
+  REQUIRE(curl4 != nullptr);
+  empty_pool.release(curl4);
+  CHECK(empty_pool.idle_handle_num() == 0);
+}
+
+TEST_CASE(
+    "CURL: Test curl instances return their handle to the pool", "[curl]") {
+  Config config;
+  std::unordered_map<std::string, std::string> extra_headers;
+  std::unordered_map<std::string, std::string> redirect_meta;
+  std::mutex redirect_mtx;
+  CurlHandlePool pool(1);
+
+  {
+    Curl curl(global_logger().clone("curl", 0), &pool);
+    REQUIRE(curl.init(&config, extra_headers, &redirect_meta, &redirect_mtx)
+                .ok());
+    CHECK(pool.idle_handle_num() == 0);
+  }
+  CHECK(pool.idle_handle_num() == 1);
+
+  {
+    Curl curl(global_logger().clone("curl", 0), &pool);
+    REQUIRE(curl.init(&config, extra_headers, &redirect_meta, &redirect_mtx)
+                .ok());
+    CHECK(pool.idle_handle_num() == 0);
+  }
+  CHECK(pool.idle_handle_num() == 1);
+}
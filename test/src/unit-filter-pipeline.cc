@@ -45,6 +45,7 @@
 #include "tiledb/sm/enums/filter_option.h"
 #include "tiledb/sm/enums/filter_type.h"
 #include "tiledb/sm/filter/bit_width_reduction_filter.h"
+#include "tiledb/sm/filter/bitmap_filter.h"
 #include "tiledb/sm/filter/bitshuffle_filter.h"
 #include "tiledb/sm/filter/byteshuffle_filter.h"
 #include "tiledb/sm/filter/checksum_md5_filter.h"
@@ -3880,6 +3881,102 @@ TEST_CASE("Filter: Test byteshuffle var", "[filter][byteshuffle][var]") {
   Tile::set_max_tile_chunk_size(constants::max_tile_chunk_size);
 }
 
+TEST_CASE("Filter: Test bitmap", "[filter][bitmap]") {
+  tiledb::sm::Config config;
+
+  // Set up test data, with an uneven number of elements
+  const uint64_t nelts = 1001;
+  const uint64_t tile_size = nelts * sizeof(uint8_t);
+  const uint64_t cell_size = sizeof(uint8_t);
+  const uint32_t dim_num = 0;
+
+  Tile tile;
+  tile.init_unfiltered(
+      constants::format_version,
+      Datatype::UINT8,
+      tile_size,
+      cell_size,
+      dim_num);
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<uint32_t> dis(0, 1);
+  std::vector<uint8_t> values(nelts);
+  for (uint64_t i = 0; i < nelts; i++) {
+    values[i] = (uint8_t)dis(gen);
+    CHECK(tile.write(&values[i], i, sizeof(uint8_t)).ok());
+  }
+
+  FilterPipeline pipeline;
+  ThreadPool tp(4);
+  CHECK(pipeline.add_filter(BitmapFilter()).ok());
+
+  SECTION("- Single stage") {
+    CHECK(
+        pipeline.run_forward(&test::g_helper_stats, &tile, nullptr, &tp).ok());
+    CHECK(tile.size() == 0);
+    CHECK(tile.filtered_buffer().size() != 0);
+    CHECK(tile.filtered_buffer().size() < tile_size / 4);
+    CHECK(tile.alloc_data(tile_size).ok());
+    CHECK(
+        pipeline.run_reverse(&test::g_helper_stats, &tile, nullptr, &tp, config)
+            .ok());
+    CHECK(tile.filtered_buffer().size() == 0);
+    for (uint64_t i = 0; i < nelts; i++) {
+      uint8_t elt = 0;
+      CHECK(tile.read(&elt, i, sizeof(uint8_t)).ok());
+      CHECK(elt == values[i]);
+    }
+  }
+
+  SECTION("- Values other than 0 and 1") {
+    uint8_t value = 2;
+    CHECK(tile.write(&value, nelts - 1, sizeof(uint8_t)).ok());
+    CHECK(
+        !pipeline.run_forward(&test::g_helper_stats, &tile, nullptr, &tp).ok());
+  }
+
+  SECTION("- Unsupported type") {
+    Tile tile2;
+    tile2.init_unfiltered(
+        constants::format_version,
+        Datatype::UINT32,
+        sizeof(uint32_t),
+        sizeof(uint32_t),
+        dim_num);
+    uint32_t value = 1;
+    CHECK(tile2.write(&value, 0, sizeof(uint32_t)).ok());
+    CHECK(!pipeline.run_forward(&test::g_helper_stats, &tile2, nullptr, &tp)
+               .ok());
+  }
+
+  SECTION("- Pack and unpack") {
+    std::vector<uint8_t> wide_values(values);
+    for (uint64_t i = 0; i < nelts; i += 3)
+      wide_values[i] *= 2;
+    for (uint64_t size : {0, 1, 7, 8, 9, 64, 1001}) {
+      std::vector<uint8_t> bitmap((size + 7) / 8, 0xff);
+      std::vector<uint8_t> bytemap(size, 0xff);
+      CHECK(BitmapFilter::pack(values.data(), size, bitmap.data()));
+      for (uint64_t i = 0; i < size; i++)
+        CHECK(((bitmap[i / 8] >> (i % 8)) & 1) == values[i]);
+      BitmapFilter::unpack(bitmap.data(), size, bytemap.data());
+      for (uint64_t i = 0; i < size; i++)
+        CHECK(bytemap[i] == values[i]);
+
+      // Non-zero values other than 1 are packed as set bits, but reported.
+      const bool has_wide = std::any_of(
+          wide_values.begin(), wide_values.begin() + size, [](uint8_t v) {
+            return v > 1;
+          });
+      CHECK(
+          BitmapFilter::pack(wide_values.data(), size, bitmap.data()) ==
+          !has_wide);
+      for (uint64_t i = 0; i < size; i++)
+        CHECK(((bitmap[i / 8] >> (i % 8)) & 1) == (wide_values[i] != 0));
+    }
+  }
+}
+
 TEST_CASE("Filter: Test encryption", "[filter][encryption]") {
   tiledb::sm::Config config;
 
@@ -33,6 +33,7 @@
 #include "tiledb/sm/c_api/tiledb_struct_def.h"
 
 #include "test/src/helpers.h"
+#include "tiledb/sm/misc/comparators.h"
 #include "tiledb/sm/query/readers/result_coords.h"
 #include "tiledb/sm/query/readers/sparse_index_reader_base.h"
 
@@ -261,4 +262,46 @@ TEST_CASE_METHOD(
   REQUIRE(rc2.advance_to_next_cell() == true);
   REQUIRE(rc2.pos_ == 2);
   REQUIRE(rc2.advance_to_next_cell() == false);
-}
\ No newline at end of file
+}
+
+TEST_CASE_METHOD(
+    CResultCoordsFx,
+    "GlobalOrderResultCoords: typed global order comparator",
+    "[globalorderresultcoords][typed_global_cmp]") {
+  std::vector<int64_t> coords = {7, 2, 5, 10, 1, 6, 5};
+  GlobalOrderResultTile<uint8_t> tile(0, 0, false, false, *frag_md);
+  tile.init_attr_tile(constants::coords, false, false);
+  Tile* const t = &tile.tile_tuple(constants::coords)->fixed_tile();
+  REQUIRE(t->init_unfiltered(
+               constants::format_version,
+               Datatype::INT64,
+               coords.size() * sizeof(int64_t),
+               sizeof(int64_t),
+               1)
+              .ok());
+  REQUIRE(t->write(coords.data(), 0, coords.size() * sizeof(int64_t)).ok());
+
+  const auto& domain = array_->array_->array_schema_latest().domain();
+  GlobalCmp generic_cmp(domain);
+  TypedGlobalCmp<int64_t, 1, Layout::ROW_MAJOR, Layout::ROW_MAJOR> typed_cmp(
+      domain);
+  ReverseCmp<TypedGlobalCmp<int64_t, 1, Layout::ROW_MAJOR, Layout::ROW_MAJOR>>
+      typed_cmp_reverse(domain);
+  for (uint64_t i = 0; i < coords.size(); i++) {
+    for (uint64_t j = 0; j < coords.size(); j++) {
+      GlobalOrderResultCoords a(&tile, i);
+      GlobalOrderResultCoords b(&tile, j);
+      CHECK(typed_cmp(a, b) == generic_cmp(a, b));
+      CHECK(typed_cmp_reverse(a, b) == !generic_cmp(a, b));
+    }
+  }
+
+  // The domain has a single int64 dimension, so it must be specialized.
+  auto is_typed = with_global_cmp_reverse(domain, [](auto cmp) {
+    return std::is_same_v<
+        decltype(cmp),
+        ReverseCmp<
+            TypedGlobalCmp<int64_t, 1, Layout::ROW_MAJOR, Layout::ROW_MAJOR>>>;
+  });
+  CHECK(is_typed);
+}
@@ -29,6 +29,9 @@
  *
  * Tests for the ResultTile classes.
  */
+#include "tiledb/sm/array_schema/array_schema.h"
+#include "tiledb/sm/array_schema/dimension.h"
+#include "tiledb/sm/array_schema/domain.h"
 #include "tiledb/sm/c_api/tiledb.h"
 #include "tiledb/sm/c_api/tiledb_struct_def.h"
 #include "tiledb/sm/misc/types.h"
@@ -43,7 +46,9 @@
 #endif
 
 #include <test/support/tdb_catch.h>
+#include <algorithm>
 #include <numeric>
+#include <random>
 
 using namespace tiledb::sm;
 using namespace tiledb::test;
@@ -253,6 +258,7 @@ TEST_CASE_METHOD(
   std::iota(range_indexes.begin(), range_indexes.end(), 0);
 
   std::vector<uint8_t> result_count(num_cells, 1);
+  ResultTile::RangeIndexScratch scratch;
   ResultTile::compute_results_count_sparse_string(
       &rt,
       dim_idx,
@@ -261,7 +267,8 @@ TEST_CASE_METHOD(
       result_count,
       Layout::ROW_MAJOR,
       0,
-      num_cells);
+      num_cells,
+      scratch);
 
   CHECK(memcmp(result_count.data(), exp_result_count.data(), num_cells) == 0);
 }
@@ -373,6 +380,7 @@ TEST_CASE_METHOD(
   std::iota(range_indexes.begin(), range_indexes.end(), 0);
 
   std::vector<uint64_t> result_count(num_cells, 1);
+  ResultTile::RangeIndexScratch scratch;
   ResultTile::compute_results_count_sparse_string(
       &rt,
       dim_idx,
@@ -381,7 +389,112 @@ TEST_CASE_METHOD(
       result_count,
       Layout::ROW_MAJOR,
       0,
-      num_cells);
+      num_cells,
+      scratch);
 
   CHECK(memcmp(result_count.data(), exp_result_count.data(), num_cells) == 0);
-}
\ No newline at end of file
+}
+TEST_CASE(
+    "Test compute_results_count_sparse against a full range scan",
+    "[resulttile][compute_results_count_sparse]") {
+  const uint64_t num_cells = 1000;
+  const uint64_t max_coord = 500;
+
+  // Two dimensions, the first one is sorted for the row-major cell order.
+  ArraySchema array_schema;
+  Domain domain;
+  uint64_t bounds[2] = {0, max_coord};
+  Range range(bounds, 2 * sizeof(uint64_t));
+  for (auto name : {"d1", "d2"}) {
+    Dimension dim(name, Datatype::UINT64);
+    REQUIRE(dim.set_domain(range).ok());
+    REQUIRE(
+        domain.add_dimension(make_shared<Dimension>(HERE(), &dim)).ok());
+  }
+  REQUIRE(array_schema.set_domain(make_shared<Domain>(HERE(), &domain)).ok());
+
+  // Sorted coordinates for d1 with duplicates, random ones for d2.
+  std::mt19937_64 gen(0);
+  std::uniform_int_distribution<uint64_t> dis(0, max_coord);
+  std::vector<std::vector<uint64_t>> coords(2);
+  for (auto& dim_coords : coords) {
+    dim_coords.resize(num_cells);
+    for (auto& c : dim_coords) {
+      c = dis(gen);
+    }
+  }
+  std::sort(coords[0].begin(), coords[0].end());
+
+  ResultTile rt(0, 0, array_schema);
+  for (unsigned d = 0; d < 2; d++) {
+    rt.init_coord_tile(d == 0 ? "d1" : "d2", false, d);
+    Tile* const t = &rt.tile_tuple(d == 0 ? "d1" : "d2")->fixed_tile();
+    REQUIRE(t->init_unfiltered(
+                 constants::format_version,
+                 Datatype::UINT64,
+                 num_cells * sizeof(uint64_t),
+                 sizeof(uint64_t),
+                 0)
+                .ok());
+    REQUIRE(t->write(coords[d].data(), 0, num_cells * sizeof(uint64_t)).ok());
+  }
+
+  // Ranges sorted on their start, possibly overlapping.
+  const bool overlapping = GENERATE(true, false);
+  const uint64_t num_ranges = GENERATE(1, 10, 300);
+  NDRange ranges;
+  for (uint64_t r = 0; r < num_ranges; r++) {
+    uint64_t start = dis(gen);
+    uint64_t end = std::min(start + dis(gen) % 10, max_coord);
+    if (overlapping && r % 7 == 0) {
+      end = std::min(start + 200, max_coord);
+    }
+    uint64_t range_bounds[2] = {start, end};
+    ranges.emplace_back(range_bounds, 2 * sizeof(uint64_t));
+  }
+  std::sort(ranges.begin(), ranges.end(), [](const Range& a, const Range& b) {
+    auto a_start = ((const uint64_t*)a.start_fixed())[0];
+    auto b_start = ((const uint64_t*)b.start_fixed())[0];
+    auto a_end = ((const uint64_t*)a.start_fixed())[1];
+    auto b_end = ((const uint64_t*)b.start_fixed())[1];
+    return a_start < b_start || (a_start == b_start && a_end < b_end);
+  });
+
+  // Only use every other range.
+  std::vector<uint64_t> range_indexes;
+  for (uint64_t r = 0; r < num_ranges; r += 1 + (num_ranges > 1)) {
+    range_indexes.emplace_back(r);
+  }
+
+  // Process the cells in parts, as done for multiple range threads. Small
+  // parts have more ranges than cells squared, which binary searches the
+  // ranges on the sorted dimension instead of galloping over them.
+  const uint64_t part_size = GENERATE(4, 300, 1000);
+  ResultTile::RangeIndexScratch scratch;
+  for (unsigned d = 0; d < 2; d++) {
+    std::vector<uint64_t> exp_result_count(num_cells);
+    for (uint64_t pos = 0; pos < num_cells; pos++) {
+      for (auto r : range_indexes) {
+        auto range_bounds = (const uint64_t*)ranges[r].start_fixed();
+        exp_result_count[pos] += coords[d][pos] >= range_bounds[0] &&
+                                 coords[d][pos] <= range_bounds[1];
+      }
+    }
+
+    std::vector<uint64_t> result_count(num_cells, 1);
+    for (uint64_t min = 0; min < num_cells; min += part_size) {
+      ResultTile::compute_results_count_sparse<uint64_t, uint64_t>(
+          &rt,
+          d,
+          ranges,
+          range_indexes,
+          result_count,
+          Layout::ROW_MAJOR,
+          min,
+          std::min(min + part_size, num_cells),
+          scratch);
+    }
+
+    CHECK(result_count == exp_result_count);
+  }
+}
@@ -34,6 +34,7 @@
 #include "tiledb/sm/array_schema/dimension.h"
 #include "tiledb/sm/enums/datatype.h"
 #include "tiledb/sm/enums/layout.h"
+#include "tiledb/sm/misc/constants.h"
 #include "tiledb/sm/rtree/rtree.h"
 
 #include <test/support/tdb_catch.h>
@@ -379,6 +380,118 @@ TEST_CASE("RTree: Test 1D R-tree, height 3", "[rtree][1d][3h]") {
   CHECK(overlap.tiles_[0].second == 3.0 / 6);
 }
 
+TEST_CASE("RTree: Test 1D R-tree, multiple ranges", "[rtree][1d][batch]") {
+  // Build tree
+  std::vector<bool> is_default(1, false);
+  int32_t dim_dom[] = {1, 1000};
+  int32_t dim_extent = 10;
+  std::vector<NDRange> mbrs = create_mbrs<int32_t, 1>(
+      {1, 3, 5, 10, 20, 22, 30, 35, 36, 38, 40, 49, 50, 51, 65, 69});
+  Domain dom1 =
+      create_domain({"d"}, {Datatype::INT32}, {dim_dom}, {&dim_extent});
+  const Domain d1(&dom1);
+  RTree rtree(&d1, 3);
+  rtree.set_leaves(mbrs);
+  rtree.build_tree();
+  CHECK(rtree.height() == 3);
+
+  // The batched traversal matches the single range traversal
+  std::vector<std::vector<int32_t>> r_vals = {
+      {0, 0}, {1, 69}, {10, 20}, {30, 69}, {1, 32}, {21, 21}, {37, 50}};
+  std::vector<NDRange> ranges(r_vals.size(), NDRange(1));
+  for (uint64_t r = 0; r < r_vals.size(); ++r)
+    ranges[r][0].set_range(r_vals[r].data(), 2 * sizeof(int32_t));
+
+  auto overlaps = rtree.get_tile_overlap(ranges, is_default);
+  REQUIRE(overlaps.size() == ranges.size());
+  for (uint64_t r = 0; r < ranges.size(); ++r) {
+    auto overlap = rtree.get_tile_overlap(ranges[r], is_default);
+    CHECK(overlaps[r].tiles_ == overlap.tiles_);
+    CHECK(overlaps[r].tile_ranges_ == overlap.tile_ranges_);
+  }
+
+  CHECK(rtree.get_tile_overlap(std::vector<NDRange>(), is_default).empty());
+}
+
+TEST_CASE("RTree: Test 1D R-tree, paged leaves", "[rtree][1d][paged]") {
+  // Build tree
+  std::vector<bool> is_default(1, false);
+  int32_t dim_dom[] = {1, 1000};
+  int32_t dim_extent = 10;
+  std::vector<NDRange> mbrs = create_mbrs<int32_t, 1>(
+      {1, 3, 5, 10, 20, 22, 30, 35, 36, 38, 40, 49, 50, 51, 65, 69});
+  Domain dom1 =
+      create_domain({"d"}, {Datatype::INT32}, {dim_dom}, {&dim_extent});
+  const Domain d1(&dom1);
+  RTree rtree(&d1, 3);
+  rtree.set_leaves(mbrs);
+  rtree.build_tree();
+
+  // Serialize the leaves in pages of 3 leaves, indexed by page offset
+  uint64_t page_size = 3;
+  std::vector<std::vector<uint8_t>> pages;
+  std::vector<uint64_t> page_offsets;
+  for (uint64_t start = 0; start < rtree.leaf_num(); start += page_size) {
+    auto num = std::min(page_size, rtree.leaf_num() - start);
+    SizeComputationSerializer size_computation_serializer;
+    rtree.serialize_leaves(size_computation_serializer, start, num);
+    pages.emplace_back(size_computation_serializer.size());
+    Serializer serializer(pages.back().data(), pages.back().size());
+    rtree.serialize_leaves(serializer, start, num);
+    page_offsets.push_back(100 * pages.size());
+  }
+  CHECK(pages.size() == 3);
+
+  SizeComputationSerializer size_computation_serializer;
+  rtree.serialize_paged(size_computation_serializer, page_size, page_offsets);
+  std::vector<uint8_t> directory(size_computation_serializer.size());
+  Serializer serializer(directory.data(), directory.size());
+  rtree.serialize_paged(serializer, page_size, page_offsets);
+
+  // Deserialize, loading the leaf pages on demand
+  RTree paged(&d1, 3);
+  Deserializer deserializer(directory.data(), directory.size());
+  paged.deserialize(deserializer, &d1, constants::format_version);
+  CHECK(paged.paged());
+  CHECK(paged.height() == 3);
+  CHECK(paged.leaf_num() == 8);
+
+  std::vector<uint64_t> loaded;
+  paged.set_leaf_page_loader([&](uint64_t page_offset) {
+    loaded.push_back(page_offset);
+    auto& page = pages[page_offset / 100 - 1];
+    Deserializer page_deserializer(page.data(), page.size());
+    shared_ptr<const std::vector<NDRange>> leaves =
+        make_shared<std::vector<NDRange>>(
+            HERE(), RTree::deserialize_leaves(page_deserializer, &d1));
+    return leaves;
+  });
+
+  // Only the pages of the overlapping subtrees are loaded
+  NDRange range(1);
+  int32_t r_only_tiles[] = {10, 20};
+  range[0].set_range(r_only_tiles, 2 * sizeof(int32_t));
+  auto overlap = paged.get_tile_overlap(range, is_default);
+  CHECK(overlap.tile_ranges_.empty());
+  CHECK(overlap.tiles_.size() == 2);
+  CHECK(overlap.tiles_[0].first == 1);
+  CHECK(overlap.tiles_[0].second == 1.0 / 6);
+  CHECK(overlap.tiles_[1].first == 2);
+  CHECK(overlap.tiles_[1].second == 1.0 / 3);
+  CHECK(loaded == std::vector<uint64_t>{100});
+
+  // Leaves are served from the pages
+  for (uint64_t i = 0; i < mbrs.size(); ++i)
+    CHECK(paged.leaf(i) == rtree.leaf(i));
+
+  // Leaves read through a pinned page load each page once
+  loaded.clear();
+  RTree::PinnedLeafPage pinned;
+  for (uint64_t i = 0; i < paged.leaf_num(); ++i)
+    CHECK(paged.leaf(i, &pinned) == rtree.leaf(i));
+  CHECK(loaded == std::vector<uint64_t>{100, 200, 300});
+}
+
 TEST_CASE("RTree: Test 2D R-tree, height 2", "[rtree][2d][2h]") {
   // Build tree
   std::vector<bool> is_default(2, false);
@@ -507,6 +620,154 @@ TEST_CASE("RTree: Test 2D R-tree, height 3", "[rtree][2d][3h]") {
   CHECK(overlap.tiles_[0].second == 2.0 / 3);
 }
 
+TEST_CASE("RTree: Test 2D R-tree, multiple ranges", "[rtree][2d][batch]") {
+  std::vector<bool> is_default(2, false);
+  int32_t dim_dom[] = {1, 1000};
+  int32_t dim_extent = 10;
+  Domain dom2 = create_domain(
+      {"d1", "d2"},
+      {Datatype::INT32, Datatype::INT32},
+      {dim_dom, dim_dom},
+      {&dim_extent, &dim_extent});
+  const Domain d2{&dom2};
+
+  // 100 MBRs on a 10x10 grid, in row-major order
+  std::vector<int32_t> mbr_vals;
+  for (int32_t row = 0; row < 10; ++row) {
+    for (int32_t col = 0; col < 10; ++col) {
+      mbr_vals.insert(
+          mbr_vals.end(),
+          {row * 10 + 1, row * 10 + 8, col * 10 + 1, col * 10 + 8});
+    }
+  }
+  RTree rtree(&d2, 3);
+  rtree.set_leaves(create_mbrs<int32_t, 2>(mbr_vals));
+  rtree.build_tree();
+  CHECK(rtree.height() == 6);
+
+  // Disjoint ranges on `d2` sort their ends as well, overlapping ones do not
+  std::vector<int32_t> r_vals;
+  auto disjoint = GENERATE(true, false);
+  for (int32_t i = 0; i < 40; ++i) {
+    int32_t start = (i * 7) % 40 * 2 + 1;
+    int32_t end = disjoint ? start + 1 : start + (i % 5) * 9;
+    r_vals.insert(r_vals.end(), {(i * 13) % 90 + 1, (i * 13) % 90 + 9});
+    r_vals.insert(r_vals.end(), {start, end});
+  }
+  auto ranges = create_mbrs<int32_t, 2>(r_vals);
+  std::vector<const Range*> range_ptrs;
+  for (const auto& range : ranges)
+    range_ptrs.insert(range_ptrs.end(), {&range[0], &range[1]});
+
+  // The serial and parallel batched traversals match the single range
+  // traversal
+  ThreadPool tp(4);
+  uint64_t serial_node_num = 0, parallel_node_num = 0;
+  auto serial =
+      rtree.get_tile_overlap(range_ptrs, is_default, nullptr, &serial_node_num);
+  auto parallel =
+      rtree.get_tile_overlap(range_ptrs, is_default, &tp, &parallel_node_num);
+  REQUIRE(serial.size() == ranges.size());
+  REQUIRE(parallel.size() == ranges.size());
+  for (uint64_t r = 0; r < ranges.size(); ++r) {
+    auto overlap = rtree.get_tile_overlap(ranges[r], is_default);
+    CHECK(serial[r].tiles_ == overlap.tiles_);
+    CHECK(serial[r].tile_ranges_ == overlap.tile_ranges_);
+    CHECK(parallel[r].tiles_ == overlap.tiles_);
+    CHECK(parallel[r].tile_ranges_ == overlap.tile_ranges_);
+  }
+  CHECK(serial_node_num == parallel_node_num);
+}
+
+TEST_CASE("RTree: Test 2D R-tree, packed leaves", "[rtree][2d][packing]") {
+  std::vector<bool> is_default(2, false);
+  int32_t dim_dom[] = {1, 1000};
+  int32_t dim_extent = 10;
+  Domain dom2 = create_domain(
+      {"d1", "d2"},
+      {Datatype::INT32, Datatype::INT32},
+      {dim_dom, dim_dom},
+      {&dim_extent, &dim_extent});
+  const Domain d2{&dom2};
+
+  // 64 small MBRs on an 8x8 grid, scattered in tile order
+  std::vector<int32_t> mbr_vals;
+  for (int32_t i = 0; i < 64; ++i) {
+    int32_t p = (i * 37) % 64;
+    int32_t row = p / 8, col = p % 8;
+    mbr_vals.insert(
+        mbr_vals.end(),
+        {row * 10 + 1, row * 10 + 2, col * 10 + 1, col * 10 + 2});
+  }
+  std::vector<NDRange> mbrs = create_mbrs<int32_t, 2>(mbr_vals);
+
+  RTree sequential(&d2, 4);
+  sequential.set_leaves(mbrs);
+  sequential.build_tree();
+  CHECK(!sequential.packed());
+
+  auto packing = GENERATE(RTree::Packing::STR, RTree::Packing::HILBERT);
+  RTree packed(&d2, 4);
+  packed.set_leaves(mbrs);
+  packed.build_tree(packing);
+  CHECK(packed.packed());
+  CHECK(packed.height() == sequential.height());
+
+  // Leaves are still addressed by tile id
+  for (uint64_t i = 0; i < mbrs.size(); ++i)
+    CHECK(packed.leaf(i) == mbrs[i]);
+
+  // Serialization round trip
+  SizeComputationSerializer size_computation_serializer;
+  packed.serialize(size_computation_serializer);
+  std::vector<uint8_t> buff(size_computation_serializer.size());
+  Serializer serializer(buff.data(), buff.size());
+  packed.serialize(serializer);
+  RTree deserialized;
+  Deserializer deserializer(buff.data(), buff.size());
+  deserialized.deserialize(deserializer, &d2, constants::format_version);
+  CHECK(deserialized.packed());
+
+  // The overlapping tiles match the sequential R-tree
+  auto full_tiles = [](const TileOverlap& overlap) {
+    std::vector<uint64_t> tiles;
+    for (const auto& tile_range : overlap.tile_ranges_) {
+      for (auto t = tile_range.first; t <= tile_range.second; ++t)
+        tiles.push_back(t);
+    }
+    return tiles;
+  };
+  std::vector<std::vector<int32_t>> r_vals = {
+      {1, 1, 1, 1}, {1, 80, 1, 80}, {2, 25, 5, 35}, {30, 32, 1, 80}};
+  std::vector<NDRange> ranges(r_vals.size(), NDRange(2));
+  for (uint64_t r = 0; r < r_vals.size(); ++r) {
+    ranges[r][0].set_range(&r_vals[r][0], 2 * sizeof(int32_t));
+    ranges[r][1].set_range(&r_vals[r][2], 2 * sizeof(int32_t));
+  }
+  for (const auto* rtree : {&packed, &deserialized}) {
+    for (const auto& range : ranges) {
+      auto expected = sequential.get_tile_overlap(range, is_default);
+      auto overlap = rtree->get_tile_overlap(range, is_default);
+      CHECK(overlap.tiles_ == expected.tiles_);
+      CHECK(full_tiles(overlap) == full_tiles(expected));
+
+      std::vector<uint8_t> expected_bitmap(mbrs.size()), bitmap(mbrs.size());
+      sequential.compute_tile_bitmap(range[1], 1, &expected_bitmap);
+      rtree->compute_tile_bitmap(range[1], 1, &bitmap);
+      CHECK(bitmap == expected_bitmap);
+    }
+  }
+
+  // Packing visits fewer nodes for a point query
+  uint64_t sequential_node_num = 0, packed_node_num = 0;
+  std::vector<NDRange> point(1, ranges[0]);
+  auto expected = sequential.get_tile_overlap(
+      point, is_default, &sequential_node_num);
+  auto overlaps = packed.get_tile_overlap(point, is_default, &packed_node_num);
+  CHECK(overlaps[0].tiles_ == expected[0].tiles_);
+  CHECK(packed_node_num < sequential_node_num);
+}
+
 TEST_CASE(
     "RTree: Test R-Tree, heterogeneous (uint8, int32), basic functions",
     "[rtree][basic][heter]") {
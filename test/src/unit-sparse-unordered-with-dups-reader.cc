@@ -1516,4 +1516,111 @@ TEST_CASE_METHOD(
       data_offsets_r,
       &data_offsets_r_size);
   CHECK(rc == TILEDB_OK);
-}
\ No newline at end of file
+}
+TEST_CASE_METHOD(
+    CSparseUnorderedWithDupsFx,
+    "Sparse unordered with dups reader: set membership query condition",
+    "[sparse-unordered-with-dups][query-condition][set-membership]") {
+  // Create default array.
+  reset_config();
+  create_default_array_1d();
+
+  // Write a fragment.
+  int coords[] = {1, 2, 3, 4, 5, 6, 7, 8};
+  uint64_t coords_size = sizeof(coords);
+  int data[] = {10, 20, 30, 40, 50, 60, 70, 80};
+  uint64_t data_size = sizeof(data);
+  write_1d_fragment(coords, &coords_size, data, &data_size);
+
+  // Set membership ops only initialize from a set, and other ops from a
+  // value.
+  tiledb_query_condition_t* query_condition = nullptr;
+  auto rc = tiledb_query_condition_alloc(ctx_, &query_condition);
+  REQUIRE(rc == TILEDB_OK);
+  int32_t val = 20;
+  rc = tiledb_query_condition_init(
+      ctx_, query_condition, "a", &val, sizeof(int32_t), TILEDB_IN);
+  CHECK(rc == TILEDB_ERR);
+  int32_t members[] = {20, 50, 80, 90};
+  uint64_t offsets[] = {0, 4, 8, 12};
+  rc = tiledb_query_condition_init_set_membership(
+      ctx_,
+      query_condition,
+      "a",
+      members,
+      sizeof(members),
+      offsets,
+      sizeof(offsets),
+      TILEDB_EQ);
+  CHECK(rc == TILEDB_ERR);
+
+  // Offsets must be sorted and lie within the set data.
+  uint64_t bad_offsets[] = {0, 8, 4, 12};
+  rc = tiledb_query_condition_init_set_membership(
+      ctx_,
+      query_condition,
+      "a",
+      members,
+      sizeof(members),
+      bad_offsets,
+      sizeof(bad_offsets),
+      TILEDB_IN);
+  CHECK(rc == TILEDB_ERR);
+  tiledb_query_condition_free(&query_condition);
+
+  tiledb_query_condition_op_t op = GENERATE(TILEDB_IN, TILEDB_NOT_IN);
+  rc = tiledb_query_condition_alloc(ctx_, &query_condition);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_condition_init_set_membership(
+      ctx_,
+      query_condition,
+      "a",
+      members,
+      sizeof(members),
+      offsets,
+      sizeof(offsets),
+      op);
+  REQUIRE(rc == TILEDB_OK);
+
+  // Read with the condition.
+  tiledb_array_t* array;
+  rc = tiledb_array_alloc(ctx_, array_name_.c_str(), &array);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_array_open(ctx_, array, TILEDB_READ);
+  REQUIRE(rc == TILEDB_OK);
+  tiledb_query_t* query;
+  rc = tiledb_query_alloc(ctx_, array, TILEDB_READ, &query);
+  REQUIRE(rc == TILEDB_OK);
+  rc = tiledb_query_set_condition(ctx_, query, query_condition);
+  REQUIRE(rc == TILEDB_OK);
+
+  int coords_r[8];
+  int data_r[8];
+  uint64_t coords_r_size = sizeof(coords_r);
+  uint64_t data_r_size = sizeof(data_r);
+  rc = tiledb_query_set_layout(ctx_, query, TILEDB_UNORDERED);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_set_data_buffer(ctx_, query, "a", data_r, &data_r_size);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_set_data_buffer(
+      ctx_, query, "d", coords_r, &coords_r_size);
+  CHECK(rc == TILEDB_OK);
+  rc = tiledb_query_submit(ctx_, query);
+  CHECK(rc == TILEDB_OK);
+
+  // Check the results.
+  std::vector<int> expected = op == TILEDB_IN ?
+                                  std::vector<int>{20, 50, 80} :
+                                  std::vector<int>{10, 30, 40, 60, 70};
+  std::vector<int> results(data_r, data_r + data_r_size / sizeof(int));
+  std::sort(results.begin(), results.end());
+  CHECK(results == expected);
+  CHECK(coords_r_size == expected.size() * sizeof(int));
+
+  // Clean up.
+  rc = tiledb_array_close(ctx_, array);
+  CHECK(rc == TILEDB_OK);
+  tiledb_array_free(&array);
+  tiledb_query_free(&query);
+  tiledb_query_condition_free(&query_condition);
+}
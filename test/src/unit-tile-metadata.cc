@@ -27,14 +27,15 @@
  *
  * @section DESCRIPTION
  *
- * Tests the min/max/sum/null count values written to disk by using the
- * load_tile_*_values and get_tile_* apis of fragment metadata.
+ * Tests the min/max/sum/null count values and Bloom filters written to disk
+ * by using the load_tile_* and get_tile_* apis of fragment metadata.
  */
 
 #include <test/support/tdb_catch.h>
 #include "helpers.h"
 #include "tiledb/sm/c_api/tiledb_struct_def.h"
 #include "tiledb/sm/cpp_api/tiledb"
+#include "tiledb/sm/misc/bloom_filter.h"
 #include "tiledb/sm/tile/tile_metadata_generator.h"
 
 using namespace tiledb;
@@ -1051,3 +1052,122 @@ TEST_CASE_METHOD(
     CPPVarTileMetadataFx::check_metadata(f, layout, nullable, all_null);
   }
 }
+
+TEST_CASE("TileMetadata: Bloom filters", "[tile-metadata][bloom-filter]") {
+  const char* array_name = "tile_metadata_bloom_filter_unit_array";
+  const std::string bits_per_cell = GENERATE("0", "10");
+  const bool has_filters = bits_per_cell != "0";
+  Config config;
+  config["sm.bloom_filter_bits_per_cell"] = bits_per_cell;
+  Context ctx(config);
+  VFS vfs(ctx);
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+
+  // Sparse array with duplicates, 10 tiles of 10 cells.
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<uint32_t>(ctx, "d", {{0, 999}}, 10));
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain);
+  schema.set_capacity(10);
+  schema.set_allows_dups(true);
+  schema.add_attribute(Attribute::create<std::string>(ctx, "a"));
+  Array::create(array_name, schema);
+
+  std::vector<uint32_t> d(100);
+  std::string a;
+  std::vector<uint64_t> a_offsets(100);
+  for (uint32_t i = 0; i < 100; i++) {
+    d[i] = i * 10;
+    a_offsets[i] = a.size();
+    a += "v" + std::to_string(i);
+  }
+
+  Array array_w(ctx, array_name, TILEDB_WRITE);
+  Query query_w(ctx, array_w);
+  query_w.set_layout(TILEDB_UNORDERED)
+      .set_data_buffer("d", d)
+      .set_data_buffer("a", a)
+      .set_offsets_buffer("a", a_offsets);
+  query_w.submit();
+  array_w.close();
+
+  // Check the Bloom filters through the fragment metadata.
+  tiledb_array_t* array;
+  REQUIRE(tiledb_array_alloc(ctx.ptr().get(), array_name, &array) == TILEDB_OK);
+  REQUIRE(tiledb_array_open(ctx.ptr().get(), array, TILEDB_READ) == TILEDB_OK);
+  auto frag_meta = array->array_->fragment_metadata();
+  auto& enc_key = array->array_->get_encryption_key();
+  CHECK(frag_meta[0]->has_tile_bloom_filters("d") == has_filters);
+  CHECK(frag_meta[0]->has_tile_bloom_filters("a") == has_filters);
+  std::vector<std::string> names{"d", "a"};
+  CHECK(frag_meta[0]->load_tile_bloom_filters(enc_key, std::move(names)).ok());
+
+  uint64_t false_positive_num = 0;
+  for (uint32_t i = 0; i < 100; i++) {
+    std::string value = "v" + std::to_string(i);
+    auto hash_d = sm::BloomFilter::hash(&d[i], sizeof(uint32_t));
+    auto hash_a = sm::BloomFilter::hash(value.data(), value.size());
+    for (uint64_t t = 0; t < 10; t++) {
+      auto contains_d = frag_meta[0]->tile_may_contain("d", t, hash_d);
+      auto contains_a = frag_meta[0]->tile_may_contain("a", t, hash_a);
+      if (t == i / 10) {
+        CHECK(contains_d);
+        CHECK(contains_a);
+      } else {
+        false_positive_num += contains_d + contains_a;
+      }
+    }
+  }
+
+  // Without filters, every tile may contain every value.
+  if (has_filters) {
+    CHECK(false_positive_num < 100);
+  } else {
+    CHECK(false_positive_num == 2 * 100 * 9);
+  }
+  tiledb_array_close(ctx.ptr().get(), array);
+  tiledb_array_free(&array);
+
+  // Point and equality reads return the right cells.
+  Array array_r(ctx, array_name, TILEDB_READ);
+  std::vector<uint32_t> d_r(10);
+  std::string a_r(100, '\0');
+  std::vector<uint64_t> a_r_offsets(10);
+
+  Query query_r(ctx, array_r);
+  Subarray subarray(ctx, array_r);
+  subarray.add_range<uint32_t>(0, 420, 420);
+  query_r.set_subarray(subarray)
+      .set_layout(TILEDB_UNORDERED)
+      .set_data_buffer("d", d_r)
+      .set_data_buffer("a", a_r)
+      .set_offsets_buffer("a", a_r_offsets);
+  query_r.submit();
+  CHECK(query_r.query_status() == Query::Status::COMPLETE);
+  auto result_num = query_r.result_buffer_elements()["d"].second;
+  CHECK(result_num == 1);
+  CHECK(d_r[0] == 420);
+
+  Query query_qc(ctx, array_r);
+  Subarray subarray_qc(ctx, array_r);
+  subarray_qc.add_range<uint32_t>(0, 0, 999);
+  std::string value = "v57";
+  QueryCondition qc(ctx);
+  qc.init("a", value.data(), value.size(), TILEDB_EQ);
+  query_qc.set_subarray(subarray_qc)
+      .set_condition(qc)
+      .set_layout(TILEDB_UNORDERED)
+      .set_data_buffer("d", d_r)
+      .set_data_buffer("a", a_r)
+      .set_offsets_buffer("a", a_r_offsets);
+  query_qc.submit();
+  CHECK(query_qc.query_status() == Query::Status::COMPLETE);
+  result_num = query_qc.result_buffer_elements()["d"].second;
+  CHECK(result_num == 1);
+  CHECK(d_r[0] == 570);
+  array_r.close();
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
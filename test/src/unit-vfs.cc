@@ -229,6 +229,55 @@ TEST_CASE("VFS: Test read batching", "[vfs]") {
     REQUIRE(vfs->terminate().ok());
   }
 
+  SECTION("- Split large batches into parallel reads") {
+    // Set a small min parallel size so that batches are split
+    Config default_config, vfs_config;
+    vfs_config.set("vfs.min_parallel_size", "16");
+    vfs_config.set("vfs.file.max_parallel_ops", "4");
+    REQUIRE(vfs->init(
+                   &g_helper_stats,
+                   &compute_tp,
+                   &io_tp,
+                   &default_config,
+                   &vfs_config)
+                .ok());
+
+    // A single large region is read directly in several parts.
+    std::memset(tile[0].filtered_buffer().data(), 0, nelts * sizeof(uint32_t));
+    batches.clear();
+    batches.emplace_back(0, &tile[0], nelts * sizeof(uint32_t));
+    REQUIRE(vfs->read_all(testfile, batches, &io_tp, &tasks).ok());
+    REQUIRE(io_tp.wait_all(tasks).ok());
+    tasks.clear();
+    for (unsigned i = 0; i < nelts; i++) {
+      REQUIRE(tile[0].filtered_buffer().data_as<uint32_t>()[i] == i);
+    }
+
+    // Mix a large region with small regions, which are grouped and staged.
+    batches.clear();
+    for (unsigned i = 0; i < 11; i++) {
+      std::memset(
+          tile[i].filtered_buffer().data(), 0, nelts * sizeof(uint32_t));
+    }
+    batches.emplace_back(0, &tile[0], (nelts / 2) * sizeof(uint32_t));
+    for (unsigned i = 1; i < 11; i++) {
+      batches.emplace_back(
+          (nelts / 2 + 2 * i) * sizeof(uint32_t), &tile[i], sizeof(uint32_t));
+    }
+    REQUIRE(vfs->read_all(testfile, batches, &io_tp, &tasks).ok());
+    REQUIRE(io_tp.wait_all(tasks).ok());
+    tasks.clear();
+    for (unsigned i = 0; i < nelts / 2; i++) {
+      REQUIRE(tile[0].filtered_buffer().data_as<uint32_t>()[i] == i);
+    }
+    for (unsigned i = 1; i < 11; i++) {
+      REQUIRE(
+          tile[i].filtered_buffer().data_as<uint32_t>()[0] ==
+          nelts / 2 + 2 * i);
+    }
+    REQUIRE(vfs->terminate().ok());
+  }
+
   Config default_config, vfs_config;
   REQUIRE(
       vfs->init(
@@ -561,3 +610,88 @@ TEST_CASE("VFS: test ls_with_sizes", "[vfs][ls-with-sizes]") {
   // Clean up
   vfs.remove_dir(URI(path));
 }
+
+TEST_CASE("VFS: Test read-ahead planning", "[vfs][read-ahead]") {
+  const uint64_t block = 100;
+  VFS::ReadAheadCache cache(100000, block, 800, nullptr);
+  const URI uri("mem://read_ahead_file");
+
+  SECTION("Sequential reads grow the window") {
+    auto plan = cache.plan(uri, 0, 50, false);
+    CHECK(plan.read_offset_ == 0);
+    CHECK(plan.read_nbytes_ == 100);
+    CHECK(plan.prefetch_nbytes_ == 0);
+
+    // Continuing read, the window doubles and the next window is prefetched.
+    plan = cache.plan(uri, 50, 50, true);
+    CHECK(plan.read_nbytes_ == 0);
+    CHECK(plan.prefetch_offset_ == 100);
+    CHECK(plan.prefetch_nbytes_ == 200);
+
+    plan = cache.plan(uri, 100, 50, false);
+    CHECK(plan.read_offset_ == 100);
+    CHECK(plan.read_nbytes_ == 400);
+    CHECK(plan.prefetch_offset_ == 500);
+    CHECK(plan.prefetch_nbytes_ == 400);
+  }
+
+  SECTION("Random and repeated reads reset the window") {
+    cache.plan(uri, 0, 50, false);
+    cache.plan(uri, 50, 50, true);
+
+    // A read far from the previous one.
+    auto plan = cache.plan(uri, 10000, 50, false);
+    CHECK(plan.read_offset_ == 10000);
+    CHECK(plan.read_nbytes_ == 100);
+    CHECK(plan.prefetch_nbytes_ == 0);
+
+    // A repeated read at the same offset.
+    cache.plan(uri, 10050, 50, true);
+    plan = cache.plan(uri, 10050, 50, false);
+    CHECK(plan.read_offset_ == 10000);
+    CHECK(plan.read_nbytes_ == 100);
+    CHECK(plan.prefetch_nbytes_ == 0);
+  }
+
+  SECTION("Reads are clamped to the file size found by a short read") {
+    auto plan = cache.plan(uri, 0, 50, false);
+    CHECK(plan.read_nbytes_ == 100);
+    CHECK(!cache.file_size(uri).has_value());
+
+    // The prefetch of [100, 300) only returns 150 bytes.
+    plan = cache.plan(uri, 50, 50, true);
+    CHECK(plan.prefetch_offset_ == 100);
+    CHECK(plan.prefetch_nbytes_ == 200);
+    cache.set_file_size(uri, 250);
+    CHECK(cache.file_size(uri) == 250);
+
+    // The read stops at the end of the file, nothing is left to prefetch.
+    plan = cache.plan(uri, 200, 20, false);
+    CHECK(plan.read_offset_ == 200);
+    CHECK(plan.read_nbytes_ == 50);
+    CHECK(plan.prefetch_nbytes_ == 0);
+  }
+
+  SECTION("The least recently read URIs stop being tracked") {
+    const uint64_t max_uris = VFS::ReadAheadCache::max_tracked_uris_;
+    cache.plan(uri, 0, 50, false);
+    for (uint64_t i = 1; i < max_uris; ++i)
+      cache.plan(URI("mem://other_" + std::to_string(i)), 0, 50, false);
+
+    // Reading `uri` again makes `other_1` the least recently read URI.
+    cache.plan(uri, 50, 50, true);
+    cache.set_file_size(uri, 1000);
+    cache.plan(URI("mem://new_file"), 0, 50, false);
+    CHECK(cache.file_size(uri) == 1000);
+
+    // `uri` is still tracked, the read is sequential.
+    auto plan = cache.plan(uri, 100, 50, false);
+    CHECK(plan.read_nbytes_ == 400);
+    CHECK(plan.prefetch_nbytes_ > 0);
+
+    // `other_1` is no longer tracked, the read is not sequential.
+    plan = cache.plan(URI("mem://other_1"), 50, 50, false);
+    CHECK(plan.read_nbytes_ == 100);
+    CHECK(plan.prefetch_nbytes_ == 0);
+  }
+}
@@ -54,6 +54,8 @@ TILEDB_FILTER_TYPE_ENUM(FILTER_NONE) = 0,
     TILEDB_FILTER_TYPE_ENUM(FILTER_DICTIONARY) = 14,
     /** Float scaling filter. */
     TILEDB_FILTER_TYPE_ENUM(FILTER_SCALE_FLOAT) = 15,
+    /** Bitmap filter, packing a bytemap into bits. */
+    TILEDB_FILTER_TYPE_ENUM(FILTER_BITMAP) = 16,
 #endif
 
 #ifdef TILEDB_FILTER_OPTION_ENUM
@@ -591,3 +591,112 @@ TEST_CASE("ThreadPool: Test Exceptions", "[threadpool]") {
     REQUIRE(result == 207);
   }
 }
+
+TEST_CASE("ThreadPool: Test adaptive concurrency", "[threadpool]") {
+  // Adjustments only happen when the test moves the clock.
+  std::atomic<int64_t> now_ms(0);
+  auto clock = [&now_ms]() {
+    return std::chrono::steady_clock::time_point(
+        std::chrono::milliseconds(now_ms.load()));
+  };
+
+  ThreadPool pool{16};
+  REQUIRE(pool.active_concurrency_level() == 16);
+
+  pool.enable_adaptive_concurrency(4, std::chrono::milliseconds(50), clock);
+  REQUIRE(pool.active_concurrency_level() == 4);
+
+  // Occupy the active workers, each until its own gate opens.
+  std::vector<std::promise<void>> gates(4);
+  std::atomic<int> started(0);
+  std::vector<ThreadPool::Task> results;
+  for (auto& gate : gates) {
+    results.push_back(
+        pool.execute([&started, opened = gate.get_future().share()]() {
+          started++;
+          opened.wait();
+          return Status::Ok();
+        }));
+  }
+  while (started < 4) {
+    std::this_thread::yield();
+  }
+
+  // No other worker may run a task above the active concurrency level.
+  auto queued = pool.execute([]() { return Status::Ok(); });
+  CHECK(
+      queued.wait_for(std::chrono::milliseconds(10)) ==
+      std::future_status::timeout);
+
+  // A task completes after a window with a task queued: the level grows by
+  // one step, which lets the queued task run.
+  now_ms = 50;
+  gates[0].set_value();
+  REQUIRE(queued.get().ok());
+  CHECK(pool.active_concurrency_level() == 5);
+
+  // A task completes after a window where the throughput dropped below the
+  // one before the growth step: the level shrinks back.
+  now_ms = 1050;
+  gates[1].set_value();
+  for (int i = 0; i < 10000 && pool.active_concurrency_level() != 4; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  CHECK(pool.active_concurrency_level() == 4);
+
+  // The level does not change without a new window.
+  gates[2].set_value();
+  gates[3].set_value();
+  REQUIRE(pool.wait_all(results).ok());
+  CHECK(pool.active_concurrency_level() == 4);
+}
+
+TEST_CASE("ThreadPool: Test borrowing idle workers", "[threadpool]") {
+  // The lender adjusts its concurrency as soon as one of its tasks completes.
+  std::atomic<int64_t> now_ms(0);
+  auto clock = [&now_ms]() {
+    return std::chrono::steady_clock::time_point(
+        std::chrono::milliseconds(now_ms.load()));
+  };
+  ThreadPool lender{4};
+  lender.enable_adaptive_concurrency(1, std::chrono::milliseconds(50), clock);
+  now_ms = 1000;
+
+  ThreadPool pool{1};
+  pool.borrow_idle_workers(&lender);
+
+  // Keep the single worker of the pool busy.
+  std::promise<void> gate;
+  std::atomic<bool> started(false);
+  auto blocker = pool.execute([&started, opened = gate.get_future()]() {
+    started = true;
+    opened.wait();
+    return Status::Ok();
+  });
+  while (!started) {
+    std::this_thread::yield();
+  }
+
+  // Only lender workers can run the tasks submitted now. Workers are only
+  // borrowed when one of them waits for a task, submit until one does.
+  std::atomic<int> result(0);
+  std::vector<ThreadPool::Task> results;
+  do {
+    results.push_back(pool.execute([&result]() {
+      result++;
+      return Status::Ok();
+    }));
+  } while (results.back().wait_for(std::chrono::milliseconds(1)) !=
+               std::future_status::ready &&
+           result == 0);
+  CHECK(pool.borrowed_task_num() > 0);
+
+  // The borrowed tasks are not part of the lender load.
+  CHECK(lender.active_concurrency_level() == 1);
+
+  gate.set_value();
+  REQUIRE(blocker.get().ok());
+  REQUIRE(pool.wait_all(results).ok());
+  REQUIRE(result == static_cast<int>(results.size()));
+  pool.borrow_idle_workers(nullptr);
+}
@@ -30,6 +30,7 @@
  * This file defines the ThreadPool class.
  */
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 #include <queue>
@@ -40,10 +41,21 @@
 
 namespace tiledb::common {
 
+namespace {
+
+/**
+ * The relative throughput drop after a growth step above which the active
+ * concurrency level is decreased.
+ */
+constexpr double adapt_throughput_tolerance = 0.1;
+
+}  // namespace
+
 // Constructor.  May throw an exception on error.  No logging is done as the
 // logger may not yet be initialized.
 ThreadPool::ThreadPool(size_t n)
-    : concurrency_level_(n) {
+    : concurrency_level_(n)
+    , active_concurrency_level_(n) {
   // If concurrency_level_ is set to zero, construct the thread pool in shutdown
   // state.  Explicitly shut down the task queue as well.
   if (concurrency_level_ == 0) {
@@ -99,21 +111,200 @@ ThreadPool::ThreadPool(size_t n)
   }
 }
 
+void ThreadPool::enable_adaptive_concurrency(
+    size_t min_concurrency_level,
+    std::chrono::milliseconds window,
+    Clock clock) {
+  if (concurrency_level_ == 0) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(adapt_mtx_);
+  min_active_concurrency_level_ = std::clamp<size_t>(
+      min_concurrency_level, 1, concurrency_level_.load());
+  adapt_window_ = window;
+  clock_ = std::move(clock);
+  window_start_ = clock_();
+  completed_task_num_ = 0;
+  last_throughput_ = 0;
+  last_active_concurrency_level_ = min_active_concurrency_level_;
+  set_active_concurrency_level(min_active_concurrency_level_);
+  adaptive_ = true;
+}
+
+void ThreadPool::borrow_idle_workers(ThreadPool* lender) {
+  if (lender != this) {
+    lender_ = lender;
+  }
+}
+
 void ThreadPool::worker() {
+  // Only the workers holding a permit wait for tasks and execute them, the
+  // others are parked.
   while (true) {
+    acquire_permit();
+    idle_worker_num_++;
     auto val = task_queue_.pop();
-    if (val) {
-      (*(*val))();
-    } else {
+    idle_worker_num_--;
+    if (!val) {
+      release_permit();
       break;
     }
+
+    if (!val->borrowed_) {
+      queued_task_num_--;
+    }
+
+    // The active concurrency level decreased while waiting for the task,
+    // hand it back to a worker that is still allowed to run.
+    if (!keep_permit()) {
+      if (!val->borrowed_) {
+        queued_task_num_++;
+      }
+      if (task_queue_.push(*val)) {
+        continue;
+      }
+
+      // The pool is shutting down, execute the task rather than drop it.
+      if (!val->borrowed_) {
+        queued_task_num_--;
+      }
+      (*val->task_)();
+      continue;
+    }
+
+    (*val->task_)();
+
+    // Account for the task before giving back the permit, so the adjustment
+    // sees the queue as it was when the task completed.
+    if (adaptive_ && !val->borrowed_) {
+      completed_task_num_++;
+      adapt_concurrency();
+    }
+
+    release_permit();
+  }
+}
+
+void ThreadPool::acquire_permit() {
+  std::unique_lock<std::mutex> lock(park_mtx_);
+  park_cv_.wait(lock, [this]() {
+    return permit_num_ < active_concurrency_level_ || concurrency_level_ == 0;
+  });
+  permit_num_++;
+}
+
+void ThreadPool::release_permit() {
+  {
+    std::lock_guard<std::mutex> lock(park_mtx_);
+    permit_num_--;
+  }
+  park_cv_.notify_one();
+}
+
+bool ThreadPool::keep_permit() {
+  {
+    std::lock_guard<std::mutex> lock(park_mtx_);
+    if (permit_num_ <= active_concurrency_level_) {
+      return true;
+    }
+    permit_num_--;
+  }
+  return false;
+}
+
+std::optional<ThreadPool::QueuedTask> ThreadPool::try_pop_task() {
+  auto val = task_queue_.try_pop();
+  if (val && !val->borrowed_) {
+    queued_task_num_--;
+  }
+
+  return val;
+}
+
+void ThreadPool::adapt_concurrency() {
+  // Every completion is checked against the window, so that an adjustment
+  // is not missed while another worker holds the lock. The section is short.
+  std::lock_guard<std::mutex> lock(adapt_mtx_);
+  const auto now = clock_();
+  const std::chrono::duration<double> elapsed = now - window_start_;
+  if (elapsed < adapt_window_) {
+    return;
+  }
+
+  const double throughput = completed_task_num_.exchange(0) / elapsed.count();
+  const size_t level = active_concurrency_level_;
+  size_t new_level = level;
+  if (level > last_active_concurrency_level_ &&
+      throughput < (1 - adapt_throughput_tolerance) * last_throughput_) {
+    // The last growth step reduced the throughput, the tasks compete for a
+    // saturated resource: back off multiplicatively.
+    new_level = std::max(min_active_concurrency_level_, level - level / 4);
+  } else if (queued_task_num_ > 0) {
+    // Tasks are waiting for a worker: grow additively.
+    new_level = std::min<size_t>(
+        concurrency_level_,
+        level + std::max<size_t>(1, concurrency_level_ / 16));
+  }
+
+  window_start_ = now;
+  last_throughput_ = throughput;
+  last_active_concurrency_level_ = level;
+  if (new_level != level) {
+    set_active_concurrency_level(new_level);
+  }
+}
+
+void ThreadPool::set_active_concurrency_level(size_t level) {
+  {
+    std::lock_guard<std::mutex> lock(park_mtx_);
+    active_concurrency_level_ = level;
+  }
+  park_cv_.notify_all();
+}
+
+void ThreadPool::borrow_idle_worker() {
+  // Only borrow when more tasks are queued than this pool has idle workers,
+  // and the lender has nothing else to do.
+  auto lender = lender_.load();
+  if (lender == nullptr || queued_task_num_ <= idle_worker_num_ ||
+      lender->idle_worker_num_ == 0 || lender->queued_task_num_ > 0) {
+    return;
+  }
+
+  borrowed_worker_num_++;
+  auto task = make_shared<std::packaged_task<Status()>>(HERE(), [this]() {
+    if (auto val = try_pop_task()) {
+      borrowed_task_num_++;
+      (*val->task_)();
+    }
+
+    borrowed_worker_num_--;
+    return Status::Ok();
+  });
+
+  // The borrowed task is not counted in the queued and completed tasks of
+  // the lender, it is not part of its load.
+  if (!lender->task_queue_.push({task, true})) {
+    borrowed_worker_num_--;
   }
 }
 
 // shutdown is private and only called by constructor and destructor (RAII), so
 // shutdown won't be called from multiple threads.
 void ThreadPool::shutdown() {
+  // Stop borrowing workers, and wait for the borrowed workers still
+  // accessing this pool.
+  lender_ = nullptr;
+  while (borrowed_worker_num_ > 0) {
+    std::this_thread::yield();
+  }
+
   concurrency_level_.store(0);
+  {
+    std::lock_guard<std::mutex> lock(park_mtx_);
+  }
+  park_cv_.notify_all();
   task_queue_.drain();
   for (auto&& t : threads_) {
     t.join();
@@ -188,8 +379,8 @@ std::vector<Status> ThreadPool::wait_all_status(std::vector<Task>& tasks) {
 
       // In the meantime, try to do something useful to make progress (and avoid
       // deadlock)
-      if (auto val = task_queue_.try_pop()) {
-        (*(*val))();
+      if (auto val = try_pop_task()) {
+        (*val->task_)();
       } else {
         // If nothing useful to do, yield so we don't burn cycles
         // going through the task list over and over (thereby slowing down other
@@ -35,6 +35,7 @@
 
 #include "producer_consumer_queue.h"
 
+#include <chrono>
 #include <functional>
 #include <future>
 
@@ -49,6 +50,9 @@ class ThreadPool {
  public:
   using Task = std::future<Status>;
 
+  /** The clock used to measure the adaptive concurrency windows. */
+  using Clock = std::function<std::chrono::steady_clock::time_point()>;
+
   /* ********************************* */
   /*     CONSTRUCTORS & DESTRUCTORS    */
   /* ********************************* */
@@ -81,6 +85,47 @@ class ThreadPool {
     return concurrency_level_;
   }
 
+  /**
+   * Returns the number of worker threads currently allowed to execute tasks.
+   * This is `concurrency_level()` unless the adaptive concurrency control is
+   * enabled.
+   */
+  size_t active_concurrency_level() const {
+    return active_concurrency_level_;
+  }
+
+  /**
+   * Enables the adaptive concurrency control. The active concurrency level
+   * starts at `min_concurrency_level` and is then adjusted at most once per
+   * `window`, AIMD style: it grows additively while tasks are queued and the
+   * task throughput does not drop, and shrinks multiplicatively when a
+   * growth step reduced the throughput. Workers beyond the active
+   * concurrency level are parked.
+   *
+   * @param min_concurrency_level The minimum active concurrency level.
+   * @param window The minimum duration between two adjustments.
+   * @param clock The clock measuring the adjustment windows.
+   */
+  void enable_adaptive_concurrency(
+      size_t min_concurrency_level,
+      std::chrono::milliseconds window = std::chrono::milliseconds(50),
+      Clock clock = std::chrono::steady_clock::now);
+
+  /**
+   * Lets the idle workers of `lender` execute the tasks of this pool when
+   * all the workers of this pool are busy. The lender must not be shut down
+   * while this pool is borrowing from it.
+   *
+   * @param lender The thread pool to borrow idle workers from, `nullptr` to
+   *     stop borrowing.
+   */
+  void borrow_idle_workers(ThreadPool* lender);
+
+  /** Returns the number of tasks executed by borrowed workers. */
+  uint64_t borrowed_task_num() const {
+    return borrowed_task_num_;
+  }
+
   /**
    * Schedule a new task to be executed. If the returned future object
    * is valid, `f` is execute asynchronously. To avoid deadlock, `f`
@@ -110,7 +155,14 @@ class ThreadPool {
 
     std::future<R> future = task->get_future();
 
-    task_queue_.push(task);
+    queued_task_num_++;
+    if (!task_queue_.push({task, false})) {
+      queued_task_num_--;
+    }
+
+    if (lender_ != nullptr) {
+      borrow_idle_worker();
+    }
 
     return future;
   }
@@ -158,23 +210,126 @@ class ThreadPool {
   /* ********************************* */
 
  private:
-  /** The worker thread routine */
+  /** A task in the task queue. */
+  struct QueuedTask {
+    /** The task to execute. */
+    shared_ptr<std::packaged_task<Status()>> task_;
+
+    /**
+     * Whether the task executes a task of a pool borrowing the workers of
+     * this pool. These are not counted as tasks of this pool.
+     */
+    bool borrowed_;
+  };
+
+  /** The worker thread routine. */
   void worker();
 
   /** Terminate threads in the thread pool */
   void shutdown();
 
+  /**
+   * Waits for one of the active concurrency level permits to be available
+   * and takes it. A worker holds a permit while it waits for a task and
+   * executes it. All workers get a permit on shutdown, to drain the queue.
+   */
+  void acquire_permit();
+
+  /** Gives back a permit taken by `acquire_permit`. */
+  void release_permit();
+
+  /**
+   * Gives back the permit of a worker if more permits are taken than the
+   * active concurrency level, which happens when the level decreased while
+   * the worker was waiting for a task.
+   *
+   * @return `true` if the worker can keep its permit.
+   */
+  bool keep_permit();
+
+  /**
+   * Pops a task from the task queue without waiting.
+   *
+   * @return The task, if available.
+   */
+  std::optional<QueuedTask> try_pop_task();
+
+  /**
+   * Adjusts the active concurrency level from the task throughput and
+   * queueing measured since the last adjustment, at most once per
+   * adjustment window.
+   */
+  void adapt_concurrency();
+
+  /** Sets the active concurrency level, waking up workers if it grows. */
+  void set_active_concurrency_level(size_t level);
+
+  /**
+   * Schedules a task on an idle worker of the lender that pops and executes
+   * one task of this pool, if all the workers of this pool are busy.
+   */
+  void borrow_idle_worker();
+
   /** Producer-consumer queue where functions to be executed are kept */
-  ProducerConsumerQueue<
-      shared_ptr<std::packaged_task<Status()>>,
-      std::deque<shared_ptr<std::packaged_task<Status()>>>>
-      task_queue_;
+  ProducerConsumerQueue<QueuedTask, std::deque<QueuedTask>> task_queue_;
 
   /** The worker threads */
   std::vector<std::thread> threads_;
 
   /** The maximum level of concurrency among all of the worker threads */
   std::atomic<size_t> concurrency_level_;
+
+  /** The number of workers allowed to execute tasks. */
+  std::atomic<size_t> active_concurrency_level_;
+
+  /** Mutex and condition variable the workers waiting for a permit use. */
+  std::mutex park_mtx_;
+  std::condition_variable park_cv_;
+
+  /** The number of permits taken by the workers, guarded by `park_mtx_`. */
+  size_t permit_num_{0};
+
+  /** The number of workers waiting for a task. */
+  std::atomic<size_t> idle_worker_num_{0};
+
+  /** The number of tasks of this pool in the task queue. */
+  std::atomic<size_t> queued_task_num_{0};
+
+  /** Whether the adaptive concurrency control is enabled. */
+  std::atomic<bool> adaptive_{false};
+
+  /** The minimum active concurrency level for the adaptive control. */
+  size_t min_active_concurrency_level_{1};
+
+  /** Guards the state of the adaptive control below. */
+  std::mutex adapt_mtx_;
+
+  /** The number of tasks completed in the current adjustment window. */
+  std::atomic<uint64_t> completed_task_num_{0};
+
+  /** The minimum duration between two adjustments. */
+  std::chrono::milliseconds adapt_window_{50};
+
+  /** The clock measuring the adjustment windows. */
+  Clock clock_;
+
+  /** The start of the current adjustment window. */
+  std::chrono::steady_clock::time_point window_start_;
+
+  /** The task throughput (tasks/s) measured in the previous window. */
+  double last_throughput_{0};
+
+  /** The active concurrency level during the previous window. */
+  size_t last_active_concurrency_level_{0};
+
+  /** The pool whose idle workers execute tasks of this pool. */
+  std::atomic<ThreadPool*> lender_{nullptr};
+
+  /** The number of borrowed workers scheduled and not yet done. */
+  std::atomic<uint64_t> borrowed_worker_num_{0};
+
+  /** The number of tasks executed by borrowed workers. */
+  std::atomic<uint64_t> borrowed_task_num_{0};
 };
 }  // namespace tiledb::common
 
@@ -36,6 +36,7 @@
 #include "tiledb/sm/filesystem/vfs.h"
 #include "tiledb/sm/misc/constants.h"
 #include "tiledb/sm/misc/parallel_functions.h"
+#include "tiledb/sm/misc/parse_argument.h"
 #include "tiledb/sm/misc/uuid.h"
 #include "tiledb/storage_format/uri/parse_uri.h"
 
@@ -230,6 +231,9 @@ Status ArrayDirectory::load() {
           fragment_uris_v12_or_higher.value().begin(),
           fragment_uris_v12_or_higher.value().end());
 
+      // Load the delete vector URIs, which depend on the fragment URIs.
+      RETURN_NOT_OK(load_delete_vector_uris(commits_dir_uris));
+
       // Merge the fragment meta URIs.
       std::copy(
           fragment_meta_uris_v12_or_higher.begin(),
@@ -304,6 +308,15 @@ ArrayDirectory::delete_tiles_location() const {
   return delete_tiles_location_;
 }
 
+const std::unordered_map<std::string, URI>&
+ArrayDirectory::delete_vector_uris() const {
+  return delete_vector_uris_;
+}
+
+const std::vector<URI>& ArrayDirectory::delete_vector_uris_to_vacuum() const {
+  return delete_vector_uris_to_vacuum_;
+}
+
 void ArrayDirectory::set_delete_tiles_location(
     const std::vector<DeleteTileLocation>& delete_tiles_location) {
   delete_tiles_location_ = delete_tiles_location;
@@ -613,6 +626,65 @@ ArrayDirectory::load_consolidated_commit_uris(
   return {Status::Ok(), uris, uris_set};
 }
 
+Status ArrayDirectory::load_delete_vector_uris(
+    const std::vector<URI>& commits_dir_uris) {
+  std::unordered_set<std::string> fragment_names;
+  for (auto& uri : unfiltered_fragment_uris_) {
+    fragment_names.emplace(uri.remove_trailing_slash().last_path_part());
+  }
+
+  // For each fragment, keep the latest delete vector (overall and up to
+  // `timestamp_end_`), everything else can be vacuumed.
+  std::unordered_map<std::string, std::pair<uint64_t, URI>> latest;
+  std::unordered_map<std::string, uint64_t> latest_to_use;
+  std::vector<std::tuple<std::string, uint64_t, URI>> delete_vectors;
+  for (auto& uri : commits_dir_uris) {
+    auto name = uri.last_path_part();
+    if (!stdx::string::ends_with(name, constants::delete_vector_file_suffix))
+      continue;
+
+    name = name.substr(
+        0, name.size() - constants::delete_vector_file_suffix.size());
+    auto pos = name.find_last_of('_');
+    uint64_t timestamp = 0;
+    if (pos == std::string::npos ||
+        !utils::parse::convert(name.substr(pos + 1), &timestamp).ok()) {
+      return LOG_STATUS(Status_ArrayDirectoryError(
+          "Cannot load delete vector URIs; Invalid delete vector name '" +
+          uri.to_string() + "'"));
+    }
+
+    auto fragment_name = name.substr(0, pos);
+    if (fragment_names.count(fragment_name) == 0) {
+      delete_vector_uris_to_vacuum_.emplace_back(uri);
+      continue;
+    }
+
+    auto it = latest.find(fragment_name);
+    if (it == latest.end() || it->second.first < timestamp) {
+      latest[fragment_name] = {timestamp, uri};
+    }
+
+    if (timestamp <= timestamp_end_) {
+      auto it_to_use = latest_to_use.find(fragment_name);
+      if (it_to_use == latest_to_use.end() || it_to_use->second < timestamp) {
+        latest_to_use[fragment_name] = timestamp;
+        delete_vector_uris_[fragment_name] = uri;
+      }
+    }
+
+    delete_vectors.emplace_back(std::move(fragment_name), timestamp, uri);
+  }
+
+  for (auto& [fragment_name, timestamp, uri] : delete_vectors) {
+    if (latest[fragment_name].first != timestamp) {
+      delete_vector_uris_to_vacuum_.emplace_back(uri);
+    }
+  }
+
+  return Status::Ok();
+}
+
 Status ArrayDirectory::load_array_meta_uris() {
   // Load the URIs in the array metadata directory
   std::vector<URI> array_meta_dir_uris;
@@ -295,6 +295,19 @@ class ArrayDirectory {
   /** Returns the location of delete tiles. */
   const std::vector<DeleteTileLocation>& delete_tiles_location() const;
 
+  /**
+   * Returns the URIs of the delete vector files to use, i.e. the latest one
+   * created up to `timestamp_end_`, indexed by fragment name.
+   */
+  const std::unordered_map<std::string, URI>& delete_vector_uris() const;
+
+  /**
+   * Returns the URIs of the delete vector files to vacuum, i.e. those
+   * superseded by a newer delete vector and those of fragments that no
+   * longer exist.
+   */
+  const std::vector<URI>& delete_vector_uris_to_vacuum() const;
+
   /** Set the location of delete tiles, used by consolidation */
   void set_delete_tiles_location(
       const std::vector<DeleteTileLocation>& delete_tiles_location);
@@ -381,6 +394,12 @@ class ArrayDirectory {
   /** The location of delete tiles. */
   std::vector<DeleteTileLocation> delete_tiles_location_;
 
+  /** The delete vector URIs to use, indexed by fragment name. */
+  std::unordered_map<std::string, URI> delete_vector_uris_;
+
+  /** The delete vector URIs to vacuum. */
+  std::vector<URI> delete_vector_uris_to_vacuum_;
+
   /**
    * Only array fragments, metadata, etc. that
    * were created within timestamp range
@@ -470,6 +489,15 @@ class ArrayDirectory {
       optional<std::unordered_set<std::string>>>
   load_consolidated_commit_uris(const std::vector<URI>& commits_dir_uris);
 
+  /**
+   * Loads the delete vector URIs to use and to vacuum from the commits
+   * directory. Delete vector files are named
+   * `<fragment_name>_<timestamp>.dvec`.
+   *
+   * @param commits_dir_uris The URIs of the commits directory.
+   */
+  Status load_delete_vector_uris(const std::vector<URI>& commits_dir_uris);
+
   /** Loads the array metadata URIs. */
   Status load_array_meta_uris();
 
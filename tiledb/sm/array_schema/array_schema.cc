@@ -264,6 +264,10 @@ uint64_t ArraySchema::cell_size(const std::string& name) const {
     return sizeof(size_t);
   }
 
+  if (name == constants::hilbert_values) {
+    return datatype_size(constants::hilbert_values_type);
+  }
+
   // Attribute
   auto attr_it = attribute_map_.find(name);
   if (attr_it != attribute_map_.end()) {
@@ -527,7 +531,9 @@ bool ArraySchema::is_dim_label(const std::string& name) const {
 
 bool ArraySchema::is_field(const std::string& name) const {
   return is_attr(name) || is_dim(name) || name == constants::coords ||
-         name == constants::timestamps || name == constants::delete_timestamps;
+         name == constants::timestamps ||
+         name == constants::delete_timestamps ||
+         name == constants::hilbert_values;
 }
 
 bool ArraySchema::is_nullable(const std::string& name) const {
@@ -630,6 +636,10 @@ Datatype ArraySchema::type(const std::string& name) const {
     return constants::delete_condition_marker_hash_type;
   }
 
+  if (name == constants::hilbert_values) {
+    return constants::hilbert_values_type;
+  }
+
   // Attribute
   auto attr_it = attribute_map_.find(name);
   if (attr_it != attribute_map_.end()) {
@@ -953,6 +963,10 @@ void ArraySchema::set_capacity(uint64_t capacity) {
 
 Status ArraySchema::set_coords_filter_pipeline(const FilterPipeline* pipeline) {
   assert(pipeline);
+  if (pipeline->has_filter(FilterType::FILTER_BITMAP))
+    return LOG_STATUS(Status_ArraySchemaError(
+        "Cannot set coordinates filter pipeline; BITMAP filter is only "
+        "applicable to validity and boolean attribute tiles"));
   RETURN_NOT_OK(check_string_compressor(*pipeline));
   RETURN_NOT_OK(check_double_delta_compressor(*pipeline));
 
@@ -962,6 +976,11 @@ Status ArraySchema::set_coords_filter_pipeline(const FilterPipeline* pipeline) {
 
 Status ArraySchema::set_cell_var_offsets_filter_pipeline(
     const FilterPipeline* pipeline) {
+  if (pipeline->has_filter(FilterType::FILTER_BITMAP))
+    return LOG_STATUS(Status_ArraySchemaError(
+        "Cannot set offsets filter pipeline; BITMAP filter is only "
+        "applicable to validity and boolean attribute tiles"));
+
   cell_var_offsets_filters_ = *pipeline;
   return Status::Ok();
 }
@@ -979,6 +998,13 @@ Status ArraySchema::set_cell_order(Layout cell_order) {
 
 Status ArraySchema::set_cell_validity_filter_pipeline(
     const FilterPipeline* pipeline) {
+  // The BITMAP filter expects the validity bytemap as input
+  if (pipeline->has_filter(FilterType::FILTER_BITMAP) &&
+      pipeline->get_filter(0)->type() != FilterType::FILTER_BITMAP)
+    return LOG_STATUS(Status_ArraySchemaError(
+        "Cannot set validity filter pipeline; BITMAP filter must be the "
+        "first filter of the pipeline"));
+
   cell_validity_filters_ = *pipeline;
   return Status::Ok();
 }
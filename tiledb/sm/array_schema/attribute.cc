@@ -275,6 +275,17 @@ Status Attribute::set_filter_pipeline(const FilterPipeline* pipeline) {
                                 "attribute with a real datatype"));
   }
 
+  // The BITMAP filter expects a bytemap of boolean values as input
+  if (pipeline->has_filter(FilterType::FILTER_BITMAP)) {
+    if (type_ != Datatype::BOOL)
+      return LOG_STATUS(
+          Status_AttributeError("Cannot set BITMAP filter to an attribute "
+                                "with a non-boolean datatype"));
+    if (pipeline->get_filter(0)->type() != FilterType::FILTER_BITMAP)
+      return LOG_STATUS(Status_AttributeError(
+          "BITMAP filter must be the first filter of the pipeline"));
+  }
+
   if (type_ == Datatype::STRING_ASCII && var_size() && pipeline->size() > 1) {
     if (pipeline->has_filter(FilterType::FILTER_RLE)) {
       return LOG_STATUS(Status_AttributeError(
@@ -1381,6 +1381,10 @@ Status Dimension::set_filter_pipeline(const FilterPipeline* pipeline) {
                                 "dimension with a real datatype"));
   }
 
+  if (pipeline->has_filter(FilterType::FILTER_BITMAP))
+    return LOG_STATUS(
+        Status_DimensionError("Cannot set BITMAP filter to a dimension"));
+
   if (type_ == Datatype::STRING_ASCII && var_size() && pipeline->size() > 1) {
     if (pipeline->has_filter(FilterType::FILTER_RLE)) {
       return LOG_STATUS(Status_DimensionError(
@@ -3415,6 +3415,37 @@ int32_t tiledb_query_get_relevant_fragment_num(
   return TILEDB_OK;
 }
 
+int32_t tiledb_query_get_view_buffer_num(
+    tiledb_ctx_t* ctx,
+    const tiledb_query_t* query,
+    const char* name,
+    uint64_t* num) {
+  if (sanity_check(ctx) == TILEDB_ERR || sanity_check(ctx, query) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  if (SAVE_ERROR_CATCH(ctx, query->query_->get_view_buffer_num(name, num)))
+    return TILEDB_ERR;
+
+  return TILEDB_OK;
+}
+
+int32_t tiledb_query_get_view_buffer(
+    tiledb_ctx_t* ctx,
+    const tiledb_query_t* query,
+    const char* name,
+    uint64_t idx,
+    const void** data,
+    uint64_t* size) {
+  if (sanity_check(ctx) == TILEDB_ERR || sanity_check(ctx, query) == TILEDB_ERR)
+    return TILEDB_ERR;
+
+  if (SAVE_ERROR_CATCH(
+          ctx, query->query_->get_view_buffer(name, idx, data, size)))
+    return TILEDB_ERR;
+
+  return TILEDB_OK;
+}
+
 /* ****************************** */
 /*         SUBARRAY               */
 /* ****************************** */
@@ -3830,6 +3861,38 @@ int32_t tiledb_query_condition_init(
   return TILEDB_OK;
 }
 
+int32_t tiledb_query_condition_init_set_membership(
+    tiledb_ctx_t* const ctx,
+    tiledb_query_condition_t* const cond,
+    const char* const attribute_name,
+    const void* const data,
+    const uint64_t data_size,
+    const uint64_t* const offsets,
+    const uint64_t offsets_size,
+    const tiledb_query_condition_op_t op) {
+  if (sanity_check(ctx) == TILEDB_ERR ||
+      sanity_check(ctx, cond) == TILEDB_ERR) {
+    return TILEDB_ERR;
+  }
+
+  // Initialize the QueryCondition object
+  auto st = cond->query_condition_->init_set_membership(
+      std::string(attribute_name),
+      data,
+      data_size,
+      offsets,
+      offsets_size,
+      static_cast<tiledb::sm::QueryConditionOp>(op));
+  if (!st.ok()) {
+    LOG_STATUS(st);
+    save_error(ctx, st);
+    return TILEDB_ERR;
+  }
+
+  // Success
+  return TILEDB_OK;
+}
+
 int32_t tiledb_query_condition_combine(
     tiledb_ctx_t* const ctx,
     const tiledb_query_condition_t* const left_cond,
@@ -8718,6 +8781,26 @@ int32_t tiledb_query_get_relevant_fragment_num(
       ctx, query, relevant_fragment_num);
 }
 
+int32_t tiledb_query_get_view_buffer_num(
+    tiledb_ctx_t* ctx,
+    const tiledb_query_t* query,
+    const char* name,
+    uint64_t* num) noexcept {
+  return api_entry<detail::tiledb_query_get_view_buffer_num>(
+      ctx, query, name, num);
+}
+
+int32_t tiledb_query_get_view_buffer(
+    tiledb_ctx_t* ctx,
+    const tiledb_query_t* query,
+    const char* name,
+    uint64_t idx,
+    const void** data,
+    uint64_t* size) noexcept {
+  return api_entry<detail::tiledb_query_get_view_buffer>(
+      ctx, query, name, idx, data, size);
+}
+
 /* ****************************** */
 /*         SUBARRAY               */
 /* ****************************** */
@@ -8922,6 +9005,26 @@ int32_t tiledb_query_condition_init(
       ctx, cond, attribute_name, condition_value, condition_value_size, op);
 }
 
+int32_t tiledb_query_condition_init_set_membership(
+    tiledb_ctx_t* const ctx,
+    tiledb_query_condition_t* const cond,
+    const char* const attribute_name,
+    const void* const data,
+    const uint64_t data_size,
+    const uint64_t* const offsets,
+    const uint64_t offsets_size,
+    const tiledb_query_condition_op_t op) noexcept {
+  return api_entry<detail::tiledb_query_condition_init_set_membership>(
+      ctx,
+      cond,
+      attribute_name,
+      data,
+      data_size,
+      offsets,
+      offsets_size,
+      op);
+}
+
 int32_t tiledb_query_condition_combine(
     tiledb_ctx_t* const ctx,
     const tiledb_query_condition_t* const left_cond,
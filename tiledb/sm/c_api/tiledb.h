@@ -926,9 +926,32 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  *    Checks if the coordinates obey the global array order. Applicable only
  *    to sparse writes in global order.
  *    **Default**: true
+ * - `sm.persist_hilbert_values` <br>
+ *    If `true`, unordered sparse writes to arrays with Hilbert cell order
+ *    store the Hilbert value of each cell in the fragment, so that reads in
+ *    global order do not have to recompute them. <br>
+ *    **Default**: false
  * - `sm.tile_cache_size` <br>
  *    The tile cache size in bytes. Any `uint64_t` value is acceptable. <br>
  *    **Default**: 10,000,000
+ * - `sm.rtree_page_cache_size` <br>
+ *    The size in bytes of the cache of R-tree leaf pages, shared by the
+ *    fragments whose R-tree is loaded on demand in pages. Any `uint64_t`
+ *    value is acceptable. <br>
+ *    **Default**: 100,000,000
+ * - `sm.rtree_packing` <br>
+ *    How the leaf MBRs of the R-trees of new sparse fragments are grouped
+ *    into nodes. `sequential` groups consecutive tiles, `str` uses
+ *    Sort-Tile-Recursive packing and `hilbert` sorts the MBRs on the
+ *    Hilbert value of their centers. <br>
+ *    **Default**: sequential
+ * - `sm.bloom_filter_bits_per_cell` <br>
+ *    The number of bits per cell of the per-tile Bloom filters built for the
+ *    dimensions and attributes of new sparse fragments, which let readers skip
+ *    tiles for point ranges and equality query conditions. Floating point
+ *    and multi-value fixed-size fields get no Bloom filters. 10 bits per cell
+ *    give about 1% false positives. `0` disables the Bloom filters. <br>
+ *    **Default**: 0
  * - `sm.enable_signal_handlers` <br>
  *    Determines whether or not TileDB will install signal handlers. <br>
  *    **Default**: true
@@ -938,13 +961,26 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  * - `sm.io_concurrency_level` <br>
  *    Upper-bound on number of threads to allocate for IO-bound tasks. <br>
  *    **Default*: # cores
+ * - `sm.io_concurrency_adaptive` <br>
+ *    If `true`, the number of threads running IO-bound tasks adapts between
+ *    `sm.io_concurrency_level_min` and `sm.io_concurrency_level`, growing
+ *    while tasks are queued and throughput improves, and shrinking when more
+ *    threads reduce throughput. Idle IO threads also run compute-bound
+ *    tasks when all compute threads are busy. The current level is reported
+ *    in the stats as `io_concurrency_level`. <br>
+ *    **Default**: false
+ * - `sm.io_concurrency_level_min` <br>
+ *    The minimum number of threads running IO-bound tasks when
+ *    `sm.io_concurrency_adaptive` is `true`. <br>
+ *    **Default**: 1
  * - `sm.vacuum.mode` <br>
  *    The vacuuming mode, one of
  *    `commits` (remove only consolidated commit files),
  *    `fragments` (remove only consolidated fragments),
  *    `fragment_meta` (remove only consolidated fragment metadata),
- *    `array_meta` (remove only consolidated array metadata files), or
- *    `group_meta` (remove only consolidate group metadata only).
+ *    `array_meta` (remove only consolidated array metadata files),
+ *    `group_meta` (remove only consolidate group metadata only), or
+ *    `delete_vectors` (remove only superseded or orphaned delete vectors).
  *    <br>
  *    **Default**: fragments
  * - `sm.consolidation_mode` <br>
@@ -952,8 +988,10 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  *    `commits` (consolidate all commit files),
  *    `fragments` (consolidate all fragments),
  *    `fragment_meta` (consolidate only fragment metadata footers to a single
- * file), `array_meta` (consolidate array metadata only), or `group_meta`
- * (consolidate group metadata only). <br>
+ * file), `array_meta` (consolidate array metadata only), `group_meta`
+ * (consolidate group metadata only), or `delete_vectors` (evaluate the
+ * delete conditions once per fragment and persist the deleted cells as
+ * delete vectors that readers use instead of the conditions). <br>
  *    **Default**: "fragments"
  * - `sm.consolidation.amplification` <br>
  *    The factor by which the size of the dense fragment resulting
@@ -1015,8 +1053,13 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  *    attributes which will point to the end of the values buffer.<br>
  *    **Default**: false
  * - `sm.var_offsets.mode` <br>
- *    The offsets format (`bytes` or `elements`) to be used for
- *    var-sized attributes.<br>
+ *    The offsets format (`bytes`, `elements` or `views`) to be used for
+ *    var-sized attributes. `views` returns a 16-byte view per cell (32-bit
+ *    size, then either the data inlined if it fits in 12 bytes, or a 4-byte
+ *    prefix, a 32-bit buffer index and a 32-bit offset in that buffer). The
+ *    buffers are retrieved with `tiledb_query_get_view_buffer` and are valid
+ *    until the next submit, no data is copied to the var buffer. `views` is
+ *    only supported by the refactored readers.<br>
  *    **Default**: bytes
  * - `sm.query.dense.reader` <br>
  *    Which reader to use for dense queries. "refactored" or "legacy".<br>
@@ -1080,6 +1123,12 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  * -  `vfs.read_ahead_cache_size` <br>
  *    The the total maximum size of the read-ahead cache, which is an LRU. <br>
  *    **Default**: 10485760
+ * -  `vfs.read_ahead_max_size` <br>
+ *    The maximum size of the read-ahead window. The window starts at
+ *    `vfs.read_ahead_size` and doubles for every read that continues a
+ *    sequential pattern on a file, up to this size. Sequential reads also
+ *    prefetch the next window asynchronously. <br>
+ *    **Default**: 1638400
  * - `vfs.min_parallel_size` <br>
  *    The minimum number of bytes in a parallel VFS operation
  *    (except parallel S3 writes, which are controlled by
@@ -1367,6 +1416,16 @@ TILEDB_EXPORT void tiledb_config_free(tiledb_config_t** config) TILEDB_NOEXCEPT;
  * - `rest.curl.buffer_size` <br>
  *    Set curl buffer size for REST requests <br>
  *    **Default**: 524288 (512KB)
+ * - `rest.curl.http2` <br>
+ *    If `true`, negotiate HTTP/2 with the REST server, falling back to
+ *    HTTP/1.1 if the server or libcurl does not support it. <br>
+ *    **Default**: false
+ * - `rest.curl.pool_size` <br>
+ *    The maximum number of idle curl handles kept per context for REST
+ *    requests. Idle handles keep their connections to the REST server open,
+ *    so later requests can skip the TCP and TLS handshakes. `0` closes the
+ *    connections after every request. <br>
+ *    **Default**: 16
  * - `filestore.buffer_size` <br>
  *    Specifies the size in bytes of the internal buffers used in the filestore
  *    API. The size should be bigger than the minimum tile size filestore
@@ -5078,6 +5137,56 @@ TILEDB_EXPORT int32_t tiledb_query_condition_init(
     uint64_t condition_value_size,
     tiledb_query_condition_op_t op) TILEDB_NOEXCEPT;
 
+/**
+ * Initializes a TileDB query condition object with a set membership
+ * operator (`TILEDB_IN` or `TILEDB_NOT_IN`), testing attribute values against
+ * a set of values. The values are given as a single buffer of concatenated
+ * values along with the starting offset of each value in that buffer, as for
+ * var-sized query buffers.
+ *
+ * Null cells are never members of the set, nor selected by `TILEDB_NOT_IN`.
+ * This matches `TILEDB_NE` against a non-null value, which does not select
+ * null cells either.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * tiledb_query_condition_t* query_condition;
+ * tiledb_query_condition_alloc(ctx, &query_condition);
+ *
+ * uint32_t values[] = {1, 5, 7};
+ * uint64_t offsets[] = {0, 4, 8};
+ * tiledb_query_condition_init_set_membership(
+ *   ctx,
+ *   query_condition,
+ *   "longitude",
+ *   values,
+ *   sizeof(values),
+ *   offsets,
+ *   sizeof(offsets),
+ *   TILEDB_IN);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param cond The allocated query condition object.
+ * @param attribute_name The attribute name.
+ * @param data The set values, concatenated.
+ * @param data_size The byte size of `data`.
+ * @param offsets The starting offsets of the values in `data`.
+ * @param offsets_size The byte size of `offsets`.
+ * @param op The set membership operator.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_query_condition_init_set_membership(
+    tiledb_ctx_t* ctx,
+    tiledb_query_condition_t* cond,
+    const char* attribute_name,
+    const void* data,
+    uint64_t data_size,
+    const uint64_t* offsets,
+    uint64_t offsets_size,
+    tiledb_query_condition_op_t op) TILEDB_NOEXCEPT;
+
 /**
  * Combines two query condition objects into a newly allocated
  * condition. Does not mutate or free the input condition objects.
@@ -292,6 +292,59 @@ TILEDB_EXPORT int32_t tiledb_query_get_relevant_fragment_num(
     const tiledb_query_t* query,
     uint64_t* relevant_fragment_num) TILEDB_NOEXCEPT;
 
+/**
+ * Get the number of buffers the views of a var-sized field point into, after
+ * a read with `sm.var_offsets.mode` set to `views`.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * uint64_t num;
+ * tiledb_query_get_view_buffer_num(ctx, query, "a", &num);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param query The query to get the data from.
+ * @param name The name of the var-sized field.
+ * @param num Variable to receive the number of view buffers.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_query_get_view_buffer_num(
+    tiledb_ctx_t* ctx,
+    const tiledb_query_t* query,
+    const char* name,
+    uint64_t* num) TILEDB_NOEXCEPT;
+
+/**
+ * Get a buffer the views of a var-sized field point into, after a read with
+ * `sm.var_offsets.mode` set to `views`. A view that does not inline its data
+ * points into the buffer at its buffer index. The buffer is owned by the
+ * query and valid until its next submit.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * const void* data;
+ * uint64_t size;
+ * tiledb_query_get_view_buffer(ctx, query, "a", 0, &data, &size);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param query The query to get the data from.
+ * @param name The name of the var-sized field.
+ * @param idx The index of the buffer.
+ * @param data Variable to receive the start of the buffer.
+ * @param size Variable to receive the size of the buffer.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_query_get_view_buffer(
+    tiledb_ctx_t* ctx,
+    const tiledb_query_t* query,
+    const char* name,
+    uint64_t idx,
+    const void** data,
+    uint64_t* size) TILEDB_NOEXCEPT;
+
 /* ********************************* */
 /*        QUERY STATUS DETAILS       */
 /* ********************************* */
@@ -218,6 +218,18 @@ class LRUCache {
     return &item_map_.at(key)->object_;
   }
 
+  /**
+   * Returns the logical size of the item in the cache associated with
+   * `key`. The caller must be certain that an item exists for `key`.
+   *
+   * @param key The item key.
+   * @return uint64_t The item size.
+   */
+  uint64_t get_item_size(const K& key) {
+    assert(item_map_.count(key) == 1);
+    return item_map_.at(key)->size_;
+  }
+
   /**
    * Touches the item associated with `key` to make it the most
    * recently used item. The caller must be certain that an item
@@ -258,6 +270,17 @@ class LRUCache {
     return Status::Ok();
   }
 
+  /**
+   * Invoked right before an item is evicted from the cache, either to make
+   * room for a new item or through `invalidate`. Derived classes may
+   * override this to account for evicted objects. The default is a no-op.
+   *
+   * @param item The item about to be evicted.
+   */
+  virtual void on_evict(const LRUCacheItem& item) {
+    (void)item;
+  }
+
   /**
    * Returns a constant iterator at the beginning of the linked list of
    * cached items, where items closest to the head (beginning) are going
@@ -312,6 +335,7 @@ class LRUCache {
     assert(!item_ll_.empty());
 
     auto& item = item_ll_.front();
+    on_evict(item);
     item_map_.erase(item.key_);
     size_ -= item.size_;
     item_ll_.pop_front();
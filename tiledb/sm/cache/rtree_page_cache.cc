@@ -0,0 +1,72 @@
+/**
+ * @file   rtree_page_cache.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class RTreePageCache.
+ */
+
+#include "tiledb/sm/cache/rtree_page_cache.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+RTreePageCache::RTreePageCache(const uint64_t max_size)
+    : LRUCache(max_size) {
+}
+
+Status RTreePageCache::insert(
+    const std::string& key,
+    shared_ptr<const std::vector<NDRange>> page,
+    const uint64_t size) {
+  std::lock_guard<std::mutex> lg(lru_mtx_);
+  return LRUCache::insert(key, std::move(page), size, false);
+}
+
+shared_ptr<const std::vector<NDRange>> RTreePageCache::read(
+    const std::string& key, uint64_t* size) {
+  std::lock_guard<std::mutex> lg(lru_mtx_);
+
+  if (!has_item(key))
+    return nullptr;
+
+  // Touch the item to make it the most recently used item.
+  touch_item(key);
+  if (size != nullptr)
+    *size = get_item_size(key);
+  return *get_item(key);
+}
+
+void RTreePageCache::clear() {
+  std::lock_guard<std::mutex> lg(lru_mtx_);
+  LRUCache::clear();
+}
+
+}  // namespace sm
+}  // namespace tiledb
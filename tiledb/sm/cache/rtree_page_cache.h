@@ -0,0 +1,119 @@
+/**
+ * @file   rtree_page_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class RTreePageCache.
+ */
+
+#ifndef TILEDB_RTREE_PAGE_CACHE_H
+#define TILEDB_RTREE_PAGE_CACHE_H
+
+#include "tiledb/common/common.h"
+#include "tiledb/common/status.h"
+#include "tiledb/sm/cache/lru_cache.h"
+#include "tiledb/sm/misc/types.h"
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * Provides a least-recently used cache for the leaf pages of paged
+ * R-trees, shared by all the fragments opened through a storage manager.
+ * The maximum capacity of the cache is defined as a total serialized byte
+ * size among all cached pages. Pages are shared with the R-trees using
+ * them, so an evicted page is freed once no traversal uses it anymore.
+ *
+ * This class is thread-safe.
+ */
+class RTreePageCache
+    : public LRUCache<std::string, shared_ptr<const std::vector<NDRange>>> {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param max_size The maximum cache byte size.
+   */
+  RTreePageCache(uint64_t max_size);
+
+  /** Destructor. */
+  virtual ~RTreePageCache() = default;
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Inserts a leaf page with a given key into the cache.
+   *
+   * @param key The key that describes the leaf page.
+   * @param page The leaf page.
+   * @param size The serialized size of the leaf page.
+   * @return Status
+   */
+  Status insert(
+      const std::string& key,
+      shared_ptr<const std::vector<NDRange>> page,
+      uint64_t size);
+
+  /**
+   * Returns the leaf page labeled by `key`, or `nullptr` if it is not
+   * cached.
+   *
+   * @param key The key that describes the leaf page.
+   * @param size Set to the serialized size of the leaf page, if cached and
+   *     not null.
+   */
+  shared_ptr<const std::vector<NDRange>> read(
+      const std::string& key, uint64_t* size = nullptr);
+
+  /** Clears the cache, deleting all cached items. */
+  void clear();
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  // Protects LRUCache routines.
+  std::mutex lru_mtx_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_RTREE_PAGE_CACHE_H
@@ -66,6 +66,8 @@ const std::string Config::REST_RETRY_INITIAL_DELAY_MS = "500";
 const std::string Config::REST_RETRY_DELAY_FACTOR = "1.25";
 const std::string Config::REST_CURL_BUFFER_SIZE = "524288";
 const std::string Config::REST_CURL_VERBOSE = "false";
+const std::string Config::REST_CURL_HTTP2 = "false";
+const std::string Config::REST_CURL_POOL_SIZE = "16";
 const std::string Config::REST_LOAD_METADATA_ON_ARRAY_OPEN = "true";
 const std::string Config::REST_LOAD_NON_EMPTY_DOMAIN_ON_ARRAY_OPEN = "true";
 const std::string Config::REST_USE_REFACTORED_ARRAY_OPEN = "false";
@@ -76,7 +78,11 @@ const std::string Config::SM_CHECK_COORD_DUPS = "true";
 const std::string Config::SM_CHECK_COORD_OOB = "true";
 const std::string Config::SM_READ_RANGE_OOB = "warn";
 const std::string Config::SM_CHECK_GLOBAL_ORDER = "true";
+const std::string Config::SM_PERSIST_HILBERT_VALUES = "false";
 const std::string Config::SM_TILE_CACHE_SIZE = "10000000";
+const std::string Config::SM_RTREE_PAGE_CACHE_SIZE = "100000000";
+const std::string Config::SM_RTREE_PACKING = "sequential";
+const std::string Config::SM_BLOOM_FILTER_BITS_PER_CELL = "0";
 const std::string Config::SM_SKIP_EST_SIZE_PARTITIONING = "false";
 const std::string Config::SM_MEMORY_BUDGET = "5368709120";       // 5GB
 const std::string Config::SM_MEMORY_BUDGET_VAR = "10737418240";  // 10GB;
@@ -104,6 +110,8 @@ const std::string Config::SM_COMPUTE_CONCURRENCY_LEVEL =
     utils::parse::to_str(std::thread::hardware_concurrency());
 const std::string Config::SM_IO_CONCURRENCY_LEVEL =
     utils::parse::to_str(std::thread::hardware_concurrency());
+const std::string Config::SM_IO_CONCURRENCY_ADAPTIVE = "false";
+const std::string Config::SM_IO_CONCURRENCY_LEVEL_MIN = "1";
 const std::string Config::SM_SKIP_CHECKSUM_VALIDATION = "false";
 const std::string Config::SM_CONSOLIDATION_AMPLIFICATION = "1.0";
 const std::string Config::SM_CONSOLIDATION_BUFFER_SIZE = "50000000";
@@ -136,6 +144,7 @@ const std::string Config::VFS_FILE_MAX_PARALLEL_OPS =
     Config::SM_IO_CONCURRENCY_LEVEL;
 const std::string Config::VFS_READ_AHEAD_SIZE = "102400";          // 100KiB
 const std::string Config::VFS_READ_AHEAD_CACHE_SIZE = "10485760";  // 10MiB;
+const std::string Config::VFS_READ_AHEAD_MAX_SIZE = "1638400";     // 1.6MiB
 const std::string Config::VFS_AZURE_STORAGE_ACCOUNT_NAME = "";
 const std::string Config::VFS_AZURE_STORAGE_ACCOUNT_KEY = "";
 const std::string Config::VFS_AZURE_STORAGE_SAS_TOKEN = "";
@@ -229,6 +238,8 @@ Config::Config() {
   param_values_["rest.retry_delay_factor"] = REST_RETRY_DELAY_FACTOR;
   param_values_["rest.curl.buffer_size"] = REST_CURL_BUFFER_SIZE;
   param_values_["rest.curl.verbose"] = REST_CURL_VERBOSE;
+  param_values_["rest.curl.http2"] = REST_CURL_HTTP2;
+  param_values_["rest.curl.pool_size"] = REST_CURL_POOL_SIZE;
   param_values_["rest.load_metadata_on_array_open"] =
       REST_LOAD_METADATA_ON_ARRAY_OPEN;
   param_values_["rest.load_non_empty_domain_on_array_open"] =
@@ -245,7 +256,12 @@ Config::Config() {
   param_values_["sm.check_coord_oob"] = SM_CHECK_COORD_OOB;
   param_values_["sm.read_range_oob"] = SM_READ_RANGE_OOB;
   param_values_["sm.check_global_order"] = SM_CHECK_GLOBAL_ORDER;
+  param_values_["sm.persist_hilbert_values"] = SM_PERSIST_HILBERT_VALUES;
   param_values_["sm.tile_cache_size"] = SM_TILE_CACHE_SIZE;
+  param_values_["sm.rtree_page_cache_size"] = SM_RTREE_PAGE_CACHE_SIZE;
+  param_values_["sm.rtree_packing"] = SM_RTREE_PACKING;
+  param_values_["sm.bloom_filter_bits_per_cell"] =
+      SM_BLOOM_FILTER_BITS_PER_CELL;
   param_values_["sm.skip_est_size_partitioning"] =
       SM_SKIP_EST_SIZE_PARTITIONING;
   param_values_["sm.memory_budget"] = SM_MEMORY_BUDGET;
@@ -277,6 +293,8 @@ Config::Config() {
   param_values_["sm.enable_signal_handlers"] = SM_ENABLE_SIGNAL_HANDLERS;
   param_values_["sm.compute_concurrency_level"] = SM_COMPUTE_CONCURRENCY_LEVEL;
   param_values_["sm.io_concurrency_level"] = SM_IO_CONCURRENCY_LEVEL;
+  param_values_["sm.io_concurrency_adaptive"] = SM_IO_CONCURRENCY_ADAPTIVE;
+  param_values_["sm.io_concurrency_level_min"] = SM_IO_CONCURRENCY_LEVEL_MIN;
   param_values_["sm.skip_checksum_validation"] = SM_SKIP_CHECKSUM_VALIDATION;
   param_values_["sm.consolidation.amplification"] =
       SM_CONSOLIDATION_AMPLIFICATION;
@@ -309,6 +327,7 @@ Config::Config() {
   param_values_["vfs.disable_batching"] = VFS_DISABLE_BATCHING;
   param_values_["vfs.read_ahead_size"] = VFS_READ_AHEAD_SIZE;
   param_values_["vfs.read_ahead_cache_size"] = VFS_READ_AHEAD_CACHE_SIZE;
+  param_values_["vfs.read_ahead_max_size"] = VFS_READ_AHEAD_MAX_SIZE;
   param_values_["vfs.file.posix_file_permissions"] =
       VFS_FILE_POSIX_FILE_PERMISSIONS;
   param_values_["vfs.file.posix_directory_permissions"] =
@@ -534,6 +553,10 @@ Status Config::unset(const std::string& param) {
     param_values_["rest.curl.buffer_size"] = REST_CURL_BUFFER_SIZE;
   } else if (param == "rest.curl.verbose") {
     param_values_["rest.curl.verbose"] = REST_CURL_VERBOSE;
+  } else if (param == "rest.curl.http2") {
+    param_values_["rest.curl.http2"] = REST_CURL_HTTP2;
+  } else if (param == "rest.curl.pool_size") {
+    param_values_["rest.curl.pool_size"] = REST_CURL_POOL_SIZE;
   } else if (param == "rest.load_metadata_on_array_open") {
     param_values_["rest.load_metadata_on_array_open"] =
         REST_LOAD_METADATA_ON_ARRAY_OPEN;
@@ -563,8 +586,17 @@ Status Config::unset(const std::string& param) {
     param_values_["sm.read_range_oob"] = SM_READ_RANGE_OOB;
   } else if (param == "sm.check_global_order") {
     param_values_["sm.check_global_order"] = SM_CHECK_GLOBAL_ORDER;
+  } else if (param == "sm.persist_hilbert_values") {
+    param_values_["sm.persist_hilbert_values"] = SM_PERSIST_HILBERT_VALUES;
   } else if (param == "sm.tile_cache_size") {
     param_values_["sm.tile_cache_size"] = SM_TILE_CACHE_SIZE;
+  } else if (param == "sm.rtree_page_cache_size") {
+    param_values_["sm.rtree_page_cache_size"] = SM_RTREE_PAGE_CACHE_SIZE;
+  } else if (param == "sm.rtree_packing") {
+    param_values_["sm.rtree_packing"] = SM_RTREE_PACKING;
+  } else if (param == "sm.bloom_filter_bits_per_cell") {
+    param_values_["sm.bloom_filter_bits_per_cell"] =
+        SM_BLOOM_FILTER_BITS_PER_CELL;
   } else if (param == "sm.memory_budget") {
     param_values_["sm.memory_budget"] = SM_MEMORY_BUDGET;
   } else if (param == "sm.memory_budget_var") {
@@ -619,6 +651,11 @@ Status Config::unset(const std::string& param) {
         SM_COMPUTE_CONCURRENCY_LEVEL;
   } else if (param == "sm.io_concurrency_level") {
     param_values_["sm.io_concurrency_level"] = SM_IO_CONCURRENCY_LEVEL;
+  } else if (param == "sm.io_concurrency_adaptive") {
+    param_values_["sm.io_concurrency_adaptive"] = SM_IO_CONCURRENCY_ADAPTIVE;
+  } else if (param == "sm.io_concurrency_level_min") {
+    param_values_["sm.io_concurrency_level_min"] =
+        SM_IO_CONCURRENCY_LEVEL_MIN;
   } else if (param == "sm.consolidation.amplification") {
     param_values_["sm.consolidation.amplification"] =
         SM_CONSOLIDATION_AMPLIFICATION;
@@ -675,6 +712,8 @@ Status Config::unset(const std::string& param) {
     param_values_["vfs.read_ahead_size"] = VFS_READ_AHEAD_SIZE;
   } else if (param == "vfs.read_ahead_cache_size") {
     param_values_["vfs.read_ahead_cache_size"] = VFS_READ_AHEAD_CACHE_SIZE;
+  } else if (param == "vfs.read_ahead_max_size") {
+    param_values_["vfs.read_ahead_max_size"] = VFS_READ_AHEAD_MAX_SIZE;
   } else if (param == "vfs.file.posix_file_permissions") {
     param_values_["vfs.file.posix_file_permissions"] =
         VFS_FILE_POSIX_FILE_PERMISSIONS;
@@ -838,6 +877,10 @@ Status Config::sanity_check(
   if (param == "rest.server_serialization_format") {
     SerializationType serialization_type;
     RETURN_NOT_OK(serialization_type_enum(value, &serialization_type));
+  } else if (param == "rest.curl.http2") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
+  } else if (param == "rest.curl.pool_size") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "config.logging_level") {
     RETURN_NOT_OK(utils::parse::convert(value, &v32));
   } else if (param == "config.logging_format") {
@@ -852,8 +895,18 @@ Status Config::sanity_check(
     RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "sm.check_global_order") {
     RETURN_NOT_OK(utils::parse::convert(value, &v));
+  } else if (param == "sm.persist_hilbert_values") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "sm.tile_cache_size") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "sm.rtree_page_cache_size") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "sm.rtree_packing") {
+    if (value != "sequential" && value != "str" && value != "hilbert")
+      return LOG_STATUS(
+          Status_ConfigError("Invalid R-tree packing parameter value"));
+  } else if (param == "sm.bloom_filter_bits_per_cell") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "sm.memory_budget") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "sm.memory_budget_var") {
@@ -864,6 +917,10 @@ Status Config::sanity_check(
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "sm.io_concurrency_level") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "sm.io_concurrency_adaptive") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
+  } else if (param == "sm.io_concurrency_level_min") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "sm.consolidation.amplification") {
     RETURN_NOT_OK(utils::parse::convert(value, &vf));
   } else if (param == "sm.consolidation.buffer_size") {
@@ -883,7 +940,7 @@ Status Config::sanity_check(
   } else if (param == "sm.var_offsets.extra_element") {
     RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "sm.var_offsets.mode") {
-    if (value != "bytes" && value != "elements")
+    if (value != "bytes" && value != "elements" && value != "views")
       return LOG_STATUS(
           Status_ConfigError("Invalid offsets format parameter value"));
   } else if (param == "vfs.min_parallel_size") {
@@ -900,6 +957,8 @@ Status Config::sanity_check(
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "vfs.read_ahead_cache_size") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "vfs.read_ahead_max_size") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "vfs.file.posix_file_permissions") {
     RETURN_NOT_OK(utils::parse::convert(value, &v32));
   } else if (param == "vfs.file.posix_directory_permissions") {
@@ -83,6 +83,12 @@ class Config {
   /** The default for Curl's verbose mode used by REST. */
   static const std::string REST_CURL_VERBOSE;
 
+  /** The default for negotiating HTTP/2 with the REST server. */
+  static const std::string REST_CURL_HTTP2;
+
+  /** The default maximum number of idle curl handles kept for REST. */
+  static const std::string REST_CURL_POOL_SIZE;
+
   /** If the array metadata should be loaded on array open */
   static const std::string REST_LOAD_METADATA_ON_ARRAY_OPEN;
 
@@ -143,9 +149,27 @@ class Config {
    */
   static const std::string SM_CHECK_GLOBAL_ORDER;
 
+  /**
+   * If `true`, sparse writes to arrays with Hilbert cell order will store
+   * the Hilbert value of each cell with the fragment.
+   */
+  static const std::string SM_PERSIST_HILBERT_VALUES;
+
   /** The tile cache size. */
   static const std::string SM_TILE_CACHE_SIZE;
 
+  /** The size of the cache of the leaf pages of paged R-trees. */
+  static const std::string SM_RTREE_PAGE_CACHE_SIZE;
+
+  /** The packing of the leaf MBRs of the R-trees of new sparse fragments. */
+  static const std::string SM_RTREE_PACKING;
+
+  /**
+   * The number of bits per cell of the per-tile Bloom filters of new sparse
+   * fragments, 0 to disable them.
+   */
+  static const std::string SM_BLOOM_FILTER_BITS_PER_CELL;
+
   /** If `true`, bypass partitioning on estimated result sizes. */
   static const std::string SM_SKIP_EST_SIZE_PARTITIONING;
 
@@ -221,6 +245,15 @@ class Config {
   /** The maximum concurrency level for io-bound operations. */
   static const std::string SM_IO_CONCURRENCY_LEVEL;
 
+  /**
+   * If `true`, the io-bound concurrency level adapts to the measured io
+   * throughput and queueing, and idle io threads run compute-bound tasks.
+   */
+  static const std::string SM_IO_CONCURRENCY_ADAPTIVE;
+
+  /** The minimum adaptive concurrency level for io-bound operations. */
+  static const std::string SM_IO_CONCURRENCY_LEVEL_MIN;
+
   /** If `true`, checksum validation will be skipped on reads. */
   static const std::string SM_SKIP_CHECKSUM_VALIDATION;
 
@@ -362,6 +395,12 @@ class Config {
   /** The maximum size (in bytes) of the VFS read-ahead cache . */
   static const std::string VFS_READ_AHEAD_CACHE_SIZE;
 
+  /**
+   * The maximum size (in bytes) the VFS read-ahead window grows to for
+   * sequential reads.
+   */
+  static const std::string VFS_READ_AHEAD_MAX_SIZE;
+
   /** Azure storage account name. */
   static const std::string VFS_AZURE_STORAGE_ACCOUNT_NAME;
 
@@ -34,6 +34,7 @@
 #include "tiledb/common/logger.h"
 #include "tiledb/sm/consolidator/array_meta_consolidator.h"
 #include "tiledb/sm/consolidator/commits_consolidator.h"
+#include "tiledb/sm/consolidator/delete_vectors_consolidator.h"
 #include "tiledb/sm/consolidator/fragment_consolidator.h"
 #include "tiledb/sm/consolidator/fragment_meta_consolidator.h"
 #include "tiledb/sm/consolidator/group_meta_consolidator.h"
@@ -66,6 +67,8 @@ shared_ptr<Consolidator> Consolidator::create(
     case ConsolidationMode::GROUP_META:
       return make_shared<GroupMetaConsolidator>(
           HERE(), config, storage_manager);
+    case ConsolidationMode::DELETE_VECTORS:
+      return make_shared<DeleteVectorsConsolidator>(HERE(), storage_manager);
     default:
       return nullptr;
   }
@@ -92,6 +95,8 @@ ConsolidationMode Consolidator::mode_from_config(
     return ConsolidationMode::COMMITS;
   else if (mode == "group_meta")
     return ConsolidationMode::GROUP_META;
+  else if (mode == "delete_vectors")
+    return ConsolidationMode::DELETE_VECTORS;
 
   throw std::logic_error("Cannot consolidate; invalid configuration mode");
 }
@@ -58,7 +58,8 @@ enum class ConsolidationMode {
   FRAGMENT_META,  // Fragment metadata mode.
   ARRAY_META,     // Array metadata mode.
   COMMITS,        // Commits mode.
-  GROUP_META      // Group metadata mode.
+  GROUP_META,     // Group metadata mode.
+  DELETE_VECTORS  // Delete vectors mode.
 };
 
 /** Handles array consolidation. */
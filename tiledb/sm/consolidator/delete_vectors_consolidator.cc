@@ -0,0 +1,207 @@
+/**
+ * @file   delete_vectors_consolidator.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements the DeleteVectorsConsolidator class.
+ */
+
+#include "tiledb/sm/consolidator/delete_vectors_consolidator.h"
+#include "tiledb/common/logger.h"
+#include "tiledb/common/stdx_string.h"
+#include "tiledb/sm/enums/query_type.h"
+#include "tiledb/sm/fragment/fragment_metadata.h"
+#include "tiledb/sm/misc/parallel_functions.h"
+#include "tiledb/sm/misc/parse_argument.h"
+#include "tiledb/sm/misc/tdb_time.h"
+#include "tiledb/sm/query/deletes_and_updates/delete_vector_builder.h"
+#include "tiledb/sm/query/query_buffer.h"
+#include "tiledb/sm/stats/global_stats.h"
+#include "tiledb/sm/storage_manager/storage_manager.h"
+#include "tiledb/sm/subarray/subarray.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/* ****************************** */
+/*          CONSTRUCTOR           */
+/* ****************************** */
+
+DeleteVectorsConsolidator::DeleteVectorsConsolidator(
+    StorageManager* storage_manager)
+    : Consolidator(storage_manager) {
+}
+
+/* ****************************** */
+/*               API              */
+/* ****************************** */
+
+Status DeleteVectorsConsolidator::consolidate(
+    const char* array_name,
+    EncryptionType encryption_type,
+    const void* encryption_key,
+    uint32_t key_length) {
+  auto timer_se = stats_->start_timer("consolidate_delete_vectors");
+
+  // Open array for reading
+  Array array(URI(array_name), storage_manager_);
+  RETURN_NOT_OK(array.open(
+      QueryType::READ, encryption_type, encryption_key, key_length));
+
+  RETURN_NOT_OK_ELSE(consolidate_internal(array), array.close());
+
+  return array.close();
+}
+
+Status DeleteVectorsConsolidator::vacuum(const char* array_name) {
+  if (array_name == nullptr)
+    return logger_->status(Status_StorageManagerError(
+        "Cannot vacuum delete vectors; Array name cannot be null"));
+
+  // Get the delete vector URIs to vacuum
+  auto vfs = storage_manager_->vfs();
+  auto compute_tp = storage_manager_->compute_tp();
+  ArrayDirectory array_dir;
+  array_dir = ArrayDirectory(
+      vfs,
+      compute_tp,
+      URI(array_name),
+      0,
+      utils::time::timestamp_now_ms(),
+      ArrayDirectoryMode::READ);
+
+  const auto& delete_vector_uris_to_vacuum =
+      array_dir.delete_vector_uris_to_vacuum();
+
+  // Delete the delete vector files
+  auto status = parallel_for(
+      compute_tp, 0, delete_vector_uris_to_vacuum.size(), [&](size_t i) {
+        RETURN_NOT_OK(vfs->remove_file(delete_vector_uris_to_vacuum[i]));
+        return Status::Ok();
+      });
+  RETURN_NOT_OK(status);
+
+  return Status::Ok();
+}
+
+/* ****************************** */
+/*        PRIVATE METHODS         */
+/* ****************************** */
+
+Status DeleteVectorsConsolidator::consolidate_internal(Array& array) {
+  // Deletes are only supported on sparse arrays.
+  const auto& array_schema = array.array_schema_latest();
+  if (array_schema.dense()) {
+    return Status::Ok();
+  }
+
+  // Load delete conditions.
+  auto&& [st, delete_conditions] =
+      storage_manager_->load_delete_conditions(array);
+  RETURN_NOT_OK(st);
+  if (delete_conditions->empty()) {
+    return Status::Ok();
+  }
+
+  Config config = storage_manager_->config();
+  std::unordered_map<std::string, QueryBuffer> buffers;
+  Subarray subarray(
+      &array, Layout::UNORDERED, stats_, logger_, true, storage_manager_);
+  QueryCondition condition;
+  DeleteVectorBuilder builder(
+      stats_,
+      logger_,
+      storage_manager_,
+      &array,
+      config,
+      buffers,
+      subarray,
+      condition);
+  RETURN_NOT_OK(builder.init(std::move(*delete_conditions)));
+
+  const auto& array_dir = array.array_directory();
+  const auto& delete_vector_uris = array_dir.delete_vector_uris();
+  const auto commits_dir =
+      array_dir.get_commits_dir(array_schema.write_version());
+  const auto& encryption_key = *array.encryption_key();
+  const auto fragment_metadata = array.fragment_metadata();
+  for (unsigned f = 0; f < fragment_metadata.size(); f++) {
+    auto markers = builder.condition_markers(f);
+    if (markers.empty()) {
+      continue;
+    }
+
+    // Skip fragments with an up to date delete vector. Otherwise, make sure
+    // the new delete vector supersedes the existing one.
+    const auto fragment_name = fragment_metadata[f]
+                                   ->fragment_uri()
+                                   .remove_trailing_slash()
+                                   .last_path_part();
+    uint64_t timestamp = utils::time::timestamp_now_ms();
+    auto it = delete_vector_uris.find(fragment_name);
+    if (it != delete_vector_uris.end()) {
+      auto&& [st_load, tile] = storage_manager_->load_data_from_generic_tile(
+          it->second, 0, encryption_key);
+      RETURN_NOT_OK(st_load);
+      try {
+        auto existing = DeleteVector::deserialize(tile->data(), tile->size());
+        if (existing.condition_markers() == markers) {
+          continue;
+        }
+      } catch (const std::exception& e) {
+        return logger_->status(Status_ConsolidatorError(
+            "Cannot consolidate delete vectors; " + std::string(e.what())));
+      }
+
+      auto name = it->second.last_path_part();
+      name = name.substr(
+          0, name.size() - constants::delete_vector_file_suffix.size());
+      uint64_t existing_timestamp = 0;
+      RETURN_NOT_OK(utils::parse::convert(
+          name.substr(name.find_last_of('_') + 1), &existing_timestamp));
+      timestamp = std::max(timestamp, existing_timestamp + 1);
+    }
+
+    // Build and store the delete vector.
+    auto&& [st_build, delete_vector] = builder.build(f);
+    RETURN_NOT_OK(st_build);
+    auto data = delete_vector->serialize();
+    auto uri = commits_dir.join_path(
+        fragment_name + "_" + std::to_string(timestamp) +
+        constants::delete_vector_file_suffix);
+    RETURN_NOT_OK(storage_manager_->store_data_to_generic_tile(
+        data.data(), data.size(), uri, encryption_key));
+    stats_->add_counter("consolidate_delete_vectors_num", 1);
+  }
+
+  return Status::Ok();
+}
+
+}  // namespace sm
+}  // namespace tiledb
@@ -76,14 +76,45 @@ struct ArrowArray {
   // Opaque producer-specific data
   void* private_data;
 };
+
+/*
+ * Arrow C Stream Interface
+ * Apache License 2.0
+ * source: https://arrow.apache.org/docs/format/CStreamInterface.html
+ */
+
+#ifndef ARROW_C_STREAM_INTERFACE
+#define ARROW_C_STREAM_INTERFACE
+
+struct ArrowArrayStream {
+  // Callbacks providing stream functionality
+  int (*get_schema)(struct ArrowArrayStream*, struct ArrowSchema* out);
+  int (*get_next)(struct ArrowArrayStream*, struct ArrowArray* out);
+  const char* (*get_last_error)(struct ArrowArrayStream*);
+
+  // Release callback
+  void (*release)(struct ArrowArrayStream*);
+
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+#endif  // ARROW_C_STREAM_INTERFACE
 /* End Arrow C API */
 /* ************************************************************************ */
 
 /* ************************************************************************ */
 /* Begin TileDB Arrow IO internal implementation */
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <future>
 #include <memory>
+#include <new>
 #include <optional>
+#include <string>
+#include <vector>
 
 /* ****************************** */
 /*      Error context helper      */
@@ -781,6 +812,432 @@ void ArrowExporter::export_(
   cpp_arrow_array->export_ptr(array);
 }
 
+/* ****************************** */
+/*      Arrow Stream Reader       */
+/* ****************************** */
+
+// Alignment of the buffers allocated by the stream reader, as recommended
+// by the Arrow columnar format.
+constexpr size_t arrow_buffer_alignment = 64;
+
+struct ArrowBufferDeleter {
+  void operator()(void* p) const {
+    ::operator delete(p, std::align_val_t(arrow_buffer_alignment));
+  }
+};
+
+// Owning pointer to an Arrow-aligned buffer
+using ArrowBufferPtr = std::unique_ptr<void, ArrowBufferDeleter>;
+
+// Allocates an Arrow-aligned buffer. Never allocates zero bytes, so that
+// every exported buffer has a valid address.
+inline ArrowBufferPtr arrow_buffer_alloc(uint64_t nbytes) {
+  return ArrowBufferPtr(::operator new(
+      std::max<uint64_t>(nbytes, 1), std::align_val_t(arrow_buffer_alignment)));
+}
+
+// Description of a field exported by the stream reader
+struct ArrowStreamField {
+  std::string name;
+  std::string format;
+  TypeInfo tdbtype;
+  bool is_var;
+  bool nullable;
+};
+
+// Buffers of a single field for a single batch.
+//
+// lifetime:
+//   - owned by the batch until the batch is exported
+//   - then owned by the child ArrowArray (via private_data)
+struct ArrowStreamFieldBatch {
+  ArrowBufferPtr data;
+  ArrowBufferPtr offsets;
+  // TileDB validity, one byte per cell
+  ArrowBufferPtr validity;
+  // Arrow validity bitmap, only allocated if there are nulls
+  ArrowBufferPtr bitmap;
+
+  // Buffer sizes in bytes, set by TileDB to the result sizes on submit
+  uint64_t data_size = 0;
+  uint64_t offsets_size = 0;
+  uint64_t validity_size = 0;
+
+  const void* buffers[3] = {nullptr, nullptr, nullptr};
+};
+
+// A batch of results.
+//
+// lifetime:
+//   - owned by the reader until the batch is exported
+//   - then owned by the root ArrowArray (via private_data), which also
+//     owns the storage of the child ArrowArray structs
+struct ArrowStreamBatch {
+  uint64_t cell_num = 0;
+  bool complete = false;
+  std::vector<std::unique_ptr<ArrowStreamFieldBatch>> fields;
+  std::vector<ArrowArray> child_arrays;
+  std::vector<ArrowArray*> children;
+  const void* buffers[1] = {nullptr};
+};
+
+// Private data of an exported ArrowSchema child
+struct ArrowStreamFieldSchema {
+  std::string name;
+  std::string format;
+};
+
+// Private data of the exported root ArrowSchema
+struct ArrowStreamSchema {
+  std::vector<ArrowSchema> child_schemas;
+  std::vector<ArrowSchema*> children;
+};
+
+/*
+ * Produces an ArrowArrayStream over the results of a read Query.
+ *
+ * The reader allocates Arrow-aligned result buffers for every batch, sets
+ * them on the query and resubmits the query while it is incomplete. Data
+ * and offsets (with the extra element, in the configured bitsize) are
+ * exported as-is; only validity is repacked into Arrow bitmaps. If enabled,
+ * the next batch is read in the background while the consumer processes
+ * the current one.
+ */
+class ArrowStreamReader {
+ public:
+  ArrowStreamReader(
+      Context* const ctx,
+      Query* const query,
+      const std::vector<std::string>& names,
+      uint64_t batch_size,
+      bool read_ahead)
+      : ctx_(ctx)
+      , query_(query)
+      , batch_size_(std::max<uint64_t>(batch_size, 1))
+      , read_ahead_(read_ahead)
+      , done_(false) {
+    if (query_->query_type() != TILEDB_READ)
+      throw TDB_LERROR("[TileDB-Arrow]: Cannot stream a write query");
+    if (names.empty())
+      throw TDB_LERROR("[TileDB-Arrow]: Cannot stream zero fields");
+
+    // Request offsets in Arrow form: byte offsets with the extra element
+    auto config = query_->config();
+    config["sm.var_offsets.mode"] = "bytes";
+    config["sm.var_offsets.extra_element"] = "true";
+    offsets_elem_size_ = config.get("sm.var_offsets.bitsize") == "32" ? 4 : 8;
+    query_->set_config(config);
+
+    auto schema = query_->array().schema();
+    for (const auto& name : names) {
+      ArrowStreamField field;
+      field.name = name;
+      field.tdbtype = tiledb_dt_info(schema, name);
+      field.is_var = field.tdbtype.cell_val_num == TILEDB_VAR_NUM;
+      field.nullable =
+          schema.has_attribute(name) && schema.attribute(name).nullable();
+
+      if (!field.is_var && field.tdbtype.cell_val_num != 1)
+        throw TDB_LERROR(
+            "[TileDB-Arrow]: Cannot stream multi-value field '" + name + "'");
+
+      auto bufferinfo = BufferInfo();
+      bufferinfo.tdbtype = field.tdbtype;
+      bufferinfo.is_var = field.is_var;
+      bufferinfo.offsets_elem_size = offsets_elem_size_;
+      field.format = tiledb_buffer_arrow_fmt(bufferinfo).fmt_;
+
+      if (field.is_var && field.format != "u" && field.format != "U" &&
+          field.format != "z" && field.format != "Z")
+        throw TDB_LERROR(
+            "[TileDB-Arrow]: Cannot stream var-length field '" + name + "'");
+
+      fields_.push_back(field);
+    }
+
+    // Start with a guess for the var-length data buffers, which grow if a
+    // batch cannot make progress.
+    var_capacity_ = batch_size_ * var_cell_size_hint_;
+  }
+
+  ~ArrowStreamReader() {
+    // Wait for an in-flight batch, which writes into buffers it owns
+    if (pending_.valid()) {
+      try {
+        pending_.get();
+      } catch (...) {
+      }
+    }
+  }
+
+  /*
+   * Exports the reader to a pre-allocated ArrowArrayStream struct, which
+   * takes ownership of the reader.
+   */
+  static void export_stream(
+      std::unique_ptr<ArrowStreamReader> reader, ArrowArrayStream* out) {
+    out->get_schema = [](ArrowArrayStream* stream, ArrowSchema* out_schema) {
+      return static_cast<ArrowStreamReader*>(stream->private_data)
+          ->get_schema(out_schema);
+    };
+    out->get_next = [](ArrowArrayStream* stream, ArrowArray* out_array) {
+      return static_cast<ArrowStreamReader*>(stream->private_data)
+          ->get_next(out_array);
+    };
+    out->get_last_error = [](ArrowArrayStream* stream) -> const char* {
+      auto reader = static_cast<ArrowStreamReader*>(stream->private_data);
+      return reader->last_error_.empty() ? nullptr :
+                                           reader->last_error_.c_str();
+    };
+    out->release = [](ArrowArrayStream* stream) {
+      delete static_cast<ArrowStreamReader*>(stream->private_data);
+      stream->release = nullptr;
+    };
+    out->private_data = reader.release();
+  }
+
+ private:
+  // Initial var-length data buffer size per cell, in bytes
+  static constexpr uint64_t var_cell_size_hint_ = 64;
+
+  Context* const ctx_;
+  Query* const query_;
+  std::vector<ArrowStreamField> fields_;
+  uint64_t batch_size_;
+  uint64_t var_capacity_;
+  uint8_t offsets_elem_size_;
+  bool read_ahead_;
+  bool done_;
+  std::future<std::unique_ptr<ArrowStreamBatch>> pending_;
+  std::string last_error_;
+
+  int get_schema(ArrowSchema* out) {
+    try {
+      export_schema(out);
+      return 0;
+    } catch (const std::exception& e) {
+      last_error_ = e.what();
+      return EIO;
+    }
+  }
+
+  int get_next(ArrowArray* out) {
+    try {
+      if (done_) {
+        out->release = nullptr;
+        return 0;
+      }
+
+      auto batch = pending_.valid() ? pending_.get() : read_batch();
+      done_ = batch->complete;
+      if (!done_ && read_ahead_)
+        pending_ = std::async(std::launch::async, [this]() {
+          return read_batch();
+        });
+
+      // Only a completed query may produce an empty batch
+      if (batch->cell_num == 0) {
+        out->release = nullptr;
+        return 0;
+      }
+
+      export_batch(std::move(batch), out);
+      return 0;
+    } catch (const std::exception& e) {
+      last_error_ = e.what();
+      done_ = true;
+      return EIO;
+    }
+  }
+
+  // Submits the query into newly allocated buffers, growing the var-length
+  // buffers until at least one cell fits.
+  std::unique_ptr<ArrowStreamBatch> read_batch() {
+    auto batch = std::make_unique<ArrowStreamBatch>();
+    auto ctx = ctx_->ptr().get();
+    auto query = query_->ptr().get();
+    bool has_var = false;
+
+    while (true) {
+      batch->fields.clear();
+      for (const auto& field : fields_) {
+        auto fb = std::make_unique<ArrowStreamFieldBatch>();
+        if (field.is_var) {
+          has_var = true;
+          fb->data_size = var_capacity_;
+          fb->offsets_size = (batch_size_ + 1) * offsets_elem_size_;
+          fb->offsets = arrow_buffer_alloc(fb->offsets_size);
+          ctx_->handle_error(tiledb_query_set_offsets_buffer(
+              ctx,
+              query,
+              field.name.c_str(),
+              static_cast<uint64_t*>(fb->offsets.get()),
+              &fb->offsets_size));
+        } else {
+          fb->data_size = batch_size_ * field.tdbtype.elem_size;
+        }
+        fb->data = arrow_buffer_alloc(fb->data_size);
+        ctx_->handle_error(tiledb_query_set_data_buffer(
+            ctx, query, field.name.c_str(), fb->data.get(), &fb->data_size));
+
+        if (field.nullable) {
+          fb->validity_size = batch_size_;
+          fb->validity = arrow_buffer_alloc(fb->validity_size);
+          ctx_->handle_error(tiledb_query_set_validity_buffer(
+              ctx,
+              query,
+              field.name.c_str(),
+              static_cast<uint8_t*>(fb->validity.get()),
+              &fb->validity_size));
+        }
+        batch->fields.push_back(std::move(fb));
+      }
+
+      auto status = query_->submit();
+      if (status == Query::Status::FAILED)
+        throw TDB_LERROR("[TileDB-Arrow]: Query failed");
+      batch->complete = status != Query::Status::INCOMPLETE;
+
+      // All fields hold the same number of cells
+      const auto& field = fields_.front();
+      const auto& fb = batch->fields.front();
+      if (field.is_var) {
+        const uint64_t offsets_num = fb->offsets_size / offsets_elem_size_;
+        batch->cell_num = offsets_num > 0 ? offsets_num - 1 : 0;
+      } else {
+        batch->cell_num = fb->data_size / field.tdbtype.elem_size;
+      }
+
+      if (batch->cell_num > 0 || batch->complete)
+        return batch;
+
+      // No cell fit in the buffers
+      if (has_var)
+        var_capacity_ *= 2;
+      else
+        batch_size_ *= 2;
+    }
+  }
+
+  void export_schema(ArrowSchema* out) const {
+    auto root = new ArrowStreamSchema();
+    root->child_schemas.resize(fields_.size());
+    root->children.resize(fields_.size());
+
+    for (size_t i = 0; i < fields_.size(); i++) {
+      auto fs = new ArrowStreamFieldSchema{fields_[i].name, fields_[i].format};
+      ArrowSchema& child = root->child_schemas[i];
+      child.format = fs->format.c_str();
+      child.name = fs->name.c_str();
+      child.metadata = nullptr;
+      child.flags = fields_[i].nullable ? ARROW_FLAG_NULLABLE : 0;
+      child.n_children = 0;
+      child.children = nullptr;
+      child.dictionary = nullptr;
+      child.release = [](ArrowSchema* schema_p) {
+        delete static_cast<ArrowStreamFieldSchema*>(schema_p->private_data);
+        schema_p->release = nullptr;
+      };
+      child.private_data = fs;
+      root->children[i] = &child;
+    }
+
+    out->format = "+s";
+    out->name = "";
+    out->metadata = nullptr;
+    out->flags = 0;
+    out->n_children = static_cast<int64_t>(fields_.size());
+    out->children = root->children.data();
+    out->dictionary = nullptr;
+    out->release = [](ArrowSchema* schema_p) {
+      // Release the children that were not moved out by the consumer
+      for (int64_t i = 0; i < schema_p->n_children; i++) {
+        ArrowSchema* child = schema_p->children[i];
+        if (child->release != nullptr)
+          child->release(child);
+      }
+      delete static_cast<ArrowStreamSchema*>(schema_p->private_data);
+      schema_p->release = nullptr;
+    };
+    out->private_data = root;
+  }
+
+  void export_batch(std::unique_ptr<ArrowStreamBatch> batch, ArrowArray* out) {
+    const uint64_t cell_num = batch->cell_num;
+    batch->child_arrays.resize(fields_.size());
+    batch->children.resize(fields_.size());
+
+    for (size_t i = 0; i < fields_.size(); i++) {
+      const auto& field = fields_[i];
+      auto fb = batch->fields[i].release();
+
+      // Pack the TileDB validity bytes into an Arrow bitmap, which can be
+      // omitted if there are no nulls.
+      int64_t null_count = 0;
+      if (field.nullable) {
+        auto validity = static_cast<const uint8_t*>(fb->validity.get());
+        for (uint64_t c = 0; c < cell_num; c++)
+          null_count += validity[c] == 0;
+
+        if (null_count > 0) {
+          const uint64_t bitmap_size = (cell_num + 7) / 8;
+          fb->bitmap = arrow_buffer_alloc(bitmap_size);
+          auto bitmap = static_cast<uint8_t*>(fb->bitmap.get());
+          std::memset(bitmap, 0, bitmap_size);
+          for (uint64_t c = 0; c < cell_num; c++)
+            bitmap[c / 8] |= uint8_t(validity[c] != 0) << (c % 8);
+        }
+        fb->validity.reset();
+      }
+
+      fb->buffers[0] = fb->bitmap.get();
+      if (field.is_var) {
+        fb->buffers[1] = fb->offsets.get();
+        fb->buffers[2] = fb->data.get();
+      } else {
+        fb->buffers[1] = fb->data.get();
+      }
+
+      ArrowArray& child = batch->child_arrays[i];
+      child.length = static_cast<int64_t>(cell_num);
+      child.null_count = null_count;
+      child.offset = 0;
+      child.n_buffers = field.is_var ? 3 : 2;
+      child.n_children = 0;
+      child.buffers = fb->buffers;
+      child.children = nullptr;
+      child.dictionary = nullptr;
+      child.release = [](ArrowArray* array_p) {
+        delete static_cast<ArrowStreamFieldBatch*>(array_p->private_data);
+        array_p->release = nullptr;
+      };
+      child.private_data = fb;
+      batch->children[i] = &child;
+    }
+    batch->fields.clear();
+
+    out->length = static_cast<int64_t>(cell_num);
+    out->null_count = 0;
+    out->offset = 0;
+    out->n_buffers = 1;
+    out->n_children = static_cast<int64_t>(fields_.size());
+    out->buffers = batch->buffers;
+    out->children = batch->children.data();
+    out->dictionary = nullptr;
+    out->release = [](ArrowArray* array_p) {
+      // Release the children that were not moved out by the consumer
+      for (int64_t i = 0; i < array_p->n_children; i++) {
+        ArrowArray* child = array_p->children[i];
+        if (child->release != nullptr)
+          child->release(child);
+      }
+      delete static_cast<ArrowStreamBatch*>(array_p->private_data);
+      array_p->release = nullptr;
+    };
+    out->private_data = batch.release();
+  }
+};
+
 /* End TileDB Arrow IO internal implementation */
 /* ************************************************************************ */
 
@@ -832,6 +1289,23 @@ void query_get_buffer_arrow_array(
   exporter.export_(name, (ArrowArray*)v_arw_array, (ArrowSchema*)v_arw_schema);
 }
 
+void query_export_arrow_stream(
+    Context* const ctx,
+    Query* const query,
+    const std::vector<std::string>& names,
+    void* arrow_stream,
+    uint64_t batch_size,
+    bool read_ahead) {
+  if (arrow_stream == nullptr)
+    throw tiledb::TileDBError(
+        "[TileDB-Arrow]: received invalid pointer to output stream.");
+
+  auto reader = std::make_unique<ArrowStreamReader>(
+      ctx, query, names, batch_size, read_ahead);
+  ArrowStreamReader::export_stream(
+      std::move(reader), static_cast<ArrowArrayStream*>(arrow_stream));
+}
+
 void query_set_buffer_arrow_array(
     Query* const query,
     std::string name,
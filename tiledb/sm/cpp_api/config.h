@@ -289,9 +289,33 @@ class Config {
    *    Checks if the coordinates obey the global array order. Applicable only
    *    to sparse writes in global order.
    *    **Default**: true
+   * - `sm.persist_hilbert_values` <br>
+   *    If `true`, unordered sparse writes to arrays with Hilbert cell order
+   *    store the Hilbert value of each cell in the fragment, so that reads in
+   *    global order do not have to recompute them. <br>
+   *    **Default**: false
    * - `sm.tile_cache_size` <br>
    *    The tile cache size in bytes. Any `uint64_t` value is acceptable. <br>
    *    **Default**: 10,000,000
+   * - `sm.rtree_page_cache_size` <br>
+   *    The size in bytes of the cache of R-tree leaf pages, shared by the
+   *    fragments whose R-tree is loaded on demand in pages. Any `uint64_t`
+   *    value is acceptable. <br>
+   *    **Default**: 100,000,000
+   * - `sm.rtree_packing` <br>
+   *    How the leaf MBRs of the R-trees of new sparse fragments are grouped
+   *    into nodes. `sequential` groups consecutive tiles, `str` uses
+   *    Sort-Tile-Recursive packing and `hilbert` sorts the MBRs on the
+   *    Hilbert value of their centers. <br>
+   *    **Default**: sequential
+   * - `sm.bloom_filter_bits_per_cell` <br>
+   *    The number of bits per cell of the per-tile Bloom filters built for
+   *    the dimensions and attributes of new sparse fragments, which let
+   *    readers skip tiles for point ranges and equality query conditions.
+   *    Floating point and multi-value fixed-size fields get no Bloom
+   *    filters. 10 bits per cell give about 1% false positives. `0` disables
+   *    the Bloom filters. <br>
+   *    **Default**: 0
    * - `sm.array_schema_cache_size` <br>
    *    Array schema cache size in bytes. Any `uint64_t` value is acceptable.
    *    <br>
@@ -306,13 +330,26 @@ class Config {
    * - `sm.io_concurrency_level` <br>
    *    Upper-bound on number of threads to allocate for IO-bound tasks. <br>
    *    **Default*: # cores
+   * - `sm.io_concurrency_adaptive` <br>
+   *    If `true`, the number of threads running IO-bound tasks adapts
+   *    between `sm.io_concurrency_level_min` and `sm.io_concurrency_level`,
+   *    growing while tasks are queued and throughput improves, and shrinking
+   *    when more threads reduce throughput. Idle IO threads also run
+   *    compute-bound tasks when all compute threads are busy. The current
+   *    level is reported in the stats as `io_concurrency_level`. <br>
+   *    **Default**: false
+   * - `sm.io_concurrency_level_min` <br>
+   *    The minimum number of threads running IO-bound tasks when
+   *    `sm.io_concurrency_adaptive` is `true`. <br>
+   *    **Default**: 1
    * - `sm.vacuum.mode` <br>
    *    The vacuuming mode, one of
    *    `commits` (remove only consolidated commit files),
    *    `fragments` (remove only consolidated fragments),
    *    `fragment_meta` (remove only consolidated fragment metadata),
-   *    `array_meta` (remove only consolidated array metadata files), or
-   *    `group_meta` (remove only consolidate group metadata only).
+   *    `array_meta` (remove only consolidated array metadata files),
+   *    `group_meta` (remove only consolidate group metadata only), or
+   *    `delete_vectors` (remove only superseded or orphaned delete vectors).
    *    <br>
    *    **Default**: "fragments"
    * - `sm.consolidation_mode` <br>
@@ -320,8 +357,10 @@ class Config {
    *    `commits` (consolidate all commit files),
    *    `fragments` (consolidate all fragments),
    *    `fragment_meta` (consolidate only fragment metadata footers to a single
-   * file), `array_meta` (consolidate array metadata only), or `group_meta`
-   * (consolidate group metadata only). <br>
+   * file), `array_meta` (consolidate array metadata only), `group_meta`
+   * (consolidate group metadata only), or `delete_vectors` (evaluate the
+   * delete conditions once per fragment and persist the deleted cells as
+   * delete vectors that readers use instead of the conditions). <br>
    *    **Default**: "fragments"
    * - `sm.consolidation.amplification` <br>
    *    The factor by which the size of the dense fragment resulting
@@ -383,8 +422,14 @@ class Config {
    *    attributes which will point to the end of the values buffer.<br>
    *    **Default**: false
    * - `sm.var_offsets.mode` <br>
-   *    The offsets format (`bytes` or `elements`) to be used for
-   *    var-sized attributes.<br>
+   *    The offsets format (`bytes`, `elements` or `views`) to be used for
+   *    var-sized attributes. `views` returns a 16-byte view per cell (32-bit
+   *    size, then either the data inlined if it fits in 12 bytes, or a
+   *    4-byte prefix, a 32-bit buffer index and a 32-bit offset in that
+   *    buffer). The buffers are retrieved with
+   *    `QueryExperimental::get_view_buffers` and are valid until the next
+   *    submit, no data is copied to the var buffer. `views` is only
+   *    supported by the refactored readers.<br>
    *    **Default**: bytes
    * - `sm.query.dense.reader` <br>
    *    Which reader to use for dense queries. "refactored" or "legacy".<br>
@@ -449,6 +494,12 @@ class Config {
    *    The the total maximum size of the read-ahead cache, which is an LRU.
    *    <br>
    *    **Default**: 10485760
+   * -  `vfs.read_ahead_max_size` <br>
+   *    The maximum size of the read-ahead window. The window starts at
+   *    `vfs.read_ahead_size` and doubles for every read that continues a
+   *    sequential pattern on a file, up to this size. Sequential reads also
+   *    prefetch the next window asynchronously. <br>
+   *    **Default**: 1638400
    * - `vfs.min_parallel_size` <br>
    *    The minimum number of bytes in a parallel VFS operation
    *    (except parallel S3 writes, which are controlled by
@@ -737,6 +788,16 @@ class Config {
    * - `rest.curl.buffer_size` <br>
    *    Set curl buffer size for REST requests <br>
    *    **Default**: 524288 (512KB)
+   * - `rest.curl.http2` <br>
+   *    If `true`, negotiate HTTP/2 with the REST server, falling back to
+   *    HTTP/1.1 if the server or libcurl does not support it. <br>
+   *    **Default**: false
+   * - `rest.curl.pool_size` <br>
+   *    The maximum number of idle curl handles kept per context for REST
+   *    requests. Idle handles keep their connections to the REST server
+   *    open, so later requests can skip the TCP and TLS handshakes. `0`
+   *    closes the connections after every request. <br>
+   *    **Default**: 16
    * - `filestore.buffer_size` <br>
    *    Specifies the size in bytes of the internal buffers used in the
    *    filestore API. The size should be bigger than the minimum tile size
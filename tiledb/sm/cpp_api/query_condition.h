@@ -38,6 +38,7 @@
 
 #include <string>
 #include <type_traits>
+#include <vector>
 
 namespace tiledb {
 
@@ -168,6 +169,53 @@ class QueryCondition {
         op));
   }
 
+  /**
+   * Initializes a TileDB query condition object with a set membership
+   * operation, testing each cell value against a set of values. As for
+   * `TILEDB_NE` against a non-null value, null cells are selected by neither
+   * `TILEDB_IN` nor `TILEDB_NOT_IN`.
+   *
+   * **Example:**
+   *
+   * @code{.cpp}
+   * std::vector<int> values = {1, 5, 7};
+   * std::vector<uint64_t> offsets = {0, 4, 8};
+   * tiledb::QueryCondition qc(ctx);
+   * qc.init_set_membership(
+   *     "a1",
+   *     values.data(),
+   *     values.size() * sizeof(int),
+   *     offsets.data(),
+   *     offsets.size() * sizeof(uint64_t),
+   *     TILEDB_IN);
+   * @endcode
+   *
+   * @param attribute_name The name of the attribute to compare against.
+   * @param data The set values, concatenated.
+   * @param data_size The byte size of `data`.
+   * @param offsets The starting offsets of the values in `data`.
+   * @param offsets_size The byte size of `offsets`.
+   * @param op The set membership operation, `TILEDB_IN` or `TILEDB_NOT_IN`.
+   */
+  void init_set_membership(
+      const std::string& attribute_name,
+      const void* data,
+      uint64_t data_size,
+      const uint64_t* offsets,
+      uint64_t offsets_size,
+      tiledb_query_condition_op_t op) {
+    auto& ctx = ctx_.get();
+    ctx.handle_error(tiledb_query_condition_init_set_membership(
+        ctx.ptr().get(),
+        query_condition_.get(),
+        attribute_name.c_str(),
+        data,
+        data_size,
+        offsets,
+        offsets_size,
+        op));
+  }
+
   /** Returns a shared pointer to the C TileDB query condition object. */
   std::shared_ptr<tiledb_query_condition_t> ptr() const {
     return query_condition_;
@@ -274,6 +322,88 @@ class QueryCondition {
     return qc;
   }
 
+  /**
+   * Factory function for creating a new set membership query condition with
+   * a string datatype.
+   *
+   * **Example:**
+   * @code{.cpp}
+   * tiledb::Context ctx;
+   * std::vector<std::string> values = {"foo", "bar"};
+   * auto a1 = tiledb::QueryCondition::create(ctx, "a1", values, TILEDB_IN);
+   * @endcode
+   *
+   * @param ctx The TileDB context.
+   * @param name The attribute name.
+   * @param values The set of values to compare against.
+   * @param op The set membership operator.
+   * @return A new QueryCondition object.
+   */
+  static QueryCondition create(
+      const Context& ctx,
+      const std::string& attribute_name,
+      const std::vector<std::string>& values,
+      tiledb_query_condition_op_t op) {
+    std::string data;
+    std::vector<uint64_t> offsets;
+    offsets.reserve(values.size());
+    for (const auto& value : values) {
+      offsets.push_back(data.size());
+      data += value;
+    }
+
+    QueryCondition qc(ctx);
+    qc.init_set_membership(
+        attribute_name,
+        data.data(),
+        data.size(),
+        offsets.data(),
+        offsets.size() * sizeof(uint64_t),
+        op);
+    return qc;
+  }
+
+  /**
+   * Factory function for creating a new set membership query condition with
+   * datatype T.
+   *
+   * **Example:**
+   * @code{.cpp}
+   * tiledb::Context ctx;
+   * std::vector<int> values = {1, 5, 7};
+   * auto a1 = tiledb::QueryCondition::create(ctx, "a1", values, TILEDB_IN);
+   * @endcode
+   *
+   * @tparam T Datatype of the attribute, an arithmetic type.
+   * @param ctx The TileDB context.
+   * @param name The attribute name.
+   * @param values The set of values to compare against.
+   * @param op The set membership operator.
+   * @return A new QueryCondition object.
+   */
+  template <typename T>
+  static QueryCondition create(
+      const Context& ctx,
+      const std::string& attribute_name,
+      const std::vector<T>& values,
+      tiledb_query_condition_op_t op) {
+    static_assert(std::is_arithmetic_v<T>, "T must be an arithmetic type");
+    std::vector<uint64_t> offsets(values.size());
+    for (uint64_t i = 0; i < offsets.size(); i++) {
+      offsets[i] = i * sizeof(T);
+    }
+
+    QueryCondition qc(ctx);
+    qc.init_set_membership(
+        attribute_name,
+        values.data(),
+        values.size() * sizeof(T),
+        offsets.data(),
+        offsets.size() * sizeof(uint64_t),
+        op);
+    return qc;
+  }
+
  private:
   /* ********************************* */
   /*         PRIVATE ATTRIBUTES        */
@@ -35,6 +35,10 @@
 #include "context.h"
 #include "tiledb.h"
 
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace tiledb {
 class QueryExperimental {
  public:
@@ -52,6 +56,36 @@ class QueryExperimental {
         ctx.ptr().get(), query.ptr().get(), &relevant_fragment_num));
     return relevant_fragment_num;
   }
+
+  /**
+   * Get the buffers the views of a var-sized field point into, after a read
+   * with `sm.var_offsets.mode` set to `views`. A view that does not inline
+   * its data points into the buffer at its buffer index. The buffers are
+   * valid until the next submit of the query.
+   *
+   * @param ctx TileDB context.
+   * @param query Query object.
+   * @param name Field name.
+   * @return The pointer and size of each buffer, by buffer index.
+   */
+  static std::vector<std::pair<const void*, uint64_t>> get_view_buffers(
+      Context& ctx, const Query& query, const std::string& name) {
+    uint64_t num = 0;
+    ctx.handle_error(tiledb_query_get_view_buffer_num(
+        ctx.ptr().get(), query.ptr().get(), name.c_str(), &num));
+
+    std::vector<std::pair<const void*, uint64_t>> buffers(num);
+    for (uint64_t i = 0; i < num; i++) {
+      ctx.handle_error(tiledb_query_get_view_buffer(
+          ctx.ptr().get(),
+          query.ptr().get(),
+          name.c_str(),
+          i,
+          &buffers[i].first,
+          &buffers[i].second));
+    }
+    return buffers;
+  }
 };
 }  // namespace tiledb
 
@@ -90,6 +90,8 @@ inline const std::string& filter_type_str(FilterType filter_type) {
       return constants::filter_dictionary_str;
     case FilterType::FILTER_SCALE_FLOAT:
       return constants::filter_scale_float_str;
+    case FilterType::FILTER_BITMAP:
+      return constants::filter_bitmap_str;
     default:
       return constants::empty_str;
   }
@@ -128,21 +130,23 @@ inline Status filter_type_enum(
     *filter_type = FilterType::FILTER_DICTIONARY;
   else if (filter_type_str == constants::filter_scale_float_str)
     *filter_type = FilterType::FILTER_SCALE_FLOAT;
+  else if (filter_type_str == constants::filter_bitmap_str)
+    *filter_type = FilterType::FILTER_BITMAP;
   else {
     return Status_Error("Invalid FilterType " + filter_type_str);
   }
   return Status::Ok();
 }
 
-/** Throws error if the input Filtertype enum is not between 0 and 15. */
+/** Throws error if the input Filtertype enum is not between 0 and 16. */
 inline void ensure_filtertype_is_valid(uint8_t type) {
-  if (type > 15) {
+  if (type > 16) {
     throw std::runtime_error(
         "Invalid FilterType (" + std::to_string(type) + ")");
   }
 }
 
-/** Throws error if the input Filtertype's enum is not between 0 and 14. */
+/** Throws error if the input Filtertype's enum is not between 0 and 16. */
 inline void ensure_filtertype_is_valid(FilterType type) {
   ensure_filtertype_is_valid(::stdx::to_underlying(type));
 }
@@ -68,6 +68,10 @@ inline const std::string& query_condition_op_str(
       return constants::query_condition_op_eq_str;
     case QueryConditionOp::NE:
       return constants::query_condition_op_ne_str;
+    case QueryConditionOp::IN:
+      return constants::query_condition_op_in_str;
+    case QueryConditionOp::NOT_IN:
+      return constants::query_condition_op_not_in_str;
     default:
       return constants::empty_str;
   }
@@ -89,6 +93,10 @@ inline Status query_condition_op_enum(
     *query_condition_op = QueryConditionOp::EQ;
   else if (query_condition_op_str == constants::query_condition_op_ne_str)
     *query_condition_op = QueryConditionOp::NE;
+  else if (query_condition_op_str == constants::query_condition_op_in_str)
+    *query_condition_op = QueryConditionOp::IN;
+  else if (query_condition_op_str == constants::query_condition_op_not_in_str)
+    *query_condition_op = QueryConditionOp::NOT_IN;
   else {
     return Status_Error("Invalid QueryConditionOp " + query_condition_op_str);
   }
@@ -97,7 +105,7 @@ inline Status query_condition_op_enum(
 
 inline void ensure_qc_op_is_valid(QueryConditionOp query_condition_op) {
   auto qc_op_enum{::stdx::to_underlying(query_condition_op)};
-  if (qc_op_enum > 5) {
+  if (qc_op_enum > 7) {
     throw std::runtime_error(
         "Invalid Query Condition Op " + std::to_string(qc_op_enum));
   }
@@ -113,6 +121,11 @@ inline void ensure_qc_op_string_is_valid(const std::string& qc_op_str) {
   ensure_qc_op_is_valid(qc_op);
 }
 
+/** Returns true if the op tests membership in a set of values. */
+constexpr bool is_set_membership_op(const QueryConditionOp op) {
+  return op == QueryConditionOp::IN || op == QueryConditionOp::NOT_IN;
+}
+
 /** Returns the negated op given a query condition op. */
 inline QueryConditionOp negate_query_condition_op(const QueryConditionOp op) {
   switch (op) {
@@ -134,6 +147,12 @@ inline QueryConditionOp negate_query_condition_op(const QueryConditionOp op) {
     case QueryConditionOp::EQ:
       return QueryConditionOp::NE;
 
+    case QueryConditionOp::IN:
+      return QueryConditionOp::NOT_IN;
+
+    case QueryConditionOp::NOT_IN:
+      return QueryConditionOp::IN;
+
     default:
       throw std::runtime_error("negate_query_condition_op: Invalid op.");
   }
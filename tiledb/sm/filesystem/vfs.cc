@@ -43,7 +43,9 @@
 #include "tiledb/sm/stats/global_stats.h"
 #include "tiledb/sm/tile/tile.h"
 
+#include <chrono>
 #include <iostream>
+#include <limits>
 #include <list>
 #include <sstream>
 #include <unordered_map>
@@ -62,8 +64,10 @@ VFS::VFS()
     : stats_(nullptr)
     , init_(false)
     , read_ahead_size_(0)
+    , read_ahead_max_size_(0)
     , compute_tp_(nullptr)
-    , io_tp_(nullptr) {
+    , io_tp_(nullptr)
+    , read_throughput_(0) {
 #ifdef HAVE_AZURE
   supported_fs_.insert(Filesystem::AZURE);
 #endif
@@ -753,19 +757,27 @@ Status VFS::init(
   if (vfs_config)
     config_.inherit(*vfs_config);
 
-  // Construct the read-ahead cache.
+  // Store the read-ahead sizes. The window never shrinks below a block.
   bool found = false;
-  uint64_t read_ahead_cache_size = 0;
+  RETURN_NOT_OK(
+      config_.get<uint64_t>("vfs.read_ahead_size", &read_ahead_size_, &found));
+  assert(found);
   RETURN_NOT_OK(config_.get<uint64_t>(
-      "vfs.read_ahead_cache_size", &read_ahead_cache_size, &found));
+      "vfs.read_ahead_max_size", &read_ahead_max_size_, &found));
   assert(found);
-  read_ahead_cache_ = tdb_unique_ptr<ReadAheadCache>(
-      tdb_new(ReadAheadCache, read_ahead_cache_size));
+  read_ahead_max_size_ = std::max(read_ahead_max_size_, read_ahead_size_);
 
-  // Store the read-ahead size.
-  RETURN_NOT_OK(
-      config_.get<uint64_t>("vfs.read_ahead_size", &read_ahead_size_, &found));
+  // Construct the read-ahead cache.
+  uint64_t read_ahead_cache_size = 0;
+  RETURN_NOT_OK(config_.get<uint64_t>(
+      "vfs.read_ahead_cache_size", &read_ahead_cache_size, &found));
   assert(found);
+  read_ahead_cache_ = tdb_unique_ptr<ReadAheadCache>(tdb_new(
+      ReadAheadCache,
+      read_ahead_cache_size,
+      read_ahead_size_,
+      read_ahead_max_size_,
+      stats_));
 
 #ifdef HAVE_HDFS
   hdfs_ = tdb_unique_ptr<hdfs::HDFS>(tdb_new(hdfs::HDFS));
@@ -805,6 +817,10 @@ Status VFS::init(
 }
 
 Status VFS::terminate() {
+  // Wait for any outstanding read-ahead prefetches.
+  if (init_)
+    cancelable_tasks_.cancel_all_tasks();
+
 #ifdef HAVE_S3
   return s3_.disconnect();
 #endif
@@ -1413,54 +1429,106 @@ Status VFS::read_ahead_impl(
   uint64_t nbytes_read = 0;
 
   // Do not use the read-ahead cache if disabled by the caller.
-  if (!use_read_ahead)
+  if (!use_read_ahead || read_ahead_size_ == 0)
     return read_fn(uri, offset, buffer, nbytes, 0, &nbytes_read);
 
-  // Only perform a read-ahead if the requested read size
-  // is smaller than the size of the buffers in the read-ahead
-  // cache. This is because:
+  // Only use the read-ahead cache if the requested read size is smaller
+  // than the largest read-ahead window. This is because:
   // 1. The read-ahead is primarily beneficial for IO patterns
-  //    that consist of numerous small reads.
+  //    that consist of numerous small or sequential reads.
   // 2. Large reads may evict cached buffers that would be useful
   //    to a future small read.
   // 3. It saves us a copy. We must make a copy of the buffer at
   //    some point (one for the user, one for the cache).
-  if (nbytes >= read_ahead_size_)
+  if (nbytes == 0 || nbytes >= read_ahead_max_size_)
     return read_fn(uri, offset, buffer, nbytes, 0, &nbytes_read);
 
-  // Avoid a read if the requested buffer can be read from the
+  // Avoid a read if the requested range can be read from the
   // read cache. Note that we intentionally do not use a read
   // cache for local files because we rely on the operating
   // system's file system to cache readahead data in memory.
   // Additionally, we do not perform readahead with HDFS.
-  bool success;
-  RETURN_NOT_OK(read_ahead_cache_->read(uri, offset, buffer, nbytes, &success));
-  if (success)
-    return Status::Ok();
-
-  // We will read directly into the read-ahead buffer and then copy
-  // the subrange of this buffer back to the user to satisfy the
-  // read request.
-  Buffer ra_buffer;
-  RETURN_NOT_OK(ra_buffer.realloc(read_ahead_size_));
+  bool hit;
+  RETURN_NOT_OK(read_ahead_cache_->read(uri, offset, buffer, nbytes, &hit));
+  stats_->add_counter(hit ? "read_ahead_hit_num" : "read_ahead_miss_num", 1);
+
+  // Update the access pattern of `uri` and determine the I/O to perform.
+  // The file size is not looked up, as it costs a request on object
+  // stores. The I/O is clamped to it once a short read has revealed it.
+  const ReadAheadPlan plan = read_ahead_cache_->plan(uri, offset, nbytes, hit);
+
+  if (!hit) {
+    // We will read the whole window, starting at the block containing
+    // `offset`, directly into the read-ahead buffer and then copy the
+    // subrange of this buffer back to the user to satisfy the read request.
+    assert(plan.read_offset_ <= offset);
+    Buffer ra_buffer;
+    RETURN_NOT_OK(ra_buffer.realloc(plan.read_nbytes_));
+
+    // Only the bytes up to the end of the request are required, the rest
+    // of the window may extend past the end of the file.
+    const uint64_t offset_in_buffer = offset - plan.read_offset_;
+    const uint64_t required_nbytes = offset_in_buffer + nbytes;
+    assert(plan.read_nbytes_ >= required_nbytes);
+    RETURN_NOT_OK(read_fn(
+        uri,
+        plan.read_offset_,
+        ra_buffer.data(),
+        required_nbytes,
+        plan.read_nbytes_ - required_nbytes,
+        &nbytes_read));
+
+    // A short read ends at the end of the file.
+    if (nbytes_read < plan.read_nbytes_)
+      read_ahead_cache_->set_file_size(uri, plan.read_offset_ + nbytes_read);
+
+    // Copy the requested read range back into the caller's output `buffer`.
+    assert(nbytes_read >= required_nbytes);
+    std::memcpy(
+        buffer,
+        static_cast<uint8_t*>(ra_buffer.data()) + offset_in_buffer,
+        nbytes);
+
+    // Cache the blocks of `ra_buffer`.
+    ra_buffer.set_size(nbytes_read);
+    RETURN_NOT_OK(read_ahead_cache_->insert(
+        uri, plan.read_offset_, std::move(ra_buffer), required_nbytes));
+  }
+
+  if (plan.prefetch_nbytes_ > 0)
+    prefetch(read_fn, uri, plan.prefetch_offset_, plan.prefetch_nbytes_);
 
-  // Calculate the exact number of bytes to populate `ra_buffer`
-  // with `read_ahead_size_` bytes.
-  const uint64_t ra_nbytes = read_ahead_size_ - nbytes;
-
-  // Read into `ra_buffer`.
-  RETURN_NOT_OK(
-      read_fn(uri, offset, ra_buffer.data(), nbytes, ra_nbytes, &nbytes_read));
-
-  // Copy the requested read range back into the caller's output `buffer`.
-  assert(nbytes_read >= nbytes);
-  std::memcpy(buffer, ra_buffer.data(), nbytes);
+  return Status::Ok();
+}
 
-  // Cache `ra_buffer` at `offset`.
-  ra_buffer.set_size(nbytes_read);
-  RETURN_NOT_OK(read_ahead_cache_->insert(uri, offset, std::move(ra_buffer)));
+void VFS::prefetch(
+    const std::function<Status(
+        const URI&, off_t, void*, uint64_t, uint64_t, uint64_t*)>& read_fn,
+    const URI& uri,
+    const uint64_t offset,
+    const uint64_t nbytes) {
+  assert(nbytes > 0);
+  auto task = cancelable_tasks_.execute(
+      io_tp_, [this, read_fn, uri, offset, nbytes]() {
+        Buffer ra_buffer;
+        RETURN_NOT_OK(ra_buffer.realloc(nbytes));
+
+        // Require a single byte so that a prefetch that only partially
+        // overlaps the end of the file still succeeds.
+        uint64_t nbytes_read = 0;
+        RETURN_NOT_OK(read_fn(
+            uri, offset, ra_buffer.data(), 1, nbytes - 1, &nbytes_read));
+        stats_->add_counter("read_ahead_prefetch_byte_num", nbytes_read);
+        if (nbytes_read < nbytes)
+          read_ahead_cache_->set_file_size(uri, offset + nbytes_read);
+
+        ra_buffer.set_size(nbytes_read);
+        return read_ahead_cache_->insert(uri, offset, std::move(ra_buffer), 0);
+      });
 
-  return Status::Ok();
+  // The prefetch is best-effort, the task is intentionally not waited on.
+  // Outstanding prefetches are waited on in `cancel_all_tasks`/`terminate`.
+  (void)task;
 }
 
 Status VFS::read_all(
@@ -1481,30 +1549,13 @@ Status VFS::read_all(
   std::vector<BatchedRead> batches;
   RETURN_NOT_OK(compute_read_batches(regions, &batches));
 
-  // Read all the batches and copy to the original destinations.
+  // Read all the batches into the original destinations.
   for (const auto& batch : batches) {
     URI uri_copy = uri;
     BatchedRead batch_copy = batch;
     auto task =
         thread_pool->execute([this, uri_copy, batch_copy, use_read_ahead]() {
-          Buffer buffer;
-          RETURN_NOT_OK(buffer.realloc(batch_copy.nbytes));
-          RETURN_NOT_OK(read(
-              uri_copy,
-              batch_copy.offset,
-              buffer.data(),
-              batch_copy.nbytes,
-              use_read_ahead));
-          // Parallel copy back into the individual destinations.
-          for (uint64_t i = 0; i < batch_copy.regions.size(); i++) {
-            const auto& region = batch_copy.regions[i];
-            uint64_t offset = std::get<0>(region);
-            void* dest = std::get<1>(region)->filtered_buffer().data();
-            uint64_t nbytes = std::get<2>(region);
-            std::memcpy(dest, buffer.data(offset - batch_copy.offset), nbytes);
-          }
-
-          return Status::Ok();
+          return read_batch(uri_copy, batch_copy, use_read_ahead);
         });
 
     tasks->push_back(std::move(task));
@@ -1548,6 +1599,173 @@ Status VFS::read_all_no_batching(
   return Status::Ok();
 }
 
+Status VFS::read_batch(
+    const URI& uri, const BatchedRead& batch, const bool use_read_ahead) {
+  stats_->add_counter("read_byte_num", batch.nbytes);
+
+  uint64_t max_ops = 0;
+  RETURN_NOT_OK(max_parallel_ops(uri, &max_ops));
+  uint64_t part_size = 0;
+  RETURN_NOT_OK(read_part_size(batch.nbytes, max_ops, &part_size));
+
+  // Reads landing directly in a destination tile, as tuples
+  // `(file_offset, dest, nbytes)`.
+  std::vector<tuple<uint64_t, void*, uint64_t>> direct_parts;
+
+  // Groups of small regions, read into a staging buffer.
+  std::vector<BatchedRead> staged_parts;
+
+  // Splits the region into direct reads of at most `part_size` bytes.
+  auto add_direct = [&](const tuple<uint64_t, Tile*, uint64_t>& region) {
+    const uint64_t offset = std::get<0>(region);
+    auto dest =
+        static_cast<char*>(std::get<1>(region)->filtered_buffer().data());
+    const uint64_t nbytes = std::get<2>(region);
+    const uint64_t num =
+        std::max(utils::math::ceil(nbytes, part_size), uint64_t(1));
+    const uint64_t piece_nbytes = utils::math::ceil(nbytes, num);
+    for (uint64_t begin = 0; begin < nbytes; begin += piece_nbytes) {
+      direct_parts.emplace_back(
+          offset + begin,
+          dest + begin,
+          std::min(piece_nbytes, nbytes - begin));
+    }
+  };
+
+  // A staged group of a single region needs no staging buffer.
+  auto add_staged = [&](BatchedRead&& group) {
+    if (group.regions.size() == 1)
+      add_direct(group.regions.front());
+    else
+      staged_parts.emplace_back(std::move(group));
+  };
+
+  optional<BatchedRead> group;
+  for (const auto& region : batch.regions) {
+    const uint64_t offset = std::get<0>(region);
+    const uint64_t nbytes = std::get<2>(region);
+    if (nbytes >= part_size) {
+      if (group.has_value()) {
+        add_staged(std::move(group.value()));
+        group.reset();
+      }
+      add_direct(region);
+    } else if (
+        group.has_value() && offset + nbytes - group->offset <= part_size) {
+      group->nbytes = offset + nbytes - group->offset;
+      group->regions.push_back(region);
+    } else {
+      if (group.has_value())
+        add_staged(std::move(group.value()));
+      group.emplace(region);
+    }
+  }
+  if (group.has_value())
+    add_staged(std::move(group.value()));
+
+  // Reads a staged group and copies back into the individual destinations.
+  auto read_staged = [this, &uri, use_read_ahead](const BatchedRead& part) {
+    Buffer buffer;
+    RETURN_NOT_OK(buffer.realloc(part.nbytes));
+    RETURN_NOT_OK(read_timed(
+        uri, part.offset, buffer.data(), part.nbytes, use_read_ahead));
+    for (const auto& region : part.regions) {
+      const uint64_t offset = std::get<0>(region);
+      void* dest = std::get<1>(region)->filtered_buffer().data();
+      const uint64_t nbytes = std::get<2>(region);
+      std::memcpy(dest, buffer.data(offset - part.offset), nbytes);
+    }
+    return Status::Ok();
+  };
+
+  // Execute inline if the batch is a single part.
+  const uint64_t num_parts = direct_parts.size() + staged_parts.size();
+  if (num_parts == 1) {
+    if (!direct_parts.empty()) {
+      const auto& part = direct_parts.front();
+      return read_timed(
+          uri,
+          std::get<0>(part),
+          std::get<1>(part),
+          std::get<2>(part),
+          use_read_ahead);
+    }
+    return read_staged(staged_parts.front());
+  }
+
+  // We don't want read-ahead when performing parallel reads.
+  std::vector<ThreadPool::Task> results;
+  results.reserve(num_parts);
+  for (const auto& part : direct_parts) {
+    results.push_back(cancelable_tasks_.execute(io_tp_, [this, &uri, part]() {
+      return read_timed(
+          uri, std::get<0>(part), std::get<1>(part), std::get<2>(part), false);
+    }));
+  }
+  for (const auto& part : staged_parts) {
+    results.push_back(cancelable_tasks_.execute(
+        io_tp_, [&read_staged, &part]() { return read_staged(part); }));
+  }
+
+  Status st = io_tp_->wait_all(results);
+  if (!st.ok()) {
+    std::stringstream errmsg;
+    errmsg << "VFS parallel read error '" << uri.to_string() << "'; "
+           << st.message();
+    return LOG_STATUS(Status_VFSError(errmsg.str()));
+  }
+  return st;
+}
+
+Status VFS::read_part_size(
+    const uint64_t nbytes, const uint64_t max_ops, uint64_t* part_size) const {
+  bool found;
+  uint64_t min_parallel_size = 0;
+  RETURN_NOT_OK(config_.get<uint64_t>(
+      "vfs.min_parallel_size", &min_parallel_size, &found));
+  assert(found);
+
+  // Parts that complete faster than the minimum part duration at the
+  // observed per-connection throughput are dominated by request latency.
+  uint64_t min_part_size = std::max(min_parallel_size, uint64_t(1));
+  const uint64_t throughput = read_throughput_.load();
+  if (throughput > 0) {
+    min_part_size = std::max(
+        min_part_size,
+        throughput * constants::vfs_read_part_min_duration_ms / 1000);
+  }
+
+  // Spread the batch over all available connections.
+  *part_size = std::max(
+      utils::math::ceil(nbytes, std::max(max_ops, uint64_t(1))),
+      min_part_size);
+  return Status::Ok();
+}
+
+Status VFS::read_timed(
+    const URI& uri,
+    const uint64_t offset,
+    void* const buffer,
+    const uint64_t nbytes,
+    const bool use_read_ahead) {
+  const auto start = std::chrono::steady_clock::now();
+  RETURN_NOT_OK(read_impl(uri, offset, buffer, nbytes, use_read_ahead));
+  if (nbytes < constants::vfs_throughput_sample_min_size)
+    return Status::Ok();
+
+  // Update the moving average with weight 1/4 for the new sample. Racing
+  // updates may drop a sample, which is harmless.
+  const uint64_t elapsed_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - start)
+          .count();
+  const uint64_t sample = nbytes * 1000000 / std::max(elapsed_us, uint64_t(1));
+  const uint64_t prev = read_throughput_.load();
+  read_throughput_.store(prev == 0 ? sample : (3 * prev + sample) / 4);
+
+  return Status::Ok();
+}
+
 Status VFS::compute_read_batches(
     const std::vector<tuple<uint64_t, Tile*, uint64_t>>& regions,
     std::vector<BatchedRead>* batches) const {
@@ -1825,5 +2043,239 @@ Status VFS::write(const URI& uri, const void* buffer, uint64_t buffer_size) {
       Status_VFSError("Unsupported URI schemes: " + uri.to_string()));
 }
 
+/* ********************************* */
+/*          READ-AHEAD CACHE         */
+/* ********************************* */
+
+VFS::ReadAheadCache::ReadAheadCache(
+    const uint64_t max_cached_bytes,
+    const uint64_t block_size,
+    const uint64_t max_window,
+    stats::Stats* const stats)
+    : LRUCache(max_cached_bytes)
+    , block_size_(block_size)
+    , max_window_(max_window)
+    , stats_(stats) {
+}
+
+uint64_t VFS::ReadAheadCache::block_size() const {
+  return block_size_;
+}
+
+Status VFS::ReadAheadCache::read(
+    const URI& uri,
+    const uint64_t offset,
+    void* const buffer,
+    const uint64_t nbytes,
+    bool* const success) {
+  assert(success);
+  assert(nbytes > 0);
+  *success = false;
+
+  // Store the URI's string representation.
+  const std::string uri_str = uri.to_string();
+
+  // Compute the keys of the blocks overlapping the requested range.
+  const uint64_t end = offset + nbytes;
+  const uint64_t first_block = offset / block_size_;
+  const uint64_t last_block = (end - 1) / block_size_;
+  std::vector<std::string> keys;
+  keys.reserve(last_block - first_block + 1);
+  for (uint64_t b = first_block; b <= last_block; ++b)
+    keys.emplace_back(block_key(uri_str, b));
+
+  // Protect access to the derived LRUCache routines.
+  std::lock_guard<std::mutex> lg(lru_mtx_);
+
+  // Check that every block is cached and holds the requested bytes. A block
+  // may be shorter than `block_size_` if it is the last block of the file.
+  for (uint64_t b = first_block; b <= last_block; ++b) {
+    const auto& key = keys[b - first_block];
+    if (!has_item(key))
+      return Status::Ok();
+
+    const uint64_t block_start = b * block_size_;
+    const uint64_t needed = std::min(end, block_start + block_size_);
+    if (block_start + get_item(key)->buffer_.size() < needed)
+      return Status::Ok();
+  }
+
+  // Copy the subrange of each cached block that overlaps the caller's
+  // read request back into their output `buffer`.
+  for (uint64_t b = first_block; b <= last_block; ++b) {
+    const auto& key = keys[b - first_block];
+    const ReadAheadBuffer* const ra_buffer = get_item(key);
+    const uint64_t block_start = b * block_size_;
+    const uint64_t from = std::max(offset, block_start);
+    const uint64_t to = std::min(end, block_start + block_size_);
+    std::memcpy(
+        static_cast<uint8_t*>(buffer) + (from - offset),
+        static_cast<uint8_t*>(ra_buffer->buffer_.data()) + (from - block_start),
+        to - from);
+    ra_buffer->used_ = true;
+
+    // Touch the item to make it the most recently used item.
+    touch_item(key);
+  }
+
+  *success = true;
+  return Status::Ok();
+}
+
+Status VFS::ReadAheadCache::insert(
+    const URI& uri,
+    const uint64_t offset,
+    Buffer&& buffer,
+    const uint64_t used_nbytes) {
+  assert(offset % block_size_ == 0);
+  const std::string uri_str = uri.to_string();
+  const uint64_t size = buffer.size();
+  const uint64_t first_block = offset / block_size_;
+
+  // Protect access to the derived LRUCache routines.
+  std::lock_guard<std::mutex> lg(lru_mtx_);
+
+  // Avoid a copy if the buffer fits in a single block.
+  if (size <= block_size_) {
+    ReadAheadBuffer ra_buffer(offset, std::move(buffer), used_nbytes > 0);
+    return LRUCache::insert(
+        block_key(uri_str, first_block), std::move(ra_buffer), size, false);
+  }
+
+  for (uint64_t pos = 0; pos < size; pos += block_size_) {
+    const uint64_t block_nbytes = std::min(block_size_, size - pos);
+    Buffer block;
+    RETURN_NOT_OK(block.write(
+        static_cast<uint8_t*>(buffer.data()) + pos, block_nbytes));
+    ReadAheadBuffer ra_buffer(
+        offset + pos, std::move(block), pos < used_nbytes);
+    RETURN_NOT_OK(LRUCache::insert(
+        block_key(uri_str, first_block + pos / block_size_),
+        std::move(ra_buffer),
+        block_nbytes,
+        false));
+  }
+
+  return Status::Ok();
+}
+
+VFS::ReadAheadPlan VFS::ReadAheadCache::plan(
+    const URI& uri,
+    const uint64_t offset,
+    const uint64_t nbytes,
+    const bool hit) {
+  const uint64_t end = offset + nbytes;
+
+  // Protect access to `states_`.
+  std::lock_guard<std::mutex> lg(lru_mtx_);
+  auto& state = this->state(uri.to_string());
+
+  // The planned I/O never goes past the end of the file, but always covers
+  // the request itself.
+  const uint64_t limit =
+      state.file_size_.has_value() ?
+          std::max(end, state.file_size_.value()) :
+          std::numeric_limits<uint64_t>::max();
+
+  // A read is sequential if it starts at or after the end of the previous
+  // read on the same URI, and no further than one block past it. Sequential
+  // reads double the window, any other read (including a repeated read)
+  // resets it to a single block.
+  const bool sequential = state.window_ > 0 && offset >= state.next_offset_ &&
+                          offset <= state.next_offset_ + block_size_;
+  if (sequential) {
+    state.window_ = std::min(state.window_ * 2, max_window_);
+  } else {
+    state.window_ = block_size_;
+    state.prefetched_end_ = 0;
+  }
+  state.next_offset_ = end;
+
+  // On a miss, read the whole window starting at the block containing
+  // `offset`, extended to cover the request.
+  ReadAheadPlan plan;
+  const uint64_t block_start = offset / block_size_ * block_size_;
+  uint64_t covered_end = utils::math::ceil(end, block_size_) * block_size_;
+  if (!hit) {
+    covered_end = std::max(
+        covered_end,
+        utils::math::ceil(block_start + state.window_, block_size_) *
+            block_size_);
+    covered_end = std::min(covered_end, limit);
+    plan.read_offset_ = block_start;
+    plan.read_nbytes_ = covered_end - block_start;
+  }
+
+  // On a sequential read, prefetch the window following the covered range,
+  // skipping whatever has already been prefetched.
+  if (sequential) {
+    const uint64_t prefetch_start =
+        std::max(covered_end, state.prefetched_end_);
+    const uint64_t prefetch_end = std::min(
+        utils::math::ceil(covered_end + state.window_, block_size_) *
+            block_size_,
+        limit);
+    if (prefetch_start < prefetch_end) {
+      plan.prefetch_offset_ = prefetch_start;
+      plan.prefetch_nbytes_ = prefetch_end - prefetch_start;
+    }
+    state.prefetched_end_ = std::max(state.prefetched_end_, prefetch_end);
+  }
+
+  return plan;
+}
+
+void VFS::ReadAheadCache::set_file_size(
+    const URI& uri, const uint64_t file_size) {
+  // Protect access to `states_`.
+  std::lock_guard<std::mutex> lg(lru_mtx_);
+
+  auto it = states_.find(uri.to_string());
+  if (it != states_.end())
+    it->second.file_size_ = file_size;
+}
+
+optional<uint64_t> VFS::ReadAheadCache::file_size(const URI& uri) {
+  // Protect access to `states_`.
+  std::lock_guard<std::mutex> lg(lru_mtx_);
+
+  auto it = states_.find(uri.to_string());
+  if (it == states_.end())
+    return nullopt;
+
+  return it->second.file_size_;
+}
+
+void VFS::ReadAheadCache::on_evict(const LRUCacheItem& item) {
+  if (!item.object_.used_)
+    stats_->add_counter("read_ahead_wasted_byte_num", item.size_);
+}
+
+std::string VFS::ReadAheadCache::block_key(
+    const std::string& uri_str, const uint64_t block_idx) {
+  return uri_str + "#" + std::to_string(block_idx);
+}
+
+VFS::ReadAheadCache::ReadAheadState& VFS::ReadAheadCache::state(
+    const std::string& uri_str) {
+  auto it = states_.find(uri_str);
+  if (it != states_.end()) {
+    states_lru_.splice(
+        states_lru_.begin(), states_lru_, it->second.lru_it_);
+    return it->second;
+  }
+
+  // Stop tracking the least recently read URI.
+  if (states_.size() >= max_tracked_uris_) {
+    states_.erase(states_lru_.back());
+    states_lru_.pop_back();
+  }
+
+  states_lru_.push_front(uri_str);
+  auto& state = states_[uri_str];
+  state.lru_it_ = states_lru_.begin();
+  return state;
+}
+
 }  // namespace sm
 }  // namespace tiledb
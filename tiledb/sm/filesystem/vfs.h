@@ -33,10 +33,13 @@
 #ifndef TILEDB_VFS_H
 #define TILEDB_VFS_H
 
+#include <atomic>
 #include <functional>
 #include <list>
+#include <mutex>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "tiledb/common/common.h"
@@ -342,7 +345,10 @@ class VFS {
       bool use_read_ahead = true);
 
   /**
-   * Reads multiple regions from a file.
+   * Reads multiple regions from a file. Nearby regions are batched
+   * together, and large batches are further split into parallel ranged
+   * reads. Regions large enough to get their own ranged reads are read
+   * directly into their destination tiles, without a staging copy.
    *
    * @param uri The URI of the file.
    * @param regions The list of regions to read. Each region is a tuple
@@ -459,6 +465,11 @@ class VFS {
     std::vector<tuple<uint64_t, Tile*, uint64_t>> regions;
   };
 
+ public:
+  /* ********************************* */
+  /*         PUBLIC DATATYPES          */
+  /* ********************************* */
+
   /**
    * Represents a sub-range of data within a URI file at a
    * specific file offset.
@@ -469,15 +480,17 @@ class VFS {
     /* ********************************* */
 
     /** Value Constructor. */
-    ReadAheadBuffer(const uint64_t offset, Buffer&& buffer)
+    ReadAheadBuffer(const uint64_t offset, Buffer&& buffer, const bool used)
         : offset_(offset)
-        , buffer_(std::move(buffer)) {
+        , buffer_(std::move(buffer))
+        , used_(used) {
     }
 
     /** Move Constructor. */
     ReadAheadBuffer(ReadAheadBuffer&& other)
         : offset_(other.offset_)
-        , buffer_(std::move(other.buffer_)) {
+        , buffer_(std::move(other.buffer_))
+        , used_(other.used_) {
     }
 
     /* ********************************* */
@@ -488,6 +501,7 @@ class VFS {
     ReadAheadBuffer& operator=(ReadAheadBuffer&& other) {
       offset_ = other.offset_;
       buffer_ = std::move(other.buffer_);
+      used_ = other.used_;
       return *this;
     }
 
@@ -502,21 +516,66 @@ class VFS {
 
     /** The buffered data at `offset`. */
     Buffer buffer_;
+
+    /**
+     * `true` if any byte of the buffer was returned to a caller. Buffers
+     * evicted without ever being used count as wasted read-ahead bytes.
+     */
+    mutable bool used_;
   };
 
   /**
-   * An LRU cache of `ReadAheadBuffer` objects keyed by a URI string.
+   * Describes the I/O the read-ahead cache wants performed for a single
+   * read request.
+   */
+  struct ReadAheadPlan {
+    /** The offset of the synchronous read, block-aligned. */
+    uint64_t read_offset_ = 0;
+
+    /** The size of the synchronous read, zero on a cache hit. */
+    uint64_t read_nbytes_ = 0;
+
+    /** The offset of the asynchronous prefetch, block-aligned. */
+    uint64_t prefetch_offset_ = 0;
+
+    /** The size of the asynchronous prefetch, zero if none. */
+    uint64_t prefetch_nbytes_ = 0;
+  };
+
+  /**
+   * An LRU cache of fixed-size, block-aligned `ReadAheadBuffer` objects.
+   * Each block is keyed by its URI and block index, so that any number of
+   * blocks of the same URI may be cached at once.
+   *
+   * The cache additionally tracks the access pattern of every URI. Reads
+   * that continue where the previous read on the same URI left off grow
+   * the read-ahead window (doubling up to a maximum size) and trigger an
+   * asynchronous prefetch of the following window. Any other read resets
+   * the window to a single block. The least recently read URIs stop being
+   * tracked once `max_tracked_uris_` URIs are.
    */
   class ReadAheadCache : public LRUCache<std::string, ReadAheadBuffer> {
    public:
+    /** The maximum number of URIs whose access pattern is tracked. */
+    static constexpr uint64_t max_tracked_uris_ = 1024;
+
     /* ********************************* */
     /*     CONSTRUCTORS & DESTRUCTORS    */
     /* ********************************* */
 
-    /** Constructor. */
-    ReadAheadCache(const uint64_t max_cached_buffers)
-        : LRUCache(max_cached_buffers) {
-    }
+    /**
+     * Constructor.
+     *
+     * @param max_cached_bytes The maximum size of all cached blocks.
+     * @param block_size The size of a cached block.
+     * @param max_window The maximum size of the read-ahead window.
+     * @param stats The VFS stats.
+     */
+    ReadAheadCache(
+        uint64_t max_cached_bytes,
+        uint64_t block_size,
+        uint64_t max_window,
+        stats::Stats* stats);
 
     /** Destructor. */
     virtual ~ReadAheadCache() = default;
@@ -525,93 +584,142 @@ class VFS {
     /*                API                */
     /* ********************************* */
 
+    /** Returns the size of a cached block. */
+    uint64_t block_size() const;
+
     /**
-     * Attempts to read a buffer from the cache.
+     * Attempts to read a range from the cache. The read succeeds only if
+     * all blocks overlapping the range are cached.
      *
-     * @param uri The URI associated with the buffer to cache.
-     * @param offset The offset that buffer starts at within the URI.
-     * @param buffer The buffer to cache.
-     * @param nbytes The number of bytes within the buffer.
+     * @param uri The URI to read from.
+     * @param offset The offset of the range within the URI.
+     * @param buffer The buffer to read into.
+     * @param nbytes The number of bytes to read.
      * @param success True if `buffer` was read from the cache.
      * @return Status
      */
     Status read(
         const URI& uri,
-        const uint64_t offset,
-        void* const buffer,
-        const uint64_t nbytes,
-        bool* const success) {
-      assert(success);
-      *success = false;
-
-      // Store the URI's string representation.
-      const std::string uri_str = uri.to_string();
-
-      // Protect access to the derived LRUCache routines.
-      std::lock_guard<std::mutex> lg(lru_mtx_);
-
-      // Check that a cached buffer exists for `uri`.
-      if (!has_item(uri_str))
-        return Status::Ok();
-
-      // Store a reference to the cached buffer.
-      const ReadAheadBuffer* const ra_buffer = get_item(uri_str);
-
-      // Check that the read offset is not below the offset of
-      // the cached buffer.
-      if (offset < ra_buffer->offset_)
-        return Status::Ok();
-
-      // Calculate the offset within the cached buffer that corresponds
-      // to the requested read offset.
-      const uint64_t offset_in_buffer = offset - ra_buffer->offset_;
-
-      // Check that both the start and end positions of the requested
-      // read range reside within the cached buffer.
-      if (offset_in_buffer + nbytes > ra_buffer->buffer_.size())
-        return Status::Ok();
-
-      // Copy the subrange of the cached buffer that satisfies the caller's
-      // read request back into their output `buffer`.
-      std::memcpy(
-          buffer,
-          static_cast<uint8_t*>(ra_buffer->buffer_.data()) + offset_in_buffer,
-          nbytes);
-
-      // Touch the item to make it the most recently used item.
-      touch_item(uri_str);
-
-      *success = true;
-      return Status::Ok();
-    }
+        uint64_t offset,
+        void* buffer,
+        uint64_t nbytes,
+        bool* success);
 
     /**
-     * Writes a cached buffer for the given uri.
+     * Splits the given buffer into blocks and caches them. Blocks that are
+     * already cached are left untouched.
      *
      * @param uri The URI associated with the buffer to cache.
-     * @param offset The offset that buffer starts at within the URI.
+     * @param offset The block-aligned offset of the buffer within the URI.
      * @param buffer The buffer to cache.
+     * @param used_nbytes The number of leading bytes of `buffer` that were
+     *     already returned to a caller.
      * @return Status
      */
-    Status insert(const URI& uri, const uint64_t offset, Buffer&& buffer) {
-      // Protect access to the derived LRUCache routines.
-      std::lock_guard<std::mutex> lg(lru_mtx_);
-
-      const uint64_t size = buffer.size();
-      ReadAheadBuffer ra_buffer(offset, std::move(buffer));
-      return LRUCache<std::string, ReadAheadBuffer>::insert(
-          uri.to_string(), std::move(ra_buffer), size);
-    }
+    Status insert(
+        const URI& uri, uint64_t offset, Buffer&& buffer, uint64_t used_nbytes);
+
+    /**
+     * Records a read request against the access pattern of `uri` and
+     * returns the I/O that should be performed for it. The read-ahead
+     * window and the prefetch never extend past the end of the file, once
+     * it is known.
+     *
+     * @param uri The URI being read.
+     * @param offset The offset of the read request.
+     * @param nbytes The size of the read request.
+     * @param hit `true` if the request was served from the cache.
+     * @return The planned I/O.
+     */
+    ReadAheadPlan plan(
+        const URI& uri, uint64_t offset, uint64_t nbytes, bool hit);
+
+    /**
+     * Records the size of the file at `uri`, as found by a read that
+     * returned less bytes than requested. Nothing is recorded if the URI
+     * is not tracked.
+     *
+     * @param uri The URI of the file.
+     * @param file_size The size of the file.
+     */
+    void set_file_size(const URI& uri, uint64_t file_size);
+
+    /**
+     * Returns the size of the file at `uri`, if it was recorded since the
+     * URI is tracked.
+     */
+    optional<uint64_t> file_size(const URI& uri);
+
+   protected:
+    /* ********************************* */
+    /*         PROTECTED METHODS         */
+    /* ********************************* */
+
+    /** Accounts for evicted blocks that were never read. */
+    void on_evict(const LRUCacheItem& item) override;
 
    private:
+    /* ********************************* */
+    /*      PRIVATE DATA STRUCTURES      */
+    /* ********************************* */
+
+    /** The access pattern state of a single URI. */
+    struct ReadAheadState {
+      /** The offset right after the end of the last read. */
+      uint64_t next_offset_ = 0;
+
+      /** The current read-ahead window, zero before the first read. */
+      uint64_t window_ = 0;
+
+      /** The end of the furthest range cached or being prefetched. */
+      uint64_t prefetched_end_ = 0;
+
+      /** The size of the file, if known. */
+      optional<uint64_t> file_size_;
+
+      /** The position of the URI in `states_lru_`. */
+      std::list<std::string>::iterator lru_it_;
+    };
+
     /* ********************************* */
     /*         PRIVATE ATTRIBUTES        */
     /* ********************************* */
 
-    // Protects LRUCache routines.
+    /** The size of a cached block. */
+    const uint64_t block_size_;
+
+    /** The maximum size of the read-ahead window. */
+    const uint64_t max_window_;
+
+    /** The VFS stats. */
+    stats::Stats* const stats_;
+
+    /** The access pattern state, keyed by URI string. */
+    std::unordered_map<std::string, ReadAheadState> states_;
+
+    /** The tracked URIs, the most recently read first. */
+    std::list<std::string> states_lru_;
+
+    // Protects LRUCache routines and `states_`.
     std::mutex lru_mtx_;
+
+    /* ********************************* */
+    /*          PRIVATE METHODS          */
+    /* ********************************* */
+
+    /** Returns the cache key of the given block of `uri_str`. */
+    static std::string block_key(
+        const std::string& uri_str, uint64_t block_idx);
+
+    /**
+     * Returns the access pattern state of `uri_str`, marking it as the most
+     * recently read and starting to track it if needed. Must be called with
+     * `lru_mtx_` held.
+     */
+    ReadAheadState& state(const std::string& uri_str);
   };
 
+ private:
   /* ********************************* */
   /*         PRIVATE ATTRIBUTES        */
   /* ********************************* */
@@ -650,9 +758,18 @@ class VFS {
   /** `true` if the VFS object has been initialized. */
   bool init_;
 
-  /** The byte size to read-ahead for each read. */
+  /**
+   * The byte size to read-ahead for each read. This is also the size of the
+   * blocks held in the read-ahead cache and the initial read-ahead window.
+   */
   uint64_t read_ahead_size_;
 
+  /**
+   * The maximum size the read-ahead window grows to for sequential reads.
+   * Reads of at least this size bypass the read-ahead cache.
+   */
+  uint64_t read_ahead_max_size_;
+
   /** The set with the supported filesystems. */
   std::set<Filesystem> supported_fs_;
 
@@ -668,6 +785,12 @@ class VFS {
   /** The read-ahead cache. */
   tdb_unique_ptr<ReadAheadCache> read_ahead_cache_;
 
+  /**
+   * Moving average of the observed per-connection read throughput, in
+   * bytes per second. Zero until the first sample.
+   */
+  std::atomic<uint64_t> read_throughput_;
+
   /* ********************************* */
   /*          PRIVATE METHODS          */
   /* ********************************* */
@@ -685,6 +808,54 @@ class VFS {
       const std::vector<tuple<uint64_t, Tile*, uint64_t>>& regions,
       std::vector<BatchedRead>* batches) const;
 
+  /**
+   * Reads a single batch, splitting it into ranged reads of at most
+   * `read_part_size` bytes that execute in parallel on the io thread pool.
+   * Regions of at least the part size are read directly into their
+   * destination tiles. Smaller regions are grouped into parts that are
+   * read into a staging buffer and copied out.
+   *
+   * @param uri The URI of the file.
+   * @param batch The batch to read.
+   * @param use_read_ahead Whether to use the read-ahead cache.
+   * @return Status
+   */
+  Status read_batch(
+      const URI& uri, const BatchedRead& batch, bool use_read_ahead);
+
+  /**
+   * Computes the size of the ranged reads a batch of `nbytes` bytes is
+   * split into. The batch is spread over `max_ops` connections, but every
+   * part is at least `vfs.min_parallel_size` bytes and large enough to take
+   * `constants::vfs_read_part_min_duration_ms` at the observed
+   * per-connection throughput.
+   *
+   * @param nbytes The size of the batch.
+   * @param max_ops The maximum number of parallel operations.
+   * @param part_size Set to the size of a part.
+   * @return Status
+   */
+  Status read_part_size(
+      uint64_t nbytes, uint64_t max_ops, uint64_t* part_size) const;
+
+  /**
+   * Reads from a file by calling `read_impl`, and samples the read
+   * throughput.
+   *
+   * @param uri The URI of the file.
+   * @param offset The offset where the read begins.
+   * @param buffer The buffer to read into.
+   * @param nbytes Number of bytes to read.
+   * @param use_read_ahead Whether to use the read-ahead cache.
+   * @return Status
+   */
+  Status read_timed(
+      const URI& uri,
+      uint64_t offset,
+      void* buffer,
+      uint64_t nbytes,
+      bool use_read_ahead);
+
   /**
    * Reads from a file by calling the specific backend read function.
    *
@@ -722,6 +893,23 @@ class VFS {
       const uint64_t nbytes,
       const bool use_read_ahead);
 
+  /**
+   * Asynchronously reads a range into the read-ahead cache on the io
+   * thread pool. This is best-effort: the task is not waited on and
+   * errors (e.g. prefetching past the end of the file) are ignored.
+   *
+   * @param read_fn The read routine to execute.
+   * @param uri The URI of the file.
+   * @param offset The block-aligned offset where the prefetch begins.
+   * @param nbytes Number of bytes to prefetch.
+   */
+  void prefetch(
+      const std::function<Status(
+          const URI&, off_t, void*, uint64_t, uint64_t, uint64_t*)>& read_fn,
+      const URI& uri,
+      uint64_t offset,
+      uint64_t nbytes);
+
   /**
    * Retrieves the backend-specific max number of parallel operations for VFS
    * read.
@@ -0,0 +1,209 @@
+/**
+ * @file   bitmap_filter.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class BitmapFilter.
+ */
+
+#include "tiledb/sm/filter/bitmap_filter.h"
+#include "tiledb/common/logger.h"
+#include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/enums/filter_type.h"
+#include "tiledb/sm/tile/tile.h"
+
+#include <cstring>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+BitmapFilter::BitmapFilter()
+    : Filter(FilterType::FILTER_BITMAP) {
+}
+
+BitmapFilter* BitmapFilter::clone_impl() const {
+  return new BitmapFilter;
+}
+
+void BitmapFilter::dump(FILE* out) const {
+  if (out == nullptr)
+    out = stdout;
+
+  fprintf(out, "Bitmap");
+}
+
+Status BitmapFilter::run_forward(
+    const Tile& tile,
+    Tile* const,  // offsets_tile,
+    FilterBuffer* input_metadata,
+    FilterBuffer* input,
+    FilterBuffer* output_metadata,
+    FilterBuffer* output) const {
+  auto tile_type = tile.type();
+  if (tile_type != Datatype::UINT8 && tile_type != Datatype::BOOL)
+    return LOG_STATUS(
+        Status_FilterError("Cannot filter; Unsupported input type"));
+
+  // Compute the output size
+  auto parts = input->buffers();
+  auto num_parts = (uint32_t)parts.size();
+  uint64_t output_size = 0;
+  for (const auto& part : parts)
+    output_size += (part.size() + 7) / 8;
+
+  RETURN_NOT_OK(output->prepend_buffer(output_size));
+  Buffer* output_buf = output->buffer_ptr(0);
+  assert(output_buf != nullptr);
+
+  // Write the metadata
+  uint32_t metadata_size = sizeof(uint32_t) + num_parts * sizeof(uint32_t);
+  RETURN_NOT_OK(output_metadata->append_view(input_metadata));
+  RETURN_NOT_OK(output_metadata->prepend_buffer(metadata_size));
+  RETURN_NOT_OK(output_metadata->write(&num_parts, sizeof(uint32_t)));
+
+  // Pack all parts
+  for (const auto& part : parts) {
+    auto part_size = (uint32_t)part.size();
+    RETURN_NOT_OK(output_metadata->write(&part_size, sizeof(uint32_t)));
+
+    auto packed_size = (part.size() + 7) / 8;
+    if (!pack(
+            static_cast<const uint8_t*>(part.data()),
+            part.size(),
+            static_cast<uint8_t*>(output_buf->cur_data())))
+      return LOG_STATUS(Status_FilterError(
+          "Cannot filter; BITMAP filter input must only hold 0 and 1 values"));
+
+    if (output_buf->owns_data())
+      output_buf->advance_size(packed_size);
+    output_buf->advance_offset(packed_size);
+  }
+
+  return Status::Ok();
+}
+
+Status BitmapFilter::run_reverse(
+    const Tile&,
+    Tile* const,
+    FilterBuffer* input_metadata,
+    FilterBuffer* input,
+    FilterBuffer* output_metadata,
+    FilterBuffer* output,
+    const Config& config) const {
+  (void)config;
+
+  // Get the part sizes
+  uint32_t num_parts;
+  RETURN_NOT_OK(input_metadata->read(&num_parts, sizeof(uint32_t)));
+  std::vector<uint32_t> part_sizes(num_parts);
+  uint64_t output_size = 0;
+  for (uint32_t i = 0; i < num_parts; i++) {
+    RETURN_NOT_OK(input_metadata->read(&part_sizes[i], sizeof(uint32_t)));
+    output_size += part_sizes[i];
+  }
+
+  RETURN_NOT_OK(output->prepend_buffer(output_size));
+  Buffer* output_buf = output->buffer_ptr(0);
+  assert(output_buf != nullptr);
+
+  for (auto part_size : part_sizes) {
+    auto packed_size = (part_size + 7) / 8;
+    ConstBuffer part(nullptr, 0);
+    RETURN_NOT_OK(input->get_const_buffer(packed_size, &part));
+
+    unpack(
+        static_cast<const uint8_t*>(part.data()),
+        part_size,
+        static_cast<uint8_t*>(output_buf->cur_data()));
+
+    if (output_buf->owns_data())
+      output_buf->advance_size(part_size);
+    output_buf->advance_offset(part_size);
+    input->advance_offset(packed_size);
+  }
+
+  // Output metadata is a view on the input metadata, skipping what was used
+  // by this filter.
+  auto md_offset = input_metadata->offset();
+  RETURN_NOT_OK(output_metadata->append_view(
+      input_metadata, md_offset, input_metadata->size() - md_offset));
+
+  return Status::Ok();
+}
+
+bool BitmapFilter::pack(
+    const uint8_t* bytemap, uint64_t size, uint8_t* bitmap) {
+  // Pack 8 bytes at a time: fold each byte onto its lowest bit, then gather
+  // the lowest bits of the 8 bytes into the top byte with a multiplication.
+  // Bits set above the lowest bit of any byte are accumulated in `high`.
+  const uint64_t word_num = size / 8;
+  uint64_t high = 0;
+  for (uint64_t w = 0; w < word_num; w++) {
+    uint64_t x;
+    std::memcpy(&x, bytemap + w * 8, sizeof(uint64_t));
+    high |= x & 0xfefefefefefefefeULL;
+    x |= x >> 4;
+    x |= x >> 2;
+    x |= x >> 1;
+    x &= 0x0101010101010101ULL;
+    bitmap[w] = (uint8_t)((x * 0x0102040810204080ULL) >> 56);
+  }
+
+  // Pack the remaining bytes
+  if (size % 8 != 0) {
+    uint8_t last = 0;
+    for (uint64_t i = word_num * 8; i < size; i++) {
+      high |= bytemap[i] & 0xfe;
+      last |= (uint8_t)((bytemap[i] != 0) << (i % 8));
+    }
+    bitmap[word_num] = last;
+  }
+
+  return high == 0;
+}
+
+void BitmapFilter::unpack(
+    const uint8_t* bitmap, uint64_t size, uint8_t* bytemap) {
+  // Unpack 8 bytes at a time: broadcast the bitmap byte to the 8 bytes of a
+  // word, keep bit `i` in byte `i`, then turn each non-zero byte into 1.
+  const uint64_t word_num = size / 8;
+  for (uint64_t w = 0; w < word_num; w++) {
+    uint64_t x = bitmap[w] * 0x0101010101010101ULL;
+    x &= 0x8040201008040201ULL;
+    x = ((x + 0x7f7f7f7f7f7f7f7fULL) >> 7) & 0x0101010101010101ULL;
+    std::memcpy(bytemap + w * 8, &x, sizeof(uint64_t));
+  }
+
+  // Unpack the remaining bytes
+  for (uint64_t i = word_num * 8; i < size; i++)
+    bytemap[i] = (bitmap[i / 8] >> (i % 8)) & 1;
+}
+
+}  // namespace sm
+}  // namespace tiledb
@@ -0,0 +1,137 @@
+/**
+ * @file   bitmap_filter.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares class BitmapFilter.
+ */
+
+#ifndef TILEDB_BITMAP_FILTER_H
+#define TILEDB_BITMAP_FILTER_H
+
+#include "tiledb/common/status.h"
+#include "tiledb/sm/filter/filter.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * A filter that packs a bytemap of 0 and 1 values into a bitmap with one bit
+ * per byte, in LSB order (i.e. the first byte maps to the least significant
+ * bit of the first bitmap byte, as in Arrow validity bitmaps). This reduces
+ * the size of validity tiles 8 times before compression.
+ *
+ * The filter applies to tiles of `UINT8` or `BOOL` cells, and must be the
+ * first filter of the pipeline. Bytes other than 0 and 1 cannot be restored
+ * and fail the forward direction.
+ *
+ * Only the stored tiles are packed: validity tiles are unpacked on read, so
+ * the validity vectors, the user validity buffers and the query condition
+ * null checks still operate on bytemaps.
+ *
+ * If the input comes in multiple FilterBuffer parts, each part is packed
+ * independently in the forward direction.
+ *
+ * Input metadata is not modified.
+ *
+ * The forward output metadata has the format:
+ *   uint32_t - Number of parts
+ *   uint32_t - Number of bytes of part0
+ *   ...
+ *   uint32_t - Number of bytes of partN
+ *
+ * The forward output data is the concatenated packed bits:
+ *   uint8_t[] - Packed bits of part0, padded with zeros to a byte
+ *   ...
+ *   uint8_t[] - Packed bits of partN, padded with zeros to a byte
+ *
+ * The reverse output data format is a bytemap of 0 and 1 values.
+ */
+class BitmapFilter : public Filter {
+ public:
+  /**
+   * Constructor.
+   */
+  BitmapFilter();
+
+  /** Dumps the filter details in ASCII format in the selected output. */
+  void dump(FILE* out) const override;
+
+  /**
+   * Pack the bytes of the input data into the output data buffer.
+   */
+  Status run_forward(
+      const Tile& tile,
+      Tile* const tile_offsets,
+      FilterBuffer* input_metadata,
+      FilterBuffer* input,
+      FilterBuffer* output_metadata,
+      FilterBuffer* output) const override;
+
+  /**
+   * Unpack the bits of the input data into the output data buffer.
+   */
+  Status run_reverse(
+      const Tile& tile,
+      Tile* const tile_offsets,
+      FilterBuffer* input_metadata,
+      FilterBuffer* input,
+      FilterBuffer* output_metadata,
+      FilterBuffer* output,
+      const Config& config) const override;
+
+  /**
+   * Packs a bytemap into a bitmap, in LSB order.
+   *
+   * @param bytemap The bytemap, where each non-zero byte is a set bit.
+   * @param size The number of bytes in `bytemap`.
+   * @param bitmap The output bitmap, of at least `(size + 7) / 8` bytes.
+   * @return `true` if `bytemap` only holds 0 and 1 values, i.e. if unpacking
+   *     `bitmap` restores it.
+   */
+  static bool pack(const uint8_t* bytemap, uint64_t size, uint8_t* bitmap);
+
+  /**
+   * Unpacks a bitmap, in LSB order, into a bytemap of 0 and 1 values.
+   *
+   * @param bitmap The bitmap.
+   * @param size The number of bytes to write in `bytemap`.
+   * @param bytemap The output bytemap.
+   */
+  static void unpack(const uint8_t* bitmap, uint64_t size, uint8_t* bytemap);
+
+ private:
+  /** Returns a new clone of this filter. */
+  BitmapFilter* clone_impl() const override;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_BITMAP_FILTER_H
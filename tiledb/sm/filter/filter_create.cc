@@ -33,6 +33,7 @@
 
 #include "filter_create.h"
 #include "bit_width_reduction_filter.h"
+#include "bitmap_filter.h"
 #include "bitshuffle_filter.h"
 #include "byteshuffle_filter.h"
 #include "checksum_md5_filter.h"
@@ -78,6 +79,8 @@ tiledb::sm::Filter* tiledb::sm::FilterCreate::make(FilterType type) {
       return tdb_new(tiledb::sm::ChecksumSHA256Filter);
     case tiledb::sm::FilterType::FILTER_SCALE_FLOAT:
       return tdb_new(tiledb::sm::FloatScalingFilter);
+    case tiledb::sm::FilterType::FILTER_BITMAP:
+      return tdb_new(tiledb::sm::BitmapFilter);
     default:
       throw StatusException(
           "FilterCreate",
@@ -138,6 +141,8 @@ shared_ptr<tiledb::sm::Filter> tiledb::sm::FilterCreate::deserialize(
       return make_shared<ChecksumMD5Filter>(HERE());
     case FilterType::FILTER_CHECKSUM_SHA256:
       return make_shared<ChecksumSHA256Filter>(HERE());
+    case FilterType::FILTER_BITMAP:
+      return make_shared<BitmapFilter>(HERE());
     case FilterType::FILTER_SCALE_FLOAT: {
       auto filter_config =
           deserializer.read<FloatScalingFilter::FilterConfig>();
@@ -489,7 +489,7 @@ Status FragmentInfo::get_mbr_num(uint32_t fid, uint64_t* mbr_num) {
 
   auto meta = single_fragment_info_vec_[fid].meta();
   RETURN_NOT_OK(meta->load_rtree(enc_key_));
-  *mbr_num = meta->mbrs().size();
+  *mbr_num = meta->mbr_num();
 
   return Status::Ok();
 }
@@ -510,13 +510,11 @@ Status FragmentInfo::get_mbr(
 
   auto meta = single_fragment_info_vec_[fid].meta();
   RETURN_NOT_OK(meta->load_rtree(enc_key_));
-  const auto& mbrs = meta->mbrs();
-
-  if (mid >= mbrs.size())
+  if (mid >= meta->mbr_num())
     return LOG_STATUS(
         Status_FragmentInfoError("Cannot get MBR; Invalid MBR index"));
 
-  const auto& minimum_bounding_rectangle = mbrs[mid];
+  const auto minimum_bounding_rectangle = meta->mbr(mid);
   if (did >= minimum_bounding_rectangle.size())
     return LOG_STATUS(
         Status_FragmentInfoError("Cannot get MBR; Invalid dimension index"));
@@ -590,13 +588,11 @@ Status FragmentInfo::get_mbr_var_size(
 
   auto meta = single_fragment_info_vec_[fid].meta();
   RETURN_NOT_OK(meta->load_rtree(enc_key_));
-  const auto& mbrs = meta->mbrs();
-
-  if (mid >= mbrs.size())
+  if (mid >= meta->mbr_num())
     return LOG_STATUS(
         Status_FragmentInfoError("Cannot get MBR; Invalid mbr index"));
 
-  const auto& minimum_bounding_rectangle = mbrs[mid];
+  const auto minimum_bounding_rectangle = meta->mbr(mid);
 
   if (did >= minimum_bounding_rectangle.size())
     return LOG_STATUS(Status_FragmentInfoError(
@@ -668,13 +664,11 @@ Status FragmentInfo::get_mbr_var(
 
   auto meta = single_fragment_info_vec_[fid].meta();
   RETURN_NOT_OK(meta->load_rtree(enc_key_));
-  const auto& mbrs = meta->mbrs();
-
-  if (mid >= mbrs.size())
+  if (mid >= meta->mbr_num())
     return LOG_STATUS(
         Status_FragmentInfoError("Cannot get MBR var; Invalid mbr index"));
 
-  const auto& minimum_bounding_rectangle = mbrs[mid];
+  const auto minimum_bounding_rectangle = meta->mbr(mid);
 
   if (did >= minimum_bounding_rectangle.size())
     return LOG_STATUS(Status_FragmentInfoError(
@@ -41,10 +41,13 @@
 #include "tiledb/sm/array_schema/dimension.h"
 #include "tiledb/sm/array_schema/domain.h"
 #include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/cache/rtree_page_cache.h"
 #include "tiledb/sm/filesystem/vfs.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
+#include "tiledb/sm/misc/bloom_filter.h"
 #include "tiledb/sm/misc/constants.h"
 #include "tiledb/sm/misc/parallel_functions.h"
+#include "tiledb/sm/misc/tdb_math.h"
 #include "tiledb/sm/misc/utils.h"
 #include "tiledb/sm/stats/global_stats.h"
 #include "tiledb/sm/storage_manager/storage_manager.h"
@@ -88,7 +91,8 @@ FragmentMetadata::FragmentMetadata(
     const std::pair<uint64_t, uint64_t>& timestamp_range,
     bool dense,
     bool has_timestamps,
-    bool has_deletes_meta)
+    bool has_deletes_meta,
+    bool has_hilbert_values)
     : storage_manager_(storage_manager)
     , memory_tracker_(memory_tracker)
     , array_schema_(array_schema)
@@ -100,6 +104,7 @@ FragmentMetadata::FragmentMetadata(
     , last_tile_cell_num_(0)
     , has_timestamps_(has_timestamps)
     , has_delete_meta_(has_deletes_meta)
+    , has_hilbert_values_(has_hilbert_values)
     , sparse_tile_num_(0)
     , meta_file_size_(0)
     , rtree_(RTree(&array_schema_->domain(), constants::rtree_fanout))
@@ -116,6 +121,7 @@ FragmentMetadata::~FragmentMetadata() = default;
 // Copy initialization
 FragmentMetadata::FragmentMetadata(const FragmentMetadata& other) {
   storage_manager_ = other.storage_manager_;
+  memory_tracker_ = nullptr;
   array_schema_ = other.array_schema_;
   dense_ = other.dense_;
   fragment_uri_ = other.fragment_uri_;
@@ -127,12 +133,18 @@ FragmentMetadata::FragmentMetadata(const FragmentMetadata& other) {
   tile_index_base_ = other.tile_index_base_;
   has_timestamps_ = other.has_timestamps_;
   has_delete_meta_ = other.has_delete_meta_;
+  has_hilbert_values_ = other.has_hilbert_values_;
   sparse_tile_num_ = other.sparse_tile_num_;
   footer_size_ = other.footer_size_;
   footer_offset_ = other.footer_offset_;
   idx_map_ = other.idx_map_;
   array_schema_name_ = other.array_schema_name_;
   array_uri_ = other.array_uri_;
+  if (rtree_.paged()) {
+    throw_if_not_ok(
+        keep_lazy_load_encryption_key(other.lazy_load_encryption_key_));
+    set_rtree_leaf_page_loader();
+  }
 }
 
 FragmentMetadata& FragmentMetadata::operator=(const FragmentMetadata& other) {
@@ -148,12 +160,18 @@ FragmentMetadata& FragmentMetadata::operator=(const FragmentMetadata& other) {
   tile_index_base_ = other.tile_index_base_;
   has_timestamps_ = other.has_timestamps_;
   has_delete_meta_ = other.has_delete_meta_;
+  has_hilbert_values_ = other.has_hilbert_values_;
   sparse_tile_num_ = other.sparse_tile_num_;
   footer_size_ = other.footer_size_;
   footer_offset_ = other.footer_offset_;
   idx_map_ = other.idx_map_;
   array_schema_name_ = other.array_schema_name_;
   array_uri_ = other.array_uri_;
+  if (rtree_.paged()) {
+    throw_if_not_ok(
+        keep_lazy_load_encryption_key(other.lazy_load_encryption_key_));
+    set_rtree_leaf_page_loader();
+  }
 
   return *this;
 }
@@ -364,6 +382,16 @@ void FragmentMetadata::set_tile_null_count(
   tile_null_counts_[idx][tid] = null_count;
 }
 
+void FragmentMetadata::set_tile_bloom_filter(
+    const std::string& name, uint64_t tid, const ByteVec& bloom_filter) {
+  auto it = idx_map_.find(name);
+  assert(it != idx_map_.end());
+  auto idx = it->second;
+  tid += tile_index_base_;
+  assert(tid < tile_bloom_filters_[idx].size());
+  tile_bloom_filters_[idx][tid] = bloom_filter;
+}
+
 template <>
 void FragmentMetadata::compute_fragment_min_max_sum<char>(
     const std::string& name);
@@ -731,6 +759,18 @@ Status FragmentMetadata::get_tile_overlap(
   return Status::Ok();
 }
 
+Status FragmentMetadata::get_tile_overlap(
+    const std::vector<const Range*>& ranges,
+    std::vector<bool>& is_default,
+    ThreadPool* compute_tp,
+    std::vector<TileOverlap>* tile_overlaps,
+    uint64_t* visited_node_num) {
+  assert(version_ <= 2 || loaded_metadata_.rtree_);
+  *tile_overlaps = rtree_.get_tile_overlap(
+      ranges, is_default, compute_tp, visited_node_num);
+  return Status::Ok();
+}
+
 void FragmentMetadata::compute_tile_bitmap(
     const Range& range, unsigned d, std::vector<uint8_t>* tile_bitmap) {
   assert(version_ <= 2 || loaded_metadata_.rtree_);
@@ -769,6 +809,7 @@ Status FragmentMetadata::init(const NDRange& non_empty_domain) {
   // Initialize tile offsets
   tile_offsets_.resize(num);
   tile_offsets_mtx_.resize(num);
+  tile_offsets_pages_.resize(num);
   file_sizes_.resize(num);
   for (unsigned int i = 0; i < num; ++i)
     file_sizes_[i] = 0;
@@ -776,15 +817,18 @@ Status FragmentMetadata::init(const NDRange& non_empty_domain) {
   // Initialize variable tile offsets
   tile_var_offsets_.resize(num);
   tile_var_offsets_mtx_.resize(num);
+  tile_var_offsets_pages_.resize(num);
   file_var_sizes_.resize(num);
   for (unsigned int i = 0; i < num; ++i)
     file_var_sizes_[i] = 0;
 
   // Initialize variable tile sizes
   tile_var_sizes_.resize(num);
+  tile_var_sizes_pages_.resize(num);
 
   // Initialize validity tile offsets
   tile_validity_offsets_.resize(num);
+  tile_validity_offsets_pages_.resize(num);
   file_validity_sizes_.resize(num);
   for (unsigned int i = 0; i < num; ++i)
     file_validity_sizes_[i] = 0;
@@ -796,6 +840,7 @@ Status FragmentMetadata::init(const NDRange& non_empty_domain) {
   tile_max_var_buffer_.resize(num);
   tile_sums_.resize(num);
   tile_null_counts_.resize(num);
+  tile_bloom_filters_.resize(num);
 
   // Initialize fragment min/max/sum/null count
   fragment_mins_.resize(num);
@@ -1101,18 +1146,36 @@ Status FragmentMetadata::store_v15_or_higher(
       fragment_uri_.join_path(constants::fragment_metadata_filename);
   auto num = num_dims_and_attrs();
   uint64_t offset = 0, nbytes;
+  auto paged = version_ >= constants::tile_metadata_pages_min_version;
 
   // Store R-Tree
   gt_offsets_.rtree_ = offset;
-  RETURN_NOT_OK_ELSE(store_rtree(encryption_key, &nbytes), clean_up());
+  if (version_ >= constants::rtree_pages_min_version) {
+    RETURN_NOT_OK_ELSE(
+        store_rtree_pages(encryption_key, &gt_offsets_.rtree_, &nbytes),
+        clean_up());
+  } else {
+    RETURN_NOT_OK_ELSE(store_rtree(encryption_key, &nbytes), clean_up());
+  }
   offset += nbytes;
 
   // Store tile offsets
   gt_offsets_.tile_offsets_.resize(num);
   for (unsigned int i = 0; i < num; ++i) {
     gt_offsets_.tile_offsets_[i] = offset;
-    RETURN_NOT_OK_ELSE(
-        store_tile_offsets(i, encryption_key, &nbytes), clean_up());
+    if (paged) {
+      RETURN_NOT_OK_ELSE(
+          store_tile_metadata_pages(
+              tile_offsets_[i],
+              encryption_key,
+              "write_tile_offsets_size",
+              &gt_offsets_.tile_offsets_[i],
+              &nbytes),
+          clean_up());
+    } else {
+      RETURN_NOT_OK_ELSE(
+          store_tile_offsets(i, encryption_key, &nbytes), clean_up());
+    }
     offset += nbytes;
   }
 
@@ -1120,8 +1183,19 @@ Status FragmentMetadata::store_v15_or_higher(
   gt_offsets_.tile_var_offsets_.resize(num);
   for (unsigned int i = 0; i < num; ++i) {
     gt_offsets_.tile_var_offsets_[i] = offset;
-    RETURN_NOT_OK_ELSE(
-        store_tile_var_offsets(i, encryption_key, &nbytes), clean_up());
+    if (paged) {
+      RETURN_NOT_OK_ELSE(
+          store_tile_metadata_pages(
+              tile_var_offsets_[i],
+              encryption_key,
+              "write_tile_var_offsets_size",
+              &gt_offsets_.tile_var_offsets_[i],
+              &nbytes),
+          clean_up());
+    } else {
+      RETURN_NOT_OK_ELSE(
+          store_tile_var_offsets(i, encryption_key, &nbytes), clean_up());
+    }
     offset += nbytes;
   }
 
@@ -1129,8 +1203,19 @@ Status FragmentMetadata::store_v15_or_higher(
   gt_offsets_.tile_var_sizes_.resize(num);
   for (unsigned int i = 0; i < num; ++i) {
     gt_offsets_.tile_var_sizes_[i] = offset;
-    RETURN_NOT_OK_ELSE(
-        store_tile_var_sizes(i, encryption_key, &nbytes), clean_up());
+    if (paged) {
+      RETURN_NOT_OK_ELSE(
+          store_tile_metadata_pages(
+              tile_var_sizes_[i],
+              encryption_key,
+              "write_tile_var_sizes_size",
+              &gt_offsets_.tile_var_sizes_[i],
+              &nbytes),
+          clean_up());
+    } else {
+      RETURN_NOT_OK_ELSE(
+          store_tile_var_sizes(i, encryption_key, &nbytes), clean_up());
+    }
     offset += nbytes;
   }
 
@@ -1138,8 +1223,19 @@ Status FragmentMetadata::store_v15_or_higher(
   gt_offsets_.tile_validity_offsets_.resize(num);
   for (unsigned int i = 0; i < num; ++i) {
     gt_offsets_.tile_validity_offsets_[i] = offset;
-    RETURN_NOT_OK_ELSE(
-        store_tile_validity_offsets(i, encryption_key, &nbytes), clean_up());
+    if (paged) {
+      RETURN_NOT_OK_ELSE(
+          store_tile_metadata_pages(
+              tile_validity_offsets_[i],
+              encryption_key,
+              "write_tile_validity_offsets_size",
+              &gt_offsets_.tile_validity_offsets_[i],
+              &nbytes),
+          clean_up());
+    } else {
+      RETURN_NOT_OK_ELSE(
+          store_tile_validity_offsets(i, encryption_key, &nbytes), clean_up());
+    }
     offset += nbytes;
   }
 
@@ -1189,6 +1285,26 @@ Status FragmentMetadata::store_v15_or_higher(
       store_processed_conditions(encryption_key, &nbytes), clean_up());
   offset += nbytes;
 
+  // Store Bloom filters, only for the fields that have some
+  if (version_ >= constants::tile_bloom_filters_min_version) {
+    gt_offsets_.tile_bloom_filter_offsets_.resize(num);
+    for (unsigned int i = 0; i < num; ++i) {
+      const auto& filters = tile_bloom_filters_[i];
+      if (std::all_of(filters.begin(), filters.end(), [](const auto& f) {
+            return f.empty();
+          })) {
+        gt_offsets_.tile_bloom_filter_offsets_[i] =
+            constants::no_tile_bloom_filters_offset;
+        continue;
+      }
+
+      gt_offsets_.tile_bloom_filter_offsets_[i] = offset;
+      RETURN_NOT_OK_ELSE(
+          store_tile_bloom_filters(i, encryption_key, &nbytes), clean_up());
+      offset += nbytes;
+    }
+  }
+
   // Store footer
   RETURN_NOT_OK_ELSE(store_footer(encryption_key), clean_up());
 
@@ -1235,6 +1351,9 @@ Status FragmentMetadata::set_num_tiles(uint64_t num_tiles) {
 
       if (array_schema_->is_nullable(it.first))
         tile_null_counts_[i].resize(num_tiles, 0);
+
+      if (!dense_)
+        tile_bloom_filters_[i].resize(num_tiles);
     }
   }
 
@@ -1346,6 +1465,10 @@ tuple<Status, optional<std::string>> FragmentMetadata::encode_name(
     return {Status::Ok(), "dcmh"};
   }
 
+  if (name == constants::hilbert_values) {
+    return {Status::Ok(), "hv"};
+  }
+
   auto err = "Unable to locate dimension/attribute " + name;
   return {Status_FragmentMetadataError(err), std::nullopt};
 }
@@ -1509,6 +1632,28 @@ Status FragmentMetadata::load_tile_null_count_values(
   return Status::Ok();
 }
 
+Status FragmentMetadata::load_tile_bloom_filters(
+    const EncryptionKey& encryption_key, std::vector<std::string>&& names) {
+  // Sort 'names' in ascending order of their index. The
+  // motivation is to load the filters in order of their
+  // layout for sequential reads to the file.
+  std::sort(
+      names.begin(),
+      names.end(),
+      [&](const std::string& lhs, const std::string& rhs) {
+        assert(idx_map_.count(lhs) > 0);
+        assert(idx_map_.count(rhs) > 0);
+        return idx_map_[lhs] < idx_map_[rhs];
+      });
+
+  // Load all the Bloom filters.
+  for (const auto& name : names) {
+    RETURN_NOT_OK(load_tile_bloom_filters(encryption_key, idx_map_[name]));
+  }
+
+  return Status::Ok();
+}
+
 Status FragmentMetadata::load_fragment_min_max_sum_null_count(
     const EncryptionKey& encryption_key) {
   if (loaded_metadata_.fragment_min_max_sum_null_count_)
@@ -1573,8 +1718,12 @@ Status FragmentMetadata::file_offset(
         "Trying to access metadata that's not loaded"));
   }
 
-  *offset = tile_offsets_[idx][tile_idx];
-  return Status::Ok();
+  return get_tile_metadata_value(
+      tile_offsets_pages_[idx],
+      tile_offsets_[idx],
+      "read_tile_offsets_size",
+      tile_idx,
+      offset);
 }
 
 Status FragmentMetadata::file_var_offset(
@@ -1587,8 +1736,12 @@ Status FragmentMetadata::file_var_offset(
         "Trying to access metadata that's not loaded"));
   }
 
-  *offset = tile_var_offsets_[idx][tile_idx];
-  return Status::Ok();
+  return get_tile_metadata_value(
+      tile_var_offsets_pages_[idx],
+      tile_var_offsets_[idx],
+      "read_tile_var_offsets_size",
+      tile_idx,
+      offset);
 }
 
 Status FragmentMetadata::file_validity_offset(
@@ -1601,16 +1754,25 @@ Status FragmentMetadata::file_validity_offset(
         "Trying to access metadata that's not loaded"));
   }
 
-  *offset = tile_validity_offsets_[idx][tile_idx];
-  return Status::Ok();
+  return get_tile_metadata_value(
+      tile_validity_offsets_pages_[idx],
+      tile_validity_offsets_[idx],
+      "read_tile_validity_offsets_size",
+      tile_idx,
+      offset);
 }
 
-const NDRange& FragmentMetadata::mbr(uint64_t tile_idx) const {
+NDRange FragmentMetadata::mbr(uint64_t tile_idx) const {
   return rtree_.leaf(tile_idx);
 }
 
-const std::vector<NDRange>& FragmentMetadata::mbrs() const {
-  return rtree_.leaves();
+const NDRange& FragmentMetadata::mbr(
+    uint64_t tile_idx, RTree::PinnedLeafPage* pinned) const {
+  return rtree_.leaf(tile_idx, pinned);
+}
+
+uint64_t FragmentMetadata::mbr_num() const {
+  return rtree_.leaf_num();
 }
 
 tuple<Status, optional<uint64_t>> FragmentMetadata::persisted_tile_size(
@@ -1626,10 +1788,27 @@ tuple<Status, optional<uint64_t>> FragmentMetadata::persisted_tile_size(
 
   auto tile_num = this->tile_num();
 
-  auto tile_size =
-      (tile_idx != tile_num - 1) ?
-          tile_offsets_[idx][tile_idx + 1] - tile_offsets_[idx][tile_idx] :
-          file_sizes_[idx] - tile_offsets_[idx][tile_idx];
+  uint64_t offset = 0;
+  auto st = get_tile_metadata_value(
+      tile_offsets_pages_[idx],
+      tile_offsets_[idx],
+      "read_tile_offsets_size",
+      tile_idx,
+      &offset);
+  RETURN_NOT_OK_TUPLE(st, nullopt);
+
+  uint64_t next_offset = file_sizes_[idx];
+  if (tile_idx != tile_num - 1) {
+    st = get_tile_metadata_value(
+        tile_offsets_pages_[idx],
+        tile_offsets_[idx],
+        "read_tile_offsets_size",
+        tile_idx + 1,
+        &next_offset);
+    RETURN_NOT_OK_TUPLE(st, nullopt);
+  }
+
+  auto tile_size = next_offset - offset;
 
   return {Status::Ok(), tile_size};
 }
@@ -1648,10 +1827,27 @@ tuple<Status, optional<uint64_t>> FragmentMetadata::persisted_tile_var_size(
 
   auto tile_num = this->tile_num();
 
-  auto tile_size = (tile_idx != tile_num - 1) ?
-                       tile_var_offsets_[idx][tile_idx + 1] -
-                           tile_var_offsets_[idx][tile_idx] :
-                       file_var_sizes_[idx] - tile_var_offsets_[idx][tile_idx];
+  uint64_t offset = 0;
+  auto st = get_tile_metadata_value(
+      tile_var_offsets_pages_[idx],
+      tile_var_offsets_[idx],
+      "read_tile_var_offsets_size",
+      tile_idx,
+      &offset);
+  RETURN_NOT_OK_TUPLE(st, nullopt);
+
+  uint64_t next_offset = file_var_sizes_[idx];
+  if (tile_idx != tile_num - 1) {
+    st = get_tile_metadata_value(
+        tile_var_offsets_pages_[idx],
+        tile_var_offsets_[idx],
+        "read_tile_var_offsets_size",
+        tile_idx + 1,
+        &next_offset);
+    RETURN_NOT_OK_TUPLE(st, nullopt);
+  }
+
+  auto tile_size = next_offset - offset;
 
   return {Status::Ok(), tile_size};
 }
@@ -1670,11 +1866,27 @@ FragmentMetadata::persisted_tile_validity_size(
 
   auto tile_num = this->tile_num();
 
-  auto tile_size =
-      (tile_idx != tile_num - 1) ?
-          tile_validity_offsets_[idx][tile_idx + 1] -
-              tile_validity_offsets_[idx][tile_idx] :
-          file_validity_sizes_[idx] - tile_validity_offsets_[idx][tile_idx];
+  uint64_t offset = 0;
+  auto st = get_tile_metadata_value(
+      tile_validity_offsets_pages_[idx],
+      tile_validity_offsets_[idx],
+      "read_tile_validity_offsets_size",
+      tile_idx,
+      &offset);
+  RETURN_NOT_OK_TUPLE(st, nullopt);
+
+  uint64_t next_offset = file_validity_sizes_[idx];
+  if (tile_idx != tile_num - 1) {
+    st = get_tile_metadata_value(
+        tile_validity_offsets_pages_[idx],
+        tile_validity_offsets_[idx],
+        "read_tile_validity_offsets_size",
+        tile_idx + 1,
+        &next_offset);
+    RETURN_NOT_OK_TUPLE(st, nullopt);
+  }
+
+  auto tile_size = next_offset - offset;
 
   return {Status::Ok(), tile_size};
 }
@@ -1698,7 +1910,15 @@ tuple<Status, optional<uint64_t>> FragmentMetadata::tile_var_size(
             nullopt};
   }
 
-  auto tile_size = tile_var_sizes_[idx][tile_idx];
+  uint64_t tile_size = 0;
+  auto st = get_tile_metadata_value(
+      tile_var_sizes_pages_[idx],
+      tile_var_sizes_[idx],
+      "read_tile_var_sizes_size",
+      tile_idx,
+      &tile_size);
+  RETURN_NOT_OK_TUPLE(st, nullopt);
+
   return {Status::Ok(), tile_size};
 }
 
@@ -1827,6 +2047,32 @@ tuple<Status, optional<uint64_t>> FragmentMetadata::get_tile_null_count(
   return {Status::Ok(), null_count};
 }
 
+bool FragmentMetadata::has_tile_bloom_filters(const std::string& name) const {
+  if (version_ < constants::tile_bloom_filters_min_version)
+    return false;
+
+  auto it = idx_map_.find(name);
+  return it != idx_map_.end() &&
+         gt_offsets_.tile_bloom_filter_offsets_[it->second] !=
+             constants::no_tile_bloom_filters_offset;
+}
+
+bool FragmentMetadata::tile_may_contain(
+    const std::string& name, uint64_t tile_idx, uint64_t hash) const {
+  auto it = idx_map_.find(name);
+  if (it == idx_map_.end())
+    return true;
+
+  auto idx = it->second;
+  if (idx >= loaded_metadata_.tile_bloom_filter_.size() ||
+      !loaded_metadata_.tile_bloom_filter_[idx] ||
+      tile_idx >= tile_bloom_filters_[idx].size())
+    return true;
+
+  const auto& filter = tile_bloom_filters_[idx][tile_idx];
+  return BloomFilter::may_contain(filter.data(), filter.size(), hash);
+}
+
 tuple<Status, optional<std::vector<uint8_t>>> FragmentMetadata::get_min(
     const std::string& name) {
   auto it = idx_map_.find(name);
@@ -1966,6 +2212,10 @@ Status FragmentMetadata::write_footer(Buffer* buff) const {
     RETURN_NOT_OK(write_has_delete_meta(buff));
   }
 
+  if (version_ >= constants::hilbert_values_min_version) {
+    RETURN_NOT_OK(write_has_hilbert_values(buff));
+  }
+
   RETURN_NOT_OK(write_file_sizes(buff));
   RETURN_NOT_OK(write_file_var_sizes(buff));
   RETURN_NOT_OK(write_file_validity_sizes(buff));
@@ -2002,6 +2252,10 @@ Status FragmentMetadata::load_rtree(const EncryptionKey& encryption_key) {
 
   Deserializer deserializer(tile.data(), tile.size());
   rtree_.deserialize(deserializer, &array_schema_->domain(), version_);
+  if (rtree_.paged()) {
+    RETURN_NOT_OK(keep_lazy_load_encryption_key(encryption_key));
+    set_rtree_leaf_page_loader();
+  }
 
   loaded_metadata_.rtree_ = true;
 
@@ -2394,7 +2648,13 @@ Status FragmentMetadata::load_tile_offsets(
   storage_manager_->stats()->add_counter("read_tile_offsets_size", tile.size());
 
   ConstBuffer cbuff(tile.data(), tile.size());
-  RETURN_NOT_OK(load_tile_offsets(idx, &cbuff));
+  bool paged = false;
+  if (version_ >= constants::tile_metadata_pages_min_version) {
+    RETURN_NOT_OK(load_tile_metadata_pages(
+        encryption_key, &cbuff, &tile_offsets_pages_[idx], &paged));
+  }
+  if (!paged)
+    RETURN_NOT_OK(load_tile_offsets(idx, &cbuff));
 
   loaded_metadata_.tile_offsets_[idx] = true;
 
@@ -2424,7 +2684,13 @@ Status FragmentMetadata::load_tile_var_offsets(
       "read_tile_var_offsets_size", tile.size());
 
   ConstBuffer cbuff(tile.data(), tile.size());
-  RETURN_NOT_OK(load_tile_var_offsets(idx, &cbuff));
+  bool paged = false;
+  if (version_ >= constants::tile_metadata_pages_min_version) {
+    RETURN_NOT_OK(load_tile_metadata_pages(
+        encryption_key, &cbuff, &tile_var_offsets_pages_[idx], &paged));
+  }
+  if (!paged)
+    RETURN_NOT_OK(load_tile_var_offsets(idx, &cbuff));
 
   loaded_metadata_.tile_var_offsets_[idx] = true;
 
@@ -2450,7 +2716,13 @@ Status FragmentMetadata::load_tile_var_sizes(
       "read_tile_var_sizes_size", tile.size());
 
   ConstBuffer cbuff(tile.data(), tile.size());
-  RETURN_NOT_OK(load_tile_var_sizes(idx, &cbuff));
+  bool paged = false;
+  if (version_ >= constants::tile_metadata_pages_min_version) {
+    RETURN_NOT_OK(load_tile_metadata_pages(
+        encryption_key, &cbuff, &tile_var_sizes_pages_[idx], &paged));
+  }
+  if (!paged)
+    RETURN_NOT_OK(load_tile_var_sizes(idx, &cbuff));
 
   loaded_metadata_.tile_var_sizes_[idx] = true;
 
@@ -2476,7 +2748,13 @@ Status FragmentMetadata::load_tile_validity_offsets(
       "read_tile_validity_offsets_size", tile.size());
 
   ConstBuffer cbuff(tile.data(), tile.size());
-  RETURN_NOT_OK(load_tile_validity_offsets(idx, &cbuff));
+  bool paged = false;
+  if (version_ >= constants::tile_metadata_pages_min_version) {
+    RETURN_NOT_OK(load_tile_metadata_pages(
+        encryption_key, &cbuff, &tile_validity_offsets_pages_[idx], &paged));
+  }
+  if (!paged)
+    RETURN_NOT_OK(load_tile_validity_offsets(idx, &cbuff));
 
   loaded_metadata_.tile_validity_offsets_[idx] = true;
 
@@ -2584,6 +2862,39 @@ Status FragmentMetadata::load_tile_null_count_values(
   return Status::Ok();
 }
 
+Status FragmentMetadata::load_tile_bloom_filters(
+    const EncryptionKey& encryption_key, unsigned idx) {
+  if (version_ < constants::tile_bloom_filters_min_version)
+    return Status::Ok();
+
+  std::lock_guard<std::mutex> lock(mtx_);
+
+  if (loaded_metadata_.tile_bloom_filter_[idx])
+    return Status::Ok();
+
+  // Fields without filters have no generic tile to read
+  if (gt_offsets_.tile_bloom_filter_offsets_[idx] ==
+      constants::no_tile_bloom_filters_offset) {
+    loaded_metadata_.tile_bloom_filter_[idx] = true;
+    return Status::Ok();
+  }
+
+  auto&& [st, tile_opt] = read_generic_tile_from_file(
+      encryption_key, gt_offsets_.tile_bloom_filter_offsets_[idx]);
+  RETURN_NOT_OK(st);
+  auto& tile = *tile_opt;
+
+  storage_manager_->stats()->add_counter(
+      "read_tile_bloom_filter_size", tile.size());
+
+  ConstBuffer cbuff(tile.data(), tile.size());
+  RETURN_NOT_OK(load_tile_bloom_filters(idx, &cbuff));
+
+  loaded_metadata_.tile_bloom_filter_[idx] = true;
+
+  return Status::Ok();
+}
+
 // ===== FORMAT =====
 //  bounding_coords_num (uint64_t)
 //  bounding_coords_#1 (void*) bounding_coords_#2 (void*) ...
@@ -2752,6 +3063,24 @@ Status FragmentMetadata::load_has_delete_meta(ConstBuffer* buff) {
   return Status::Ok();
 }
 
+// ===== FORMAT =====
+// has_hilbert_values (char)
+Status FragmentMetadata::load_has_hilbert_values(ConstBuffer* buff) {
+  // Get includes Hilbert values
+  Status st = buff->read(&has_hilbert_values_, sizeof(char));
+  if (!st.ok()) {
+    return LOG_STATUS(Status_FragmentMetadataError(
+        "Cannot load fragment metadata; Reading include Hilbert values "
+        "failed"));
+  }
+
+  // Rebuild index map
+  if (has_hilbert_values_) {
+    build_idx_map();
+  }
+  return Status::Ok();
+}
+
 // ===== FORMAT =====
 // mbr_num (uint64_t)
 // mbr_#1 (void*)
@@ -3208,6 +3537,134 @@ Status FragmentMetadata::load_tile_validity_offsets(
   return Status::Ok();
 }
 
+Status FragmentMetadata::keep_lazy_load_encryption_key(
+    const EncryptionKey& encryption_key) {
+  Status st = Status::Ok();
+  std::call_once(lazy_load_encryption_key_flag_, [&]() {
+    auto key = encryption_key.key();
+    st = lazy_load_encryption_key_.set_key(
+        encryption_key.encryption_type(),
+        key.data(),
+        static_cast<uint32_t>(key.size()));
+  });
+
+  return st;
+}
+
+// ===== FORMAT =====
+// marker (uint64_t)
+// values_num (uint64_t)
+// page_size (uint64_t)
+// page_num (uint64_t)
+// page#0_offset (uint64_t) ... page#<page_num-1>_offset (uint64_t)
+Status FragmentMetadata::load_tile_metadata_pages(
+    const EncryptionKey& encryption_key,
+    ConstBuffer* buff,
+    TileMetadataPages* pages,
+    bool* paged) {
+  // Arrays that fit in a single page are stored whole, as the number of
+  // values followed by the values. Page directories start with a marker
+  // that cannot be a number of values.
+  *paged = false;
+  if (buff->size() < sizeof(uint64_t) ||
+      buff->value<uint64_t>(0) !=
+          constants::tile_metadata_page_directory_marker)
+    return Status::Ok();
+
+  RETURN_NOT_OK(keep_lazy_load_encryption_key(encryption_key));
+
+  uint64_t marker = 0, page_size = 0, page_num = 0;
+  Status st = buff->read(&marker, sizeof(uint64_t));
+  if (st.ok())
+    st = buff->read(&pages->num_, sizeof(uint64_t));
+  if (st.ok())
+    st = buff->read(&page_size, sizeof(uint64_t));
+  if (st.ok())
+    st = buff->read(&page_num, sizeof(uint64_t));
+  if (!st.ok() || page_size == 0 || page_num == 0 ||
+      page_num != utils::math::ceil(pages->num_, page_size)) {
+    return LOG_STATUS(Status_FragmentMetadataError(
+        "Cannot load fragment metadata; Reading tile metadata page "
+        "directory failed"));
+  }
+
+  pages->page_size_ = page_size;
+  pages->page_offsets_.resize(page_num);
+  st = buff->read(&pages->page_offsets_[0], page_num * sizeof(uint64_t));
+  if (!st.ok()) {
+    return LOG_STATUS(Status_FragmentMetadataError(
+        "Cannot load fragment metadata; Reading tile metadata page offsets "
+        "failed"));
+  }
+
+  pages->pages_.resize(page_num);
+  pages->page_loaded_ = std::vector<std::atomic<bool>>(page_num);
+  pages->paged_ = true;
+  *paged = true;
+
+  return Status::Ok();
+}
+
+Status FragmentMetadata::get_tile_metadata_value(
+    TileMetadataPages& pages,
+    const std::vector<uint64_t>& values,
+    const std::string& stat_name,
+    uint64_t tile_idx,
+    uint64_t* value) {
+  if (!pages.paged_) {
+    *value = values[tile_idx];
+    return Status::Ok();
+  }
+
+  if (tile_idx >= pages.num_) {
+    return LOG_STATUS(Status_FragmentMetadataError(
+        "Cannot get tile metadata; Tile index out of bounds"));
+  }
+
+  // Load the page holding the value if needed. Pages are never unloaded, so
+  // the lock is only taken the first time a page is accessed.
+  auto page_idx = tile_idx / pages.page_size_;
+  if (!pages.page_loaded_[page_idx]) {
+    std::lock_guard<std::mutex> lock(pages.mtx_);
+    if (!pages.page_loaded_[page_idx]) {
+      auto&& [st, tile_opt] = read_generic_tile_from_file(
+          lazy_load_encryption_key_, pages.page_offsets_[page_idx]);
+      RETURN_NOT_OK(st);
+      auto& tile = *tile_opt;
+
+      storage_manager_->stats()->add_counter(stat_name, tile.size());
+
+      auto page_start = page_idx * pages.page_size_;
+      auto page_values_num =
+          std::min(pages.page_size_, pages.num_ - page_start);
+      auto size = page_values_num * sizeof(uint64_t);
+      if (tile.size() != size) {
+        return LOG_STATUS(Status_FragmentMetadataError(
+            "Cannot load fragment metadata; Unexpected tile metadata page "
+            "size"));
+      }
+
+      if (memory_tracker_ != nullptr && !memory_tracker_->take_memory(size)) {
+        return LOG_STATUS(Status_FragmentMetadataError(
+            "Cannot load tile metadata page; Insufficient memory budget; "
+            "Needed " +
+            std::to_string(size) + " but only had " +
+            std::to_string(memory_tracker_->get_memory_available()) +
+            " from budget " +
+            std::to_string(memory_tracker_->get_memory_budget())));
+      }
+
+      auto& page = pages.pages_[page_idx];
+      page.resize(page_values_num);
+      memcpy(page.data(), tile.data(), size);
+      pages.page_loaded_[page_idx] = true;
+    }
+  }
+
+  *value = pages.pages_[page_idx][tile_idx % pages.page_size_];
+  return Status::Ok();
+}
+
 // ===== FORMAT =====
 // tile_min_values#0_size_buffer (uint64_t)
 // tile_min_values#0_size_buffer_var (uint64_t)
@@ -3419,6 +3876,56 @@ Status FragmentMetadata::load_tile_null_count_values(
   return Status::Ok();
 }
 
+// ===== FORMAT =====
+// tile_bloom_filter_num (uint64_t)
+// tile_bloom_filter_size_#1 (uint64_t) tile_bloom_filter_#1 (uint8_t[]) ...
+// tile_bloom_filter_size_#2 (uint64_t) tile_bloom_filter_#2 (uint8_t[]) ...
+Status FragmentMetadata::load_tile_bloom_filters(
+    unsigned idx, ConstBuffer* buff) {
+  uint64_t tile_bloom_filter_num = 0;
+
+  // Get number of tile Bloom filters
+  auto st = buff->read(&tile_bloom_filter_num, sizeof(uint64_t));
+  if (!st.ok()) {
+    return LOG_STATUS(
+        Status_FragmentMetadataError("Cannot load fragment metadata; Reading "
+                                     "number of tile Bloom filters failed"));
+  }
+
+  // Get tile Bloom filters
+  if (tile_bloom_filter_num != 0) {
+    auto size = buff->size() - buff->offset();
+    if (memory_tracker_ != nullptr && !memory_tracker_->take_memory(size)) {
+      return LOG_STATUS(Status_FragmentMetadataError(
+          "Cannot load tile Bloom filters; Insufficient memory budget; "
+          "Needed " +
+          std::to_string(size) + " but only had " +
+          std::to_string(memory_tracker_->get_memory_available()) +
+          " from budget " +
+          std::to_string(memory_tracker_->get_memory_budget())));
+    }
+
+    tile_bloom_filters_[idx].resize(tile_bloom_filter_num);
+    for (uint64_t t = 0; t < tile_bloom_filter_num; t++) {
+      uint64_t filter_size = 0;
+      st = buff->read(&filter_size, sizeof(uint64_t));
+      if (st.ok()) {
+        tile_bloom_filters_[idx][t].resize(filter_size);
+        if (filter_size != 0)
+          st = buff->read(tile_bloom_filters_[idx][t].data(), filter_size);
+      }
+
+      if (!st.ok()) {
+        return LOG_STATUS(Status_FragmentMetadataError(
+            "Cannot load fragment metadata; Reading tile Bloom filters "
+            "failed"));
+      }
+    }
+  }
+
+  return Status::Ok();
+}
+
 // ===== FORMAT =====
 // fragment_min_size_attr#0 (uint64_t)
 // fragment_min_attr#0 (min_size)
@@ -3857,6 +4364,15 @@ Status FragmentMetadata::load_generic_tile_offsets_v16_or_higher(
   RETURN_NOT_OK(
       buff->read(&gt_offsets_.processed_conditions_offsets_, sizeof(uint64_t)));
 
+  // Load offsets for tile Bloom filters
+  if (version_ >= constants::tile_bloom_filters_min_version) {
+    gt_offsets_.tile_bloom_filter_offsets_.resize(num);
+    for (unsigned i = 0; i < num; ++i) {
+      RETURN_NOT_OK(buff->read(
+          &gt_offsets_.tile_bloom_filter_offsets_[i], sizeof(uint64_t)));
+    }
+  }
+
   return Status::Ok();
 }
 
@@ -3992,26 +4508,35 @@ Status FragmentMetadata::load_footer(
     RETURN_NOT_OK(load_has_delete_meta(cbuff.get()));
   }
 
+  if (version_ >= constants::hilbert_values_min_version) {
+    RETURN_NOT_OK(load_has_hilbert_values(cbuff.get()));
+  }
+
   RETURN_NOT_OK(load_file_sizes(cbuff.get()));
   RETURN_NOT_OK(load_file_var_sizes(cbuff.get()));
   RETURN_NOT_OK(load_file_validity_sizes(cbuff.get()));
 
   unsigned num = array_schema_->attribute_num() + 1 + has_timestamps_ +
-                 has_delete_meta_ * 2;
+                 has_delete_meta_ * 2 + has_hilbert_values_;
   num += (version_ >= 5) ? array_schema_->dim_num() : 0;
 
   tile_offsets_.resize(num);
   tile_offsets_mtx_.resize(num);
+  tile_offsets_pages_.resize(num);
   tile_var_offsets_.resize(num);
   tile_var_offsets_mtx_.resize(num);
+  tile_var_offsets_pages_.resize(num);
   tile_var_sizes_.resize(num);
+  tile_var_sizes_pages_.resize(num);
   tile_validity_offsets_.resize(num);
+  tile_validity_offsets_pages_.resize(num);
   tile_min_buffer_.resize(num);
   tile_min_var_buffer_.resize(num);
   tile_max_buffer_.resize(num);
   tile_max_var_buffer_.resize(num);
   tile_sums_.resize(num);
   tile_null_counts_.resize(num);
+  tile_bloom_filters_.resize(num);
 
   fragment_mins_.resize(num);
   fragment_maxs_.resize(num);
@@ -4026,6 +4551,7 @@ Status FragmentMetadata::load_footer(
   loaded_metadata_.tile_max_.resize(num, false);
   loaded_metadata_.tile_sum_.resize(num, false);
   loaded_metadata_.tile_null_count_.resize(num, false);
+  loaded_metadata_.tile_bloom_filter_.resize(num, false);
 
   RETURN_NOT_OK(load_generic_tile_offsets(cbuff.get()));
 
@@ -4214,6 +4740,19 @@ Status FragmentMetadata::write_generic_tile_offsets(Buffer* buff) const {
     }
   }
 
+  // Write tile Bloom filter offsets
+  if (version_ >= constants::tile_bloom_filters_min_version) {
+    for (unsigned i = 0; i < num; ++i) {
+      st = buff->write(
+          &gt_offsets_.tile_bloom_filter_offsets_[i], sizeof(uint64_t));
+      if (!st.ok()) {
+        return LOG_STATUS(Status_FragmentMetadataError(
+            "Cannot serialize fragment metadata; Writing tile Bloom filters "
+            "failed"));
+      }
+    }
+  }
+
   return Status::Ok();
 }
 
@@ -4256,8 +4795,76 @@ Status FragmentMetadata::store_rtree(
   return Status::Ok();
 }
 
+Status FragmentMetadata::store_rtree_pages(
+    const EncryptionKey& encryption_key,
+    uint64_t* gt_offset,
+    uint64_t* nbytes) {
+  // Align the leaf pages with the leaf level nodes
+  uint64_t fanout = std::max(rtree_.fanout(), 1u);
+  auto page_size =
+      utils::math::ceil(constants::rtree_leaf_page_size, fanout) * fanout;
+
+  // R-trees whose leaves fit in a single page are stored whole
+  auto leaf_num = rtree_.leaf_num();
+  if (leaf_num <= page_size)
+    return store_rtree(encryption_key, nbytes);
+
+  rtree_.build_tree(rtree_packing());
+
+  // Store the leaf pages
+  auto page_num = utils::math::ceil(leaf_num, page_size);
+  std::vector<uint64_t> page_offsets(page_num);
+  uint64_t tile_nbytes = 0;
+  *nbytes = 0;
+  for (uint64_t p = 0; p < page_num; ++p) {
+    auto page_start = p * page_size;
+    auto page_leaf_num = std::min(page_size, leaf_num - page_start);
+    SizeComputationSerializer size_computation_serializer;
+    rtree_.serialize_leaves(
+        size_computation_serializer, page_start, page_leaf_num);
+
+    Tile tile;
+    RETURN_NOT_OK(tile.init_unfiltered(
+        0,
+        constants::generic_tile_datatype,
+        size_computation_serializer.size(),
+        constants::generic_tile_cell_size,
+        0));
+    Serializer serializer(tile.data(), tile.size());
+    rtree_.serialize_leaves(serializer, page_start, page_leaf_num);
+
+    page_offsets[p] = *gt_offset + *nbytes;
+    RETURN_NOT_OK(
+        write_generic_tile_to_file(encryption_key, tile, &tile_nbytes));
+    *nbytes += tile_nbytes;
+  }
+
+  // Store the upper levels and the leaf page offsets, which the loader
+  // starts from
+  SizeComputationSerializer size_computation_serializer;
+  rtree_.serialize_paged(size_computation_serializer, page_size, page_offsets);
+
+  Tile tile;
+  RETURN_NOT_OK(tile.init_unfiltered(
+      0,
+      constants::generic_tile_datatype,
+      size_computation_serializer.size(),
+      constants::generic_tile_cell_size,
+      0));
+  Serializer serializer(tile.data(), tile.size());
+  rtree_.serialize_paged(serializer, page_size, page_offsets);
+
+  *gt_offset += *nbytes;
+  RETURN_NOT_OK(write_generic_tile_to_file(encryption_key, tile, &tile_nbytes));
+  *nbytes += tile_nbytes;
+
+  storage_manager_->stats()->add_counter("write_rtree_size", *nbytes);
+
+  return Status::Ok();
+}
+
 Tile FragmentMetadata::write_rtree() {
-  rtree_.build_tree();
+  rtree_.build_tree(rtree_packing());
   SizeComputationSerializer size_computation_serializer;
   rtree_.serialize(size_computation_serializer);
 
@@ -4278,6 +4885,73 @@ Tile FragmentMetadata::write_rtree() {
   return tile;
 }
 
+RTree::Packing FragmentMetadata::rtree_packing() const {
+  if (version_ < constants::rtree_packing_min_version)
+    return RTree::Packing::SEQUENTIAL;
+
+  bool found = false;
+  auto packing = storage_manager_->config().get("sm.rtree_packing", &found);
+  assert(found);
+  if (packing == "str")
+    return RTree::Packing::STR;
+  if (packing == "hilbert")
+    return RTree::Packing::HILBERT;
+
+  return RTree::Packing::SEQUENTIAL;
+}
+
+void FragmentMetadata::set_rtree_leaf_page_loader() {
+  rtree_.set_leaf_page_loader([this](uint64_t page_offset) {
+    return load_rtree_leaf_page(page_offset);
+  });
+}
+
+shared_ptr<const std::vector<NDRange>>
+FragmentMetadata::load_rtree_leaf_page(uint64_t page_offset) const {
+  auto cache = storage_manager_->rtree_page_cache();
+  auto key = fragment_uri_.to_string() + "#" + std::to_string(page_offset);
+  uint64_t size = 0;
+  auto page = cache->read(key, &size);
+  if (page != nullptr) {
+    storage_manager_->stats()->add_counter("rtree_page_cache_hit_num", 1);
+  } else {
+    auto&& [st, tile_opt] =
+        read_generic_tile_from_file(lazy_load_encryption_key_, page_offset);
+    throw_if_not_ok(st);
+    auto& tile = *tile_opt;
+    size = tile.size();
+
+    storage_manager_->stats()->add_counter("read_rtree_size", size);
+
+    Deserializer deserializer(tile.data(), tile.size());
+    page = make_shared<std::vector<NDRange>>(
+        HERE(),
+        RTree::deserialize_leaves(deserializer, &array_schema_->domain()));
+    throw_if_not_ok(cache->insert(key, page, size));
+  }
+
+  if (memory_tracker_ == nullptr)
+    return page;
+
+  // Charge the page to the memory budget while the R-tree traversal pins
+  // it, using the serialized size to approximate its memory usage as for
+  // the rest of the R-tree.
+  if (!memory_tracker_->take_memory(size)) {
+    throw FragmentMetadataStatusException(
+        "Cannot load R-tree leaf page; Insufficient memory budget; Needed " +
+        std::to_string(size) + " but only had " +
+        std::to_string(memory_tracker_->get_memory_available()) +
+        " from budget " +
+        std::to_string(memory_tracker_->get_memory_budget()));
+  }
+
+  auto memory_tracker = memory_tracker_;
+  return shared_ptr<const std::vector<NDRange>>(
+      page.get(), [memory_tracker, size, page](const std::vector<NDRange>*) {
+        memory_tracker->release_memory(size);
+      });
+}
+
 // ===== FORMAT =====
 // null_non_empty_domain(char)
 // fix-sized: range(void*)
@@ -4553,6 +5227,60 @@ Status FragmentMetadata::write_tile_validity_offsets(
   return Status::Ok();
 }
 
+Status FragmentMetadata::store_tile_metadata_pages(
+    const std::vector<uint64_t>& values,
+    const EncryptionKey& encryption_key,
+    const std::string& stat_name,
+    uint64_t* gt_offset,
+    uint64_t* nbytes) {
+  uint64_t values_num = values.size();
+  uint64_t page_size = constants::tile_metadata_page_size;
+  uint64_t tile_nbytes = 0;
+  *nbytes = 0;
+
+  // Arrays that fit in a single page are stored whole
+  if (values_num <= page_size) {
+    Buffer buff;
+    RETURN_NOT_OK(buff.write(&values_num, sizeof(uint64_t)));
+    if (values_num != 0)
+      RETURN_NOT_OK(buff.write(&values[0], values_num * sizeof(uint64_t)));
+    RETURN_NOT_OK(write_generic_tile_to_file(encryption_key, buff, nbytes));
+    storage_manager_->stats()->add_counter(stat_name, *nbytes);
+    return Status::Ok();
+  }
+
+  // Store the pages
+  uint64_t page_num = utils::math::ceil(values_num, page_size);
+  std::vector<uint64_t> page_offsets(page_num);
+  for (uint64_t p = 0; p < page_num; ++p) {
+    auto page_start = p * page_size;
+    auto page_values_num = std::min(page_size, values_num - page_start);
+    Buffer buff;
+    RETURN_NOT_OK(buff.write(
+        &values[page_start], page_values_num * sizeof(uint64_t)));
+    page_offsets[p] = *gt_offset + *nbytes;
+    RETURN_NOT_OK(
+        write_generic_tile_to_file(encryption_key, buff, &tile_nbytes));
+    *nbytes += tile_nbytes;
+  }
+
+  // Store the page directory, which the loaders start from
+  Buffer buff;
+  RETURN_NOT_OK(buff.write(
+      &constants::tile_metadata_page_directory_marker, sizeof(uint64_t)));
+  RETURN_NOT_OK(buff.write(&values_num, sizeof(uint64_t)));
+  RETURN_NOT_OK(buff.write(&page_size, sizeof(uint64_t)));
+  RETURN_NOT_OK(buff.write(&page_num, sizeof(uint64_t)));
+  RETURN_NOT_OK(buff.write(&page_offsets[0], page_num * sizeof(uint64_t)));
+  *gt_offset += *nbytes;
+  RETURN_NOT_OK(write_generic_tile_to_file(encryption_key, buff, &tile_nbytes));
+  *nbytes += tile_nbytes;
+
+  storage_manager_->stats()->add_counter(stat_name, *nbytes);
+
+  return Status::Ok();
+}
+
 Status FragmentMetadata::store_tile_mins(
     unsigned idx, const EncryptionKey& encryption_key, uint64_t* nbytes) {
   Buffer buff;
@@ -4740,6 +5468,49 @@ Status FragmentMetadata::write_tile_null_counts(unsigned idx, Buffer* buff) {
   return Status::Ok();
 }
 
+Status FragmentMetadata::store_tile_bloom_filters(
+    unsigned idx, const EncryptionKey& encryption_key, uint64_t* nbytes) {
+  Buffer buff;
+  RETURN_NOT_OK(write_tile_bloom_filters(idx, &buff));
+  RETURN_NOT_OK(write_generic_tile_to_file(encryption_key, buff, nbytes));
+
+  storage_manager_->stats()->add_counter("write_bloom_filters_size", *nbytes);
+
+  return Status::Ok();
+}
+
+Status FragmentMetadata::write_tile_bloom_filters(unsigned idx, Buffer* buff) {
+  Status st;
+
+  // Write number of tile Bloom filters
+  const auto& filters = tile_bloom_filters_[idx];
+  uint64_t tile_bloom_filter_num = filters.size();
+
+  st = buff->write(&tile_bloom_filter_num, sizeof(uint64_t));
+  if (!st.ok()) {
+    return LOG_STATUS(
+        Status_FragmentMetadataError("Cannot serialize fragment metadata; "
+                                     "Writing number of tile Bloom filters "
+                                     "failed"));
+  }
+
+  // Write tile Bloom filters
+  for (uint64_t t = 0; t < tile_bloom_filter_num; t++) {
+    uint64_t filter_size = filters[t].size();
+    st = buff->write(&filter_size, sizeof(uint64_t));
+    if (st.ok() && filter_size != 0)
+      st = buff->write(filters[t].data(), filter_size);
+
+    if (!st.ok()) {
+      return LOG_STATUS(Status_FragmentMetadataError(
+          "Cannot serialize fragment metadata; Writing tile Bloom filters "
+          "failed"));
+    }
+  }
+
+  return Status::Ok();
+}
+
 Status FragmentMetadata::store_fragment_min_max_sum_null_count(
     uint64_t num, const EncryptionKey& encryption_key, uint64_t* nbytes) {
   Status st;
@@ -5164,6 +5935,11 @@ Status FragmentMetadata::write_has_delete_meta(Buffer* buff) const {
   return Status::Ok();
 }
 
+Status FragmentMetadata::write_has_hilbert_values(Buffer* buff) const {
+  RETURN_NOT_OK(buff->write(&has_hilbert_values_, sizeof(char)));
+  return Status::Ok();
+}
+
 Status FragmentMetadata::store_footer(const EncryptionKey& encryption_key) {
   (void)encryption_key;  // Not used for now, maybe in the future
 
@@ -5211,6 +5987,9 @@ void FragmentMetadata::build_idx_map() {
     idx_map_[constants::delete_timestamps] = idx++;
     idx_map_[constants::delete_condition_marker_hash] = idx++;
   }
+  if (has_hilbert_values_) {
+    idx_map_[constants::hilbert_values] = idx++;
+  }
 }
 
 // Explicit template instantiations
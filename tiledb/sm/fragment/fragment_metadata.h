@@ -34,6 +34,7 @@
 #ifndef TILEDB_FRAGMENT_METADATA_H
 #define TILEDB_FRAGMENT_METADATA_H
 
+#include <atomic>
 #include <deque>
 #include <mutex>
 #include <unordered_map>
@@ -42,6 +43,7 @@
 #include "tiledb/common/common.h"
 #include "tiledb/common/status.h"
 #include "tiledb/sm/array_schema/array_schema.h"
+#include "tiledb/sm/crypto/encryption_key.h"
 #include "tiledb/sm/filesystem/uri.h"
 #include "tiledb/sm/misc/types.h"
 #include "tiledb/sm/rtree/rtree.h"
@@ -58,7 +60,6 @@ namespace sm {
 
 class ArraySchema;
 class Buffer;
-class EncryptionKey;
 class MemoryTracker;
 class StorageManager;
 
@@ -86,6 +87,7 @@ class FragmentMetadata {
    * @param dense Indicates whether the fragment is dense or sparse.
    * @param has_timestamps Does the fragment contains timestamps.
    * @param has_delete_meta Does the fragment contains delete metadata.
+   * @param has_hilbert_values Does the fragment contains Hilbert values.
    */
   FragmentMetadata(
       StorageManager* storage_manager,
@@ -95,7 +97,8 @@ class FragmentMetadata {
       const std::pair<uint64_t, uint64_t>& timestamp_range,
       bool dense = true,
       bool has_timestamps = false,
-      bool has_delete_mata = false);
+      bool has_delete_mata = false,
+      bool has_hilbert_values = false);
 
   /** Destructor. */
   ~FragmentMetadata();
@@ -114,7 +117,7 @@ class FragmentMetadata {
    */
   inline uint64_t num_dims_and_attrs() const {
     return array_schema_->attribute_num() + array_schema_->dim_num() + 1 +
-           has_timestamps_ + (has_delete_meta_ * 2);
+           has_timestamps_ + (has_delete_meta_ * 2) + has_hilbert_values_;
   }
 
   /** Returns the number of cells in the fragment. */
@@ -245,6 +248,11 @@ class FragmentMetadata {
     return has_delete_meta_;
   }
 
+  /** Returns true if the fragment has persisted Hilbert values. */
+  inline bool has_hilbert_values() const {
+    return has_hilbert_values_;
+  }
+
   /**
    * Retrieves the overlap of all MBRs with the input ND range.
    */
@@ -253,6 +261,19 @@ class FragmentMetadata {
       std::vector<bool>& is_default,
       TileOverlap* tile_overlap);
 
+  /**
+   * Retrieves the overlap of all MBRs with each of the input ND ranges,
+   * traversing the R-tree once for all ranges (see
+   * `RTree::get_tile_overlap`). If `visited_node_num` is not `nullptr`, it
+   * is incremented by the number of R-tree nodes visited.
+   */
+  Status get_tile_overlap(
+      const std::vector<const Range*>& ranges,
+      std::vector<bool>& is_default,
+      ThreadPool* compute_tp,
+      std::vector<TileOverlap>* tile_overlaps,
+      uint64_t* visited_node_num = nullptr);
+
   /**
    * Compute tile bitmap for the curent fragment/range/dimension.
    */
@@ -492,6 +513,17 @@ class FragmentMetadata {
   void set_tile_null_count(
       const std::string& name, uint64_t tid, uint64_t null_count);
 
+  /**
+   * Sets a tile Bloom filter for the input attribute/dimension.
+   *
+   * @param name The attribute/dimension for which the Bloom filter is set.
+   * @param tid The index of the tile for which the Bloom filter is set.
+   * @param bloom_filter The serialized Bloom filter.
+   * @return void
+   */
+  void set_tile_bloom_filter(
+      const std::string& name, uint64_t tid, const ByteVec& bloom_filter);
+
   /**
    * Compute fragment min, max, sum, null count for all dimensions/attributes.
    *
@@ -570,11 +602,21 @@ class FragmentMetadata {
 
   uint64_t footer_size() const;
 
-  /** Returns the MBR of the input tile. */
-  const NDRange& mbr(uint64_t tile_idx) const;
+  /**
+   * Returns the MBR of the input tile. For paged R-trees, this loads the
+   * R-tree leaf page holding the MBR if needed.
+   */
+  NDRange mbr(uint64_t tile_idx) const;
+
+  /**
+   * Returns the MBR of the input tile without copying it. For paged
+   * R-trees, the leaf page holding the MBR is loaded if needed and kept in
+   * `pinned`, the returned reference is valid as long as it stays pinned.
+   */
+  const NDRange& mbr(uint64_t tile_idx, RTree::PinnedLeafPage* pinned) const;
 
-  /** Returns all the MBRs of all tiles in the fragment. */
-  const std::vector<NDRange>& mbrs() const;
+  /** Returns the number of MBRs, one per tile in the fragment. */
+  uint64_t mbr_num() const;
 
   /**
    * Retrieves the size of the tile when it is persisted (e.g. the size of the
@@ -678,6 +720,29 @@ class FragmentMetadata {
   tuple<Status, optional<uint64_t>> get_tile_null_count(
       const std::string& name, uint64_t tile_idx);
 
+  /**
+   * Returns whether any tile of the input attribute/dimension has a Bloom
+   * filter. This only requires the footer to be loaded.
+   *
+   * @param name The input attribute/dimension.
+   * @return bool
+   */
+  bool has_tile_bloom_filters(const std::string& name) const;
+
+  /**
+   * Checks the tile Bloom filter of a given attribute or dimension and tile
+   * index for a value. The Bloom filters must have been loaded with
+   * `load_tile_bloom_filters`.
+   *
+   * @param name The input attribute/dimension.
+   * @param tile_idx The index of the tile in the metadata.
+   * @param hash The hash of the value to look up, see `BloomFilter::hash`.
+   * @return `false` if the tile definitely does not contain the value,
+   *     `true` otherwise, including when the tile has no Bloom filter.
+   */
+  bool tile_may_contain(
+      const std::string& name, uint64_t tile_idx, uint64_t hash) const;
+
   /**
    * Retrieves the min value for a given attribute or dimension.
    *
@@ -745,7 +810,10 @@ class FragmentMetadata {
   /** Serializes the fragment metadata footer into the input buffer. */
   Status write_footer(Buffer* buff) const;
 
-  /** Loads the R-tree from storage. */
+  /**
+   * Loads the R-tree from storage. For paged R-trees, only the upper levels
+   * are loaded, the leaf pages are loaded on demand.
+   */
   Status load_rtree(const EncryptionKey& encryption_key);
 
   /** Frees the memory associated with the rtree. */
@@ -808,6 +876,16 @@ class FragmentMetadata {
   Status load_tile_null_count_values(
       const EncryptionKey& encryption_key, std::vector<std::string>&& names);
 
+  /**
+   * Loads the tile Bloom filters for the attribute/dimension names.
+   *
+   * @param encryption_key The key the array got opened with.
+   * @param names The attribute/dimension names.
+   * @return Status
+   */
+  Status load_tile_bloom_filters(
+      const EncryptionKey& encryption_key, std::vector<std::string>&& names);
+
   /**
    * Loads the min max sum null count values for the fragment.
    *
@@ -879,6 +957,7 @@ class FragmentMetadata {
     std::vector<uint64_t> tile_null_count_offsets_;
     uint64_t fragment_min_max_sum_null_count_offset_;
     uint64_t processed_conditions_offsets_;
+    std::vector<uint64_t> tile_bloom_filter_offsets_;
   };
 
   /** Keeps track of which metadata is loaded. */
@@ -895,6 +974,37 @@ class FragmentMetadata {
     std::vector<bool> tile_null_count_;
     bool fragment_min_max_sum_null_count_ = false;
     bool processed_conditions_ = false;
+    std::vector<bool> tile_bloom_filter_;
+  };
+
+  /**
+   * Page directory and loaded pages of one per-tile metadata array (tile
+   * offsets, var offsets, var sizes or validity offsets) stored in the paged
+   * layout of format version 17 or higher. Only the directory is loaded up
+   * front, the pages are loaded the first time one of their tiles is
+   * accessed.
+   */
+  struct TileMetadataPages {
+    /** True if the array is stored in pages and its directory is loaded. */
+    bool paged_ = false;
+
+    /** Total number of values. */
+    uint64_t num_ = 0;
+
+    /** Number of values per page. */
+    uint64_t page_size_ = 0;
+
+    /** Offsets of the page generic tiles in the metadata file. */
+    std::vector<uint64_t> page_offsets_;
+
+    /** The page values, empty for pages that are not loaded yet. */
+    std::vector<std::vector<uint64_t>> pages_;
+
+    /** Set once the corresponding page is loaded. */
+    std::vector<std::atomic<bool>> page_loaded_;
+
+    /** Protects the page loading. */
+    std::mutex mtx_;
   };
 
   /* ********************************* */
@@ -966,6 +1076,9 @@ class FragmentMetadata {
   /** True if the fragment has delete metadata, and false otherwise. */
   bool has_delete_meta_;
 
+  /** True if the fragment has Hilbert values, and false otherwise. */
+  bool has_hilbert_values_;
+
   /** Number of sparse tiles. */
   uint64_t sparse_tile_num_;
 
@@ -978,12 +1091,34 @@ class FragmentMetadata {
   /** Local mutex for thread-safety. */
   std::mutex mtx_;
 
+  /**
+   * Copy of the encryption key the metadata is loaded with, used for the
+   * metadata and R-tree pages loaded lazily, possibly after the caller's
+   * key is gone.
+   */
+  EncryptionKey lazy_load_encryption_key_;
+
+  /** Guards the copy of `lazy_load_encryption_key_`. */
+  std::once_flag lazy_load_encryption_key_flag_;
+
   /** Mutex per tile offset loading. */
   std::deque<std::mutex> tile_offsets_mtx_;
 
   /** Mutex per tile var offset loading. */
   std::deque<std::mutex> tile_var_offsets_mtx_;
 
+  /** Pages of the tile offsets, for format version 17 or higher. */
+  std::deque<TileMetadataPages> tile_offsets_pages_;
+
+  /** Pages of the tile var offsets, for format version 17 or higher. */
+  std::deque<TileMetadataPages> tile_var_offsets_pages_;
+
+  /** Pages of the tile var sizes, for format version 17 or higher. */
+  std::deque<TileMetadataPages> tile_var_sizes_pages_;
+
+  /** Pages of the tile validity offsets, for format version 17 or higher. */
+  std::deque<TileMetadataPages> tile_validity_offsets_pages_;
+
   /** The non-empty domain of the fragment. */
   NDRange non_empty_domain_;
 
@@ -1052,6 +1187,12 @@ class FragmentMetadata {
    */
   std::vector<std::vector<uint64_t>> tile_null_counts_;
 
+  /**
+   * The serialized tile Bloom filters for attributes/dimensions, one per
+   * tile. An empty filter means the tile has no Bloom filter.
+   */
+  std::vector<std::vector<ByteVec>> tile_bloom_filters_;
+
   /**
    * Fragment min values.
    */
@@ -1202,6 +1343,12 @@ class FragmentMetadata {
   Status load_tile_null_count_values(
       const EncryptionKey& encryption_key, unsigned idx);
 
+  /**
+   * Loads the tile Bloom filters for the input attribute idx from storage.
+   */
+  Status load_tile_bloom_filters(
+      const EncryptionKey& encryption_key, unsigned idx);
+
   /** Loads the generic tile offsets from the buffer. */
   Status load_generic_tile_offsets(ConstBuffer* buff);
 
@@ -1314,6 +1461,14 @@ class FragmentMetadata {
    */
   Status load_has_delete_meta(ConstBuffer* buff);
 
+  /**
+   * Loads the `has_hilbert_values_` field from the buffer.
+   *
+   * @param buff Metadata buffer.
+   * @return Status
+   */
+  Status load_has_hilbert_values(ConstBuffer* buff);
+
   /**
    * Loads the MBRs from the fragment metadata buffer.
    *
@@ -1382,6 +1537,52 @@ class FragmentMetadata {
    */
   Status load_tile_validity_offsets(unsigned idx, ConstBuffer* buff);
 
+  /**
+   * Keeps a copy of the encryption key for the metadata pages loaded
+   * lazily. Only the first key is kept, as a fragment is always loaded with
+   * the same key.
+   *
+   * @param encryption_key The encryption key the metadata is loaded with.
+   * @return Status
+   */
+  Status keep_lazy_load_encryption_key(const EncryptionKey& encryption_key);
+
+  /**
+   * Loads the page directory of a paged per-tile metadata array from the
+   * input buffer. Arrays that fit in a single page are stored whole, in
+   * which case `paged` is set to false and the buffer is left untouched.
+   * Page directories are told apart by the marker they start with.
+   *
+   * @param encryption_key The encryption key used to load the pages.
+   * @param buff The buffer holding the generic tile of the array.
+   * @param pages The page directory to load.
+   * @param paged Set to true if the buffer holds a page directory.
+   * @return Status
+   */
+  Status load_tile_metadata_pages(
+      const EncryptionKey& encryption_key,
+      ConstBuffer* buff,
+      TileMetadataPages* pages,
+      bool* paged);
+
+  /**
+   * Retrieves a value of a per-tile metadata array, loading the page that
+   * holds it if the array is paged.
+   *
+   * @param pages The page directory of the array.
+   * @param values The array values, when it is not paged.
+   * @param stat_name The stats counter to add the loaded page size to.
+   * @param tile_idx The index of the tile.
+   * @param value The retrieved value.
+   * @return Status
+   */
+  Status get_tile_metadata_value(
+      TileMetadataPages& pages,
+      const std::vector<uint64_t>& values,
+      const std::string& stat_name,
+      uint64_t tile_idx,
+      uint64_t* value);
+
   /**
    * Loads the min values for the input attribute from the input buffer.
    */
@@ -1403,6 +1604,12 @@ class FragmentMetadata {
    */
   Status load_tile_null_count_values(unsigned idx, ConstBuffer* buff);
 
+  /**
+   * Loads the tile Bloom filters for the input attribute from the input
+   * buffer.
+   */
+  Status load_tile_bloom_filters(unsigned idx, ConstBuffer* buff);
+
   /**
    * Loads the min max sum null count values for the fragment.
    */
@@ -1480,6 +1687,11 @@ class FragmentMetadata {
    */
   Status write_has_delete_meta(Buffer* buff) const;
 
+  /**
+   * Writes the `has_hilbert_values_` field to the fragment metadata buffer.
+   */
+  Status write_has_hilbert_values(Buffer* buff) const;
+
   /**
    * Writes the R-tree to storage.
    *
@@ -1489,12 +1701,51 @@ class FragmentMetadata {
    */
   Status store_rtree(const EncryptionKey& encryption_key, uint64_t* nbytes);
 
+  /**
+   * Writes the R-tree to storage in the paged format of format version 17
+   * or higher. An R-tree whose leaves fit in a single leaf page is written
+   * as with `store_rtree`. Otherwise every leaf page is written as a
+   * separate generic tile, followed by the upper levels of the tree and the
+   * leaf page offsets.
+   *
+   * @param encryption_key The encryption key.
+   * @param gt_offset The offset the R-tree is written at. It is set to the
+   *     offset of the upper levels if the R-tree is paged.
+   * @param nbytes The total number of bytes written for the R-tree.
+   * @return Status
+   */
+  Status store_rtree_pages(
+      const EncryptionKey& encryption_key,
+      uint64_t* gt_offset,
+      uint64_t* nbytes);
+
   /** Stores a footer with the basic information. */
   Status store_footer(const EncryptionKey& encryption_key);
 
   /** Writes the R-tree to a tile. */
   Tile write_rtree();
 
+  /**
+   * Returns the packing of the R-tree leaves for new fragments, set with
+   * `sm.rtree_packing`.
+   */
+  RTree::Packing rtree_packing() const;
+
+  /**
+   * Sets the leaf page loader of a paged R-tree, which loads the pages with
+   * `lazy_load_encryption_key_`.
+   */
+  void set_rtree_leaf_page_loader();
+
+  /**
+   * Loads the R-tree leaf page stored at the input offset of the metadata
+   * file, going through the R-tree page cache of the storage manager. The
+   * page is charged to the memory budget until the caller releases it. It
+   * throws on failure.
+   */
+  shared_ptr<const std::vector<NDRange>> load_rtree_leaf_page(
+      uint64_t page_offset) const;
+
   /** Writes the non-empty domain to the input buffer. */
   Status write_non_empty_domain(Buffer* buff) const;
 
@@ -1515,6 +1766,28 @@ class FragmentMetadata {
    */
   Status write_tile_offsets(unsigned idx, Buffer* buff);
 
+  /**
+   * Writes a per-tile metadata array to storage in the paged layout of
+   * format version 17 or higher. An array that fits in a single page is
+   * written as one generic tile, as in earlier versions. Otherwise every
+   * page is written as a separate generic tile, followed by a page
+   * directory.
+   *
+   * @param values The array values.
+   * @param encryption_key The encryption key.
+   * @param stat_name The stats counter to add the written size to.
+   * @param gt_offset The offset the array is written at. It is set to
+   *     the offset of the page directory if the array is paged.
+   * @param nbytes The total number of bytes written for the array.
+   * @return Status
+   */
+  Status store_tile_metadata_pages(
+      const std::vector<uint64_t>& values,
+      const EncryptionKey& encryption_key,
+      const std::string& stat_name,
+      uint64_t* gt_offset,
+      uint64_t* nbytes);
+
   /**
    * Writes the variable tile offsets of the input attribute or dimension
    * to storage.
@@ -1633,6 +1906,22 @@ class FragmentMetadata {
    */
   Status write_tile_null_counts(unsigned idx, Buffer* buff);
 
+  /**
+   * Writes the tile Bloom filters of the input attribute idx to storage.
+   *
+   * @param idx The index of the attribute.
+   * @param encryption_key The encryption key.
+   * @param nbytes The total number of bytes written for the Bloom filters.
+   * @return Status
+   */
+  Status store_tile_bloom_filters(
+      unsigned idx, const EncryptionKey& encryption_key, uint64_t* nbytes);
+
+  /**
+   * Writes the Bloom filters of the input attribute idx to the input buffer.
+   */
+  Status write_tile_bloom_filters(unsigned idx, Buffer* buff);
+
   /**
    * Writes the fragment min, max, sum and null count to storage.
    *
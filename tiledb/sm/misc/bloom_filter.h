@@ -0,0 +1,209 @@
+/**
+ * @file   bloom_filter.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class BloomFilter.
+ */
+
+#ifndef TILEDB_BLOOM_FILTER_H
+#define TILEDB_BLOOM_FILTER_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * A Bloom filter over the raw bytes of cell values, used as per-tile
+ * metadata to answer "does this tile possibly contain value v?" without
+ * reading the tile. False positives are possible, false negatives are not.
+ *
+ * The serialized filter is self-describing and has the following layout:
+ *
+ *   hash_num (uint8_t) | bits (uint64_t words)
+ *
+ * An empty serialized filter means "no filter", i.e. any value may be
+ * contained. The hash function is stable across platforms and releases, as
+ * the filters are persisted in the fragment metadata.
+ */
+class BloomFilter {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param value_num The (expected) number of values that will be inserted.
+   * @param bits_per_value The number of filter bits per value.
+   */
+  BloomFilter(uint64_t value_num, uint64_t bits_per_value)
+      : hash_num_(hash_num(bits_per_value))
+      , words_(std::max<uint64_t>(1, (value_num * bits_per_value + 63) / 64)) {
+  }
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Inserts a value into the filter. */
+  void insert(const void* value, uint64_t size) {
+    const uint64_t bit_num = words_.size() * 64;
+    uint64_t h1, h2;
+    hashes(value, size, &h1, &h2);
+    for (uint8_t i = 0; i < hash_num_; i++) {
+      const uint64_t bit = (h1 + i * h2) % bit_num;
+      words_[bit / 64] |= uint64_t(1) << (bit % 64);
+    }
+  }
+
+  /** Serializes the filter, see the class description for the layout. */
+  std::vector<uint8_t> serialize() const {
+    std::vector<uint8_t> buff(1 + words_.size() * sizeof(uint64_t));
+    buff[0] = hash_num_;
+    std::memcpy(&buff[1], words_.data(), words_.size() * sizeof(uint64_t));
+    return buff;
+  }
+
+  /**
+   * Checks whether a serialized filter possibly contains a value.
+   *
+   * @param filter The serialized filter.
+   * @param filter_size The size of the serialized filter.
+   * @param value The value to look up.
+   * @param size The size of the value.
+   * @return `false` if the value is definitely not contained in the filter,
+   *     `true` otherwise (including when the filter is empty or malformed).
+   */
+  static bool may_contain(
+      const uint8_t* filter,
+      uint64_t filter_size,
+      const void* value,
+      uint64_t size) {
+    return may_contain(filter, filter_size, hash(value, size));
+  }
+
+  /**
+   * Checks whether a serialized filter possibly contains a value, given the
+   * hash of the value computed with `hash`. This avoids rehashing a value
+   * looked up in many filters.
+   *
+   * @param filter The serialized filter.
+   * @param filter_size The size of the serialized filter.
+   * @param h The hash of the value to look up.
+   * @return `false` if the value is definitely not contained in the filter,
+   *     `true` otherwise (including when the filter is empty or malformed).
+   */
+  static bool may_contain(
+      const uint8_t* filter, uint64_t filter_size, uint64_t h) {
+    if (filter_size < 1 + sizeof(uint64_t) ||
+        (filter_size - 1) % sizeof(uint64_t) != 0)
+      return true;
+
+    const uint8_t hash_num = filter[0];
+    const uint8_t* bits = filter + 1;
+    const uint64_t bit_num = (filter_size - 1) * 8;
+    const uint64_t h1 = h;
+    const uint64_t h2 = second_hash(h);
+    for (uint8_t i = 0; i < hash_num; i++) {
+      // Bit `b` of word `w` is stored in little-endian byte order.
+      const uint64_t bit = (h1 + i * h2) % bit_num;
+      const uint64_t byte = (bit / 64) * 8 + (bit % 64) / 8;
+      if ((bits[byte] & (1 << (bit % 8))) == 0)
+        return false;
+    }
+
+    return true;
+  }
+
+  /**
+   * Returns the number of hash functions that minimizes the false positive
+   * rate for the input number of bits per value, i.e. `bits * ln(2)`.
+   */
+  static uint8_t hash_num(uint64_t bits_per_value) {
+    const auto k = std::lround(bits_per_value * 0.6931471805599453);
+    return (uint8_t)std::clamp<long>(k, 1, 16);
+  }
+
+  /** Returns a stable 64-bit hash of the input bytes (FNV-1a + fmix64). */
+  static uint64_t hash(const void* value, uint64_t size) {
+    auto bytes = static_cast<const uint8_t*>(value);
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (uint64_t i = 0; i < size; i++) {
+      h ^= bytes[i];
+      h *= 0x100000001b3ULL;
+    }
+
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The number of hash functions. */
+  uint8_t hash_num_;
+
+  /** The filter bits. */
+  std::vector<uint64_t> words_;
+
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /**
+   * Computes the two base hashes used for double hashing, i.e. the i-th hash
+   * function is `h1 + i * h2`.
+   */
+  static void hashes(
+      const void* value, uint64_t size, uint64_t* h1, uint64_t* h2) {
+    *h1 = hash(value, size);
+    *h2 = second_hash(*h1);
+  }
+
+  /** Derives the second base hash from the first one. */
+  static uint64_t second_hash(uint64_t h1) {
+    return (h1 >> 32) | (h1 << 32) | 1;
+  }
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_BLOOM_FILTER_H
@@ -36,9 +36,12 @@
 #define TILEDB_COMPARATORS_H
 
 #include <cinttypes>
+#include <type_traits>
 #include <vector>
 
+#include "tiledb/sm/array_schema/dimension.h"
 #include "tiledb/sm/array_schema/domain.h"
+#include "tiledb/sm/enums/datatype.h"
 #include "tiledb/sm/enums/layout.h"
 #include "tiledb/sm/query/readers/result_coords.h"
 #include "tiledb/sm/query/readers/sparse_global_order_reader.h"
@@ -512,6 +515,322 @@ class HilbertCmpQB : protected DomainValueCmpBaseQB {
   }
 };
 
+/**
+ * Global order comparison function class specialized at compile time for
+ * domains of `DimNum` fixed-sized dimensions that all have coordinate type
+ * `T`. The tile extents and domain lower bounds are captured on construction,
+ * so that the tile and cell order comparisons can be fully inlined instead of
+ * going through the per-dimension comparators of `Domain`.
+ *
+ * @tparam T The coordinate type of all dimensions.
+ * @tparam DimNum The number of dimensions.
+ * @tparam TileOrder The tile order (row-major or col-major).
+ * @tparam CellOrder The cell order (row-major or col-major).
+ */
+template <class T, unsigned DimNum, Layout TileOrder, Layout CellOrder>
+class TypedGlobalCmp {
+  static_assert(DimNum > 0, "TypedGlobalCmp requires at least one dimension");
+  static_assert(
+      TileOrder == Layout::ROW_MAJOR || TileOrder == Layout::COL_MAJOR,
+      "TypedGlobalCmp requires a row-major or col-major tile order");
+  static_assert(
+      CellOrder == Layout::ROW_MAJOR || CellOrder == Layout::COL_MAJOR,
+      "TypedGlobalCmp requires a row-major or col-major cell order");
+
+ public:
+  /**
+   * Constructor.
+   *
+   * @param domain The array domain.
+   */
+  explicit TypedGlobalCmp(const Domain& domain) {
+    assert(domain.dim_num() == DimNum);
+    for (unsigned d = 0; d < DimNum; ++d) {
+      const auto dim{domain.dimension_ptr(d)};
+      assert(!dim->var_size());
+      domain_low_[d] = *static_cast<const T*>(dim->domain().start_fixed());
+      has_tile_extent_[d] = static_cast<bool>(dim->tile_extent());
+      tile_extent_[d] =
+          has_tile_extent_[d] ? dim->tile_extent().template rvalue_as<T>() : 0;
+    }
+  }
+
+  /**
+   * Comparison operator for `ResultCoords` types.
+   *
+   * @param a The first coordinate.
+   * @param b The second coordinate.
+   * @return `true` if `a` precedes `b` and `false` otherwise.
+   */
+  template <class RCType>
+  bool operator()(const RCType& a, const RCType& b) const {
+    T ca[DimNum];
+    T cb[DimNum];
+    for (unsigned d = 0; d < DimNum; ++d) {
+      ca[d] = *static_cast<const T*>(a.coord(d));
+      cb[d] = *static_cast<const T*>(b.coord(d));
+    }
+
+    // Compare tile order
+    for (unsigned i = 0; i < DimNum; ++i) {
+      const unsigned d = TileOrder == Layout::ROW_MAJOR ? i : DimNum - 1 - i;
+      if (!has_tile_extent_[d])
+        continue;
+
+      auto ta = Dimension::tile_idx(ca[d], domain_low_[d], tile_extent_[d]);
+      auto tb = Dimension::tile_idx(cb[d], domain_low_[d], tile_extent_[d]);
+      if (ta < tb)
+        return true;
+      if (ta > tb)
+        return false;
+      // else same tile on dimension d --> continue
+    }
+
+    // Compare cell order
+    for (unsigned i = 0; i < DimNum; ++i) {
+      const unsigned d = CellOrder == Layout::ROW_MAJOR ? i : DimNum - 1 - i;
+      if (ca[d] < cb[d])
+        return true;
+      if (ca[d] > cb[d])
+        return false;
+      // else same coordinate on dimension d --> continue
+    }
+
+    return false;
+  }
+
+ private:
+  /** The lower bound of the domain, per dimension. */
+  T domain_low_[DimNum];
+
+  /** The tile extents, per dimension. */
+  T tile_extent_[DimNum];
+
+  /** Whether the dimension has a tile extent, per dimension. */
+  bool has_tile_extent_[DimNum];
+};
+
+/**
+ * Hilbert order comparison function class specialized at compile time for
+ * domains of `DimNum` fixed-sized dimensions that all have coordinate type
+ * `T`. Ties on the Hilbert value are broken on row-major cell order.
+ *
+ * @tparam T The coordinate type of all dimensions.
+ * @tparam DimNum The number of dimensions.
+ */
+template <class T, unsigned DimNum>
+class TypedHilbertCmp {
+  static_assert(DimNum > 0, "TypedHilbertCmp requires at least one dimension");
+
+ public:
+  /**
+   * Constructor.
+   *
+   * @param domain The array domain.
+   */
+  explicit TypedHilbertCmp(const Domain& domain) {
+    assert(domain.dim_num() == DimNum);
+    (void)domain;
+  }
+
+  /**
+   * Positional comparison operator.
+   *
+   * @param a The first coordinate.
+   * @param b The second coordinate.
+   * @return `true` if `a` precedes `b` and `false` otherwise.
+   */
+  template <class BitmapType>
+  bool operator()(
+      const GlobalOrderResultCoords<BitmapType>& a,
+      const GlobalOrderResultCoords<BitmapType>& b) const {
+    auto hilbert_a = a.tile_->hilbert_value(a.pos_);
+    auto hilbert_b = b.tile_->hilbert_value(b.pos_);
+    if (hilbert_a < hilbert_b)
+      return true;
+    else if (hilbert_a > hilbert_b)
+      return false;
+    // else the hilbert values are equal
+
+    // Compare cell order on row-major to break the tie
+    for (unsigned d = 0; d < DimNum; ++d) {
+      auto ca = *static_cast<const T*>(a.coord(d));
+      auto cb = *static_cast<const T*>(b.coord(d));
+      if (ca < cb)
+        return true;
+      if (ca > cb)
+        return false;
+      // else same coordinate on dimension d --> continue
+    }
+
+    return false;
+  }
+};
+
+/**
+ * Wrapper of a comparison function class that sorts in reverse order, used
+ * to turn the comparators above into min heap comparators.
+ *
+ * @tparam CmpType The wrapped comparison function class.
+ */
+template <class CmpType>
+class ReverseCmp {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param domain The array domain.
+   */
+  explicit ReverseCmp(const Domain& domain)
+      : cmp_(domain) {
+  }
+
+  /**
+   * Comparison operator.
+   *
+   * @param a The first coordinate.
+   * @param b The second coordinate.
+   * @return `true` if `a` does not precede `b` and `false` otherwise.
+   */
+  template <class RCType>
+  bool operator()(const RCType& a, const RCType& b) const {
+    return !cmp_.operator()(a, b);
+  }
+
+ private:
+  /** The wrapped comparator. */
+  CmpType cmp_;
+};
+
+namespace detail {
+
+/**
+ * Invokes `f` with the reverse order comparator specialized for coordinate
+ * type `T` and the number of dimensions of `domain`, or returns `nullopt`
+ * if the domain shape has no specialization.
+ */
+template <class T, class F>
+auto with_typed_reverse_cmp(const Domain& domain, F&& f)
+    -> optional<std::invoke_result_t<F, GlobalCmpReverse>> {
+  using ResultType = std::invoke_result_t<F, GlobalCmpReverse>;
+  const auto cell_order = domain.cell_order();
+  const auto tile_order = domain.tile_order();
+
+  auto dispatch = [&](auto dim_num) -> optional<ResultType> {
+    constexpr unsigned N = decltype(dim_num)::value;
+    if (cell_order == Layout::HILBERT) {
+      return f(ReverseCmp<TypedHilbertCmp<T, N>>(domain));
+    } else if (
+        tile_order == Layout::ROW_MAJOR && cell_order == Layout::ROW_MAJOR) {
+      return f(ReverseCmp<
+               TypedGlobalCmp<T, N, Layout::ROW_MAJOR, Layout::ROW_MAJOR>>(
+          domain));
+    } else if (
+        tile_order == Layout::COL_MAJOR && cell_order == Layout::COL_MAJOR) {
+      return f(ReverseCmp<
+               TypedGlobalCmp<T, N, Layout::COL_MAJOR, Layout::COL_MAJOR>>(
+          domain));
+    }
+
+    // Mixed tile/cell orders use the generic comparators.
+    return nullopt;
+  };
+
+  switch (domain.dim_num()) {
+    case 1:
+      return dispatch(std::integral_constant<unsigned, 1>());
+    case 2:
+      return dispatch(std::integral_constant<unsigned, 2>());
+    case 3:
+      return dispatch(std::integral_constant<unsigned, 3>());
+    case 4:
+      return dispatch(std::integral_constant<unsigned, 4>());
+    default:
+      return nullopt;
+  }
+}
+
+}  // namespace detail
+
+/**
+ * Invokes `f` with the reverse global order comparator (Hilbert order if the
+ * cell order is Hilbert) that is best suited for `domain` and returns its
+ * result. Domains of one to four dimensions that all have the same 32 or 64
+ * bit integer, datetime or floating point type, in row-major, col-major or
+ * Hilbert order, get a comparator specialized at compile time. All other
+ * domains fall back to `GlobalCmpReverse` or `HilbertCmpReverse`.
+ *
+ * The comparator is selected once, so that `f` (typically a merge loop
+ * templated on the comparator type) is instantiated per specialization.
+ *
+ * @param domain The array domain.
+ * @param f Function object invoked with the comparator.
+ * @return The result of `f`.
+ */
+template <class F>
+auto with_global_cmp_reverse(const Domain& domain, F&& f)
+    -> std::invoke_result_t<F, GlobalCmpReverse> {
+  using ResultType = std::invoke_result_t<F, GlobalCmpReverse>;
+  optional<ResultType> ret = nullopt;
+
+  if (domain.all_dims_same_type() && !domain.dimension_ptr(0)->var_size()) {
+    switch (domain.dimension_ptr(0)->type()) {
+      case Datatype::INT32:
+        ret = detail::with_typed_reverse_cmp<int32_t>(domain, f);
+        break;
+      case Datatype::UINT32:
+        ret = detail::with_typed_reverse_cmp<uint32_t>(domain, f);
+        break;
+      case Datatype::INT64:
+      case Datatype::DATETIME_YEAR:
+      case Datatype::DATETIME_MONTH:
+      case Datatype::DATETIME_WEEK:
+      case Datatype::DATETIME_DAY:
+      case Datatype::DATETIME_HR:
+      case Datatype::DATETIME_MIN:
+      case Datatype::DATETIME_SEC:
+      case Datatype::DATETIME_MS:
+      case Datatype::DATETIME_US:
+      case Datatype::DATETIME_NS:
+      case Datatype::DATETIME_PS:
+      case Datatype::DATETIME_FS:
+      case Datatype::DATETIME_AS:
+      case Datatype::TIME_HR:
+      case Datatype::TIME_MIN:
+      case Datatype::TIME_SEC:
+      case Datatype::TIME_MS:
+      case Datatype::TIME_US:
+      case Datatype::TIME_NS:
+      case Datatype::TIME_PS:
+      case Datatype::TIME_FS:
+      case Datatype::TIME_AS:
+        ret = detail::with_typed_reverse_cmp<int64_t>(domain, f);
+        break;
+      case Datatype::UINT64:
+        ret = detail::with_typed_reverse_cmp<uint64_t>(domain, f);
+        break;
+      case Datatype::FLOAT32:
+        ret = detail::with_typed_reverse_cmp<float>(domain, f);
+        break;
+      case Datatype::FLOAT64:
+        ret = detail::with_typed_reverse_cmp<double>(domain, f);
+        break;
+      default:
+        break;
+    }
+  }
+
+  if (ret.has_value()) {
+    return std::move(ret.value());
+  }
+
+  if (domain.cell_order() == Layout::HILBERT) {
+    return f(HilbertCmpReverse(domain));
+  }
+
+  return f(GlobalCmpReverse(domain));
+}
+
 }  // namespace tiledb::sm
 
 #endif  // TILEDB_COMPARATORS_H
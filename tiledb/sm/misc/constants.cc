@@ -102,6 +102,12 @@ const uint64_t cell_var_offset_size = sizeof(uint64_t);
 /** The type of a variable cell offset. */
 const Datatype cell_var_offset_type = Datatype::UINT64;
 
+/** The size of a variable cell view, in the `views` offsets format. */
+const uint64_t cell_var_view_size = 16;
+
+/** The maximum size of a variable cell stored inline in its view. */
+const uint64_t cell_var_view_inline_size = 12;
+
 /** The size of a validity cell. */
 const uint64_t cell_validity_size = sizeof(uint8_t);
 
@@ -136,6 +142,9 @@ const std::string delete_timestamps = "__delete_timestamps";
 const std::string delete_condition_marker_hash =
     "__delete_condition_marker_hash";
 
+/** Special name reserved for the Hilbert values attribute. */
+const std::string hilbert_values = "__hilbert_values";
+
 /** The size of a timestamp cell. */
 const uint64_t timestamp_size = sizeof(uint64_t);
 
@@ -145,6 +154,9 @@ extern const Datatype timestamp_type = Datatype::UINT64;
 /** The type of a delete condition marker hash cell. */
 extern const Datatype delete_condition_marker_hash_type = Datatype::UINT64;
 
+/** The type of a Hilbert value cell. */
+extern const Datatype hilbert_values_type = Datatype::UINT64;
+
 /** The default compressor for the coordinates. */
 Compressor coords_compression = Compressor::ZSTD;
 
@@ -229,6 +241,9 @@ const std::string write_file_suffix = ".wrt";
 /** Suffix for the special delete files used in TileDB. */
 const std::string delete_file_suffix = ".del";
 
+/** Suffix for the delete vector files used in TileDB. */
+const std::string delete_vector_file_suffix = ".dvec";
+
 /** Suffix for the special metadata files used in TileDB. */
 const std::string meta_file_suffix = ".meta";
 
@@ -318,6 +333,18 @@ const std::string query_condition_op_eq_str = "EQ";
 /** TILEDB_NE Query Condition Op String **/
 const std::string query_condition_op_ne_str = "NE";
 
+/** TILEDB_IN Query Condition Op String **/
+const std::string query_condition_op_in_str = "IN";
+
+/** TILEDB_NOT_IN Query Condition Op String **/
+const std::string query_condition_op_not_in_str = "NOT_IN";
+
+/**
+ * Sets with more members than this are probed by hashing, smaller ones
+ * by a linear scan.
+ */
+const uint64_t query_condition_set_hash_min_size = 16;
+
 /** TILEDB_AND Query Condition Combination Op String **/
 const std::string query_condition_combination_op_and_str = "AND";
 
@@ -387,6 +414,9 @@ const std::string filter_dictionary_str = "DICTIONARY_ENCODING";
 /** String describing FILTER_SCALE_FLOAT. */
 const std::string filter_scale_float_str = "SCALE_FLOAT";
 
+/** String describing FILTER_BITMAP. */
+const std::string filter_bitmap_str = "BITMAP";
+
 /** The string representation for FilterOption type compression_level. */
 const std::string filter_option_compression_level_str = "COMPRESSION_LEVEL";
 
@@ -611,7 +641,7 @@ const int32_t library_version[3] = {
     TILEDB_VERSION_MAJOR, TILEDB_VERSION_MINOR, TILEDB_VERSION_PATCH};
 
 /** The TileDB serialization base format version number. */
-const uint32_t base_format_version = 16;
+const uint32_t base_format_version = 17;
 
 /**
  * The TileDB serialization format version number.
@@ -633,6 +663,41 @@ const uint32_t consolidation_with_timestamps_min_version = 15;
 /** The lowest version supported for deletes. */
 const uint32_t deletes_min_version = 16;
 
+/** The lowest version supported for persisted Hilbert values. */
+const uint32_t hilbert_values_min_version = 17;
+
+/** The lowest version supported for paged tile offsets and var sizes. */
+const uint32_t tile_metadata_pages_min_version = 17;
+
+/** Number of values in a page of paged tile offsets and var sizes. */
+const uint64_t tile_metadata_page_size = 8192;
+
+/**
+ * Marker starting the page directory of paged tile offsets and var sizes,
+ * which cannot be the number of values of an array stored whole.
+ */
+const uint64_t tile_metadata_page_directory_marker =
+    std::numeric_limits<uint64_t>::max();
+
+/** The lowest version supported for paged R-trees. */
+const uint32_t rtree_pages_min_version = 17;
+
+/** Minimum number of leaves in a leaf page of a paged R-tree. */
+const uint64_t rtree_leaf_page_size = 8192;
+
+/** The lowest version supported for R-trees with packed leaves. */
+const uint32_t rtree_packing_min_version = 17;
+
+/** The lowest version supported for per-tile Bloom filters. */
+const uint32_t tile_bloom_filters_min_version = 17;
+
+/**
+ * Offset recorded for the tile Bloom filters of a field that has none, in
+ * which case no generic tile is stored for them.
+ */
+const uint64_t no_tile_bloom_filters_offset =
+    std::numeric_limits<uint64_t>::max();
+
 /** The maximum size of a tile chunk (unit of compression) in bytes. */
 const uint64_t max_tile_chunk_size = 64 * 1024;
 
@@ -648,6 +713,15 @@ const unsigned int s3_max_attempts = 100;
 /** Milliseconds of wait time between S3 attempts. */
 const unsigned int s3_attempt_sleep_ms = 100;
 
+/**
+ * The minimum duration (in milliseconds) of a single ranged read issued by
+ * a batched VFS read, at the observed per-connection read throughput.
+ */
+const uint64_t vfs_read_part_min_duration_ms = 250;
+
+/** The minimum size of a read used to sample the VFS read throughput. */
+const uint64_t vfs_throughput_sample_min_size = 1048576;  // 1MiB
+
 /** Maximum number of attempts to wait for an Azure response. */
 const unsigned int azure_max_attempts = 10;
 
@@ -89,6 +89,12 @@ extern const uint64_t cell_var_offset_size;
 /** The type of a variable offset cell. */
 extern const Datatype cell_var_offset_type;
 
+/** The size of a variable cell view, in the `views` offsets format. */
+extern const uint64_t cell_var_view_size;
+
+/** The maximum size of a variable cell stored inline in its view. */
+extern const uint64_t cell_var_view_inline_size;
+
 /** The size of a validity cell. */
 extern const uint64_t cell_validity_size;
 
@@ -131,6 +137,9 @@ extern const std::string delete_timestamps;
 /** Special name reserved for the delete condition marker hash attribute. */
 extern const std::string delete_condition_marker_hash;
 
+/** Special name reserved for the Hilbert values attribute. */
+extern const std::string hilbert_values;
+
 /** The size of a timestamp cell. */
 extern const uint64_t timestamp_size;
 
@@ -140,6 +149,9 @@ extern const Datatype timestamp_type;
 /** The type of a delete condition marker hash cell. */
 extern const Datatype delete_condition_marker_hash_type;
 
+/** The type of a Hilbert value cell. */
+extern const Datatype hilbert_values_type;
+
 /** The special value for an empty int32. */
 extern const int empty_int32;
 
@@ -212,6 +224,9 @@ extern const std::string write_file_suffix;
 /** Suffix for the special delete files used in TileDB. */
 extern const std::string delete_file_suffix;
 
+/** Suffix for the delete vector files used in TileDB. */
+extern const std::string delete_vector_file_suffix;
+
 /** Suffix for the special metadata files used in TileDB. */
 extern const std::string meta_file_suffix;
 
@@ -302,6 +317,18 @@ extern const std::string query_condition_op_eq_str;
 /** TILEDB_NE Query Condition Op String **/
 extern const std::string query_condition_op_ne_str;
 
+/** TILEDB_IN Query Condition Op String **/
+extern const std::string query_condition_op_in_str;
+
+/** TILEDB_NOT_IN Query Condition Op String **/
+extern const std::string query_condition_op_not_in_str;
+
+/**
+ * Sets with more members than this are probed by hashing, smaller ones
+ * by a linear scan.
+ */
+extern const uint64_t query_condition_set_hash_min_size;
+
 /** TILEDB_AND Query Condition Combination Op String **/
 extern const std::string query_condition_combination_op_and_str;
 
@@ -371,6 +398,9 @@ extern const std::string filter_dictionary_str;
 /** String describing FILTER_SCALE_FLOAT. */
 extern const std::string filter_scale_float_str;
 
+/** String describing FILTER_BITMAP. */
+extern const std::string filter_bitmap_str;
+
 /** The string representation for FilterOption type compression_level. */
 extern const std::string filter_option_compression_level_str;
 
@@ -606,6 +636,39 @@ extern const uint32_t consolidation_with_timestamps_min_version;
 /** The lowest version supported for deletes. */
 extern const uint32_t deletes_min_version;
 
+/** The lowest version supported for persisted Hilbert values. */
+extern const uint32_t hilbert_values_min_version;
+
+/** The lowest version supported for paged tile offsets and var sizes. */
+extern const uint32_t tile_metadata_pages_min_version;
+
+/** Number of values in a page of paged tile offsets and var sizes. */
+extern const uint64_t tile_metadata_page_size;
+
+/**
+ * Marker starting the page directory of paged tile offsets and var sizes,
+ * which cannot be the number of values of an array stored whole.
+ */
+extern const uint64_t tile_metadata_page_directory_marker;
+
+/** The lowest version supported for paged R-trees. */
+extern const uint32_t rtree_pages_min_version;
+
+/** Minimum number of leaves in a leaf page of a paged R-tree. */
+extern const uint64_t rtree_leaf_page_size;
+
+/** The lowest version supported for R-trees with packed leaves. */
+extern const uint32_t rtree_packing_min_version;
+
+/** The lowest version supported for per-tile Bloom filters. */
+extern const uint32_t tile_bloom_filters_min_version;
+
+/**
+ * Offset recorded for the tile Bloom filters of a field that has none, in
+ * which case no generic tile is stored for them.
+ */
+extern const uint64_t no_tile_bloom_filters_offset;
+
 /** The maximum size of a tile chunk (unit of compression) in bytes. */
 extern const uint64_t max_tile_chunk_size;
 
@@ -621,6 +684,19 @@ extern const unsigned int s3_max_attempts;
 /** Milliseconds of wait time between S3 attempts. */
 extern const unsigned int s3_attempt_sleep_ms;
 
+/**
+ * The minimum duration (in milliseconds) of a single ranged read issued by
+ * a batched VFS read, at the observed per-connection read throughput.
+ * Shorter reads are dominated by the request latency.
+ */
+extern const uint64_t vfs_read_part_min_duration_ms;
+
+/**
+ * The minimum size of a read used to sample the per-connection VFS read
+ * throughput. Smaller reads are dominated by the request latency.
+ */
+extern const uint64_t vfs_throughput_sample_min_size;
+
 /** Maximum number of attempts to wait for an Azure response. */
 extern const unsigned int azure_max_attempts;
 
@@ -35,8 +35,11 @@
 #define TILEDB_HILBERT_H
 
 #include <sys/types.h>
+#include <algorithm>
+#include <cassert>
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 
 namespace tiledb {
@@ -114,6 +117,12 @@ class Hilbert {
    */
   static const int HC_MAX_DIM = 16;
 
+  /**
+   * Number of cells converted together by the batched version of
+   * `coords_to_hilbert`.
+   */
+  static const int HC_BATCH_SIZE = 64;
+
   /* ********************************* */
   /*     CONSTRUCTORS & DESTRUCTORS    */
   /* ********************************* */
@@ -186,6 +195,38 @@ class Hilbert {
     return ret;
   }
 
+  /**
+   * Converts a batch of coordinates to Hilbert values. This produces the
+   * same values as calling `coords_to_hilbert` for each cell, but converts
+   * up to `HC_BATCH_SIZE` cells at a time with branch-free loops over the
+   * cells, which the compiler can vectorize.
+   *
+   * The coordinates are given in a structure-of-arrays layout, i.e., the
+   * coordinate of cell `i` on dimension `d` is `coords[d * cell_num + i]`.
+   *
+   * @param coords The coordinates to be converted (left unmodified).
+   * @param cell_num The number of cells.
+   * @param hilbert The output Hilbert values, one per cell.
+   */
+  void coords_to_hilbert(
+      const uint64_t* coords, uint64_t cell_num, uint64_t* hilbert) const {
+    assert(coords != nullptr);
+    assert(hilbert != nullptr);
+
+    uint64_t X[HC_MAX_DIM][HC_BATCH_SIZE];
+    for (uint64_t start = 0; start < cell_num; start += HC_BATCH_SIZE) {
+      const uint64_t len =
+          std::min<uint64_t>(HC_BATCH_SIZE, cell_num - start);
+      for (int i = 0; i < dim_num_; ++i) {
+        std::memcpy(
+            X[i], coords + i * cell_num + start, len * sizeof(uint64_t));
+      }
+
+      axes_to_transpose_batch(X, len);
+      transpose_to_hilbert_batch(X, len, hilbert + start);
+    }
+  }
+
   /**
    * Converts a Hilbert value into a set of coordinates.
    *
@@ -288,6 +329,87 @@ class Hilbert {
       X[i] ^= t;
   }
 
+  /**
+   * Batched, branch-free version of `axes_to_transpose`, converting `len`
+   * cells in place. `X[i][c]` is the coordinate of cell `c` on dimension `i`.
+   *
+   * @param X Input coordinates, and output transpose.
+   * @param len Number of cells, at most `HC_BATCH_SIZE`.
+   * @return void
+   */
+  void axes_to_transpose_batch(
+      uint64_t (*X)[HC_BATCH_SIZE], uint64_t len) const {
+    const int b = bits_;
+    const int n = dim_num_;
+    uint64_t* const X0 = X[0];
+
+    // Inverse undo
+    for (uint64_t Q = (uint64_t)1 << (b - 1); Q > 1; Q >>= 1) {
+      const uint64_t P = Q - 1;
+      for (uint64_t c = 0; c < len; ++c) {
+        const uint64_t invert = 0 - (uint64_t)((X0[c] & Q) != 0);
+        X0[c] ^= P & invert;
+      }
+      for (int i = 1; i < n; ++i) {
+        uint64_t* const Xi = X[i];
+        for (uint64_t c = 0; c < len; ++c) {
+          // Either invert X[0] or exchange the low bits of X[0] and X[i]
+          const uint64_t invert = 0 - (uint64_t)((Xi[c] & Q) != 0);
+          const uint64_t t = (X0[c] ^ Xi[c]) & P & ~invert;
+          X0[c] ^= (P & invert) | t;
+          Xi[c] ^= t;
+        }
+      }
+    }
+
+    // Gray encode (inverse of decode)
+    for (int i = 1; i < n; ++i) {
+      for (uint64_t c = 0; c < len; ++c)
+        X[i][c] ^= X[i - 1][c];
+    }
+    uint64_t T[HC_BATCH_SIZE];
+    uint64_t* const Xn = X[n - 1];
+    for (uint64_t c = 0; c < len; ++c) {
+      uint64_t x = Xn[c];
+      for (int i = 1; i < b; i <<= 1)
+        x ^= x >> i;
+      T[c] = Xn[c] ^ x;
+      Xn[c] = x;
+    }
+    for (int i = n - 2; i >= 0; --i) {
+      for (uint64_t c = 0; c < len; ++c)
+        X[i][c] ^= T[c];
+    }
+  }
+
+  /**
+   * Interleaves the bits of the transpose form of `len` Hilbert values into
+   * the Hilbert values themselves.
+   *
+   * @param X The transpose forms, `X[i][c]` for cell `c` and dimension `i`.
+   * @param len Number of cells, at most `HC_BATCH_SIZE`.
+   * @param hilbert The output Hilbert values.
+   * @return void
+   */
+  void transpose_to_hilbert_batch(
+      const uint64_t (*X)[HC_BATCH_SIZE], uint64_t len, uint64_t* hilbert)
+      const {
+    const int b = bits_;
+    const int n = dim_num_;
+
+    uint64_t H[HC_BATCH_SIZE] = {};
+    for (int j = 0; j < b; ++j) {
+      for (int i = 0; i < n; ++i) {
+        const int shift = j * n + (n - 1 - i);
+        const uint64_t* const Xi = X[i];
+        for (uint64_t c = 0; c < len; ++c)
+          H[c] |= ((Xi[c] >> j) & 1) << shift;
+      }
+    }
+
+    std::memcpy(hilbert, H, len * sizeof(uint64_t));
+  }
+
   /**
    * From John Skilling's work. It converts the transpose of a
    * Hilbert value into the corresponding coordinates. This is done in place.
@@ -0,0 +1,102 @@
+/**
+ * @file   unit_bloom_filter.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * Tests class BloomFilter.
+ */
+
+#include <test/support/tdb_catch.h>
+#include "tiledb/sm/misc/bloom_filter.h"
+
+#include <string>
+
+using namespace tiledb::sm;
+
+TEST_CASE("BloomFilter: Test hash number", "[bloom_filter][hash_num]") {
+  CHECK(BloomFilter::hash_num(0) == 1);
+  CHECK(BloomFilter::hash_num(1) == 1);
+  CHECK(BloomFilter::hash_num(10) == 7);
+  CHECK(BloomFilter::hash_num(100) == 16);
+}
+
+TEST_CASE("BloomFilter: Test stable hash", "[bloom_filter][hash]") {
+  // The hash is persisted, it must never change.
+  CHECK(BloomFilter::hash("", 0) == 0xefd01f60ba992926ULL);
+  CHECK(BloomFilter::hash("a", 1) != BloomFilter::hash("b", 1));
+}
+
+TEST_CASE("BloomFilter: Test fixed-size values", "[bloom_filter][fixed]") {
+  const uint64_t num = 1000;
+  BloomFilter filter(num, 10);
+  for (uint64_t i = 0; i < num; i++)
+    filter.insert(&i, sizeof(i));
+  auto buff = filter.serialize();
+  CHECK(buff.size() == 1 + 10000 / 64 * 8 + 8);
+  CHECK(buff[0] == 7);
+
+  // No false negatives.
+  for (uint64_t i = 0; i < num; i++)
+    CHECK(BloomFilter::may_contain(buff.data(), buff.size(), &i, sizeof(i)));
+
+  // Around 1% false positives for 10 bits per value.
+  uint64_t false_positive_num = 0;
+  for (uint64_t i = num; i < 11 * num; i++)
+    false_positive_num +=
+        BloomFilter::may_contain(buff.data(), buff.size(), &i, sizeof(i));
+  CHECK(false_positive_num < 3 * 10 * num / 100);
+}
+
+TEST_CASE("BloomFilter: Test var-size values", "[bloom_filter][var]") {
+  BloomFilter filter(3, 16);
+  std::vector<std::string> values = {"alpha", "beta", "gamma"};
+  for (auto& v : values)
+    filter.insert(v.data(), v.size());
+  auto buff = filter.serialize();
+
+  for (auto& v : values)
+    CHECK(BloomFilter::may_contain(
+        buff.data(), buff.size(), v.data(), v.size()));
+  std::string absent = "delta";
+  CHECK(!BloomFilter::may_contain(
+      buff.data(), buff.size(), absent.data(), absent.size()));
+
+  // Looking up precomputed hashes gives the same answers.
+  for (auto& v : values)
+    CHECK(BloomFilter::may_contain(
+        buff.data(), buff.size(), BloomFilter::hash(v.data(), v.size())));
+  CHECK(!BloomFilter::may_contain(
+      buff.data(),
+      buff.size(),
+      BloomFilter::hash(absent.data(), absent.size())));
+}
+
+TEST_CASE("BloomFilter: Test empty filter", "[bloom_filter][empty]") {
+  uint64_t v = 1;
+  CHECK(BloomFilter::may_contain(nullptr, 0, &v, sizeof(v)));
+}
@@ -90,3 +90,28 @@ TEST_CASE("Hilbert: Test default bits, getter", "[hilbert][bits][getter]") {
   CHECK(h.bits() == 21);
   CHECK(h.dim_num() == 3);
 }
+
+TEST_CASE("Hilbert: Test batch conversion", "[hilbert][batch]") {
+  const int dim_num = GENERATE(1, 2, 3, 5, 8);
+  Hilbert h(dim_num);
+
+  // Use a cell count that is not a multiple of the batch size.
+  const uint64_t cell_num = 3 * Hilbert::HC_BATCH_SIZE + 7;
+  const uint64_t max_coord = ((uint64_t)1 << h.bits()) - 1;
+  std::vector<uint64_t> coords(dim_num * cell_num);
+  uint64_t state = 12345;
+  for (auto& c : coords) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    c = (state >> 11) & max_coord;
+  }
+
+  std::vector<uint64_t> hilbert(cell_num);
+  h.coords_to_hilbert(coords.data(), cell_num, hilbert.data());
+
+  std::vector<uint64_t> cell(dim_num);
+  for (uint64_t i = 0; i < cell_num; ++i) {
+    for (int d = 0; d < dim_num; ++d)
+      cell[d] = coords[d * cell_num + i];
+    CHECK(hilbert[i] == h.coords_to_hilbert(&cell[0]));
+  }
+}
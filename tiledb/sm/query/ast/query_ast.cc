@@ -37,6 +37,23 @@ using namespace tiledb::common;
 namespace tiledb {
 namespace sm {
 
+ConditionValueSet::ConditionValueSet(
+    const void* data,
+    uint64_t data_size,
+    const std::vector<uint64_t>& offsets) {
+  auto chars = static_cast<const char*>(data);
+  members_.reserve(offsets.size());
+  for (uint64_t i = 0; i < offsets.size(); i++) {
+    const uint64_t end = i + 1 < offsets.size() ? offsets[i + 1] : data_size;
+    members_.emplace_back(chars + offsets[i], end - offsets[i]);
+  }
+
+  if (members_.size() > constants::query_condition_set_hash_min_size) {
+    set_.reserve(members_.size());
+    set_.insert(members_.begin(), members_.end());
+  }
+}
+
 bool ASTNodeVal::is_expr() const {
   return false;
 }
@@ -55,7 +72,7 @@ void ASTNodeVal::get_field_names(
 }
 
 bool ASTNodeVal::is_backwards_compatible() const {
-  return true;
+  return !is_set_membership_op(op_);
 }
 
 Status ASTNodeVal::check_node_validity(const ArraySchema& array_schema) const {
@@ -107,9 +124,23 @@ Status ASTNodeVal::check_node_validity(const ArraySchema& array_schema) const {
         field_name_);
   }
 
+  // Ensure that the set member sizes match the attribute's value size,
+  // with the same exceptions as for the condition value size below.
+  if (is_set_membership_op(op_) && cell_size != constants::var_size &&
+      type != Datatype::STRING_ASCII && type != Datatype::CHAR && (!var_size)) {
+    for (const auto& member : value_set_.members()) {
+      if (member.size() != cell_size) {
+        return Status_QueryConditionError(
+            "Value node set member size mismatch: " +
+            std::to_string(cell_size) + " != " + std::to_string(member.size()));
+      }
+    }
+  }
+
   // Ensure that the condition value size matches the attribute's
   // value size.
-  if (cell_size != constants::var_size && cell_size != condition_value_size &&
+  if (!is_set_membership_op(op_) && cell_size != constants::var_size &&
+      cell_size != condition_value_size &&
       !(nullable && condition_value_view_.content() == nullptr) &&
       type != Datatype::STRING_ASCII && type != Datatype::CHAR && (!var_size)) {
     return Status_QueryConditionError(
@@ -172,6 +203,10 @@ const QueryConditionOp& ASTNodeVal::get_op() const {
   return op_;
 }
 
+const ConditionValueSet& ASTNodeVal::get_value_set() const {
+  return value_set_;
+}
+
 const std::vector<tdb_unique_ptr<ASTNode>>& ASTNodeVal::get_children() const {
   throw std::runtime_error(
       "ASTNodeVal::get_children: Cannot get children from an AST value node.");
@@ -207,7 +242,7 @@ bool ASTNodeExpr::is_backwards_compatible() const {
     return false;
   }
   for (const auto& child : nodes_) {
-    if (child->is_expr()) {
+    if (child->is_expr() || !child->is_backwards_compatible()) {
       return false;
     }
   }
@@ -269,6 +304,12 @@ const QueryConditionOp& ASTNodeExpr::get_op() const {
       "ASTNodeExpr::get_op: Cannot get op from an AST expression node.");
 }
 
+const ConditionValueSet& ASTNodeExpr::get_value_set() const {
+  throw std::runtime_error(
+      "ASTNodeExpr::get_value_set: Cannot get value set from an AST "
+      "expression node.");
+}
+
 const std::vector<tdb_unique_ptr<ASTNode>>& ASTNodeExpr::get_children() const {
   return nodes_;
 }
@@ -36,8 +36,10 @@
 #include <memory>
 #include <optional>
 #include <sstream>
+#include <string_view>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "tiledb/common/common.h"
 #include "tiledb/common/status.h"
@@ -56,6 +58,72 @@ namespace sm {
 class ASTNegationT {};
 static constexpr ASTNegationT ASTNegation{};
 
+/**
+ * @brief The ConditionValueSet class holds the values of a set membership
+ * (IN / NOT_IN) value node, as views into the value data of the node. Small
+ * sets are probed with a linear scan, larger ones with a hash set.
+ */
+class ConditionValueSet {
+ public:
+  /**
+   * @brief Default constructor, for an empty set.
+   */
+  ConditionValueSet() = default;
+
+  /**
+   * @brief Construct a new ConditionValueSet object.
+   *
+   * @param data The member values, concatenated. Must outlive the set.
+   * @param data_size The byte size of `data`.
+   * @param offsets The starting offsets of the members in `data`.
+   */
+  ConditionValueSet(
+      const void* data,
+      uint64_t data_size,
+      const std::vector<uint64_t>& offsets);
+
+  DISABLE_COPY_AND_COPY_ASSIGN(ConditionValueSet);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(ConditionValueSet);
+
+  /**
+   * @brief Checks whether a value is a member of the set.
+   *
+   * @param value The value to look up.
+   * @param size The byte size of `value`.
+   * @return True if the value is a member of the set.
+   */
+  inline bool contains(const void* value, uint64_t size) const {
+    const std::string_view v(static_cast<const char*>(value), size);
+    if (!set_.empty()) {
+      return set_.count(v) != 0;
+    }
+
+    for (const auto& member : members_) {
+      if (member == v) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  /**
+   * @brief Get the members of the set, in insertion order.
+   *
+   * @return const std::vector<std::string_view>& The members.
+   */
+  inline const std::vector<std::string_view>& members() const {
+    return members_;
+  }
+
+ private:
+  /** The members, in insertion order. */
+  std::vector<std::string_view> members_;
+
+  /** The members hash set, only built for large sets. */
+  std::unordered_set<std::string_view> set_;
+};
+
 /**
  * @brief The ASTNode class is an abstract class that contains virtual
  * methods used by both the value and expression node implementation
@@ -157,6 +225,15 @@ class ASTNode {
    */
   virtual const QueryConditionOp& get_op() const = 0;
 
+  /**
+   * @brief Get the value set of a set membership (IN / NOT_IN) node.
+   * This is an AST value node getter method.
+   * It should throw an exception if called on an expression node.
+   *
+   * @return const ConditionValueSet& The set of values to test against.
+   */
+  virtual const ConditionValueSet& get_value_set() const = 0;
+
   /**
    * @brief Get the vector of children nodes.
    * This is an AST expression node getter method.
@@ -216,6 +293,42 @@ class ASTNodeVal : public ASTNode {
     }
   };
 
+  /**
+   * @brief Construct a new set membership ASTNodeVal object.
+   *
+   * @param field_name The name of the field this operation applies to.
+   * @param data The member values to test against, concatenated.
+   * @param data_size The byte size of data.
+   * @param offsets The starting offsets (uint64_t) of the members in `data`.
+   * @param offsets_size The byte size of offsets.
+   * @param op The set membership operation, `IN` or `NOT_IN`.
+   */
+  ASTNodeVal(
+      const std::string& field_name,
+      const void* const data,
+      const uint64_t data_size,
+      const void* const offsets,
+      const uint64_t offsets_size,
+      const QueryConditionOp op)
+      : field_name_(field_name)
+      , condition_value_data_(data_size)
+      , condition_value_view_(
+            (data_size == 0 ? (void*)"" : condition_value_data_.data()),
+            condition_value_data_.size())
+      , op_(op)
+      , value_offsets_(
+            static_cast<const uint64_t*>(offsets),
+            static_cast<const uint64_t*>(offsets) +
+                offsets_size / sizeof(uint64_t))
+      , value_set_(
+            condition_value_data_.data(),
+            condition_value_data_.size(),
+            value_offsets_) {
+    if (data_size != 0) {
+      memcpy(condition_value_data_.data(), data, data_size);
+    }
+  };
+
   /**
    * @brief Copy constructor.
    */
@@ -228,7 +341,12 @@ class ASTNodeVal : public ASTNode {
                  (void*)"" :
                  condition_value_data_.data()),
             condition_value_data_.size())
-      , op_(rhs.op_) {
+      , op_(rhs.op_)
+      , value_offsets_(rhs.value_offsets_)
+      , value_set_(
+            condition_value_data_.data(),
+            condition_value_data_.size(),
+            value_offsets_) {
   }
 
   /**
@@ -243,7 +361,12 @@ class ASTNodeVal : public ASTNode {
                  (void*)"" :
                  condition_value_data_.data()),
             condition_value_data_.size())
-      , op_(negate_query_condition_op(rhs.op_)) {
+      , op_(negate_query_condition_op(rhs.op_))
+      , value_offsets_(rhs.value_offsets_)
+      , value_set_(
+            condition_value_data_.data(),
+            condition_value_data_.size(),
+            value_offsets_) {
   }
 
   /**
@@ -351,6 +474,15 @@ class ASTNodeVal : public ASTNode {
    */
   const QueryConditionOp& get_op() const override;
 
+  /**
+   * @brief Get the value set of a set membership (IN / NOT_IN) node.
+   * This is an AST value node getter method.
+   * It should throw an exception if called on an expression node.
+   *
+   * @return const ConditionValueSet& The set of values to test against.
+   */
+  const ConditionValueSet& get_value_set() const override;
+
   /**
    * @brief Get the vector of children nodes.
    * This is an AST expression node getter method.
@@ -382,6 +514,12 @@ class ASTNodeVal : public ASTNode {
 
   /** The comparison operator. */
   QueryConditionOp op_;
+
+  /** The member offsets in the value data, for set membership ops. */
+  std::vector<uint64_t> value_offsets_;
+
+  /** The set of member values, for set membership ops. */
+  ConditionValueSet value_set_;
 };
 
 /**
@@ -528,6 +666,15 @@ class ASTNodeExpr : public ASTNode {
    */
   const QueryConditionOp& get_op() const override;
 
+  /**
+   * @brief Get the value set of a set membership (IN / NOT_IN) node.
+   * This is an AST value node getter method.
+   * It should throw an exception if called on an expression node.
+   *
+   * @return const ConditionValueSet& The set of values to test against.
+   */
+  const ConditionValueSet& get_value_set() const override;
+
   /**
    * @brief Get the vector of children nodes.
    * This is an AST expression node getter method.
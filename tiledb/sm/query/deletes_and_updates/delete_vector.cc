@@ -0,0 +1,201 @@
+/**
+ * @file   delete_vector.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class DeleteVector.
+ */
+
+#include "tiledb/sm/query/deletes_and_updates/delete_vector.h"
+#include "tiledb/storage_format/serialization/serializers.h"
+
+#include <limits>
+
+namespace tiledb {
+namespace sm {
+
+/* ********************************* */
+/*         STATIC ATTRIBUTES         */
+/* ********************************* */
+
+const uint32_t DeleteVector::version_ = 1;
+
+/* ********************************* */
+/*     CONSTRUCTORS & DESTRUCTORS    */
+/* ********************************* */
+
+DeleteVector::DeleteVector(
+    std::vector<std::string> condition_markers, uint64_t tile_num)
+    : condition_markers_(std::move(condition_markers))
+    , condition_markers_set_(
+          condition_markers_.begin(), condition_markers_.end())
+    , tiles_(tile_num) {
+}
+
+/* ********************************* */
+/*                API                */
+/* ********************************* */
+
+void DeleteVector::set_tile(
+    uint64_t tile_idx, const std::vector<uint8_t>& bitmap) {
+  auto& tile = tiles_[tile_idx];
+  tile = TileContainer();
+  tile.cell_num_ = bitmap.size();
+
+  uint64_t deleted_num = 0;
+  for (auto b : bitmap)
+    deleted_num += b == 0;
+  if (deleted_num == 0)
+    return;
+
+  // Use whichever of the array and bitset containers is smaller.
+  const uint64_t word_num = (tile.cell_num_ + 63) / 64;
+  if (tile.cell_num_ <= std::numeric_limits<uint32_t>::max() &&
+      deleted_num * sizeof(uint32_t) < word_num * sizeof(uint64_t)) {
+    tile.type_ = ContainerType::ARRAY;
+    tile.positions_.reserve(deleted_num);
+    for (uint64_t c = 0; c < tile.cell_num_; c++) {
+      if (bitmap[c] == 0)
+        tile.positions_.emplace_back(static_cast<uint32_t>(c));
+    }
+  } else {
+    tile.type_ = ContainerType::BITSET;
+    tile.words_.resize(word_num, 0);
+    for (uint64_t c = 0; c < tile.cell_num_; c++) {
+      if (bitmap[c] == 0)
+        tile.words_[c / 64] |= uint64_t(1) << (c % 64);
+    }
+  }
+}
+
+std::vector<uint8_t> DeleteVector::serialize() const {
+  auto write = [&](Serializer& serializer) {
+    serializer.write<uint32_t>(version_);
+    serializer.write<uint64_t>(condition_markers_.size());
+    for (auto& marker : condition_markers_) {
+      serializer.write<uint64_t>(marker.size());
+      serializer.write(marker.data(), marker.size());
+    }
+
+    serializer.write<uint64_t>(tiles_.size());
+    for (auto& tile : tiles_) {
+      serializer.write<uint8_t>(static_cast<uint8_t>(tile.type_));
+      serializer.write<uint64_t>(tile.cell_num_);
+      if (tile.type_ == ContainerType::ARRAY) {
+        serializer.write<uint64_t>(tile.positions_.size());
+        serializer.write(
+            tile.positions_.data(), tile.positions_.size() * sizeof(uint32_t));
+      } else {
+        serializer.write<uint64_t>(tile.words_.size());
+        serializer.write(
+            tile.words_.data(), tile.words_.size() * sizeof(uint64_t));
+      }
+    }
+  };
+
+  SizeComputationSerializer size_computation_serializer;
+  write(size_computation_serializer);
+
+  std::vector<uint8_t> data(size_computation_serializer.size());
+  Serializer serializer(data.data(), data.size());
+  write(serializer);
+
+  return data;
+}
+
+DeleteVector DeleteVector::deserialize(const void* data, storage_size_t size) {
+  Deserializer deserializer(data, size);
+  const auto version = deserializer.read<uint32_t>();
+  if (version != version_) {
+    throw std::logic_error(
+        "Cannot deserialize delete vector; Unsupported version " +
+        std::to_string(version));
+  }
+
+  const auto marker_num = deserializer.read<uint64_t>();
+  std::vector<std::string> markers;
+  for (uint64_t i = 0; i < marker_num; i++) {
+    const auto marker_size = deserializer.read<uint64_t>();
+    auto marker = deserializer.get_ptr<char>(marker_size);
+    markers.emplace_back(marker, marker_size);
+  }
+
+  const auto tile_num = deserializer.read<uint64_t>();
+  DeleteVector delete_vector(std::move(markers), 0);
+  delete_vector.tiles_.reserve(std::min<uint64_t>(tile_num, size));
+  for (uint64_t t = 0; t < tile_num; t++) {
+    TileContainer tile;
+    tile.type_ = static_cast<ContainerType>(deserializer.read<uint8_t>());
+    tile.cell_num_ = deserializer.read<uint64_t>();
+    const auto value_num = deserializer.read<uint64_t>();
+    if (value_num > deserializer.size()) {
+      throw std::logic_error(
+          "Cannot deserialize delete vector; Reading data past end of "
+          "serialized data size.");
+    }
+
+    switch (tile.type_) {
+      case ContainerType::EMPTY:
+        if (value_num != 0) {
+          throw std::logic_error(
+              "Cannot deserialize delete vector; Non-empty empty container");
+        }
+        break;
+      case ContainerType::ARRAY: {
+        // The positions are not aligned in the serialized data, copy them.
+        tile.positions_.resize(value_num);
+        deserializer.read(tile.positions_.data(), value_num * sizeof(uint32_t));
+        for (auto pos : tile.positions_) {
+          if (pos >= tile.cell_num_) {
+            throw std::logic_error(
+                "Cannot deserialize delete vector; Position out of bounds");
+          }
+        }
+        break;
+      }
+      case ContainerType::BITSET: {
+        if (value_num != (tile.cell_num_ + 63) / 64) {
+          throw std::logic_error(
+              "Cannot deserialize delete vector; Invalid bitset size");
+        }
+        tile.words_.resize(value_num);
+        deserializer.read(tile.words_.data(), value_num * sizeof(uint64_t));
+        break;
+      }
+      default:
+        throw std::logic_error(
+            "Cannot deserialize delete vector; Invalid container type");
+    }
+
+    delete_vector.tiles_.emplace_back(std::move(tile));
+  }
+
+  return delete_vector;
+}
+
+}  // namespace sm
+}  // namespace tiledb
@@ -0,0 +1,204 @@
+/**
+ * @file   delete_vector.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class DeleteVector.
+ */
+
+#ifndef TILEDB_DELETE_VECTOR_H
+#define TILEDB_DELETE_VECTOR_H
+
+#include "tiledb/common/common.h"
+
+#include <algorithm>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * The materialized result of a set of delete conditions on a fragment, i.e.
+ * for every tile of the fragment, the positions of the cells deleted by any
+ * of the conditions. Each tile is stored in the smallest of three containers
+ * (in the spirit of roaring bitmaps): empty, a sorted array of positions, or
+ * a bitset. Readers apply a delete vector on a tile bitmap instead of
+ * evaluating the conditions it covers on the tile data.
+ *
+ * The serialized delete vector has the following layout:
+ *
+ *   version (uint32_t) | marker_num (uint64_t) |
+ *   (marker_size (uint64_t) | marker)* | tile_num (uint64_t) |
+ *   (container_type (uint8_t) | cell_num (uint64_t) | value_num (uint64_t) |
+ *   values (uint32_t positions or uint64_t words))*
+ */
+class DeleteVector {
+ public:
+  /* ********************************* */
+  /*           TYPE DEFINITIONS        */
+  /* ********************************* */
+
+  /** The container used for the deleted positions of a tile. */
+  enum class ContainerType : uint8_t { EMPTY = 0, ARRAY, BITSET };
+
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param condition_markers The markers of the delete conditions that are
+   *     materialized in this delete vector.
+   * @param tile_num The number of tiles of the fragment.
+   */
+  DeleteVector(std::vector<std::string> condition_markers, uint64_t tile_num);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns the markers of the materialized delete conditions. */
+  inline const std::vector<std::string>& condition_markers() const {
+    return condition_markers_;
+  }
+
+  /** Returns `true` if the delete condition is materialized in the vector. */
+  inline bool covers(const std::string& condition_marker) const {
+    return condition_markers_set_.count(condition_marker) != 0;
+  }
+
+  /** Returns the number of tiles. */
+  inline uint64_t tile_num() const {
+    return tiles_.size();
+  }
+
+  /** Returns the number of cells of a tile. */
+  inline uint64_t cell_num(uint64_t tile_idx) const {
+    return tiles_[tile_idx].cell_num_;
+  }
+
+  /** Returns the container type used for a tile. */
+  inline ContainerType container_type(uint64_t tile_idx) const {
+    return tiles_[tile_idx].type_;
+  }
+
+  /**
+   * Sets the deleted cells of a tile.
+   *
+   * @param tile_idx The tile index.
+   * @param bitmap The cell bitmap of the tile, where `0` marks a deleted
+   *     cell.
+   */
+  void set_tile(uint64_t tile_idx, const std::vector<uint8_t>& bitmap);
+
+  /**
+   * Clears the deleted cells of a tile in a result tile bitmap.
+   *
+   * @tparam BitmapType The bitmap type.
+   * @param tile_idx The tile index.
+   * @param bitmap The bitmap of the tile, which must have `cell_num` cells.
+   */
+  template <class BitmapType>
+  void apply(uint64_t tile_idx, std::vector<BitmapType>& bitmap) const {
+    const auto& tile = tiles_[tile_idx];
+    switch (tile.type_) {
+      case ContainerType::EMPTY:
+        return;
+      case ContainerType::ARRAY:
+        for (auto pos : tile.positions_)
+          bitmap[pos] = 0;
+        return;
+      case ContainerType::BITSET:
+        for (uint64_t w = 0; w < tile.words_.size(); w++) {
+          const uint64_t word = tile.words_[w];
+          if (word == 0)
+            continue;
+          const uint64_t end =
+              std::min<uint64_t>(bitmap.size(), (w + 1) * 64);
+          for (uint64_t c = w * 64; c < end; c++)
+            bitmap[c] *= ((word >> (c % 64)) & 1) == 0;
+        }
+        return;
+    }
+  }
+
+  /** Serializes the delete vector, see the class description. */
+  std::vector<uint8_t> serialize() const;
+
+  /**
+   * Deserializes a delete vector.
+   *
+   * @param data Pointer to the serialized data.
+   * @param size Size of the serialized data.
+   * @return The delete vector. Throws if the data is malformed.
+   */
+  static DeleteVector deserialize(const void* data, storage_size_t size);
+
+ private:
+  /* ********************************* */
+  /*           TYPE DEFINITIONS        */
+  /* ********************************* */
+
+  /** The deleted cells of a tile. */
+  struct TileContainer {
+    /** The container type. */
+    ContainerType type_ = ContainerType::EMPTY;
+
+    /** The number of cells in the tile. */
+    uint64_t cell_num_ = 0;
+
+    /** Sorted deleted positions, for the `ARRAY` container. */
+    std::vector<uint32_t> positions_;
+
+    /** Deleted cells bitset, for the `BITSET` container. */
+    std::vector<uint64_t> words_;
+  };
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The version of the serialized format. */
+  static const uint32_t version_;
+
+  /** The markers of the materialized delete conditions. */
+  std::vector<std::string> condition_markers_;
+
+  /** Set of `condition_markers_`, for fast lookups. */
+  std::unordered_set<std::string> condition_markers_set_;
+
+  /** The containers, one per tile. */
+  std::vector<TileContainer> tiles_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_DELETE_VECTOR_H
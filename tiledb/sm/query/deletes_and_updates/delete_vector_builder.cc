@@ -0,0 +1,260 @@
+/**
+ * @file   delete_vector_builder.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class DeleteVectorBuilder.
+ */
+
+#include "tiledb/sm/query/deletes_and_updates/delete_vector_builder.h"
+#include "tiledb/common/logger.h"
+#include "tiledb/sm/array/array.h"
+#include "tiledb/sm/array_schema/array_schema.h"
+#include "tiledb/sm/fragment/fragment_metadata.h"
+#include "tiledb/sm/misc/parallel_functions.h"
+#include "tiledb/sm/query/readers/result_tile.h"
+#include "tiledb/sm/stats/global_stats.h"
+#include "tiledb/sm/storage_manager/storage_manager.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/* ****************************** */
+/*          CONSTRUCTORS          */
+/* ****************************** */
+
+DeleteVectorBuilder::DeleteVectorBuilder(
+    stats::Stats* stats,
+    shared_ptr<Logger> logger,
+    StorageManager* storage_manager,
+    Array* array,
+    Config& config,
+    std::unordered_map<std::string, QueryBuffer>& buffers,
+    Subarray& subarray,
+    QueryCondition& condition)
+    : ReaderBase(
+          stats,
+          logger->clone("DeleteVectorBuilder", ++logger_id_),
+          storage_manager,
+          array,
+          config,
+          buffers,
+          subarray,
+          Layout::UNORDERED,
+          condition)
+    , memory_budget_(0) {
+  disable_cache_ = true;
+}
+
+/* ****************************** */
+/*               API              */
+/* ****************************** */
+
+Status DeleteVectorBuilder::init(
+    std::vector<QueryCondition>&& delete_conditions) {
+  bool found = false;
+  RETURN_NOT_OK(
+      config_.get<uint64_t>("sm.mem.total_budget", &memory_budget_, &found));
+  assert(found);
+
+  delete_conditions_ = std::move(delete_conditions);
+  if (delete_conditions_.empty()) {
+    return Status::Ok();
+  }
+
+  if (need_timestamped_conditions()) {
+    RETURN_NOT_OK(generate_timestamped_conditions());
+  }
+
+  RETURN_NOT_OK(load_processed_conditions());
+
+  // Load the tile offsets of all the fields used by the conditions.
+  std::unordered_set<std::string> names_set;
+  for (auto& delete_condition : delete_conditions_) {
+    for (auto& name : delete_condition.field_names()) {
+      names_set.insert(name);
+    }
+  }
+  if (!timestamped_delete_conditions_.empty()) {
+    names_set.insert(constants::timestamps);
+  }
+
+  std::vector<std::string> names(names_set.begin(), names_set.end());
+  RETURN_NOT_OK(load_tile_offsets(subarray_, names));
+  RETURN_NOT_OK(load_tile_var_sizes(subarray_, names));
+
+  return Status::Ok();
+}
+
+std::vector<std::string> DeleteVectorBuilder::condition_markers(unsigned f) {
+  std::vector<std::string> markers;
+  for (auto& delete_condition : delete_conditions_) {
+    if (delete_condition_applies(*fragment_metadata_[f], delete_condition)) {
+      markers.emplace_back(delete_condition.condition_marker());
+    }
+  }
+
+  return markers;
+}
+
+tuple<Status, optional<DeleteVector>> DeleteVectorBuilder::build(unsigned f) {
+  auto timer_se = stats_->start_timer("build_delete_vector");
+
+  // For easy reference.
+  auto& fragment = fragment_metadata_[f];
+  const auto& schema = *fragment->array_schema();
+  const auto& timestamp_range = fragment->timestamp_range();
+  const auto tile_num = fragment->tile_num();
+
+  // Find the conditions to apply, whether they need to be timestamped, and
+  // the fields they use.
+  std::vector<std::pair<uint64_t, bool>> conditions;
+  std::vector<std::string> markers;
+  std::unordered_set<std::string> names_set;
+  for (uint64_t i = 0; i < delete_conditions_.size(); i++) {
+    if (!delete_condition_applies(*fragment, delete_conditions_[i])) {
+      continue;
+    }
+
+    const bool timestamped = fragment->has_timestamps() &&
+                             delete_conditions_[i].condition_timestamp() <=
+                                 timestamp_range.second;
+    conditions.emplace_back(i, timestamped);
+    markers.emplace_back(delete_conditions_[i].condition_marker());
+    for (auto& name : delete_conditions_[i].field_names()) {
+      names_set.insert(name);
+    }
+    if (timestamped) {
+      names_set.insert(constants::timestamps);
+    }
+  }
+
+  DeleteVector delete_vector(std::move(markers), tile_num);
+  if (conditions.empty()) {
+    return {Status::Ok(), std::move(delete_vector)};
+  }
+
+  std::vector<std::string> names(names_set.begin(), names_set.end());
+  std::vector<std::string> dim_names, attr_names;
+  for (auto& name : names) {
+    if (schema.is_dim(name)) {
+      dim_names.emplace_back(name);
+    } else {
+      attr_names.emplace_back(name);
+    }
+  }
+
+  // Process the tiles in batches that fit the memory budget.
+  uint64_t t = 0;
+  while (t < tile_num) {
+    uint64_t batch_size = 0;
+    uint64_t t_end = t;
+    while (t_end < tile_num) {
+      auto&& [st, size] = tiles_size(names, f, t_end);
+      RETURN_NOT_OK_TUPLE(st, nullopt);
+      if (t_end != t && batch_size + *size > memory_budget_) {
+        break;
+      }
+
+      batch_size += *size;
+      t_end++;
+    }
+
+    std::vector<ResultTile> result_tiles;
+    std::vector<ResultTile*> result_tile_ptrs;
+    result_tiles.reserve(t_end - t);
+    result_tile_ptrs.reserve(t_end - t);
+    for (uint64_t i = t; i < t_end; i++) {
+      result_tiles.emplace_back(f, i, schema);
+      result_tile_ptrs.emplace_back(&result_tiles.back());
+    }
+
+    RETURN_NOT_OK_TUPLE(
+        read_coordinate_tiles(dim_names, result_tile_ptrs), nullopt);
+    RETURN_NOT_OK_TUPLE(
+        read_attribute_tiles(attr_names, result_tile_ptrs), nullopt);
+    for (auto& name : names) {
+      RETURN_NOT_OK_TUPLE(unfilter_tiles(name, result_tile_ptrs), nullopt);
+    }
+
+    // Evaluate the conditions on each tile.
+    auto status = parallel_for(
+        storage_manager_->compute_tp(),
+        0,
+        result_tiles.size(),
+        [&](uint64_t i) {
+          auto& rt = result_tiles[i];
+          std::vector<uint8_t> bitmap(fragment->cell_num(rt.tile_idx()), 1);
+          for (auto& [c, timestamped] : conditions) {
+            auto& condition = timestamped ? timestamped_delete_conditions_[c] :
+                                            delete_conditions_[c];
+            RETURN_NOT_OK(condition.apply_sparse<uint8_t>(schema, rt, bitmap));
+          }
+
+          delete_vector.set_tile(rt.tile_idx(), bitmap);
+          return Status::Ok();
+        });
+    RETURN_NOT_OK_TUPLE(status, nullopt);
+
+    stats_->add_counter("delete_vector_tile_num", t_end - t);
+    t = t_end;
+  }
+
+  return {Status::Ok(), std::move(delete_vector)};
+}
+
+/* ****************************** */
+/*        PRIVATE METHODS         */
+/* ****************************** */
+
+tuple<Status, optional<uint64_t>> DeleteVectorBuilder::tiles_size(
+    const std::vector<std::string>& names, unsigned f, uint64_t t) {
+  const auto& fragment = fragment_metadata_[f];
+  uint64_t size = 0;
+  for (auto& name : names) {
+    if (name == constants::timestamps) {
+      size += fragment->cell_num(t) * constants::timestamp_size;
+      continue;
+    }
+
+    // Fields added by schema evolution are not read.
+    if (!fragment->array_schema()->is_field(name)) {
+      continue;
+    }
+
+    auto&& [st, tile_size] = get_attribute_tile_size(name, f, t);
+    RETURN_NOT_OK_TUPLE(st, nullopt);
+    size += *tile_size;
+  }
+
+  return {Status::Ok(), size};
+}
+
+}  // namespace sm
+}  // namespace tiledb
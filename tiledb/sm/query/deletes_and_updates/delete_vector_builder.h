@@ -0,0 +1,133 @@
+/**
+ * @file   delete_vector_builder.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class DeleteVectorBuilder.
+ */
+
+#ifndef TILEDB_DELETE_VECTOR_BUILDER_H
+#define TILEDB_DELETE_VECTOR_BUILDER_H
+
+#include "tiledb/common/common.h"
+#include "tiledb/common/status.h"
+#include "tiledb/sm/query/deletes_and_updates/delete_vector.h"
+#include "tiledb/sm/query/readers/reader_base.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * Evaluates the delete conditions of an array on the tiles of its fragments
+ * and materializes the results as delete vectors.
+ */
+class DeleteVectorBuilder : public ReaderBase {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /** Constructor. */
+  DeleteVectorBuilder(
+      stats::Stats* stats,
+      shared_ptr<Logger> logger,
+      StorageManager* storage_manager,
+      Array* array,
+      Config& config,
+      std::unordered_map<std::string, QueryBuffer>& buffers,
+      Subarray& subarray,
+      QueryCondition& condition);
+
+  /** Destructor. */
+  ~DeleteVectorBuilder() = default;
+
+  DISABLE_COPY_AND_COPY_ASSIGN(DeleteVectorBuilder);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(DeleteVectorBuilder);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Initializes the builder.
+   *
+   * @param delete_conditions The delete conditions of the array.
+   * @return Status
+   */
+  Status init(std::vector<QueryCondition>&& delete_conditions);
+
+  /**
+   * Returns the markers of the delete conditions that apply to a fragment.
+   *
+   * @param f The fragment index.
+   * @return The condition markers, empty if no condition applies.
+   */
+  std::vector<std::string> condition_markers(unsigned f);
+
+  /**
+   * Evaluates the delete conditions that apply to a fragment on all of its
+   * tiles.
+   *
+   * @param f The fragment index.
+   * @return Status, delete vector.
+   */
+  tuple<Status, optional<DeleteVector>> build(unsigned f);
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** UID of the logger instance */
+  inline static std::atomic<uint64_t> logger_id_ = 0;
+
+  /** Memory budget for the tiles loaded at once. */
+  uint64_t memory_budget_;
+
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /**
+   * Returns the size of the tiles of a list of fields for a fragment tile,
+   * once unfiltered.
+   *
+   * @param names The field names.
+   * @param f The fragment index.
+   * @param t The tile index.
+   * @return Status, size.
+   */
+  tuple<Status, optional<uint64_t>> tiles_size(
+      const std::vector<std::string>& names, unsigned f, uint64_t t);
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_DELETE_VECTOR_BUILDER_H
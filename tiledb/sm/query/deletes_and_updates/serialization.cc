@@ -48,6 +48,11 @@ void serialize_condition_impl(
   if (!node->is_expr()) {
     // Get values.
     const auto op = node->get_op();
+    if (is_set_membership_op(op)) {
+      throw std::runtime_error(
+          "Cannot serialize condition; Set membership operators are not "
+          "supported");
+    }
     const auto field_name = node->get_field_name();
     const uint32_t field_name_length =
         static_cast<uint32_t>(field_name.length());
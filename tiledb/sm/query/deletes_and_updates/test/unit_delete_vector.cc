@@ -0,0 +1,119 @@
+/**
+ * @file unit_delete_vector.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2022 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the `DeleteVector` class.
+ */
+
+#include "tiledb/sm/query/deletes_and_updates/delete_vector.h"
+
+#include <test/support/tdb_catch.h>
+
+#include <cstring>
+
+using namespace tiledb::sm;
+
+/**
+ * Makes sure a delete vector is the same after going through
+ * serialization/deserialization.
+ *
+ * @param delete_vector Delete vector to check.
+ * @return The deserialized delete vector.
+ */
+DeleteVector serialize_deserialize_check(const DeleteVector& delete_vector) {
+  auto serialized = delete_vector.serialize();
+
+  // Deserialize from an odd address, the values are not aligned anyway.
+  std::vector<uint8_t> unaligned(serialized.size() + 1);
+  memcpy(unaligned.data() + 1, serialized.data(), serialized.size());
+  auto deserialized =
+      DeleteVector::deserialize(unaligned.data() + 1, serialized.size());
+
+  CHECK(deserialized.condition_markers() == delete_vector.condition_markers());
+  REQUIRE(deserialized.tile_num() == delete_vector.tile_num());
+  for (uint64_t t = 0; t < delete_vector.tile_num(); t++) {
+    CHECK(deserialized.cell_num(t) == delete_vector.cell_num(t));
+    CHECK(deserialized.container_type(t) == delete_vector.container_type(t));
+  }
+
+  return deserialized;
+}
+
+TEST_CASE(
+    "DeleteVector: Test containers", "[deletevector][containers]") {
+  DeleteVector delete_vector({"a.del", "b.del"}, 3);
+  CHECK(delete_vector.covers("a.del"));
+  CHECK(!delete_vector.covers("c.del"));
+
+  // Nothing deleted.
+  std::vector<uint8_t> none(100, 1);
+  delete_vector.set_tile(0, none);
+  CHECK(
+      delete_vector.container_type(0) == DeleteVector::ContainerType::EMPTY);
+
+  // Few deleted cells.
+  std::vector<uint8_t> few(1000, 1);
+  few[3] = few[500] = few[999] = 0;
+  delete_vector.set_tile(1, few);
+  CHECK(
+      delete_vector.container_type(1) == DeleteVector::ContainerType::ARRAY);
+
+  // Many deleted cells.
+  std::vector<uint8_t> many(1000, 1);
+  for (uint64_t c = 0; c < many.size(); c += 2)
+    many[c] = 0;
+  delete_vector.set_tile(2, many);
+  CHECK(
+      delete_vector.container_type(2) == DeleteVector::ContainerType::BITSET);
+
+  auto deserialized = serialize_deserialize_check(delete_vector);
+  std::vector<std::vector<uint8_t>> expected{none, few, many};
+  for (uint64_t t = 0; t < 3; t++) {
+    std::vector<uint64_t> bitmap(expected[t].size(), 2);
+    deserialized.apply(t, bitmap);
+    for (uint64_t c = 0; c < bitmap.size(); c++)
+      CHECK(bitmap[c] == (expected[t][c] == 0 ? 0 : 2));
+  }
+}
+
+TEST_CASE(
+    "DeleteVector: Test malformed data", "[deletevector][malformed]") {
+  DeleteVector delete_vector({"a.del"}, 1);
+  std::vector<uint8_t> bitmap(10, 0);
+  delete_vector.set_tile(0, bitmap);
+  auto serialized = delete_vector.serialize();
+
+  // Truncated data.
+  CHECK_THROWS(DeleteVector::deserialize(
+      serialized.data(), serialized.size() - 1));
+
+  // Unknown version.
+  serialized[0] = 0xFF;
+  CHECK_THROWS(
+      DeleteVector::deserialize(serialized.data(), serialized.size()));
+}
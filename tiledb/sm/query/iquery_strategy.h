@@ -33,7 +33,11 @@
 #ifndef TILEDB_IQUERY_STRATEGY_H
 #define TILEDB_IQUERY_STRATEGY_H
 
+#include <string>
+#include <vector>
+
 #include "tiledb/common/status.h"
+#include "tiledb/sm/buffer/buffer.h"
 #include "tiledb/sm/enums/layout.h"
 #include "tiledb/sm/enums/query_status_details.h"
 
@@ -64,6 +68,16 @@ class IQueryStrategy {
 
   /** Resets the object */
   virtual void reset() = 0;
+
+  /**
+   * Returns the buffers the views of a var-sized field point into, after a
+   * read in the `views` offsets format. Empty for the other strategies.
+   */
+  virtual const std::vector<ConstBuffer>& view_buffers(
+      const std::string&) const {
+    static const std::vector<ConstBuffer> empty;
+    return empty;
+  }
 };
 
 }  // namespace sm
@@ -2103,7 +2103,8 @@ Status Reader::add_extra_offset() {
 
 bool Reader::sparse_tile_overwritten(
     unsigned frag_idx, uint64_t tile_idx) const {
-  const auto& mbr = fragment_metadata_[frag_idx]->mbr(tile_idx);
+  RTree::PinnedLeafPage pinned;
+  const auto& mbr = fragment_metadata_[frag_idx]->mbr(tile_idx, &pinned);
   assert(!mbr.empty());
   auto fragment_num = (unsigned)fragment_metadata_.size();
   auto& domain{array_schema_.domain()};
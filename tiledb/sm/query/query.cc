@@ -599,6 +599,37 @@ Status Query::get_written_fragment_timestamp_range(
   return Status::Ok();
 }
 
+Status Query::get_view_buffer_num(const char* name, uint64_t* num) const {
+  if (type_ != QueryType::READ) {
+    return logger_->status(Status_QueryError(
+        "Cannot get number of view buffers; Applicable only to READ mode"));
+  }
+
+  *num = strategy_ == nullptr ? 0 : strategy_->view_buffers(name).size();
+
+  return Status::Ok();
+}
+
+Status Query::get_view_buffer(
+    const char* name, uint64_t idx, const void** data, uint64_t* size) const {
+  if (type_ != QueryType::READ) {
+    return logger_->status(Status_QueryError(
+        "Cannot get view buffer; Applicable only to READ mode"));
+  }
+
+  uint64_t num = 0;
+  RETURN_NOT_OK(get_view_buffer_num(name, &num));
+  if (idx >= num)
+    return logger_->status(
+        Status_QueryError("Cannot get view buffer; Invalid buffer index"));
+
+  const auto& buffer = strategy_->view_buffers(name)[idx];
+  *data = buffer.data();
+  *size = buffer.size();
+
+  return Status::Ok();
+}
+
 const Array* Query::array() const {
   return array_;
 }
@@ -340,6 +340,20 @@ class Query {
   Status get_written_fragment_timestamp_range(
       uint32_t idx, uint64_t* t1, uint64_t* t2) const;
 
+  /**
+   * Retrieves the number of buffers the views of the input var-sized field
+   * point into, after a read in the `views` offsets format.
+   */
+  Status get_view_buffer_num(const char* name, uint64_t* num) const;
+
+  /**
+   * Retrieves the buffer with the input index that the views of the input
+   * var-sized field point into, after a read in the `views` offsets format.
+   * The buffer is valid until the next submit.
+   */
+  Status get_view_buffer(
+      const char* name, uint64_t idx, const void** data, uint64_t* size) const;
+
   /** Returns the array's smart pointer. */
   inline shared_ptr<Array> array_shared() {
     return array_shared_;
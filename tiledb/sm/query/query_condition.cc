@@ -41,6 +41,7 @@
 #include "tiledb/storage_format/uri/parse_uri.h"
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
 #include <iostream>
 #include <map>
@@ -115,6 +116,12 @@ Status QueryCondition::init(
     return Status_QueryConditionError("Cannot reinitialize query condition");
   }
 
+  if (is_set_membership_op(op)) {
+    return Status_QueryConditionError(
+        "Cannot initialize query condition; Set membership operators require "
+        "a set of values");
+  }
+
   // AST Construction.
   tree_ = tdb_unique_ptr<ASTNode>(tdb_new(
       ASTNodeVal, field_name, condition_value, condition_value_size, op));
@@ -122,6 +129,50 @@ Status QueryCondition::init(
   return Status::Ok();
 }
 
+Status QueryCondition::init_set_membership(
+    std::string&& field_name,
+    const void* const data,
+    const uint64_t data_size,
+    const void* const offsets,
+    const uint64_t offsets_size,
+    const QueryConditionOp& op) {
+  if (tree_) {
+    return Status_QueryConditionError("Cannot reinitialize query condition");
+  }
+
+  if (!is_set_membership_op(op)) {
+    return Status_QueryConditionError(
+        "Cannot initialize query condition; A set of values can only be used "
+        "with set membership operators");
+  }
+
+  if ((data == nullptr && data_size != 0) ||
+      (offsets == nullptr && offsets_size != 0) ||
+      offsets_size % sizeof(uint64_t) != 0) {
+    return Status_QueryConditionError(
+        "Cannot initialize query condition; Invalid set of values");
+  }
+
+  // The members must be contiguous in `data`.
+  const auto offsets_data = static_cast<const uint64_t*>(offsets);
+  const uint64_t member_num = offsets_size / sizeof(uint64_t);
+  for (uint64_t i = 0; i < member_num; i++) {
+    if (offsets_data[i] > data_size ||
+        (i == 0 && offsets_data[i] != 0) ||
+        (i != 0 && offsets_data[i] < offsets_data[i - 1])) {
+      return Status_QueryConditionError(
+          "Cannot initialize query condition; Set offsets must start at 0, be "
+          "sorted and lie within the set data");
+    }
+  }
+
+  // AST Construction.
+  tree_ = tdb_unique_ptr<ASTNode>(tdb_new(
+      ASTNodeVal, field_name, data, data_size, offsets, offsets_size, op));
+
+  return Status::Ok();
+}
+
 Status QueryCondition::check(const ArraySchema& array_schema) const {
   if (!tree_) {
     return Status::Ok();
@@ -173,6 +224,125 @@ uint64_t QueryCondition::condition_timestamp() const {
   return timestamps.first;
 }
 
+bool QueryCondition::always_satisfied(
+    const ArraySchema& array_schema, const FieldRangeFunc& field_range) const {
+  if (!tree_) {
+    return true;
+  }
+
+  return always_satisfied(tree_, array_schema, field_range);
+}
+
+/**
+ * Returns `true` if all values in [min, max] satisfy `op` against `value`.
+ */
+template <typename T>
+static bool range_always_satisfies(
+    QueryConditionOp op, const void* min, const void* max, const void* value) {
+  T lo, hi, v;
+  std::memcpy(&lo, min, sizeof(T));
+  std::memcpy(&hi, max, sizeof(T));
+  std::memcpy(&v, value, sizeof(T));
+
+  switch (op) {
+    case QueryConditionOp::LT:
+      return hi < v;
+    case QueryConditionOp::LE:
+      return hi <= v;
+    case QueryConditionOp::GT:
+      return lo > v;
+    case QueryConditionOp::GE:
+      return lo >= v;
+    case QueryConditionOp::EQ:
+      return lo == v && hi == v;
+    case QueryConditionOp::NE:
+      return v < lo || v > hi;
+    default:
+      return false;
+  }
+}
+
+bool QueryCondition::always_satisfied(
+    const tdb_unique_ptr<ASTNode>& node,
+    const ArraySchema& array_schema,
+    const FieldRangeFunc& field_range) const {
+  if (node->is_expr()) {
+    const auto& children = node->get_children();
+    switch (node->get_combination_op()) {
+      case QueryConditionCombinationOp::AND:
+        return std::all_of(
+            children.begin(), children.end(), [&](const auto& child) {
+              return always_satisfied(child, array_schema, field_range);
+            });
+      case QueryConditionCombinationOp::OR:
+        return std::any_of(
+            children.begin(), children.end(), [&](const auto& child) {
+              return always_satisfied(child, array_schema, field_range);
+            });
+      default:
+        return false;
+    }
+  }
+
+  const auto& field_name = node->get_field_name();
+  const auto& value = node->get_condition_value_view();
+  if (value.content() == nullptr) {
+    return false;
+  }
+
+  const auto range = field_range(field_name);
+  if (!range.has_value() || array_schema.var_size(field_name) ||
+      array_schema.is_nullable(field_name)) {
+    return false;
+  }
+
+  const auto type = array_schema.type(field_name);
+  if (value.size() != datatype_size(type) ||
+      array_schema.cell_size(field_name) != datatype_size(type)) {
+    return false;
+  }
+
+  const auto op = node->get_op();
+  const auto [min, max] = *range;
+  switch (type) {
+    case Datatype::INT8:
+      return range_always_satisfies<int8_t>(op, min, max, value.content());
+    case Datatype::BOOL:
+    case Datatype::UINT8:
+      return range_always_satisfies<uint8_t>(op, min, max, value.content());
+    case Datatype::INT16:
+      return range_always_satisfies<int16_t>(op, min, max, value.content());
+    case Datatype::UINT16:
+      return range_always_satisfies<uint16_t>(op, min, max, value.content());
+    case Datatype::INT32:
+      return range_always_satisfies<int32_t>(op, min, max, value.content());
+    case Datatype::UINT32:
+      return range_always_satisfies<uint32_t>(op, min, max, value.content());
+    case Datatype::INT64:
+      return range_always_satisfies<int64_t>(op, min, max, value.content());
+    case Datatype::UINT64:
+      return range_always_satisfies<uint64_t>(op, min, max, value.content());
+    case Datatype::DATETIME_YEAR:
+    case Datatype::DATETIME_MONTH:
+    case Datatype::DATETIME_WEEK:
+    case Datatype::DATETIME_DAY:
+    case Datatype::DATETIME_HR:
+    case Datatype::DATETIME_MIN:
+    case Datatype::DATETIME_SEC:
+    case Datatype::DATETIME_MS:
+    case Datatype::DATETIME_US:
+    case Datatype::DATETIME_NS:
+    case Datatype::DATETIME_PS:
+    case Datatype::DATETIME_FS:
+    case Datatype::DATETIME_AS:
+      return range_always_satisfies<int64_t>(op, min, max, value.content());
+    default:
+      // Floating point values are not pruned as NaNs are not reflected in the
+      // ranges.
+      return false;
+  }
+}
+
 /** Full template specialization for `char*` and `QueryConditionOp::LT`. */
 template <>
 struct QueryCondition::BinaryCmpNullChecks<char*, QueryConditionOp::LT> {
@@ -369,6 +539,49 @@ struct QueryCondition::BinaryCmpNullChecks<T, QueryConditionOp::NE> {
   }
 };
 
+/**
+ * Returns true if a cell value is a member of the value set of a set
+ * membership node. Floating point values are matched by value, i.e. `0.0`
+ * and `-0.0` are the same member and `NaN` is never a member.
+ */
+template <typename T>
+static inline bool value_set_contains(
+    const void* value, uint64_t size, const void* value_set) {
+  const auto set = static_cast<const ConditionValueSet*>(value_set);
+  if constexpr (std::is_floating_point_v<T>) {
+    const T v = *static_cast<const T*>(value);
+    if (std::isnan(v)) {
+      return false;
+    }
+
+    if (v == 0) {
+      const T zeros[2] = {T(0), -T(0)};
+      return set->contains(&zeros[0], sizeof(T)) ||
+             set->contains(&zeros[1], sizeof(T));
+    }
+  }
+
+  return set->contains(value, size);
+}
+
+/** Partial template specialization for `QueryConditionOp::IN`. */
+template <typename T>
+struct QueryCondition::BinaryCmpNullChecks<T, QueryConditionOp::IN> {
+  static inline bool cmp(
+      const void* lhs, uint64_t lhs_size, const void* rhs, uint64_t) {
+    return lhs != nullptr && value_set_contains<T>(lhs, lhs_size, rhs);
+  }
+};
+
+/** Partial template specialization for `QueryConditionOp::NOT_IN`. */
+template <typename T>
+struct QueryCondition::BinaryCmpNullChecks<T, QueryConditionOp::NOT_IN> {
+  static inline bool cmp(
+      const void* lhs, uint64_t lhs_size, const void* rhs, uint64_t) {
+    return lhs != nullptr && !value_set_contains<T>(lhs, lhs_size, rhs);
+  }
+};
+
 template <typename T, QueryConditionOp Op, typename CombinationOp>
 void QueryCondition::apply_ast_node(
     const tdb_unique_ptr<ASTNode>& node,
@@ -384,6 +597,11 @@ void QueryCondition::apply_ast_node(
   const void* condition_value_content =
       node->get_condition_value_view().content();
   const size_t condition_value_size = node->get_condition_value_view().size();
+
+  // Set membership ops test the cell values against the node value set.
+  if constexpr (is_set_membership_op(Op)) {
+    condition_value_content = &node->get_value_set();
+  }
   uint64_t starting_index = 0;
   for (const auto& rcs : result_cell_slabs) {
     ResultTile* const result_tile = rcs.tile_;
@@ -603,6 +821,30 @@ void QueryCondition::apply_ast_node(
           combination_op,
           result_cell_bitmap);
       break;
+    case QueryConditionOp::IN:
+      apply_ast_node<T, QueryConditionOp::IN, CombinationOp>(
+          node,
+          fragment_metadata,
+          stride,
+          var_size,
+          nullable,
+          fill_value,
+          result_cell_slabs,
+          combination_op,
+          result_cell_bitmap);
+      break;
+    case QueryConditionOp::NOT_IN:
+      apply_ast_node<T, QueryConditionOp::NOT_IN, CombinationOp>(
+          node,
+          fragment_metadata,
+          stride,
+          var_size,
+          nullable,
+          fill_value,
+          result_cell_slabs,
+          combination_op,
+          result_cell_bitmap);
+      break;
     default:
       throw std::runtime_error(
           "QueryCondition::apply_ast_node: Cannot perform query comparison; "
@@ -1013,6 +1255,11 @@ void QueryCondition::apply_ast_node_dense(
       node->get_condition_value_view().content();
   const size_t condition_value_size = node->get_condition_value_view().size();
 
+  // Set membership ops test the cell values against the node value set.
+  if constexpr (is_set_membership_op(Op)) {
+    condition_value_content = &node->get_value_set();
+  }
+
   // Get the nullable buffer.
   const auto tile_tuple = result_tile->tile_tuple(field_name);
   uint8_t* buffer_validity = nullptr;
@@ -1171,6 +1418,30 @@ void QueryCondition::apply_ast_node_dense(
           combination_op,
           result_buffer);
       break;
+    case QueryConditionOp::IN:
+      apply_ast_node_dense<T, QueryConditionOp::IN, CombinationOp>(
+          node,
+          result_tile,
+          start,
+          src_cell,
+          stride,
+          var_size,
+          nullable,
+          combination_op,
+          result_buffer);
+      break;
+    case QueryConditionOp::NOT_IN:
+      apply_ast_node_dense<T, QueryConditionOp::NOT_IN, CombinationOp>(
+          node,
+          result_tile,
+          start,
+          src_cell,
+          stride,
+          var_size,
+          nullable,
+          combination_op,
+          result_buffer);
+      break;
     default:
       throw std::runtime_error(
           "Cannot perform query comparison; Unknown query condition operator");
@@ -1700,6 +1971,24 @@ struct QueryCondition::BinaryCmp<T, QueryConditionOp::NE> {
   }
 };
 
+/** Partial template specialization for `QueryConditionOp::IN`. */
+template <typename T>
+struct QueryCondition::BinaryCmp<T, QueryConditionOp::IN> {
+  static inline bool cmp(
+      const void* lhs, uint64_t lhs_size, const void* rhs, uint64_t) {
+    return value_set_contains<T>(lhs, lhs_size, rhs);
+  }
+};
+
+/** Partial template specialization for `QueryConditionOp::NOT_IN`. */
+template <typename T>
+struct QueryCondition::BinaryCmp<T, QueryConditionOp::NOT_IN> {
+  static inline bool cmp(
+      const void* lhs, uint64_t lhs_size, const void* rhs, uint64_t) {
+    return !value_set_contains<T>(lhs, lhs_size, rhs);
+  }
+};
+
 template <typename T>
 struct QCMax {
   const T& operator()(const T& a, const T& b) const {
@@ -1723,6 +2012,11 @@ void QueryCondition::apply_ast_node_sparse(
   const void* condition_value_content =
       node->get_condition_value_view().content();
   const size_t condition_value_size = node->get_condition_value_view().size();
+
+  // Set membership ops test the cell values against the node value set.
+  if constexpr (is_set_membership_op(Op)) {
+    condition_value_content = &node->get_value_set();
+  }
   uint8_t* buffer_validity = nullptr;
 
   // Check if the combination op = OR and the attribute is nullable.
@@ -1861,6 +2155,22 @@ void QueryCondition::apply_ast_node_sparse(
           CombinationOp,
           nullable>(node, result_tile, var_size, combination_op, result_bitmap);
       break;
+    case QueryConditionOp::IN:
+      apply_ast_node_sparse<
+          T,
+          QueryConditionOp::IN,
+          BitmapType,
+          CombinationOp,
+          nullable>(node, result_tile, var_size, combination_op, result_bitmap);
+      break;
+    case QueryConditionOp::NOT_IN:
+      apply_ast_node_sparse<
+          T,
+          QueryConditionOp::NOT_IN,
+          BitmapType,
+          CombinationOp,
+          nullable>(node, result_tile, var_size, combination_op, result_bitmap);
+      break;
     default:
       throw std::runtime_error(
           "Cannot perform query comparison; Unknown query condition operator.");
@@ -35,6 +35,7 @@
 
 #include "external/include/span/span.hpp"
 
+#include <functional>
 #include <unordered_set>
 
 #include "tiledb/common/status.h"
@@ -55,6 +56,17 @@ enum class QueryConditionCombinationOp : uint8_t;
 
 class QueryCondition {
  public:
+  /* ********************************* */
+  /*           TYPE DEFINITIONS        */
+  /* ********************************* */
+
+  /**
+   * Returns pointers to the min and max values of a fixed-size field over a
+   * set of cells (e.g. a tile), or `nullopt` if they are unknown.
+   */
+  using FieldRangeFunc = std::function<optional<
+      std::pair<const void*, const void*>>(const std::string& field_name)>;
+
   /* ********************************* */
   /*     CONSTRUCTORS & DESTRUCTORS    */
   /* ********************************* */
@@ -111,6 +123,24 @@ class QueryCondition {
       uint64_t condition_value_size,
       const QueryConditionOp& op);
 
+  /**
+   * Initializes the instance with a set membership operation.
+   *
+   * @param field_name The name of the field this operation applies to.
+   * @param data The member values to test against, concatenated.
+   * @param data_size The byte size of data.
+   * @param offsets The starting offsets (uint64_t) of the members in `data`.
+   * @param offsets_size The byte size of offsets.
+   * @param op The set membership operation, `IN` or `NOT_IN`.
+   */
+  Status init_set_membership(
+      std::string&& field_name,
+      const void* data,
+      uint64_t data_size,
+      const void* offsets,
+      uint64_t offsets_size,
+      const QueryConditionOp& op);
+
   /**
    * Verifies that the current state contains supported comparison
    * operations. Currently, we support the following:
@@ -205,6 +235,21 @@ class QueryCondition {
       ResultTile& result_tile,
       std::vector<BitmapType>& result_bitmap);
 
+  /**
+   * Checks, without reading the cells, whether the condition holds for all
+   * the cells whose field values fall in the ranges returned by
+   * `field_range`, e.g. the min/max metadata of a tile. Only comparisons on
+   * fixed-size, single-value, non-nullable, integral or datetime fields are
+   * considered; anything else is assumed to possibly fail.
+   *
+   * @param array_schema The array schema.
+   * @param field_range Returns the [min, max] range of a field.
+   * @return `true` if the condition holds for all cells, `false` if it
+   *     might not.
+   */
+  bool always_satisfied(
+      const ArraySchema& array_schema, const FieldRangeFunc& field_range) const;
+
   /**
    * Reverse the query condition using De Morgan's law.
    */
@@ -275,6 +320,19 @@ class QueryCondition {
   /*          PRIVATE METHODS          */
   /* ********************************* */
 
+  /**
+   * Implements `always_satisfied` for an AST node.
+   *
+   * @param node The node to check.
+   * @param array_schema The array schema.
+   * @param field_range Returns the [min, max] range of a field.
+   * @return `true` if the node holds for all cells, `false` if it might not.
+   */
+  bool always_satisfied(
+      const tdb_unique_ptr<ASTNode>& node,
+      const ArraySchema& array_schema,
+      const FieldRangeFunc& field_range) const;
+
   /**
    * Applies a value node on primitive-typed result cell slabs,
    * templated for a query condition operator.
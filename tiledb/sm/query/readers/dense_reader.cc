@@ -31,6 +31,7 @@
  */
 
 #include "tiledb/common/logger.h"
+#include "tiledb/common/scoped_executor.h"
 
 #include "tiledb/sm/array/array.h"
 #include "tiledb/sm/array_schema/array_schema.h"
@@ -85,6 +86,9 @@ DenseReader::DenseReader(
           layout,
           condition) {
   elements_mode_ = false;
+  views_mode_ = false;
+  memory_budget_ = 0;
+  overflow_tiles_size_ = 0;
 
   // Sanity checks.
   if (storage_manager_ == nullptr) {
@@ -119,6 +123,11 @@ DenseReader::DenseReader(
   }
   assert(found);
   disable_cache_ = tile_cache_size == 0;
+
+  // Initialize memory budget variables.
+  if (!initialize_memory_budget().ok()) {
+    throw DenseReaderStatusException("Cannot initialize memory budget");
+  }
 }
 
 /* ****************************** */
@@ -135,6 +144,11 @@ QueryStatusDetailsReason DenseReader::status_incomplete_reason() const {
 }
 
 Status DenseReader::initialize_memory_budget() {
+  bool found = false;
+  RETURN_NOT_OK(
+      config_.get<uint64_t>("sm.mem.total_budget", &memory_budget_, &found));
+  assert(found);
+
   return Status::Ok();
 }
 
@@ -162,6 +176,13 @@ Status DenseReader::dowork() {
 
   get_dim_attr_stats();
 
+  // The overflow tiles are only valid for the partitions of this loop.
+  ScopedExecutor clear_overflow_tiles([&]() {
+    overflow_tiles_.clear();
+    overflow_tiles_name_.clear();
+    overflow_tiles_size_ = 0;
+  });
+
   // Get next partition.
   if (!read_state_.unsplittable_)
     RETURN_NOT_OK(read_state_.next());
@@ -172,9 +193,11 @@ Status DenseReader::dowork() {
 
     read_state_.overflowed_ = false;
     reset_buffer_sizes();
+    clear_views();
 
-    // Perform read.
-    if (offsets_bitsize_ == 64) {
+    // Perform read. In views mode, the cell sizes are first computed as
+    // 64-bit values.
+    if (offsets_bitsize_ == 64 || views_mode_) {
       RETURN_NOT_OK(dense_read<uint64_t>());
     } else {
       RETURN_NOT_OK(dense_read<uint32_t>());
@@ -260,6 +283,28 @@ Status DenseReader::dense_read() {
   // For easy reference.
   const auto dim_num = array_schema_.dim_num();
   auto& subarray = read_state_.partitioner_.current();
+
+  // Exit early if the fixed size or offsets buffers cannot hold the results,
+  // before any tile is read.
+  const auto cell_num = subarray.cell_num();
+  for (const auto& it : buffers_) {
+    const auto& name = it.first;
+    if (name == constants::coords || array_schema_.is_dim(name)) {
+      continue;
+    }
+
+    const auto required_size =
+        array_schema_.var_size(name) ?
+            (views_mode_ ?
+                 cell_num * constants::cell_var_view_size :
+                 (cell_num + offsets_extra_element_) * sizeof(OffType)) :
+            cell_num * array_schema_.cell_size(name);
+    if (required_size > *it.second.buffer_size_) {
+      read_state_.overflowed_ = true;
+      return Status::Ok();
+    }
+  }
+
   RETURN_NOT_OK(subarray.compute_tile_coords<DimType>());
   const auto& domain{array_schema_.domain()};
 
@@ -386,6 +431,18 @@ Status DenseReader::dense_read() {
     }
   }
 
+  // Only var data can overflow once the tiles are read, so process the var
+  // sized attributes first, starting with the one that overflowed last.
+  auto read_order = [&](const std::string& n) {
+    return n == overflow_tiles_name_ ? 0 : array_schema_.var_size(n) ? 1 : 2;
+  };
+  std::stable_sort(
+      names.begin() + condition_names.size(),
+      names.end(),
+      [&](const std::string& a, const std::string& b) {
+        return read_order(a) < read_order(b);
+      });
+
   // Pre-load all attribute offsets into memory for attributes
   // in query condition to be read.
   RETURN_CANCEL_OR_ERROR(
@@ -402,14 +459,97 @@ Status DenseReader::dense_read() {
       num_range_threads);
   RETURN_CANCEL_OR_ERROR(st);
 
+  // Attributes whose tiles still need to be read, in processing order.
+  std::vector<std::string> read_names;
+  for (auto& name : names) {
+    if (condition_names.count(name) == 0) {
+      read_names.emplace_back(name);
+    }
+  }
+
+  // The tiles of the next attribute are read on the IO thread pool while the
+  // current attribute is unfiltered and copied, as long as the tiles of both
+  // attributes, plus the kept overflow tiles, fit in the memory budget. Make
+  // sure no read is left in flight on an early exit, as it writes into the
+  // result tiles.
+  std::vector<ThreadPool::Task> prefetch_tasks;
+  ScopedExecutor wait_prefetch([&]() {
+    if (!prefetch_tasks.empty()) {
+      storage_manager_->io_tp()->wait_all_status(prefetch_tasks);
+    }
+  });
+
   // Process attributes.
   std::vector<std::string> to_read(1);
+  uint64_t read_idx = 0;
+  optional<uint64_t> tiles_size = nullopt;
   for (auto& name : names) {
-    if (condition_.field_names().count(name) == 0) {
-      // Read and unfilter tiles.
-      to_read[0] = name;
-      RETURN_CANCEL_OR_ERROR(read_attribute_tiles(to_read, result_tiles));
-      RETURN_CANCEL_OR_ERROR(unfilter_tiles(name, result_tiles));
+    if (condition_names.count(name) == 0) {
+      // Read the tiles, or wait for them if they are already being read.
+      std::vector<ResultTile*> missing_tiles;
+      const std::vector<ResultTile*>* to_unfilter = &result_tiles;
+      if (!prefetch_tasks.empty()) {
+        auto timer_se = stats_->start_timer("dense_read_prefetch_wait");
+        auto statuses =
+            storage_manager_->io_tp()->wait_all_status(prefetch_tasks);
+        prefetch_tasks.clear();
+        for (auto& st : statuses) {
+          RETURN_CANCEL_OR_ERROR(st);
+        }
+      } else {
+        // Reuse the tiles kept from the overflowed read of a larger partition
+        // and only read the missing ones.
+        if (name == overflow_tiles_name_) {
+          for (auto tile : result_tiles) {
+            auto it =
+                overflow_tiles_.find({tile->frag_idx(), tile->tile_idx()});
+            if (it != overflow_tiles_.end()) {
+              tile->set_attr_tile(name, std::move(it->second));
+            } else {
+              missing_tiles.emplace_back(tile);
+            }
+          }
+
+          stats_->add_counter(
+              "overflow_tiles_reused",
+              result_tiles.size() - missing_tiles.size());
+          overflow_tiles_.clear();
+          overflow_tiles_name_.clear();
+          overflow_tiles_size_ = 0;
+          to_unfilter = &missing_tiles;
+        }
+
+        to_read[0] = name;
+        RETURN_CANCEL_OR_ERROR(read_attribute_tiles(to_read, *to_unfilter));
+        tiles_size = attribute_tiles_size(name, result_tiles);
+      }
+      read_idx++;
+
+      // Start reading the tiles of the next attribute.
+      if (read_idx < read_names.size() && tiles_size.has_value()) {
+        auto next_tiles_size =
+            attribute_tiles_size(read_names[read_idx], result_tiles);
+        if (next_tiles_size.has_value() &&
+            view_tiles_size_ + overflow_tiles_size_ + *tiles_size +
+                    *next_tiles_size <=
+                memory_budget_) {
+          tiles_size = next_tiles_size;
+          prefetch_tasks.emplace_back(storage_manager_->io_tp()->execute(
+              [this, next = read_names[read_idx], &result_tiles]() {
+                return read_attribute_tiles({next}, result_tiles);
+              }));
+          stats_->add_counter("dense_read_prefetch_num", 1);
+        }
+      }
+
+      RETURN_CANCEL_OR_ERROR(unfilter_tiles(name, *to_unfilter));
+    }
+
+    // In views mode, the views of var-sized attributes point into their
+    // tiles, which are kept until the next submit instead of cleared.
+    const bool views = views_mode_ && array_schema_.var_size(name);
+    if (views) {
+      add_view_tiles(name, result_tiles);
     }
 
     // Copy attribute data to users buffers.
@@ -425,12 +565,23 @@ Status DenseReader::dense_read() {
         num_range_threads);
     RETURN_CANCEL_OR_ERROR(status);
 
+    // On overflow, the partition will be split and read again. Keep the
+    // unfiltered tiles of this attribute for that read if they fit in the
+    // memory budget and skip the remaining attributes.
+    if (read_state_.overflowed_) {
+      if (condition_names.count(name) == 0) {
+        keep_overflow_tiles(name, result_tiles);
+      }
+
+      return Status::Ok();
+    }
+
+    if (views) {
+      retain_view_tiles(name, result_tiles);
+    }
     clear_tiles(name, result_tiles);
   }
 
-  if (read_state_.overflowed_)
-    Status::Ok();
-
   // Fill coordinates if the user requested them.
   if (!read_state_.overflowed_ && has_coords()) {
     auto&& [st, overflowed] = fill_dense_coords<DimType>(subarray);
@@ -469,12 +620,14 @@ void DenseReader::init_read_state() {
 
   offsets_format_mode_ = config_.get("sm.var_offsets.mode", &found);
   assert(found);
-  if (offsets_format_mode_ != "bytes" && offsets_format_mode_ != "elements") {
+  if (offsets_format_mode_ != "bytes" && offsets_format_mode_ != "elements" &&
+      offsets_format_mode_ != "views") {
     throw DenseReaderStatusException(
         "Cannot initialize reader; Unsupported offsets format in "
         "configuration");
   }
   elements_mode_ = offsets_format_mode_ == "elements";
+  views_mode_ = offsets_format_mode_ == "views";
 
   if (!config_
            .get<bool>(
@@ -483,6 +636,11 @@ void DenseReader::init_read_state() {
     throw DenseReaderStatusException("Cannot get setting");
   }
   assert(found);
+  if (views_mode_ && offsets_extra_element_) {
+    throw DenseReaderStatusException(
+        "Cannot initialize reader; Extra offset element is not supported "
+        "with views offsets format");
+  }
 
   if (!config_
            .get<uint32_t>("sm.var_offsets.bitsize", &offsets_bitsize_, &found)
@@ -562,6 +720,86 @@ void DenseReader::init_read_state() {
   read_state_.initialized_ = true;
 }
 
+void DenseReader::keep_overflow_tiles(
+    const std::string& name, const std::vector<ResultTile*>& result_tiles) {
+  const bool var_size = array_schema_.var_size(name);
+  const bool nullable = array_schema_.is_nullable(name);
+  auto held_size = [](Tile& t) {
+    return t.size() + t.filtered_buffer().size();
+  };
+
+  std::map<std::pair<unsigned, uint64_t>, ResultTile::TileTuple> tiles;
+  uint64_t size = 0;
+  for (auto tile : result_tiles) {
+    auto tile_tuple = tile->release_attr_tile(name);
+    if (tile_tuple.has_value()) {
+      size += held_size(tile_tuple->fixed_tile());
+      if (var_size) {
+        size += held_size(tile_tuple->var_tile());
+      }
+      if (nullable) {
+        size += held_size(tile_tuple->validity_tile());
+      }
+      tiles.emplace(
+          std::make_pair(tile->frag_idx(), tile->tile_idx()),
+          std::move(*tile_tuple));
+    }
+  }
+
+  // Tiles that do not fit in the memory budget are released, the split
+  // partition will read them again.
+  if (size > memory_budget_) {
+    stats_->add_counter("overflow_tiles_dropped", tiles.size());
+    return;
+  }
+
+  overflow_tiles_name_ = name;
+  overflow_tiles_ = std::move(tiles);
+  overflow_tiles_size_ = size;
+}
+
+optional<uint64_t> DenseReader::attribute_tiles_size(
+    const std::string& name, const std::vector<ResultTile*>& result_tiles) {
+  uint64_t size = 0;
+  for (auto tile : result_tiles) {
+    auto const fragment = fragment_metadata_[tile->frag_idx()];
+    const auto& array_schema = fragment->array_schema();
+    if (!array_schema->is_field(name)) {
+      continue;
+    }
+
+    // Filtered and unfiltered tiles are both held until the tile is cleared.
+    const auto tile_idx = tile->tile_idx();
+    auto&& [st, persisted_size] = fragment->persisted_tile_size(name, tile_idx);
+    if (!st.ok()) {
+      return nullopt;
+    }
+    size += *persisted_size + fragment->tile_size(name, tile_idx);
+
+    if (array_schema->var_size(name)) {
+      auto&& [st_1, persisted_var_size] =
+          fragment->persisted_tile_var_size(name, tile_idx);
+      auto&& [st_2, var_size] = fragment->tile_var_size(name, tile_idx);
+      if (!st_1.ok() || !st_2.ok()) {
+        return nullopt;
+      }
+      size += *persisted_var_size + *var_size;
+    }
+
+    if (array_schema->is_nullable(name)) {
+      auto&& [st_3, persisted_validity_size] =
+          fragment->persisted_tile_validity_size(name, tile_idx);
+      if (!st_3.ok()) {
+        return nullopt;
+      }
+      size += *persisted_validity_size +
+              fragment->cell_num(tile_idx) * constants::cell_validity_size;
+    }
+  }
+
+  return size;
+}
+
 /** Apply the query condition. */
 template <class DimType, class OffType>
 tuple<Status, optional<std::vector<uint8_t>>>
@@ -726,6 +964,42 @@ uint64_t DenseReader::fix_offsets_buffer(
   return offset;
 }
 
+Status DenseReader::fix_views_buffer(
+    const std::string& name,
+    const bool nullable,
+    const uint64_t cell_num,
+    std::vector<void*>& var_data) {
+  // For easy reference.
+  const auto& fill_value = array_schema_.attribute(name)->fill_value();
+  auto sizes = (uint64_t*)buffers_[name].buffer_;
+
+  // The maximum value is used as a sentinel to request the fill value.
+  bool fill_value_used = false;
+  for (uint64_t i = 0; i < cell_num; ++i) {
+    if (sizes[i] == std::numeric_limits<uint64_t>::max()) {
+      sizes[i] = fill_value.size();
+      var_data[i] = (void*)fill_value.data();
+      fill_value_used = true;
+    }
+  }
+
+  if (fill_value_used) {
+    add_view_buffer(name, fill_value.data(), fill_value.size());
+  }
+
+  RETURN_NOT_OK(build_views(
+      name, cell_num, var_data.data(), (uint8_t*)buffers_[name].buffer_));
+
+  // Set the output buffer sizes, no data is copied to the var buffer.
+  *buffers_[name].buffer_size_ = cell_num * constants::cell_var_view_size;
+  *buffers_[name].buffer_var_size_ = 0;
+
+  if (nullable)
+    *buffers_[name].validity_vector_.buffer_size() = cell_num;
+
+  return Status::Ok();
+}
+
 template <class DimType, class OffType>
 Status DenseReader::copy_attribute(
     const std::string& name,
@@ -747,7 +1021,8 @@ Status DenseReader::copy_attribute(
   if (array_schema_.var_size(name)) {
     // Make sure the user offset buffers are big enough.
     const auto required_size =
-        (cell_num + offsets_extra_element_) * sizeof(OffType);
+        views_mode_ ? cell_num * constants::cell_var_view_size :
+                      (cell_num + offsets_extra_element_) * sizeof(OffType);
     if (required_size > *buffers_[name].buffer_size_) {
       read_state_.overflowed_ = true;
       return Status::Ok();
@@ -788,6 +1063,18 @@ Status DenseReader::copy_attribute(
       RETURN_NOT_OK(status);
     }
 
+    // In views mode, convert the cell lengths to views pointing into the
+    // tiles, no var data is copied.
+    if (views_mode_) {
+      if (read_state_.overflowed_) {
+        return Status::Ok();
+      }
+
+      auto timer_se = stats_->start_timer("fix_view_tiles");
+      return fix_views_buffer(
+          name, array_schema_.is_nullable(name), cell_num, var_data);
+    }
+
     uint64_t var_buffer_size;
     {
       // We have the cell lengths in the users buffer, convert to offsets.
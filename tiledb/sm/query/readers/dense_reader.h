@@ -34,6 +34,7 @@
 #define TILEDB_DENSE_READER
 
 #include <atomic>
+#include <map>
 
 #include "tiledb/common/common.h"
 #include "tiledb/common/logger_public.h"
@@ -139,6 +140,12 @@ class DenseReader : public ReaderBase, public IQueryStrategy {
   /** Resets the reader object. */
   void reset();
 
+  /** Returns the buffers the views of a var-sized field point into. */
+  const std::vector<ConstBuffer>& view_buffers(
+      const std::string& name) const {
+    return field_view_buffers(name);
+  }
+
  private:
   /* ********************************* */
   /*         PRIVATE ATTRIBUTES        */
@@ -153,6 +160,29 @@ class DenseReader : public ReaderBase, public IQueryStrategy {
   /** Are we in elements mode. */
   bool elements_mode_;
 
+  /** Are we in views mode. */
+  bool views_mode_;
+
+  /**
+   * Total memory budget. Bounds the tiles held in memory when reading the
+   * tiles of the next attribute while the current one is processed.
+   */
+  uint64_t memory_budget_;
+
+  /** Name of the attribute whose tiles are in `overflow_tiles_`. */
+  std::string overflow_tiles_name_;
+
+  /**
+   * Unfiltered tiles of the var sized attribute that overflowed the user
+   * buffers, keyed on fragment and tile index. They are reused when the
+   * split partition is read, instead of being fetched and unfiltered again.
+   */
+  std::map<std::pair<unsigned, uint64_t>, ResultTile::TileTuple>
+      overflow_tiles_;
+
+  /** Memory held by `overflow_tiles_`, charged to `memory_budget_`. */
+  uint64_t overflow_tiles_size_;
+
   /* ********************************* */
   /*           PRIVATE METHODS         */
   /* ********************************* */
@@ -168,6 +198,24 @@ class DenseReader : public ReaderBase, public IQueryStrategy {
   /** Initializes the read state. */
   void init_read_state();
 
+  /**
+   * Keeps the tiles of an attribute that overflowed the user buffers in
+   * `overflow_tiles_`, for the read of the split partition. The tiles are
+   * released instead if they do not fit in the memory budget.
+   *
+   * @param name Name of the attribute.
+   * @param result_tiles Result tiles holding the attribute tiles.
+   */
+  void keep_overflow_tiles(
+      const std::string& name, const std::vector<ResultTile*>& result_tiles);
+
+  /**
+   * Returns the memory the tiles of an attribute will take once read and
+   * unfiltered, or `nullopt` if it cannot be computed.
+   */
+  optional<uint64_t> attribute_tiles_size(
+      const std::string& name, const std::vector<ResultTile*>& result_tiles);
+
   /** Apply the query condition. */
   template <class DimType, class OffType>
   tuple<Status, optional<std::vector<uint8_t>>> apply_query_condition(
@@ -188,6 +236,24 @@ class DenseReader : public ReaderBase, public IQueryStrategy {
       const uint64_t cell_num,
       std::vector<void*>& var_data);
 
+  /**
+   * Converts the cell sizes written in the offsets buffer after reading all
+   * offsets into views, in the `views` offsets format. The views point into
+   * the attribute tiles, or into the fill value, see
+   * `ReaderBase::build_views`.
+   *
+   * @param name The attribute name.
+   * @param nullable Is the attribute nullable.
+   * @param cell_num The number of cells.
+   * @param var_data The pointers to the data of each cell.
+   * @return Status.
+   */
+  Status fix_views_buffer(
+      const std::string& name,
+      const bool nullable,
+      const uint64_t cell_num,
+      std::vector<void*>& var_data);
+
   /** Copy attribute into the users buffers. */
   template <class DimType, class OffType>
   Status copy_attribute(
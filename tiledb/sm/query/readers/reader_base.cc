@@ -42,12 +42,16 @@
 #include "tiledb/sm/filter/compression_filter.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/misc/parallel_functions.h"
+#include "tiledb/sm/misc/tdb_math.h"
 #include "tiledb/sm/query/legacy/cell_slab_iter.h"
 #include "tiledb/sm/query/query_buffer.h"
 #include "tiledb/sm/query/query_macros.h"
 #include "tiledb/sm/query/strategy_base.h"
 #include "tiledb/sm/subarray/subarray.h"
 
+#include <cstring>
+#include <numeric>
+
 namespace tiledb {
 namespace sm {
 
@@ -86,7 +90,8 @@ ReaderBase::ReaderBase(
     , disable_batching_(false)
     , user_requested_timestamps_(false)
     , use_timestamps_(false)
-    , initial_data_loaded_(false) {
+    , initial_data_loaded_(false)
+    , view_tiles_size_(0) {
   if (array != nullptr)
     fragment_metadata_ = array->fragment_metadata();
   timestamps_needed_for_deletes_.resize(fragment_metadata_.size());
@@ -179,6 +184,176 @@ void ReaderBase::clear_tiles(
   }
 }
 
+const std::vector<ConstBuffer>& ReaderBase::field_view_buffers(
+    const std::string& name) const {
+  static const std::vector<ConstBuffer> empty;
+  auto it = view_buffers_.find(name);
+  return it == view_buffers_.end() ? empty : it->second;
+}
+
+void ReaderBase::clear_views() {
+  view_buffers_.clear();
+  view_buffers_data_.clear();
+  view_result_tiles_.clear();
+  view_tiles_.clear();
+  view_tiles_size_ = 0;
+}
+
+void ReaderBase::add_view_buffer(
+    const std::string& name, const void* data, const uint64_t size) {
+  // Memory shared by several result tiles or loops is registered once.
+  if (size == 0 || !view_buffers_data_.emplace(data).second) {
+    return;
+  }
+
+  const uint64_t max_size = std::numeric_limits<int32_t>::max();
+  const uint64_t window_step = 1ULL << 30;
+  auto& buffers = view_buffers_[name];
+  for (uint64_t start = 0;; start += window_step) {
+    buffers.emplace_back(
+        static_cast<const uint8_t*>(data) + start,
+        std::min(size - start, max_size));
+    if (size - start <= max_size) {
+      break;
+    }
+  }
+}
+
+void ReaderBase::add_view_tiles(
+    const std::string& name, const std::vector<ResultTile*>& result_tiles) {
+  for (auto rt : result_tiles) {
+    auto tile_tuple = rt->tile_tuple(name);
+    if (tile_tuple != nullptr) {
+      const auto& t_var = tile_tuple->var_tile();
+      add_view_buffer(name, t_var.data(), t_var.size());
+    }
+  }
+}
+
+void ReaderBase::retain_view_tiles(
+    const std::string& name, const std::vector<ResultTile*>& result_tiles) {
+  std::unique_lock<std::mutex> lck(view_tiles_mtx_);
+  for (auto rt : result_tiles) {
+    auto tile_tuple = rt->tile_tuple(name);
+    if (tile_tuple != nullptr && tile_tuple->var_tile().size() != 0) {
+      // Moving a tile keeps its data in place.
+      view_tiles_size_ += tile_tuple->var_tile().size();
+      view_tiles_.emplace_back(std::move(tile_tuple->var_tile()));
+    }
+  }
+}
+
+void ReaderBase::keep_view_result_tiles(
+    const std::vector<ResultTile*>& result_tiles) {
+  std::unique_lock<std::mutex> lck(view_tiles_mtx_);
+  view_result_tiles_.insert(result_tiles.begin(), result_tiles.end());
+}
+
+void ReaderBase::release_view_result_tile(ResultTile* result_tile) {
+  {
+    std::unique_lock<std::mutex> lck(view_tiles_mtx_);
+    if (view_result_tiles_.erase(result_tile) == 0) {
+      return;
+    }
+  }
+
+  for (const auto& it : view_buffers_) {
+    retain_view_tiles(it.first, {result_tile});
+  }
+}
+
+Status ReaderBase::build_views(
+    const std::string& name,
+    const uint64_t cell_num,
+    const void* const* var_data,
+    uint8_t* views) {
+  // For easy reference.
+  auto& buffers = view_buffers_[name];
+  const auto inline_size = constants::cell_var_view_inline_size;
+  const uint64_t max_size = std::numeric_limits<int32_t>::max();
+
+  // Sort the buffers by address to find the one holding each cell.
+  std::vector<uint64_t> sorted(buffers.size());
+  std::iota(sorted.begin(), sorted.end(), 0);
+  std::sort(sorted.begin(), sorted.end(), [&](uint64_t a, uint64_t b) {
+    return buffers[a].data() < buffers[b].data();
+  });
+
+  auto holds = [&](uint64_t b, const uint8_t* data, uint64_t size) {
+    auto start = static_cast<const uint8_t*>(buffers[b].data());
+    return data >= start &&
+           (uint64_t)(data - start) + size <= buffers[b].size();
+  };
+
+  // Consecutive cells are usually in the same buffer.
+  uint64_t b = buffers.size();
+  for (uint64_t i = cell_num; i-- > 0;) {
+    uint64_t size;
+    std::memcpy(&size, views + i * sizeof(uint64_t), sizeof(uint64_t));
+    if (size > max_size) {
+      return logger_->status(Status_ReaderError(
+          "Cannot read views; Cell size exceeds the maximum view size"));
+    }
+
+    const auto data = static_cast<const uint8_t*>(var_data[i]);
+    uint8_t view[16] = {0};
+    const auto view_size = (int32_t)size;
+    std::memcpy(view, &view_size, sizeof(int32_t));
+    if (size <= inline_size) {
+      if (size != 0) {
+        std::memcpy(view + 4, data, size);
+      }
+    } else {
+      if (b == buffers.size() || !holds(b, data, size)) {
+        // Find the last buffer starting before the cell data.
+        auto it = std::upper_bound(
+            sorted.begin(),
+            sorted.end(),
+            data,
+            [&](const uint8_t* d, uint64_t idx) {
+              return d < static_cast<const uint8_t*>(buffers[idx].data());
+            });
+        if (it == sorted.begin() ||
+            !holds(*(it - 1), data, inline_size + 1)) {
+          return logger_->status(Status_ReaderError(
+              "Cannot read views; Cell data is not in a view buffer"));
+        }
+
+        // A cell larger than 1GB might not fit in the window starting
+        // before it, add a window starting at the cell.
+        b = *(it - 1);
+        if (!holds(b, data, size)) {
+          buffers.emplace_back(data, size);
+          b = buffers.size() - 1;
+        }
+      }
+
+      const auto buffer_idx = (int32_t)b;
+      const auto offset =
+          (int32_t)(data - static_cast<const uint8_t*>(buffers[b].data()));
+      std::memcpy(view + 4, data, 4);
+      std::memcpy(view + 8, &buffer_idx, sizeof(int32_t));
+      std::memcpy(view + 12, &offset, sizeof(int32_t));
+    }
+    std::memcpy(views + i * constants::cell_var_view_size, view, sizeof(view));
+  }
+
+  return Status::Ok();
+}
+
+bool ReaderBase::delete_condition_applies(
+    FragmentMetadata& frag_meta,
+    const QueryCondition& delete_condition) const {
+  if (frag_meta.has_delete_meta() &&
+      frag_meta.get_processed_conditions().count(
+          delete_condition.condition_marker()) != 0) {
+    return false;
+  }
+
+  return delete_condition.condition_timestamp() >=
+         frag_meta.timestamp_range().first;
+}
+
 bool ReaderBase::need_timestamped_conditions() {
   // If we have any delete condition that falls between the timestamps of a
   // fragment with timestamps, generate timestamped query conditions.
@@ -431,6 +606,11 @@ Status ReaderBase::load_tile_offsets(
             continue;
           }
 
+          // If the fragment doesn't have Hilbert values.
+          if (hilbert_values_not_present(name, frag_idx)) {
+            continue;
+          }
+
           filtered_names.emplace_back(name);
         }
 
@@ -659,6 +839,11 @@ Status ReaderBase::read_tiles(
         continue;
       }
 
+      // If the fragment doesn't have Hilbert values.
+      if (hilbert_values_not_present(name, tile->frag_idx())) {
+        continue;
+      }
+
       num_tiles_read++;
 
       const bool var_size = array_schema->var_size(name);
@@ -943,6 +1128,11 @@ ReaderBase::load_tile_chunk_data(
       return {Status::Ok(), 0, 0, 0};
     }
 
+    // If the fragment doesn't have Hilbert values.
+    if (hilbert_values_not_present(name, tile->frag_idx())) {
+      return {Status::Ok(), 0, 0, 0};
+    }
+
     const auto t = &tile_tuple->fixed_tile();
     const auto t_var = var_size ? &tile_tuple->var_tile() : nullptr;
     const auto t_validity = nullable ? &tile_tuple->validity_tile() : nullptr;
@@ -977,7 +1167,9 @@ Status ReaderBase::unfilter_tile_chunk_range(
     const uint64_t num_range_threads,
     const ChunkData& tile_chunk_data,
     const ChunkData& tile_chunk_var_data,
-    const ChunkData& tile_chunk_validity_data) const {
+    const ChunkData& tile_chunk_validity_data,
+    const std::vector<std::pair<uint64_t, uint64_t>>* result_cell_ranges)
+    const {
   assert(tile);
   auto& fragment = fragment_metadata_[tile->frag_idx()];
   auto format_version = fragment->format_version();
@@ -1006,6 +1198,11 @@ Status ReaderBase::unfilter_tile_chunk_range(
       return Status::Ok();
     }
 
+    // If the fragment doesn't have Hilbert values.
+    if (hilbert_values_not_present(name, tile->frag_idx())) {
+      return Status::Ok();
+    }
+
     auto t = &tile_tuple->fixed_tile();
     auto t_var = var_size ? &tile_tuple->var_tile() : nullptr;
     auto t_validity = nullable ? &tile_tuple->validity_tile() : nullptr;
@@ -1015,7 +1212,12 @@ Status ReaderBase::unfilter_tile_chunk_range(
     if (!var_size) {
       if (!nullable)
         RETURN_NOT_OK(unfilter_tile_chunk_range(
-            num_range_threads, range_thread_idx, name, t, tile_chunk_data));
+            num_range_threads,
+            range_thread_idx,
+            name,
+            t,
+            tile_chunk_data,
+            result_cell_ranges));
       else {
         RETURN_NOT_OK(unfilter_tile_chunk_range_nullable(
             num_range_threads,
@@ -1024,7 +1226,8 @@ Status ReaderBase::unfilter_tile_chunk_range(
             t,
             tile_chunk_data,
             t_validity,
-            tile_chunk_validity_data));
+            tile_chunk_validity_data,
+            result_cell_ranges));
       }
     } else {
       if (!nullable)
@@ -1100,6 +1303,11 @@ Status ReaderBase::post_process_unfiltered_tile(
       return Status::Ok();
     }
 
+    // If the fragment doesn't have Hilbert values.
+    if (hilbert_values_not_present(name, tile->frag_idx())) {
+      return Status::Ok();
+    }
+
     auto& t = tile_tuple->fixed_tile();
     t.filtered_buffer().clear();
 
@@ -1123,7 +1331,9 @@ Status ReaderBase::post_process_unfiltered_tile(
 
 Status ReaderBase::unfilter_tiles_chunk_range(
     const std::string& name,
-    const std::vector<ResultTile*>& result_tiles) const {
+    const std::vector<ResultTile*>& result_tiles,
+    const std::vector<std::vector<std::pair<uint64_t, uint64_t>>>*
+        result_cell_ranges) const {
   const auto num_tiles = static_cast<uint64_t>(result_tiles.size());
   if (num_tiles == 0) {
     return Status::Ok();
@@ -1189,7 +1399,9 @@ Status ReaderBase::unfilter_tiles_chunk_range(
             num_range_threads,
             tiles_chunk_data[i],
             tiles_chunk_var_data[i],
-            tiles_chunk_validity_data[i]);
+            tiles_chunk_validity_data[i],
+            result_cell_ranges != nullptr ? &(*result_cell_ranges)[i] :
+                                            nullptr);
       });
   RETURN_CANCEL_OR_ERROR(status);
 
@@ -1220,7 +1432,9 @@ Status ReaderBase::unfilter_tile_chunk_range(
     const uint64_t thread_idx,
     const std::string& name,
     Tile* tile,
-    const ChunkData& tile_chunk_data) const {
+    const ChunkData& tile_chunk_data,
+    const std::vector<std::pair<uint64_t, uint64_t>>* result_cell_ranges)
+    const {
   assert(tile);
   // Prevent processing past the end of chunks in case there are more
   // threads than chunks.
@@ -1239,14 +1453,76 @@ Status ReaderBase::unfilter_tile_chunk_range(
       tile_chunk_data.chunk_offsets_.size(), num_range_threads, thread_idx);
 
   // Reverse the tile filters.
+  RETURN_NOT_OK(unfilter_result_chunks(
+      filters, tile, tile_chunk_data, t_min, t_max, result_cell_ranges));
+
+  return Status::Ok();
+}
+
+Status ReaderBase::unfilter_result_chunks(
+    const FilterPipeline& filters,
+    Tile* tile,
+    const ChunkData& tile_chunk_data,
+    const uint64_t min_chunk,
+    const uint64_t max_chunk,
+    const std::vector<std::pair<uint64_t, uint64_t>>* result_cell_ranges)
+    const {
+  const auto concurrency_level =
+      storage_manager_->compute_tp()->concurrency_level();
+
+  // No result cell ranges, unfilter all chunks.
+  if (result_cell_ranges == nullptr) {
+    return filters.run_reverse_chunk_range(
+        stats_,
+        tile,
+        tile_chunk_data,
+        min_chunk,
+        max_chunk,
+        concurrency_level,
+        storage_manager_->config());
+  }
+
+  // Unfilter the runs of consecutive chunks that overlap the ranges. As the
+  // ranges are sorted, only move forward in them.
+  const auto cell_size = tile->cell_size();
+  auto range = result_cell_ranges->begin();
+  uint64_t run_start = min_chunk;
+  uint64_t skipped_num = 0;
+  for (uint64_t c = min_chunk; c < max_chunk; c++) {
+    // Cells (partially) stored in this chunk.
+    const auto chunk_start = tile_chunk_data.chunk_offsets_[c];
+    const auto chunk_end =
+        chunk_start + tile_chunk_data.filtered_chunks_[c].unfiltered_data_size_;
+    const auto min_cell = chunk_start / cell_size;
+    const auto max_cell = utils::math::ceil(chunk_end, cell_size);
+
+    while (range != result_cell_ranges->end() && range->second <= min_cell) {
+      range++;
+    }
+
+    if (range == result_cell_ranges->end() || range->first >= max_cell) {
+      RETURN_NOT_OK(filters.run_reverse_chunk_range(
+          stats_,
+          tile,
+          tile_chunk_data,
+          run_start,
+          c,
+          concurrency_level,
+          storage_manager_->config()));
+      run_start = c + 1;
+      skipped_num++;
+    }
+  }
+
   RETURN_NOT_OK(filters.run_reverse_chunk_range(
       stats_,
       tile,
       tile_chunk_data,
-      t_min,
-      t_max,
-      storage_manager_->compute_tp()->concurrency_level(),
+      run_start,
+      max_chunk,
+      concurrency_level,
       storage_manager_->config()));
+  stats_->add_counter("unfilter_skipped_chunk_num", skipped_num);
 
   return Status::Ok();
 }
@@ -1312,13 +1588,14 @@ Status ReaderBase::unfilter_tile_chunk_range_nullable(
     Tile* tile,
     const ChunkData& tile_chunk_data,
     Tile* tile_validity,
-    const ChunkData& tile_validity_chunk_data) const {
+    const ChunkData& tile_validity_chunk_data,
+    const std::vector<std::pair<uint64_t, uint64_t>>* result_cell_ranges)
+    const {
   assert(tile);
   assert(tile_validity);
 
   FilterPipeline filters = array_schema_.filters(name);
   FilterPipeline validity_filters = array_schema_.cell_validity_filters();
-  auto concurrency_level = storage_manager_->compute_tp()->concurrency_level();
 
   // Append an encryption unfilter when necessary.
   RETURN_NOT_OK(FilterPipeline::append_encryption_filter(
@@ -1334,14 +1611,8 @@ Status ReaderBase::unfilter_tile_chunk_range_nullable(
         tile_chunk_data.chunk_offsets_.size(), num_range_threads, thread_idx);
 
     // Reverse the tile filters.
-    RETURN_NOT_OK(filters.run_reverse_chunk_range(
-        stats_,
-        tile,
-        tile_chunk_data,
-        t_min,
-        t_max,
-        concurrency_level,
-        storage_manager_->config()));
+    RETURN_NOT_OK(unfilter_result_chunks(
+        filters, tile, tile_chunk_data, t_min, t_max, result_cell_ranges));
   }
 
   // Prevent processing past the end of chunks in case there are more
@@ -1354,14 +1625,13 @@ Status ReaderBase::unfilter_tile_chunk_range_nullable(
         thread_idx);
 
     // Reverse the tile validity filters.
-    RETURN_NOT_OK(validity_filters.run_reverse_chunk_range(
-        stats_,
+    RETURN_NOT_OK(unfilter_result_chunks(
+        validity_filters,
         tile_validity,
         tile_validity_chunk_data,
         tval_min,
         tval_max,
-        concurrency_level,
-        storage_manager_->config()));
+        result_cell_ranges));
   }
 
   return Status::Ok();
@@ -1457,7 +1727,9 @@ Status ReaderBase::unfilter_tile_chunk_range_nullable(
 
 Status ReaderBase::unfilter_tiles(
     const std::string& name,
-    const std::vector<ResultTile*>& result_tiles) const {
+    const std::vector<ResultTile*>& result_tiles,
+    const std::vector<std::vector<std::pair<uint64_t, uint64_t>>>*
+        result_cell_ranges) const {
   const auto stat_type = (array_schema_.is_attr(name)) ? "unfilter_attr_tiles" :
                                                          "unfilter_coord_tiles";
   const auto timer_se = stats_->start_timer(stat_type);
@@ -1476,7 +1748,8 @@ Status ReaderBase::unfilter_tiles(
   // was done in parallel on tiles. The new readers parallelize both on
   // tiles and chunk ranges and don't benefit from using a tile cache.
   if (disable_cache_ == true && chunking) {
-    return unfilter_tiles_chunk_range(name, result_tiles);
+    return unfilter_tiles_chunk_range(
+        name, result_tiles, var_size ? nullptr : result_cell_ranges);
   }
 
   auto status = parallel_for(
@@ -1510,6 +1783,11 @@ Status ReaderBase::unfilter_tiles(
             return Status::Ok();
           }
 
+          // If the fragment doesn't have Hilbert values.
+          if (hilbert_values_not_present(name, tile->frag_idx())) {
+            return Status::Ok();
+          }
+
           Tile* const t = &tile_tuple->fixed_tile();
           Tile* const t_var = var_size ? &tile_tuple->var_tile() : nullptr;
           Tile* const t_validity =
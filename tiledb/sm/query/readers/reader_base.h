@@ -33,12 +33,14 @@
 #ifndef TILEDB_READER_BASE_H
 #define TILEDB_READER_BASE_H
 
+#include <mutex>
 #include <queue>
 #include "../strategy_base.h"
 #include "tiledb/common/common.h"
 #include "tiledb/common/status.h"
 #include "tiledb/sm/array_schema/dimension.h"
 #include "tiledb/sm/array_schema/tile_domain.h"
+#include "tiledb/sm/buffer/buffer.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/misc/types.h"
 #include "tiledb/sm/query/query_condition.h"
@@ -51,6 +53,7 @@ namespace sm {
 
 class Array;
 class ArraySchema;
+class FilterPipeline;
 class StorageManager;
 class Subarray;
 
@@ -214,6 +217,31 @@ class ReaderBase : public StrategyBase {
   /** Have we loaded the initial data. */
   bool initial_data_loaded_;
 
+  /**
+   * The var tiles pointed to by the views returned by the current submit, in
+   * the `views` offsets format. They are kept until the next submit.
+   */
+  std::vector<Tile> view_tiles_;
+
+  /** The total size of `view_tiles_`. */
+  uint64_t view_tiles_size_;
+
+  /** The buffers the views of each var-sized field point into. */
+  std::unordered_map<std::string, std::vector<ConstBuffer>> view_buffers_;
+
+  /** The start addresses of the memory registered in `view_buffers_`. */
+  std::unordered_set<const void*> view_buffers_data_;
+
+  /**
+   * The result tiles holding var tiles pointed to by views which are still
+   * used by the reader. Those var tiles are moved to `view_tiles_` when the
+   * result tile is removed.
+   */
+  std::unordered_set<const ResultTile*> view_result_tiles_;
+
+  /** Protects `view_tiles_` and `view_result_tiles_`. */
+  std::mutex view_tiles_mtx_;
+
   /* ********************************* */
   /*         PROTECTED METHODS         */
   /* ********************************* */
@@ -240,6 +268,107 @@ class ReaderBase : public StrategyBase {
       const std::vector<ResultTile*>& result_tiles,
       const uint64_t min_result_tile = 0) const;
 
+  /**
+   * Returns the buffers the views of the input var-sized field point into,
+   * in the `views` offsets format.
+   *
+   * @param name The attribute/dimension name.
+   * @return The view buffers, indexed by the buffer index of the views.
+   */
+  const std::vector<ConstBuffer>& field_view_buffers(
+      const std::string& name) const;
+
+  /** Releases the view buffers and the tiles they point into. */
+  void clear_views();
+
+  /**
+   * Registers memory that the views of the input field can point into. A
+   * view offset is a 32-bit signed integer, so memory larger than that is
+   * registered as overlapping windows starting every 1GB, so that any cell
+   * up to 1GB fits in the window starting before it.
+   *
+   * @param name The attribute/dimension name.
+   * @param data The start of the memory.
+   * @param size The size of the memory.
+   */
+  void add_view_buffer(
+      const std::string& name, const void* data, const uint64_t size);
+
+  /**
+   * Registers the var tiles of the input field in the result tiles as
+   * memory that its views can point into.
+   *
+   * @param name The attribute/dimension name.
+   * @param result_tiles The result tiles.
+   */
+  void add_view_tiles(
+      const std::string& name, const std::vector<ResultTile*>& result_tiles);
+
+  /**
+   * Moves the var tiles of the input field out of the result tiles into
+   * `view_tiles_`, so that the views pointing into them stay valid until
+   * the next submit.
+   *
+   * @param name The attribute/dimension name.
+   * @param result_tiles The result tiles.
+   */
+  void retain_view_tiles(
+      const std::string& name, const std::vector<ResultTile*>& result_tiles);
+
+  /**
+   * Marks result tiles whose var tiles are pointed to by views, but which
+   * are still needed by the reader. See `release_view_result_tile`.
+   *
+   * @param result_tiles The result tiles.
+   */
+  void keep_view_result_tiles(const std::vector<ResultTile*>& result_tiles);
+
+  /**
+   * Moves the var tiles pointed to by views out of a result tile marked by
+   * `keep_view_result_tiles` into `view_tiles_`, before it is removed.
+   *
+   * @param result_tile The result tile.
+   */
+  void release_view_result_tile(ResultTile* result_tile);
+
+  /**
+   * Converts the cell sizes of a var-sized field to views, in the `views`
+   * offsets format. The sizes are read as 64-bit integers from the start of
+   * `views`. Each view is twice their size, so the views are written from
+   * the last cell, after the sizes they overwrite were read.
+   *
+   * Each view is 16 bytes, laid out as an Arrow string view: the cell size
+   * as a 32-bit integer, followed either by the cell data when it fits in
+   * 12 bytes, or by the first 4 bytes of the cell data, the 32-bit index of
+   * the view buffer holding the cell data and the 32-bit offset of the data
+   * in that buffer.
+   *
+   * @param name The attribute/dimension name.
+   * @param cell_num The number of cells.
+   * @param var_data The pointers to the data of each cell, which must be in
+   *     the registered view buffers unless inlined.
+   * @param views The sizes to convert, and the views on return.
+   * @return Status.
+   */
+  Status build_views(
+      const std::string& name,
+      const uint64_t cell_num,
+      const void* const* var_data,
+      uint8_t* views);
+
+  /**
+   * Returns `true` if a delete condition needs to be applied on the cells of
+   * a fragment, i.e. it was not processed by a previous deletes consolidation
+   * of the fragment and it was issued after the fragment start.
+   *
+   * @param frag_meta Fragment metadata.
+   * @param delete_condition The delete condition.
+   * @return true if the condition needs to be applied.
+   */
+  bool delete_condition_applies(
+      FragmentMetadata& frag_meta,
+      const QueryCondition& delete_condition) const;
+
   /**
    * Is there a need to build timestamped conditions for deletes.
    *
@@ -290,6 +419,16 @@ class ReaderBase : public StrategyBase {
            !fragment_metadata_[f]->has_delete_meta();
   }
 
+  /**
+   * Skip read/unfilter operations for the Hilbert values attribute and
+   * fragments without Hilbert values.
+   */
+  inline bool hilbert_values_not_present(
+      const std::string& name, const unsigned f) const {
+    return name == constants::hilbert_values &&
+           !fragment_metadata_[f]->has_hilbert_values();
+  }
+
   /**
    * Checks if timestamps should be loaded for a fragment.
    *
@@ -472,11 +611,16 @@ class ReaderBase : public StrategyBase {
    *
    * @param name Attribute/dimension whose tiles will be unfiltered.
    * @param result_tiles Vector containing the tiles to be unfiltered.
+   * @param result_cell_ranges If not null, the sorted cell ranges holding
+   *     results for each tile in `result_tiles`. Only the chunks of
+   *     fixed-sized tiles overlapping those ranges are unfiltered.
    * @return Status
    */
   Status unfilter_tiles_chunk_range(
       const std::string& name,
-      const std::vector<ResultTile*>& result_tiles) const;
+      const std::vector<ResultTile*>& result_tiles,
+      const std::vector<std::vector<std::pair<uint64_t, uint64_t>>>*
+          result_cell_ranges = nullptr) const;
 
   /**
    * Runs the input fixed-sized tile for the input attribute or dimension
@@ -489,6 +633,8 @@ class ReaderBase : public StrategyBase {
    * @param name Attribute/dimension the tile belong to.
    * @param tile Tile to be unfiltered.
    * @param tile_chunk_data Tile chunk info, buffers and offsets
+   * @param result_cell_ranges If not null, only the chunks overlapping these
+   *     sorted cell ranges are unfiltered.
    * @return Status
    */
   Status unfilter_tile_chunk_range(
@@ -496,7 +642,9 @@ class ReaderBase : public StrategyBase {
       uint64_t thread_idx,
       const std::string& name,
       Tile* tile,
-      const ChunkData& tile_chunk_data) const;
+      const ChunkData& tile_chunk_data,
+      const std::vector<std::pair<uint64_t, uint64_t>>* result_cell_ranges =
+          nullptr) const;
 
   /**
    * Runs the input var-sized tile for the input attribute or dimension through
@@ -535,6 +683,8 @@ class ReaderBase : public StrategyBase {
    * @param tile_validity Validity tile to be unfiltered.
    * @param tile_validity_chunk_data Validity tile chunk info, buffers and
    * offsets
+   * @param result_cell_ranges If not null, only the chunks overlapping these
+   *     sorted cell ranges are unfiltered.
    * @return Status
    */
   Status unfilter_tile_chunk_range_nullable(
@@ -544,7 +694,32 @@ class ReaderBase : public StrategyBase {
       Tile* tile,
       const ChunkData& tile_chunk_data,
       Tile* tile_validity,
-      const ChunkData& tile_validity_chunk_data) const;
+      const ChunkData& tile_validity_chunk_data,
+      const std::vector<std::pair<uint64_t, uint64_t>>* result_cell_ranges =
+          nullptr) const;
+
+  /**
+   * Runs the chunks in [min_chunk, max_chunk) of a fixed-sized tile through
+   * the filter pipeline, skipping the chunks that do not overlap the result
+   * cell ranges. The skipped chunks are left uninitialized in the tile.
+   *
+   * @param filters The filter pipeline.
+   * @param tile Tile to be unfiltered.
+   * @param tile_chunk_data Tile chunk info, buffers and offsets
+   * @param min_chunk First chunk to unfilter.
+   * @param max_chunk Last chunk to unfilter (excluded).
+   * @param result_cell_ranges If not null, the sorted cell ranges holding
+   *     results. Otherwise all chunks are unfiltered.
+   * @return Status
+   */
+  Status unfilter_result_chunks(
+      const FilterPipeline& filters,
+      Tile* tile,
+      const ChunkData& tile_chunk_data,
+      uint64_t min_chunk,
+      uint64_t max_chunk,
+      const std::vector<std::pair<uint64_t, uint64_t>>* result_cell_ranges)
+      const;
 
   /**
    * Runs the input var-sized tile for the input nullable attribute through
@@ -580,11 +755,17 @@ class ReaderBase : public StrategyBase {
    *
    * @param name Attribute/dimension whose tiles will be unfiltered.
    * @param result_tiles Vector containing the tiles to be unfiltered.
+   * @param result_cell_ranges If not null, the sorted cell ranges holding
+   *     results for each tile in `result_tiles`. Only the chunks of
+   *     fixed-sized tiles overlapping those ranges are unfiltered, the other
+   *     cells are left uninitialized.
    * @return Status
    */
   Status unfilter_tiles(
       const std::string& name,
-      const std::vector<ResultTile*>& result_tiles) const;
+      const std::vector<ResultTile*>& result_tiles,
+      const std::vector<std::vector<std::pair<uint64_t, uint64_t>>>*
+          result_cell_ranges = nullptr) const;
 
   /**
    * Runs the input fixed-sized tile for the input attribute or dimension
@@ -871,6 +1052,8 @@ class ReaderBase : public StrategyBase {
    * @param tile_var_chunk_data Value tile chunk info, buffers and offsets
    * @param tile_validity_chunk_data Validity tile chunk info, buffers and
    * offsets
+   * @param result_cell_ranges If not null, only the chunks of fixed-sized
+   *     tiles overlapping these sorted cell ranges are unfiltered.
    * @return Status
    */
   Status unfilter_tile_chunk_range(
@@ -882,7 +1065,9 @@ class ReaderBase : public StrategyBase {
       uint64_t num_range_threads,
       const ChunkData& tile_chunk_data,
       const ChunkData& tile_chunk_var_data,
-      const ChunkData& tile_chunk_validity_data) const;
+      const ChunkData& tile_chunk_validity_data,
+      const std::vector<std::pair<uint64_t, uint64_t>>* result_cell_ranges)
+      const;
 
   /**
    * Perform some necessary post-processing on a tile that was just unfiiltered
@@ -37,6 +37,7 @@
 #include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/type/range/range.h"
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <list>
@@ -91,6 +92,7 @@ void ResultTile::swap(ResultTile& tile) {
   std::swap(attr_tiles_, tile.attr_tiles_);
   std::swap(timestamps_tile_, tile.timestamps_tile_);
   std::swap(delete_timestamps_tile_, tile.delete_timestamps_tile_);
+  std::swap(hilbert_values_tile_, tile.hilbert_values_tile_);
   std::swap(coords_tile_, tile.coords_tile_);
   std::swap(coord_tiles_, tile.coord_tiles_);
   std::swap(compute_results_dense_func_, tile.compute_results_dense_func_);
@@ -149,6 +151,11 @@ void ResultTile::erase_tile(const std::string& name) {
     return;
   }
 
+  if (name == constants::hilbert_values) {
+    hilbert_values_tile_.reset();
+    return;
+  }
+
   // Handle dimension tile
   for (auto& ct : coord_tiles_) {
     if (ct.second.has_value() && ct.first == name) {
@@ -184,6 +191,11 @@ void ResultTile::init_attr_tile(
     return;
   }
 
+  if (name == constants::hilbert_values) {
+    hilbert_values_tile_ = TileTuple(false, false);
+    return;
+  }
+
   // Handle attributes
   for (auto& at : attr_tiles_) {
     if (at.first == name && at.second == nullopt) {
@@ -193,6 +205,29 @@ void ResultTile::init_attr_tile(
   }
 }
 
+optional<ResultTile::TileTuple> ResultTile::release_attr_tile(
+    const std::string& name) {
+  for (auto& at : attr_tiles_) {
+    if (at.first == name) {
+      auto tile_tuple = std::move(at.second);
+      at.second.reset();
+      return tile_tuple;
+    }
+  }
+
+  return nullopt;
+}
+
+void ResultTile::set_attr_tile(
+    const std::string& name, TileTuple&& tile_tuple) {
+  for (auto& at : attr_tiles_) {
+    if (at.first == name) {
+      at.second.emplace(std::move(tile_tuple));
+      return;
+    }
+  }
+}
+
 void ResultTile::init_coord_tile(
     const std::string& name, bool var_size, unsigned dim_idx) {
   coord_tiles_[dim_idx] =
@@ -220,6 +255,12 @@ ResultTile::TileTuple* ResultTile::tile_tuple(const std::string& name) {
     return &delete_timestamps_tile_.value();
   }
 
+  // Handle Hilbert values tile
+  if (hilbert_values_tile_.has_value() &&
+      name == constants::hilbert_values) {
+    return &hilbert_values_tile_.value();
+  }
+
   // Handle attribute tile
   for (auto& at : attr_tiles_) {
     if (at.first == name && at.second.has_value()) {
@@ -849,7 +890,8 @@ void ResultTile::compute_results_count_sparse_string(
     std::vector<BitmapType>& result_count,
     const Layout& cell_order,
     const uint64_t min_cell,
-    const uint64_t max_cell) {
+    const uint64_t max_cell,
+    RangeIndexScratch&) {
   auto cell_num = result_tile->cell_num();
   auto coords_num = max_cell - min_cell;
   auto dim_num = result_tile->domain()->dim_num();
@@ -1024,6 +1066,29 @@ void ResultTile::compute_results_count_sparse_string(
   }
 }
 
+template <class T>
+uint64_t ResultTile::gallop_lower_bound(
+    const T* values, uint64_t size, uint64_t from, const T& value) {
+  if (from >= size || !(values[from] < value)) {
+    return from;
+  }
+
+  // Double the step until a value not smaller than `value` is found, then
+  // binary search the last step.
+  uint64_t lo = from;
+  uint64_t step = 1;
+  uint64_t hi = from + 1;
+  while (hi < size && values[hi] < value) {
+    lo = hi;
+    step *= 2;
+    hi = lo + step;
+  }
+
+  hi = std::min(hi, size);
+  return std::distance(
+      values, std::lower_bound(values + lo + 1, values + hi, value));
+}
+
 template <class BitmapType, class T>
 void ResultTile::compute_results_count_sparse(
     const ResultTile* result_tile,
@@ -1033,87 +1098,93 @@ void ResultTile::compute_results_count_sparse(
     std::vector<BitmapType>& result_count,
     const Layout& cell_order,
     const uint64_t min_cell,
-    const uint64_t max_cell) {
-  // We don't use cell_order for this template type.
-  (void)cell_order;
-
+    const uint64_t max_cell,
+    RangeIndexScratch& scratch) {
   // For easy reference.
   auto stores_zipped_coords = result_tile->stores_zipped_coords();
   auto dim_num = result_tile->domain()->dim_num();
 
-  // Handle separate coordinate tiles.
+  // Get the coordinates, either from the separate coordinate tile or from the
+  // zipped coordinates tile.
+  const T* coords = nullptr;
+  uint64_t coords_stride = 1;
   if (!stores_zipped_coords) {
     const auto& coord_tile = result_tile->coord_tile(dim_idx).fixed_tile();
-    const T* const coords = static_cast<const T*>(coord_tile.data());
-    {
-      // Iterate over all cells.
-      for (uint64_t pos = min_cell; pos < max_cell; ++pos) {
-        // We have a previous count.
-        if (result_count[pos]) {
-          const T& c = coords[pos];
-
-          // Binary search to find the first range containing the cell.
-          auto it = std::lower_bound(
-              range_indexes.begin(),
-              range_indexes.end(),
-              c,
-              [&](const uint64_t& index, const T& value) {
-                return ((const T*)ranges[index].start_fixed())[1] < value;
-              });
-
-          // If we didn't find a range we can set count to 0 and skip to next.
-          if (it == range_indexes.end()) {
-            result_count[pos] = 0;
-            continue;
-          }
-          uint64_t start_range_idx = std::distance(range_indexes.begin(), it);
-
-          // Binary search to find the last range containing the cell.
-          auto it2 = std::lower_bound(
-              it,
-              range_indexes.end(),
-              c,
-              [&](const uint64_t& index, const T& value) {
-                return ((const T*)ranges[index].start_fixed())[0] <= value;
-              });
-
-          uint64_t end_range_idx = std::distance(it, it2) + start_range_idx;
-
-          // Iterate through all relevant ranges and compute the count for this
-          // dim.
-          uint64_t count = 0;
-          for (uint64_t j = start_range_idx; j < end_range_idx; ++j) {
-            const auto& range =
-                (const T*)ranges[range_indexes[j]].start_fixed();
-            count += c >= range[0] && c <= range[1];
-          }
-
-          // Multiply the past count by this dimension's count.
-          result_count[pos] *= count;
-        }
-      }
-    }
-
-    return;
+    coords = static_cast<const T*>(coord_tile.data());
+  } else {
+    const auto& coords_tile = result_tile->zipped_coords_tile();
+    coords = static_cast<const T*>(coords_tile.data()) + dim_idx;
+    coords_stride = dim_num;
   }
 
-  // Handle zipped coordinates tile.
-  assert(stores_zipped_coords);
-  const auto& coords_tile = result_tile->zipped_coords_tile();
-  const T* const coords = static_cast<const T*>(coords_tile.data());
-  {
-    for (uint64_t pos = min_cell; pos < max_cell; ++pos) {
-      if (result_count[pos]) {
-        T c = coords[pos * dim_num + dim_idx];
-        uint64_t count = 0;
-        for (uint64_t i = 0; i < range_indexes.size(); i++) {
-          const auto& range = (const T*)ranges[range_indexes[i]].start_fixed();
-          count += c >= range[0] && c <= range[1];
-        }
+  // Interval index over the ranges, which are sorted on their start: the
+  // running maximum of the range ends. All the ranges containing a
+  // coordinate are at or after the first entry not smaller than it, and
+  // before the first range starting after it. The three arrays are carved
+  // out of the caller's scratch buffer, which only grows.
+  const uint64_t range_num = range_indexes.size();
+  const uint64_t word_num =
+      (3 * range_num * sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+  if (scratch.size() < word_num) {
+    scratch.resize(word_num);
+  }
+  T* range_starts = reinterpret_cast<T*>(scratch.data());
+  T* range_ends = range_starts + range_num;
+  T* max_range_ends = range_ends + range_num;
+  for (uint64_t r = 0; r < range_num; ++r) {
+    const auto range = (const T*)ranges[range_indexes[r]].start_fixed();
+    range_starts[r] = range[0];
+    range_ends[r] = range[1];
+    max_range_ends[r] =
+        r == 0 ? range[1] : std::max(max_range_ends[r - 1], range[1]);
+  }
 
-        // Multiply the past count by this dimension's count.
-        result_count[pos] *= count;
+  // For row-major cell orders, the first dimension is sorted.
+  // For col-major cell orders, the last dimension is sorted.
+  // The coordinates of the sorted dimension are merge-joined with the ranges,
+  // galloping forward from the ranges of the previous cell. For the other
+  // dimensions, each coordinate is binary searched in the interval index.
+  //
+  // Galloping over a gap of g ranges costs about 2 * log(g) comparisons
+  // against log(range_num) for a binary search. The cells skip about
+  // range_num / cell_num ranges each, so the merge-join only pays off while
+  // range_num stays below cell_num^2.
+  const uint64_t cell_num = max_cell - min_cell;
+  const bool is_sorted_dim =
+      ((cell_order == Layout::ROW_MAJOR && dim_idx == 0) ||
+       (cell_order == Layout::COL_MAJOR && dim_idx == dim_num - 1));
+  const bool gallop =
+      is_sorted_dim && cell_num != 0 && range_num / cell_num <= cell_num;
+  uint64_t first_range = 0;
+  T prev_c = T();
+  bool has_prev_c = false;
+  for (uint64_t pos = min_cell; pos < max_cell; ++pos) {
+    // We have a previous count.
+    if (result_count[pos]) {
+      const T c = coords[pos * coords_stride];
+
+      // Find the first range that may contain the cell.
+      if (gallop && has_prev_c && !(c < prev_c)) {
+        first_range =
+            gallop_lower_bound(max_range_ends, range_num, first_range, c);
+      } else {
+        first_range = std::distance(
+            max_range_ends,
+            std::lower_bound(max_range_ends, max_range_ends + range_num, c));
+      }
+      prev_c = c;
+      has_prev_c = true;
+
+      // Iterate through all relevant ranges and compute the count for this
+      // dim.
+      uint64_t count = 0;
+      for (uint64_t r = first_range; r < range_num && !(c < range_starts[r]);
+           ++r) {
+        count += !(range_ends[r] < c);
       }
+
+      // Multiply the past count by this dimension's count.
+      result_count[pos] *= count;
     }
   }
 }
@@ -1156,7 +1227,8 @@ Status ResultTile::compute_results_count_sparse<uint8_t>(
     std::vector<uint8_t>& result_count,
     const Layout& cell_order,
     const uint64_t min_cell,
-    const uint64_t max_cell) const {
+    const uint64_t max_cell,
+    RangeIndexScratch& scratch) const {
   assert(compute_results_count_sparse_uint8_t_func_[dim_idx] != nullptr);
   compute_results_count_sparse_uint8_t_func_[dim_idx](
       this,
@@ -1166,7 +1238,8 @@ Status ResultTile::compute_results_count_sparse<uint8_t>(
       result_count,
       cell_order,
       min_cell,
-      max_cell);
+      max_cell,
+      scratch);
   return Status::Ok();
 }
 
@@ -1178,7 +1251,8 @@ Status ResultTile::compute_results_count_sparse<uint64_t>(
     std::vector<uint64_t>& result_count,
     const Layout& cell_order,
     const uint64_t min_cell,
-    const uint64_t max_cell) const {
+    const uint64_t max_cell,
+    RangeIndexScratch& scratch) const {
   assert(compute_results_count_sparse_uint64_t_func_[dim_idx] != nullptr);
   compute_results_count_sparse_uint64_t_func_[dim_idx](
       this,
@@ -1188,7 +1262,8 @@ Status ResultTile::compute_results_count_sparse<uint64_t>(
       result_count,
       cell_order,
       min_cell,
-      max_cell);
+      max_cell,
+      scratch);
   return Status::Ok();
 }
 
@@ -72,6 +72,13 @@ class Subarray;
  */
 class ResultTile {
  public:
+  /**
+   * Word buffer holding the interval index over the ranges built by
+   * `compute_results_count_sparse`. It only grows, so one buffer reused
+   * across tiles and dimensions is allocated a handful of times.
+   */
+  typedef std::vector<uint64_t> RangeIndexScratch;
+
   /**
    * Class definition for the tile tuple.
    */
@@ -200,6 +207,15 @@ class ResultTile {
   /** Initializes the result tile for the given attribute. */
   void init_attr_tile(const std::string& name, bool var_size, bool nullable);
 
+  /**
+   * Moves out the tile tuple of the input attribute, which is left without
+   * tile. Returns `nullopt` if the attribute has no tile.
+   */
+  optional<TileTuple> release_attr_tile(const std::string& name);
+
+  /** Sets the tile tuple of the input attribute. */
+  void set_attr_tile(const std::string& name, TileTuple&& tile_tuple);
+
   /** Initializes the result tile for the given dimension name and index. */
   void init_coord_tile(
       const std::string& name, bool var_size, unsigned dim_idx);
@@ -318,7 +334,12 @@ class ResultTile {
    * Applicable only to sparse arrays.
    *
    * Computes a result count for the input dimension for the coordinates that
-   * fall in the input ranges and multiply with the previous count.
+   * fall in the input ranges and multiply with the previous count. The ranges
+   * must be sorted on their start. The coordinates are looked up in an
+   * interval index over the ranges, built in `scratch`. On the sorted
+   * dimension of the cell order, the coordinates are merge-joined with the
+   * ranges instead, unless there are so many more ranges than cells that
+   * galloping over the ranges costs more than binary searching them.
    *
    * This only processes cells from min_cell to max_cell as we might
    * parallelize on cells.
@@ -335,7 +356,8 @@ class ResultTile {
       std::vector<BitmapType>& result_count,
       const Layout& cell_order,
       const uint64_t min_cell,
-      const uint64_t max_cell);
+      const uint64_t max_cell,
+      RangeIndexScratch& scratch);
 
   /**
    * Applicable only to sparse arrays.
@@ -381,7 +403,8 @@ class ResultTile {
       std::vector<BitmapType>& result_count,
       const Layout& cell_order,
       const uint64_t min_cell,
-      const uint64_t max_cell);
+      const uint64_t max_cell,
+      RangeIndexScratch& scratch);
 
   /**
    * Applicable only to sparse tiles of dense arrays.
@@ -425,6 +448,9 @@ class ResultTile {
    *
    * When called over multiple ranges, this follows the formula:
    * total_count = d1_count * d2_count ... dN_count.
+   *
+   * `scratch` is reused across calls to avoid allocating the interval index
+   * over the ranges for every tile and dimension.
    */
   template <class BitmapType>
   Status compute_results_count_sparse(
@@ -434,7 +460,8 @@ class ResultTile {
       std::vector<BitmapType>& result_count,
       const Layout& cell_order,
       const uint64_t min_cell,
-      const uint64_t max_cell) const;
+      const uint64_t max_cell,
+      RangeIndexScratch& scratch) const;
 
  private:
   /* ********************************* */
@@ -459,6 +486,9 @@ class ResultTile {
   /** The delete timestamp attribute tile. */
   optional<TileTuple> delete_timestamps_tile_;
 
+  /** The Hilbert values attribute tile. */
+  optional<TileTuple> hilbert_values_tile_;
+
   /** The zipped coordinates tile. */
   optional<TileTuple> coords_tile_;
 
@@ -513,7 +543,8 @@ class ResultTile {
       std::vector<uint64_t>&,
       const Layout&,
       const uint64_t,
-      const uint64_t)>>
+      const uint64_t,
+      RangeIndexScratch&)>>
       compute_results_count_sparse_uint64_t_func_;
 
   /**
@@ -528,7 +559,8 @@ class ResultTile {
       std::vector<uint8_t>&,
       const Layout&,
       const uint64_t,
-      const uint64_t)>>
+      const uint64_t,
+      RangeIndexScratch&)>>
       compute_results_count_sparse_uint8_t_func_;
 
   /* ********************************* */
@@ -544,6 +576,15 @@ class ResultTile {
   /** Implements coord() for unzipped coordinates. */
   const void* unzipped_coord(uint64_t pos, unsigned dim_idx) const;
 
+  /**
+   * Returns the first position at or after `from` in the `size` sorted
+   * `values` holding a value not smaller than `value`, galloping forward
+   * from `from`.
+   */
+  template <class T>
+  static uint64_t gallop_lower_bound(
+      const T* values, uint64_t size, uint64_t from, const T& value);
+
   /**
    * A helper routine used in `compute_results_sparse<char>` to
    * determine if a given string-valued coordinate intersects
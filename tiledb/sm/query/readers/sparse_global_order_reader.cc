@@ -97,6 +97,9 @@ SparseGlobalOrderReader<BitmapType>::SparseGlobalOrderReader(
     , last_cells_(array->fragment_metadata().size()) {
   SparseIndexReaderBase::init(skip_checks_serialization);
 
+  // Use the persisted Hilbert values, when fragments have them.
+  use_hilbert_values_ = array_schema_.cell_order() == Layout::HILBERT;
+
   // Initialize memory budget variables.
   if (!initialize_memory_budget().ok()) {
     throw SparseGlobalOrderReaderStatusException(
@@ -166,8 +169,10 @@ Status SparseGlobalOrderReader<BitmapType>::dowork() {
 
   get_dim_attr_stats();
 
-  // Start with out buffer sizes as zero.
+  // Start with out buffer sizes as zero, and release the views of the
+  // previous submit.
   zero_out_buffer_sizes();
+  clear_views();
 
   // Handle empty array.
   if (fragment_metadata_.empty()) {
@@ -261,8 +266,9 @@ Status SparseGlobalOrderReader<BitmapType>::dowork() {
 
     // No more tiles to process, done.
     if (result_cell_slabs.has_value() && !result_cell_slabs->empty()) {
-      // Copy cell slabs.
-      if (offsets_bitsize_ == 64) {
+      // Copy cell slabs. In views mode, the cell sizes are first copied as
+      // 64-bit values.
+      if (offsets_bitsize_ == 64 || views_mode_) {
         RETURN_NOT_OK(process_slabs<uint64_t>(names, *result_cell_slabs));
       } else {
         RETURN_NOT_OK(process_slabs<uint32_t>(names, *result_cell_slabs));
@@ -271,7 +277,7 @@ Status SparseGlobalOrderReader<BitmapType>::dowork() {
 
     // End the iteration.
     RETURN_NOT_OK(end_iteration());
-  } while (!buffers_full_ && incomplete());
+  } while (!buffers_full_ && incomplete() && !view_tiles_over_budget());
 
   // Fix the output buffer sizes.
   RETURN_NOT_OK(resize_output_buffers(cells_copied(names)));
@@ -682,7 +688,9 @@ SparseGlobalOrderReader<BitmapType>::compute_result_cell_slab() {
     const auto& name = it.first;
     const auto size = it.second.original_buffer_size_ - *it.second.buffer_size_;
     if (array_schema_.var_size(name)) {
-      auto temp_num_cells = size / constants::cell_var_offset_size;
+      auto temp_num_cells =
+          size / (views_mode_ ? constants::cell_var_view_size :
+                                constants::cell_var_offset_size);
 
       if (offsets_extra_element_ && temp_num_cells > 0)
         temp_num_cells--;
@@ -700,13 +708,11 @@ SparseGlobalOrderReader<BitmapType>::compute_result_cell_slab() {
     return {Status::Ok(), nullopt};
   }
 
-  if (array_schema_.cell_order() == Layout::HILBERT) {
-    return merge_result_cell_slabs(
-        num_cells, HilbertCmpReverse(array_schema_.domain()));
-  } else {
-    return merge_result_cell_slabs(
-        num_cells, GlobalCmpReverse(array_schema_.domain()));
-  }
+  // Select the comparator once for the whole merge, so that common domain
+  // shapes use a comparator specialized on the coordinate type.
+  return with_global_cmp_reverse(array_schema_.domain(), [&](auto cmp) {
+    return merge_result_cell_slabs(num_cells, std::move(cmp));
+  });
 }
 
 template <class BitmapType>
@@ -811,22 +817,51 @@ Status SparseGlobalOrderReader<BitmapType>::compute_hilbert_values(
             static_cast<GlobalOrderResultTile<BitmapType>*>(result_tiles[t]);
         auto cell_num =
             fragment_metadata_[tile->frag_idx()]->cell_num(tile->tile_idx());
+        tile->allocate_hilbert_vector();
+
+        // Use the Hilbert values stored with the fragment, if loaded.
+        auto hilbert_values_tile = tile->tile_tuple(constants::hilbert_values);
+        if (hilbert_values_tile != nullptr) {
+          const auto hilbert_values =
+              hilbert_values_tile->fixed_tile().template data_as<uint64_t>();
+          for (uint64_t c = 0; c < cell_num; c++) {
+            tile->set_hilbert_value(c, hilbert_values[c]);
+          }
+
+          return Status::Ok();
+        }
+
+        // Compute the Hilbert values of the cells in the bitmap, in batches
+        // of cells.
+        const uint64_t batch_size = Hilbert::HC_BATCH_SIZE;
         auto rc = GlobalOrderResultCoords(tile, 0);
-        std::vector<uint64_t> coords(dim_num);
+        uint64_t cell_pos[Hilbert::HC_BATCH_SIZE];
+        uint64_t coords[Hilbert::HC_MAX_DIM * Hilbert::HC_BATCH_SIZE];
+        uint64_t hilbert_values[Hilbert::HC_BATCH_SIZE];
+        uint64_t c = 0;
+        while (c < cell_num) {
+          // Gather the next batch of cells in the bitmap.
+          uint64_t len = 0;
+          for (; c < cell_num && len < batch_size; c++) {
+            if (!tile->has_bmp() || tile->bitmap()[c]) {
+              cell_pos[len++] = c;
+            }
+          }
 
-        tile->allocate_hilbert_vector();
-        for (rc.pos_ = 0; rc.pos_ < cell_num; rc.pos_++) {
-          // Process only values in bitmap.
-          if (!tile->has_bmp() || tile->bitmap()[rc.pos_]) {
-            // Compute Hilbert number for all dimensions first.
-            for (uint32_t d = 0; d < dim_num; ++d) {
-              auto dim{array_schema_.dimension_ptr(d)};
-              coords[d] = hilbert_order::map_to_uint64(
+          // Map the coordinates of the batch for all dimensions first.
+          for (uint32_t d = 0; d < dim_num; ++d) {
+            auto dim{array_schema_.dimension_ptr(d)};
+            for (uint64_t i = 0; i < len; i++) {
+              rc.pos_ = cell_pos[i];
+              coords[d * len + i] = hilbert_order::map_to_uint64(
                   *dim, rc, d, bits, max_bucket_val);
             }
+          }
 
-            // Now we are ready to get the final number.
-            tile->set_hilbert_value(rc.pos_, h.coords_to_hilbert(&coords[0]));
+          // Now we are ready to get the final numbers.
+          h.coords_to_hilbert(coords, len, hilbert_values);
+          for (uint64_t i = 0; i < len; i++) {
+            tile->set_hilbert_value(cell_pos[i], hilbert_values[i]);
           }
         }
 
@@ -1052,86 +1087,49 @@ SparseGlobalOrderReader<BitmapType>::compute_parallelization_parameters(
 
 template <class BitmapType>
 template <class OffType>
-Status SparseGlobalOrderReader<BitmapType>::copy_offsets_tiles(
+Status SparseGlobalOrderReader<BitmapType>::copy_offsets_slab(
     const std::string& name,
-    const uint64_t num_range_threads,
     const bool nullable,
     const OffType offset_div,
-    const std::vector<ResultCellSlab>& result_cell_slabs,
-    const std::vector<uint64_t>& cell_offsets,
-    QueryBuffer& query_buffer,
-    std::vector<void*>& var_data) {
-  auto timer_se = stats_->start_timer("copy_offsets_tiles");
-
-  // Process all tiles/cells in parallel.
-  auto status = parallel_for_2d(
-      storage_manager_->compute_tp(),
-      0,
-      result_cell_slabs.size(),
-      0,
-      num_range_threads,
-      [&](uint64_t i, uint64_t range_thread_idx) {
-        // For easy reference.
-        auto& rcs = result_cell_slabs[i];
-        auto rt = static_cast<GlobalOrderResultTile<BitmapType>*>(
-            result_cell_slabs[i].tile_);
-
-        // Get source buffers.
-        const auto tile_tuple = rt->tile_tuple(name);
-        const auto& t = tile_tuple->fixed_tile();
-        const auto& t_var = tile_tuple->var_tile();
-        const auto src_buff = t.template data_as<uint64_t>();
-        const auto src_var_buff = t_var.template data_as<char>();
-        const auto cell_num =
-            fragment_metadata_[rt->frag_idx()]->cell_num(rt->tile_idx());
-
-        // Compute parallelization parameters.
-        auto&& [min_pos, max_pos, dest_cell_offset, skip_copy] =
-            compute_parallelization_parameters(
-                range_thread_idx,
-                num_range_threads,
-                rcs.start_,
-                rcs.length_,
-                cell_offsets[i]);
-        if (skip_copy) {
-          return Status::Ok();
-        }
-
-        // Get dest buffers.
-        auto buffer = (OffType*)query_buffer.buffer_ + dest_cell_offset;
-        auto val_buffer =
-            query_buffer.validity_vector_.buffer() + dest_cell_offset;
-        auto var_data_buffer = &var_data[dest_cell_offset - cell_offsets[0]];
-
-        // Copy full tile. Last cell might be taken out for vectorization.
-        uint64_t end = (max_pos == cell_num) ? max_pos - 1 : max_pos;
-        for (uint64_t c = min_pos; c < end; c++) {
-          *buffer = (OffType)(src_buff[c + 1] - src_buff[c]) / offset_div;
-          buffer++;
-          *var_data_buffer = src_var_buff + src_buff[c];
-          var_data_buffer++;
-        }
-
-        // Copy last cell.
-        if (max_pos == cell_num) {
-          *buffer =
-              (OffType)(t_var.size() - src_buff[max_pos - 1]) / offset_div;
-          *var_data_buffer = src_var_buff + src_buff[max_pos - 1];
-        }
+    GlobalOrderResultTile<BitmapType>* rt,
+    const uint64_t min_pos,
+    const uint64_t max_pos,
+    OffType* buffer,
+    uint8_t* val_buffer,
+    void** var_data) {
+  // Get source buffers.
+  const auto tile_tuple = rt->tile_tuple(name);
+  const auto& t = tile_tuple->fixed_tile();
+  const auto& t_var = tile_tuple->var_tile();
+  const auto src_buff = t.template data_as<uint64_t>();
+  const auto src_var_buff = t_var.template data_as<char>();
+  const auto cell_num =
+      fragment_metadata_[rt->frag_idx()]->cell_num(rt->tile_idx());
+
+  // Copy full tile. Last cell might be taken out for vectorization.
+  uint64_t end = (max_pos == cell_num) ? max_pos - 1 : max_pos;
+  for (uint64_t c = min_pos; c < end; c++) {
+    *buffer = (OffType)(src_buff[c + 1] - src_buff[c]) / offset_div;
+    buffer++;
+    *var_data = src_var_buff + src_buff[c];
+    var_data++;
+  }
 
-        // Copy nullable values.
-        if (nullable) {
-          const auto& t_val = tile_tuple->validity_tile();
-          const auto src_val_buff = t_val.template data_as<uint8_t>();
-          for (uint64_t c = min_pos; c < max_pos; c++) {
-            *val_buffer = src_val_buff[c];
-            val_buffer++;
-          }
-        }
+  // Copy last cell.
+  if (max_pos == cell_num) {
+    *buffer = (OffType)(t_var.size() - src_buff[max_pos - 1]) / offset_div;
+    *var_data = src_var_buff + src_buff[max_pos - 1];
+  }
 
-        return Status::Ok();
-      });
-  RETURN_NOT_OK_ELSE(status, logger_->status(status));
+  // Copy nullable values.
+  if (nullable) {
+    const auto& t_val = tile_tuple->validity_tile();
+    const auto src_val_buff = t_val.template data_as<uint8_t>();
+    for (uint64_t c = min_pos; c < max_pos; c++) {
+      *val_buffer = src_val_buff[c];
+      val_buffer++;
+    }
+  }
 
   return Status::Ok();
 }
@@ -1213,17 +1211,95 @@ Status SparseGlobalOrderReader<BitmapType>::copy_var_data_tiles(
 }
 
 template <class BitmapType>
-Status SparseGlobalOrderReader<BitmapType>::copy_fixed_data_tiles(
+Status SparseGlobalOrderReader<BitmapType>::copy_fixed_data_slab(
     const std::string& name,
-    const uint64_t num_range_threads,
     const bool is_dim,
     const bool nullable,
     const unsigned dim_idx,
     const uint64_t cell_size,
+    GlobalOrderResultTile<BitmapType>* rt,
+    const uint64_t min_pos,
+    const uint64_t max_pos,
+    uint8_t* buffer,
+    uint8_t* val_buffer) {
+  // Get source buffers.
+  const auto stores_zipped_coords = is_dim && rt->stores_zipped_coords();
+  const auto tile_tuple = stores_zipped_coords ?
+                              rt->tile_tuple(constants::coords) :
+                              rt->tile_tuple(name);
+  const auto& t = tile_tuple->fixed_tile();
+  const auto src_buff = t.template data_as<uint8_t>();
+
+  if (!stores_zipped_coords) {
+    // Copy tile.
+    memcpy(
+        buffer,
+        src_buff + min_pos * cell_size,
+        (max_pos - min_pos) * cell_size);
+  } else {  // Copy for zipped coords.
+    const auto dim_num = rt->domain()->dim_num();
+    for (uint64_t c = min_pos; c < max_pos; c++) {
+      auto pos = c * dim_num + dim_idx;
+      memcpy(buffer, src_buff + pos * cell_size, cell_size);
+      buffer += cell_size;
+    }
+  }
+
+  if (nullable) {
+    const auto& t_val = tile_tuple->validity_tile();
+    const auto src_val_buff = t_val.template data_as<uint8_t>();
+    memcpy(val_buffer, src_val_buff + min_pos, max_pos - min_pos);
+  }
+
+  return Status::Ok();
+}
+
+template <class BitmapType>
+template <class OffType>
+Status SparseGlobalOrderReader<BitmapType>::copy_fixed_data_and_offsets_tiles(
+    const std::vector<std::string>& names,
+    const uint64_t num_range_threads,
     const std::vector<ResultCellSlab>& result_cell_slabs,
     const std::vector<uint64_t>& cell_offsets,
-    QueryBuffer& query_buffer) {
-  auto timer_se = stats_->start_timer("copy_fixed_data_tiles");
+    std::vector<void*>& var_data) {
+  auto timer_se = stats_->start_timer("copy_fixed_data_and_offsets_tiles");
+
+  // Field parameters, computed once for all slabs.
+  struct FieldCopyParams {
+    const std::string* name_;
+    bool is_dim_;
+    bool var_sized_;
+    bool nullable_;
+    unsigned dim_idx_;
+    uint64_t cell_size_;
+    OffType offset_div_;
+    QueryBuffer* query_buffer_;
+  };
+
+  std::vector<FieldCopyParams> fields;
+  fields.reserve(names.size());
+  for (const auto& name : names) {
+    const auto is_dim = array_schema_.is_dim(name);
+
+    // Get dim idx for zipped coords copy.
+    unsigned dim_idx = 0;
+    if (is_dim) {
+      const auto& dim_names = array_schema_.dim_names();
+      while (name != dim_names[dim_idx])
+        dim_idx++;
+    }
+
+    fields.push_back(
+        {&name,
+         is_dim,
+         array_schema_.var_size(name),
+         array_schema_.is_nullable(name),
+         dim_idx,
+         array_schema_.cell_size(name),
+         elements_mode_ ? (OffType)datatype_size(array_schema_.type(name)) :
+                          (OffType)1,
+         &buffers_[name]});
+  }
 
   // Process all tiles/cells in parallel.
   auto status = parallel_for_2d(
@@ -1235,18 +1311,9 @@ Status SparseGlobalOrderReader<BitmapType>::copy_fixed_data_tiles(
       [&](uint64_t i, uint64_t range_thread_idx) {
         // For easy reference.
         auto& rcs = result_cell_slabs[i];
-        auto rt = static_cast<GlobalOrderResultTile<BitmapType>*>(
-            result_cell_slabs[i].tile_);
-
-        // Get source buffers.
-        const auto stores_zipped_coords = is_dim && rt->stores_zipped_coords();
-        const auto tile_tuple = stores_zipped_coords ?
-                                    rt->tile_tuple(constants::coords) :
-                                    rt->tile_tuple(name);
-        const auto& t = tile_tuple->fixed_tile();
-        const auto src_buff = t.template data_as<uint8_t>();
+        auto rt = static_cast<GlobalOrderResultTile<BitmapType>*>(rcs.tile_);
 
-        // Compute parallelization parameters.
+        // The cells to copy and their destination are shared by all fields.
         auto&& [min_pos, max_pos, dest_cell_offset, skip_copy] =
             compute_parallelization_parameters(
                 range_thread_idx,
@@ -1258,33 +1325,47 @@ Status SparseGlobalOrderReader<BitmapType>::copy_fixed_data_tiles(
           return Status::Ok();
         }
 
-        // Get dest buffers.
-        auto buffer = static_cast<uint8_t*>(query_buffer.buffer_) +
-                      dest_cell_offset * cell_size;
-        auto val_buffer =
-            query_buffer.validity_vector_.buffer() + dest_cell_offset;
+        for (uint64_t f = 0; f < fields.size(); f++) {
+          const auto& field = fields[f];
+          auto& query_buffer = *field.query_buffer_;
+          auto val_buffer =
+              query_buffer.validity_vector_.buffer() + dest_cell_offset;
+
+          if (field.var_sized_) {
+            // In views mode, the sizes are shifted so that they are not
+            // overwritten by the views of the previous cells.
+            auto offsets_buffer =
+                (OffType*)query_buffer.buffer_ + dest_cell_offset;
+            if (views_mode_) {
+              offsets_buffer += cell_offsets[0];
+            }
 
-        if (!stores_zipped_coords) {
-          // Copy tile.
-          memcpy(
-              buffer,
-              src_buff + min_pos * cell_size,
-              (max_pos - min_pos) * cell_size);
-        } else {  // Copy for zipped coords.
-          const auto dim_num = rt->domain()->dim_num();
-          for (uint64_t c = min_pos; c < max_pos; c++) {
-            auto pos = c * dim_num + dim_idx;
-            memcpy(buffer, src_buff + pos * cell_size, cell_size);
-            buffer += cell_size;
+            RETURN_NOT_OK(copy_offsets_slab<OffType>(
+                *field.name_,
+                field.nullable_,
+                field.offset_div_,
+                rt,
+                min_pos,
+                max_pos,
+                offsets_buffer,
+                val_buffer,
+                &var_data[dest_cell_offset - cell_offsets[0]]));
+          } else {
+            RETURN_NOT_OK(copy_fixed_data_slab(
+                *field.name_,
+                field.is_dim_,
+                field.nullable_,
+                field.dim_idx_,
+                field.cell_size_,
+                rt,
+                min_pos,
+                max_pos,
+                static_cast<uint8_t*>(query_buffer.buffer_) +
+                    dest_cell_offset * field.cell_size_,
+                val_buffer));
           }
         }
 
-        if (nullable) {
-          const auto& t_val = tile_tuple->validity_tile();
-          const auto src_val_buff = t_val.template data_as<uint8_t>();
-          memcpy(val_buffer, src_val_buff + min_pos, max_pos - min_pos);
-        }
-
         return Status::Ok();
       });
   RETURN_NOT_OK_ELSE(status, logger_->status(status));
@@ -1660,33 +1741,60 @@ Status SparseGlobalOrderReader<BitmapType>::process_slabs(
     return Status::Ok();
   }
 
-  // Make a list of unique result tiles.
+  // Make a list of unique result tiles, with the ranges of cells to copy for
+  // each of them. Only the chunks overlapping those ranges will be
+  // unfiltered.
   std::vector<ResultTile*> result_tiles;
+  std::vector<std::vector<std::pair<uint64_t, uint64_t>>> result_cell_ranges;
   {
-    std::unordered_set<ResultTile*> found_tiles;
+    std::unordered_map<ResultTile*, uint64_t> found_tiles;
     for (auto& rcs : result_cell_slabs) {
-      if (found_tiles.count(rcs.tile_) == 0) {
-        found_tiles.emplace(rcs.tile_);
+      auto it = found_tiles.find(rcs.tile_);
+      if (it == found_tiles.end()) {
+        it = found_tiles.emplace(rcs.tile_, result_tiles.size()).first;
         result_tiles.emplace_back(rcs.tile_);
+        result_cell_ranges.emplace_back();
       }
+
+      result_cell_ranges[it->second].emplace_back(
+          rcs.start_, rcs.start_ + rcs.length_);
     }
   }
 
+  // Slabs of a tile are not necessarily in cell order, sort and merge the
+  // ranges.
+  for (auto& ranges : result_cell_ranges) {
+    std::sort(ranges.begin(), ranges.end());
+    uint64_t merged = 0;
+    for (uint64_t r = 1; r < ranges.size(); r++) {
+      if (ranges[r].first <= ranges[merged].second) {
+        ranges[merged].second =
+            std::max(ranges[merged].second, ranges[r].second);
+      } else {
+        ranges[++merged] = ranges[r];
+      }
+    }
+    ranges.resize(merged + 1);
+  }
+
   // Read a few attributes a a time.
   uint64_t buffer_idx = 0;
   while (buffer_idx < names.size()) {
     // Read and unfilter as many attributes as can fit in the budget.
     auto&& [st, index_to_copy] = read_and_unfilter_attributes(
-        memory_budget, names, *mem_usage_per_attr, &buffer_idx, result_tiles);
+        memory_budget,
+        names,
+        *mem_usage_per_attr,
+        &buffer_idx,
+        result_tiles,
+        result_cell_ranges);
     RETURN_NOT_OK(st);
 
+    // Copy the timestamps and delete metadata, and list the other fields.
+    std::vector<std::string> names_to_copy;
+    names_to_copy.reserve(index_to_copy->size());
     for (const auto& idx : *index_to_copy) {
-      // For easy reference.
       const auto& name = names[idx];
-      const auto is_dim = array_schema_.is_dim(name);
-      const auto var_sized = array_schema_.var_size(name);
-      const auto nullable = array_schema_.is_nullable(name);
-      const auto cell_size = array_schema_.cell_size(name);
       auto& query_buffer = buffers_[name];
 
       // Delete timestamps will be processed at the same time as the delete
@@ -1695,24 +1803,6 @@ Status SparseGlobalOrderReader<BitmapType>::process_slabs(
         continue;
       }
 
-      // Pointers to var size data, generated when offsets are processed.
-      std::vector<void*> var_data;
-      if (var_sized) {
-        var_data.resize(
-            cell_offsets[result_cell_slabs.size()] - cell_offsets[0]);
-      }
-
-      // Get dim idx for zipped coords copy.
-      auto dim_idx = 0;
-      if (is_dim) {
-        const auto& dim_names = array_schema_.dim_names();
-        while (name != dim_names[dim_idx])
-          dim_idx++;
-      }
-
-      // Process all fixed tiles in parallel.
-      OffType offset_div =
-          elements_mode_ ? datatype_size(array_schema_.type(name)) : 1;
       if (name == constants::timestamps) {
         RETURN_NOT_OK(copy_timestamps_tiles(
             num_range_threads, result_cell_slabs, cell_offsets, query_buffer));
@@ -1720,55 +1810,110 @@ Status SparseGlobalOrderReader<BitmapType>::process_slabs(
         // Copy fixed size data.
         RETURN_NOT_OK(copy_delete_meta_tiles(
             num_range_threads, result_cell_slabs, cell_offsets, query_buffer));
-      } else if (var_sized) {
-        RETURN_NOT_OK(copy_offsets_tiles<OffType>(
-            name,
-            num_range_threads,
-            nullable,
-            offset_div,
-            result_cell_slabs,
-            cell_offsets,
-            query_buffer,
-            var_data));
       } else {
-        RETURN_NOT_OK(copy_fixed_data_tiles(
-            name,
-            num_range_threads,
-            is_dim,
-            nullable,
-            dim_idx,
-            cell_size,
-            result_cell_slabs,
-            cell_offsets,
-            query_buffer));
+        names_to_copy.emplace_back(name);
+      }
+    }
+
+    // Pointers to var size data, generated when offsets are processed. The
+    // array is reused for all var sized fields, which are processed one at a
+    // time.
+    std::vector<void*> var_data;
+
+    // Copy the fixed data of all other fields at once.
+    std::vector<std::string> fixed_names_to_copy;
+    for (const auto& name : names_to_copy) {
+      if (!array_schema_.var_size(name)) {
+        fixed_names_to_copy.emplace_back(name);
+      }
+    }
+    if (!fixed_names_to_copy.empty()) {
+      RETURN_NOT_OK(copy_fixed_data_and_offsets_tiles<OffType>(
+          fixed_names_to_copy,
+          num_range_threads,
+          result_cell_slabs,
+          cell_offsets,
+          var_data));
+    }
+
+    // Copy the offsets and var data one field at a time, as each of them
+    // might reduce the number of result cell slabs that fit in the user
+    // buffers.
+    std::unordered_map<std::string, uint64_t> var_buffer_sizes;
+    for (uint64_t i = 0; i < names_to_copy.size(); i++) {
+      // For easy reference.
+      const auto& name = names_to_copy[i];
+      auto& query_buffer = buffers_[name];
+      if (!array_schema_.var_size(name)) {
+        continue;
       }
 
-      uint64_t var_buffer_size = 0;
-      if (var_sized) {
-        // Adjust the offsets buffer and make sure all data fits.
-        var_buffer_size = compute_var_size_offsets<OffType>(
-            stats_, result_cell_slabs, cell_offsets, query_buffer);
-
-        // Now copy the var size data.
-        RETURN_NOT_OK(copy_var_data_tiles(
-            num_range_threads,
-            offset_div,
-            var_buffer_size,
-            result_cell_slabs,
-            cell_offsets,
-            query_buffer,
+      var_data.resize(cell_offsets[result_cell_slabs.size()] - cell_offsets[0]);
+      RETURN_NOT_OK(copy_fixed_data_and_offsets_tiles<OffType>(
+          {name},
+          num_range_threads,
+          result_cell_slabs,
+          cell_offsets,
+          var_data));
+
+      // In views mode, no var data is copied, so all cells fit.
+      if (views_mode_) {
+        RETURN_NOT_OK(copy_views(
+            name,
+            result_tiles,
+            cell_offsets[0],
+            cell_offsets[result_cell_slabs.size()] - cell_offsets[0],
             var_data));
+        continue;
+      }
+
+      // Adjust the offsets buffer and make sure all data fits.
+      auto var_buffer_size = compute_var_size_offsets<OffType>(
+          stats_, result_cell_slabs, cell_offsets, query_buffer);
+
+      // Now copy the var size data.
+      OffType offset_div =
+          elements_mode_ ? datatype_size(array_schema_.type(name)) : 1;
+      RETURN_NOT_OK(copy_var_data_tiles(
+          num_range_threads,
+          offset_div,
+          var_buffer_size,
+          result_cell_slabs,
+          cell_offsets,
+          query_buffer,
+          var_data));
+
+      var_buffer_sizes[name] = var_buffer_size;
+    }
+
+    for (const auto& idx : *index_to_copy) {
+      // For easy reference.
+      const auto& name = names[idx];
+      const auto is_dim = array_schema_.is_dim(name);
+      const auto var_sized = array_schema_.var_size(name);
+      const auto nullable = array_schema_.is_nullable(name);
+      const auto cell_size = array_schema_.cell_size(name);
+      auto& query_buffer = buffers_[name];
+
+      if (name == constants::delete_timestamps) {
+        continue;
       }
 
       // Adjust buffer sizes.
       auto total_cells = cell_offsets[result_cell_slabs.size()];
-      if (var_sized) {
+      if (var_sized && views_mode_) {
+        *query_buffer.buffer_size_ =
+            total_cells * constants::cell_var_view_size;
+        *query_buffer.buffer_var_size_ = 0;
+      } else if (var_sized) {
         *query_buffer.buffer_size_ = total_cells * sizeof(OffType);
 
         if (offsets_extra_element_)
           (*query_buffer.buffer_size_) += sizeof(OffType);
 
-        *query_buffer.buffer_var_size_ = var_buffer_size * offset_div;
+        OffType offset_div =
+            elements_mode_ ? datatype_size(array_schema_.type(name)) : 1;
+        *query_buffer.buffer_var_size_ = var_buffer_sizes[name] * offset_div;
       } else {
         *query_buffer.buffer_size_ = total_cells * cell_size;
       }
@@ -1784,11 +1929,17 @@ Status SparseGlobalOrderReader<BitmapType>::process_slabs(
             total_cells * constants::timestamp_size;
       }
 
-      // Clear tiles from memory.
+      // Clear tiles from memory. In views mode, the var tiles are kept until
+      // the next submit, after the result tiles still using them.
       if (!is_dim && qc_loaded_attr_names_set_.count(name) == 0 &&
           name != constants::timestamps &&
           name != constants::delete_timestamps) {
+        if (views_mode_ && var_sized) {
+          retain_view_tiles(name, result_tiles);
+        }
         clear_tiles(name, result_tiles);
+      } else if (views_mode_ && var_sized) {
+        keep_view_result_tiles(result_tiles);
       }
     }
   }
@@ -1825,7 +1976,8 @@ Status SparseGlobalOrderReader<BitmapType>::remove_result_tile(
     memory_used_qc_tiles_total_ -= tiles_size_qc;
   }
 
-  // Delete the tile.
+  // Delete the tile, keeping its var tiles pointed to by views.
+  release_view_result_tile(&*rt);
   result_tiles_[frag_idx].erase(rt);
 
   return Status::Ok();
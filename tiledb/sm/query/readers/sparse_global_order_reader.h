@@ -129,6 +129,12 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
   /** Resets the reader object. */
   void reset();
 
+  /** Returns the buffers the views of a var-sized field point into. */
+  const std::vector<ConstBuffer>& view_buffers(
+      const std::string& name) const {
+    return field_view_buffers(name);
+  }
+
  private:
   /* ********************************* */
   /*         PRIVATE ATTRIBUTES        */
@@ -330,29 +336,31 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
       const uint64_t cell_offset);
 
   /**
-   * Copy offsets tiles.
+   * Copy offsets for a range of cells of a result tile.
    *
    * @param name Name of the dimension/attribute.
-   * @param num_range_threads Total number of range threads.
    * @param nullable Is this field nullable.
    * @param offset_div Divisor used to convert offsets into element mode.
-   * @param result_cell_slabs Result cell slabs to process.
-   * @param cell_offsets Cell offset per result tile.
-   * @param query_buffer Query buffer to operate on.
+   * @param rt Result tile currently in process.
+   * @param min_pos Minimum cell position to copy.
+   * @param max_pos Maximum cell position to copy.
+   * @param buffer Offsets buffer.
+   * @param val_buffer Validity buffer.
    * @param var_data Stores pointers to var data cell values.
    *
    * @return Status.
    */
   template <class OffType>
-  Status copy_offsets_tiles(
+  Status copy_offsets_slab(
       const std::string& name,
-      const uint64_t num_range_threads,
       const bool nullable,
       const OffType offset_div,
-      const std::vector<ResultCellSlab>& result_cell_slabs,
-      const std::vector<uint64_t>& cell_offsets,
-      QueryBuffer& query_buffer,
-      std::vector<void*>& var_data);
+      GlobalOrderResultTile<BitmapType>* rt,
+      const uint64_t min_pos,
+      const uint64_t max_pos,
+      OffType* buffer,
+      uint8_t* val_buffer,
+      void** var_data);
 
   /**
    * Copy var data tiles.
@@ -378,30 +386,55 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
       const std::vector<void*>& var_data);
 
   /**
-   * Copy fixed size data tiles.
+   * Copy fixed size data for a range of cells of a result tile.
    *
    * @param name Name of the dimension/attribute.
-   * @param num_range_threads Total number of range threads.
    * @param is_dim Is this field a dimension.
    * @param nullable Is this field nullable.
    * @param dim_idx Dimention index, used for zipped coords.
    * @param cell_size Cell size.
-   * @param result_cell_slabs Result cell slabs to process.
-   * @param cell_offsets Cell offset per result tile.
-   * @param query_buffer Query buffer to operate on.
+   * @param rt Result tile currently in process.
+   * @param min_pos Minimum cell position to copy.
+   * @param max_pos Maximum cell position to copy.
+   * @param buffer Data buffer.
+   * @param val_buffer Validity buffer.
    *
    * @return Status.
    */
-  Status copy_fixed_data_tiles(
+  Status copy_fixed_data_slab(
       const std::string& name,
-      const uint64_t num_range_threads,
       const bool is_dim,
       const bool nullable,
       const unsigned dim_idx,
       const uint64_t cell_size,
+      GlobalOrderResultTile<BitmapType>* rt,
+      const uint64_t min_pos,
+      const uint64_t max_pos,
+      uint8_t* buffer,
+      uint8_t* val_buffer);
+
+  /**
+   * Copy the fixed size data and offsets of multiple fields in a single pass
+   * over the result cell slabs, so that the cells to copy and their position
+   * in the user buffers are computed once for all fields.
+   *
+   * @param names Names of the dimensions/attributes to copy.
+   * @param num_range_threads Total number of range threads.
+   * @param result_cell_slabs Result cell slabs to process.
+   * @param cell_offsets Cell offset per result tile.
+   * @param var_data Stores pointers to var data cell values, for the var
+   *     sized field in `names`, if any. At most one var sized field can be
+   *     copied per call.
+   *
+   * @return Status.
+   */
+  template <class OffType>
+  Status copy_fixed_data_and_offsets_tiles(
+      const std::vector<std::string>& names,
+      const uint64_t num_range_threads,
       const std::vector<ResultCellSlab>& result_cell_slabs,
       const std::vector<uint64_t>& cell_offsets,
-      QueryBuffer& query_buffer);
+      std::vector<void*>& var_data);
 
   /**
    * Copy timestamps tiles.
@@ -35,15 +35,20 @@
 #include "tiledb/common/memory_tracker.h"
 #include "tiledb/sm/array/array.h"
 #include "tiledb/sm/array_schema/array_schema.h"
+#include "tiledb/sm/enums/query_condition_combination_op.h"
 #include "tiledb/sm/filesystem/vfs.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
+#include "tiledb/sm/misc/bloom_filter.h"
+#include "tiledb/sm/misc/constants.h"
 #include "tiledb/sm/misc/parallel_functions.h"
 #include "tiledb/sm/misc/resource_pool.h"
 #include "tiledb/sm/query/iquery_strategy.h"
 #include "tiledb/sm/query/query_buffer.h"
 #include "tiledb/sm/query/query_macros.h"
 #include "tiledb/sm/query/strategy_base.h"
+#include "tiledb/sm/storage_manager/storage_manager.h"
 #include "tiledb/sm/subarray/subarray.h"
+#include "tiledb/sm/tile/tile_metadata_generator.h"
 
 #include <numeric>
 
@@ -90,8 +95,10 @@ SparseIndexReaderBase::SparseIndexReaderBase(
     , memory_budget_ratio_query_condition_(0.25)
     , memory_budget_ratio_tile_ranges_(0.1)
     , memory_budget_ratio_array_data_(0.1)
+    , views_mode_(false)
     , buffers_full_(false)
-    , deletes_consolidation_(false) {
+    , deletes_consolidation_(false)
+    , use_hilbert_values_(false) {
   read_state_.done_adding_result_tiles_ = false;
   disable_cache_ = true;
 }
@@ -129,12 +136,14 @@ void SparseIndexReaderBase::init(bool skip_checks_serialization) {
   bool found = false;
   offsets_format_mode_ = config_.get("sm.var_offsets.mode", &found);
   assert(found);
-  if (offsets_format_mode_ != "bytes" && offsets_format_mode_ != "elements") {
+  if (offsets_format_mode_ != "bytes" && offsets_format_mode_ != "elements" &&
+      offsets_format_mode_ != "views") {
     throw SparseIndexReaderBaseStatusException(
         "Cannot initialize reader; Unsupported offsets format in "
         "configuration");
   }
   elements_mode_ = offsets_format_mode_ == "elements";
+  views_mode_ = offsets_format_mode_ == "views";
 
   if (!config_
            .get<bool>(
@@ -143,6 +152,11 @@ void SparseIndexReaderBase::init(bool skip_checks_serialization) {
     throw SparseIndexReaderBaseStatusException("Cannot get setting");
   }
   assert(found);
+  if (views_mode_ && offsets_extra_element_) {
+    throw SparseIndexReaderBaseStatusException(
+        "Cannot initialize reader; Extra offset element is not supported "
+        "with views offsets format");
+  }
 
   if (!config_
            .get<uint32_t>("sm.var_offsets.bitsize", &offsets_bitsize_, &found)
@@ -173,6 +187,8 @@ uint64_t SparseIndexReaderBase::cells_copied(
   if (array_schema_.var_size(last_name)) {
     if (buffer_size == 0)
       return 0;
+    else if (views_mode_)
+      return buffer_size / constants::cell_var_view_size;
     else
       return buffer_size / (offsets_bitsize_ / 8) - offsets_extra_element_;
   } else {
@@ -180,6 +196,20 @@ uint64_t SparseIndexReaderBase::cells_copied(
   }
 }
 
+Status SparseIndexReaderBase::copy_views(
+    const std::string& name,
+    const std::vector<ResultTile*>& result_tiles,
+    const uint64_t first_cell,
+    const uint64_t cell_num,
+    const std::vector<void*>& var_data) {
+  auto timer_se = stats_->start_timer("copy_views");
+
+  add_view_tiles(name, result_tiles);
+  auto views = static_cast<uint8_t*>(buffers_[name].buffer_) +
+               first_cell * constants::cell_var_view_size;
+  return build_views(name, cell_num, var_data.data(), views);
+}
+
 template <class BitmapType>
 tuple<Status, optional<std::pair<uint64_t, uint64_t>>>
 SparseIndexReaderBase::get_coord_tiles_size(
@@ -210,6 +240,10 @@ SparseIndexReaderBase::get_coord_tiles_size(
         fragment_metadata_[f]->cell_num(t) * constants::timestamp_size;
   }
 
+  if (use_hilbert_values_ && fragment_metadata_[f]->has_hilbert_values()) {
+    tiles_size += fragment_metadata_[f]->cell_num(t) * sizeof(uint64_t);
+  }
+
   // Compute query condition tile sizes.
   uint64_t tiles_size_qc = 0;
   if (!qc_loaded_attr_names_.empty()) {
@@ -224,6 +258,208 @@ SparseIndexReaderBase::get_coord_tiles_size(
   return {Status::Ok(), std::make_pair(tiles_size, tiles_size_qc)};
 }
 
+Status SparseIndexReaderBase::load_delete_vectors() {
+  auto timer_se = stats_->start_timer("load_delete_vectors");
+  delete_vectors_.resize(fragment_metadata_.size());
+
+  const auto& delete_vector_uris =
+      array_->array_directory().delete_vector_uris();
+  if (delete_vector_uris.empty()) {
+    return Status::Ok();
+  }
+
+  std::unordered_set<std::string> condition_markers;
+  for (auto& delete_condition : delete_conditions_) {
+    condition_markers.emplace(delete_condition.condition_marker());
+  }
+
+  const auto encryption_key = array_->encryption_key();
+  auto status = parallel_for(
+      storage_manager_->compute_tp(),
+      0,
+      fragment_metadata_.size(),
+      [&](uint64_t f) {
+        auto& fragment = fragment_metadata_[f];
+        auto it = delete_vector_uris.find(
+            fragment->fragment_uri().remove_trailing_slash().last_path_part());
+        if (it == delete_vector_uris.end()) {
+          return Status::Ok();
+        }
+
+        auto&& [st, tile] = storage_manager_->load_data_from_generic_tile(
+            it->second, 0, *encryption_key);
+        RETURN_NOT_OK(st);
+
+        try {
+          auto delete_vector =
+              DeleteVector::deserialize(tile->data(), tile->size());
+
+          // Ignore delete vectors covering conditions outside of the opened
+          // timestamp range, or not matching the fragment.
+          for (auto& marker : delete_vector.condition_markers()) {
+            if (condition_markers.count(marker) == 0) {
+              return Status::Ok();
+            }
+          }
+
+          if (delete_vector.tile_num() != fragment->tile_num()) {
+            return Status::Ok();
+          }
+
+          for (uint64_t t = 0; t < delete_vector.tile_num(); t++) {
+            if (delete_vector.cell_num(t) != fragment->cell_num(t)) {
+              return Status::Ok();
+            }
+          }
+
+          delete_vectors_[f] = std::move(delete_vector);
+        } catch (const std::exception& e) {
+          return logger_->status(Status_ReaderError(
+              "Cannot load delete vector; " + std::string(e.what())));
+        }
+
+        stats_->add_counter("delete_vectors_num", 1);
+        return Status::Ok();
+      });
+  RETURN_NOT_OK(status);
+
+  return Status::Ok();
+}
+
+Status SparseIndexReaderBase::compute_fragment_delete_conditions() {
+  fragment_delete_conditions_.resize(fragment_metadata_.size());
+  if (delete_conditions_.empty()) {
+    return Status::Ok();
+  }
+
+  auto timer_se = stats_->start_timer("compute_fragment_delete_conditions");
+  std::atomic<uint64_t> skipped_num = 0;
+  auto status = parallel_for(
+      storage_manager_->compute_tp(),
+      0,
+      fragment_metadata_.size(),
+      [&](uint64_t f) {
+        auto& frag_meta = fragment_metadata_[f];
+        const DeleteVector* delete_vector =
+            delete_vectors_.empty() || !delete_vectors_[f].has_value() ?
+                nullptr :
+                &delete_vectors_[f].value();
+
+        for (uint64_t i = 0; i < delete_conditions_.size(); i++) {
+          const auto& delete_condition = delete_conditions_[i];
+          if (!delete_condition_applies(*frag_meta, delete_condition) ||
+              (delete_vector != nullptr &&
+               delete_vector->covers(delete_condition.condition_marker()))) {
+            continue;
+          }
+
+          if (delete_condition_deletes_nothing(
+                  *frag_meta, nullopt, delete_condition)) {
+            skipped_num++;
+            continue;
+          }
+
+          fragment_delete_conditions_[f].emplace_back(i);
+        }
+
+        return Status::Ok();
+      });
+  RETURN_NOT_OK_ELSE(status, logger_->status(status));
+
+  stats_->add_counter("delete_condition_skipped_fragment_num", skipped_num);
+
+  return Status::Ok();
+}
+
+Status SparseIndexReaderBase::load_delete_condition_tile_min_max() {
+  auto timer_se = stats_->start_timer("load_delete_condition_tile_min_max");
+  const auto& encryption_key = *array_->encryption_key();
+  auto status = parallel_for(
+      storage_manager_->io_tp(),
+      0,
+      fragment_metadata_.size(),
+      [&](uint64_t f) {
+        // Only fragments with tiles to read need the tile min/max values.
+        if (fragment_delete_conditions_[f].empty() ||
+            (subarray_.is_set() && result_tile_ranges_[f].empty())) {
+          return Status::Ok();
+        }
+
+        auto& frag_meta = fragment_metadata_[f];
+        std::unordered_set<std::string> min_max_names;
+        for (auto i : fragment_delete_conditions_[f]) {
+          for (auto& name : delete_conditions_[i].field_names()) {
+            if (has_tile_min_max(*frag_meta, name)) {
+              min_max_names.insert(name);
+            }
+          }
+        }
+
+        if (min_max_names.empty()) {
+          return Status::Ok();
+        }
+
+        RETURN_NOT_OK(frag_meta->load_tile_min_values(
+            encryption_key, {min_max_names.begin(), min_max_names.end()}));
+        RETURN_NOT_OK(frag_meta->load_tile_max_values(
+            encryption_key, {min_max_names.begin(), min_max_names.end()}));
+        return Status::Ok();
+      });
+  RETURN_NOT_OK_ELSE(status, logger_->status(status));
+
+  return Status::Ok();
+}
+
+bool SparseIndexReaderBase::has_tile_min_max(
+    FragmentMetadata& frag_meta, const std::string& name) const {
+  // Tile min/max values are stored starting with format version 11.
+  const auto& schema = *frag_meta.array_schema();
+  return frag_meta.format_version() >= 11 && schema.is_attr(name) &&
+         !schema.is_nullable(name) &&
+         TileMetadataGenerator::has_min_max_metadata(
+             schema.type(name),
+             false,
+             schema.var_size(name),
+             schema.cell_val_num(name));
+}
+
+bool SparseIndexReaderBase::delete_condition_deletes_nothing(
+    FragmentMetadata& frag_meta,
+    optional<uint64_t> t,
+    const QueryCondition& delete_condition) {
+  // Delete conditions are negated, i.e. they hold for the cells to keep.
+  const auto& schema = *frag_meta.array_schema();
+  const auto& non_empty_domain = frag_meta.non_empty_domain();
+  return delete_condition.always_satisfied(
+      schema,
+      [&](const std::string& name)
+          -> optional<std::pair<const void*, const void*>> {
+        // Dimensions are bounded by the fragment non-empty domain.
+        if (schema.is_dim(name)) {
+          for (unsigned d = 0; d < schema.dim_num(); d++) {
+            const auto& range = non_empty_domain[d];
+            if (schema.dimension_ptr(d)->name() == name && !range.var_size()) {
+              return std::make_pair(range.start_fixed(), range.end_fixed());
+            }
+          }
+          return nullopt;
+        }
+
+        // Attributes are bounded by the tile min/max values.
+        if (!t.has_value() || !has_tile_min_max(frag_meta, name)) {
+          return nullopt;
+        }
+
+        auto&& [st_min, min, min_size] = frag_meta.get_tile_min(name, *t);
+        auto&& [st_max, max, max_size] = frag_meta.get_tile_max(name, *t);
+        if (!st_min.ok() || !st_max.ok()) {
+          return nullopt;
+        }
+
+        return std::pair<const void*, const void*>(*min, *max);
+      });
+}
+
 Status SparseIndexReaderBase::load_initial_data(bool include_coords) {
   if (initial_data_loaded_) {
     return Status::Ok();
@@ -248,6 +484,14 @@ Status SparseIndexReaderBase::load_initial_data(bool include_coords) {
     load_processed_conditions();
   }
 
+  // Load the delete vectors materialized for the fragments.
+  if (delete_conditions_.size() > 0 && !deletes_consolidation_) {
+    RETURN_CANCEL_OR_ERROR(load_delete_vectors());
+  }
+
+  // Find the delete conditions to evaluate for each fragment.
+  RETURN_CANCEL_OR_ERROR(compute_fragment_delete_conditions());
+
   // Make a list of dim/attr that will be loaded for query condition.
   if (!condition_.empty()) {
     for (auto& name : condition_.field_names()) {
@@ -256,10 +500,12 @@ Status SparseIndexReaderBase::load_initial_data(bool include_coords) {
       }
     }
   }
-  for (auto delete_condition : delete_conditions_) {
-    for (auto& name : delete_condition.field_names()) {
-      if (!array_schema_.is_dim(name) || !include_coords) {
-        qc_loaded_attr_names_set_.insert(name);
+  for (auto& frag_delete_conditions : fragment_delete_conditions_) {
+    for (auto i : frag_delete_conditions) {
+      for (auto& name : delete_conditions_[i].field_names()) {
+        if (!array_schema_.is_dim(name) || !include_coords) {
+          qc_loaded_attr_names_set_.insert(name);
+        }
       }
     }
   }
@@ -292,6 +538,9 @@ Status SparseIndexReaderBase::load_initial_data(bool include_coords) {
         read_state_.frag_idx_,
         &result_tile_ranges_));
 
+    // Skip the tiles that the Bloom filters prove have no results.
+    RETURN_CANCEL_OR_ERROR(apply_tile_bloom_filters());
+
     // Compute the size of the tile ranges structure and mark empty fragments
     // as fully loaded.
     for (uint64_t i = 0; i < result_tile_ranges_.size(); i++) {
@@ -308,6 +557,9 @@ Status SparseIndexReaderBase::load_initial_data(bool include_coords) {
           Status_ReaderError("Exceeded memory budget for result tile ranges"));
   }
 
+  // Load the tile min/max values used to skip delete conditions on tiles.
+  RETURN_CANCEL_OR_ERROR(load_delete_condition_tile_min_max());
+
   // Set a limit to the array memory.
   array_memory_tracker_->set_budget(
       memory_budget_ * memory_budget_ratio_array_data_);
@@ -372,6 +624,11 @@ Status SparseIndexReaderBase::load_initial_data(bool include_coords) {
   // Load delete timestamps, always.
   attr_tile_offsets_to_load.emplace_back(constants::delete_timestamps);
 
+  // Load Hilbert values, if required.
+  if (use_hilbert_values_) {
+    attr_tile_offsets_to_load.emplace_back(constants::hilbert_values);
+  }
+
   // Load tile offsets and var sizes for attributes.
   RETURN_CANCEL_OR_ERROR(load_tile_var_sizes(subarray_, var_size_to_load));
   RETURN_CANCEL_OR_ERROR(
@@ -382,6 +639,190 @@ Status SparseIndexReaderBase::load_initial_data(bool include_coords) {
   return Status::Ok();
 }
 
+Status SparseIndexReaderBase::apply_tile_bloom_filters() {
+  // Per field, the values a result tile must possibly contain.
+  std::vector<std::pair<std::string, std::vector<std::string_view>>> lookups;
+
+  // Dimensions where all ranges are points.
+  for (unsigned d = 0; d < array_schema_.dim_num(); ++d) {
+    const auto dim = array_schema_.dimension_ptr(d);
+    if (!TileMetadataGenerator::has_bloom_filter_metadata(
+            dim->type(), dim->var_size(), dim->cell_val_num())) {
+      continue;
+    }
+
+    const auto& ranges = subarray_.ranges_for_dim(d);
+    std::vector<std::string_view> values;
+    values.reserve(ranges.size());
+    for (const auto& range : ranges) {
+      if (!range.unary()) {
+        values.clear();
+        break;
+      }
+
+      if (range.var_size()) {
+        values.emplace_back(range.start_str());
+      } else {
+        values.emplace_back(
+            static_cast<const char*>(range.start_fixed()), range.size() / 2);
+      }
+    }
+
+    if (!values.empty()) {
+      lookups.emplace_back(dim->name(), std::move(values));
+    }
+  }
+
+  // Attributes tested for equality. Without duplicates, the query condition
+  // is applied after deduplication, so a cell that does not match can still
+  // hide an older one: only prune on the query condition with duplicates.
+  if (!condition_.empty() && array_schema_.allows_dups()) {
+    collect_condition_bloom_filter_lookups(condition_.ast(), lookups);
+  }
+
+  if (lookups.empty()) {
+    return Status::Ok();
+  }
+
+  auto timer_se = stats_->start_timer("apply_tile_bloom_filters");
+
+  // Hash the values once, they are looked up in the filters of many tiles.
+  std::vector<std::pair<std::string, std::vector<uint64_t>>> hashed_lookups;
+  hashed_lookups.reserve(lookups.size());
+  for (const auto& lookup : lookups) {
+    std::vector<uint64_t> hashes;
+    hashes.reserve(lookup.second.size());
+    for (const auto& value : lookup.second) {
+      hashes.emplace_back(BloomFilter::hash(value.data(), value.size()));
+    }
+    hashed_lookups.emplace_back(lookup.first, std::move(hashes));
+  }
+
+  const auto& encryption_key = *array_->encryption_key();
+  std::atomic<uint64_t> skipped_tile_num = 0;
+  auto status = parallel_for(
+      storage_manager_->compute_tp(),
+      0,
+      fragment_metadata_.size(),
+      [&](uint64_t f) {
+        auto& frag_meta = fragment_metadata_[f];
+        if (result_tile_ranges_[f].empty() ||
+            frag_meta->format_version() <
+                constants::tile_bloom_filters_min_version) {
+          return Status::Ok();
+        }
+
+        // Only the fields with filters in this fragment can prune tiles,
+        // the footer tells which ones do.
+        std::vector<const std::pair<std::string, std::vector<uint64_t>>*>
+            frag_lookups;
+        std::vector<std::string> names;
+        for (const auto& lookup : hashed_lookups) {
+          if (frag_meta->has_tile_bloom_filters(lookup.first)) {
+            frag_lookups.emplace_back(&lookup);
+            names.emplace_back(lookup.first);
+          }
+        }
+
+        if (frag_lookups.empty()) {
+          return Status::Ok();
+        }
+
+        RETURN_NOT_OK(frag_meta->load_tile_bloom_filters(
+            encryption_key, std::move(names)));
+
+        // The tile ranges are stored in reverse order, rebuild them in the
+        // same order with the remaining tiles.
+        std::vector<std::pair<uint64_t, uint64_t>> tile_ranges;
+        for (const auto& range : result_tile_ranges_[f]) {
+          std::vector<std::pair<uint64_t, uint64_t>> kept;
+          for (uint64_t t = range.first; t <= range.second; t++) {
+            bool may_contain = true;
+            for (const auto lookup : frag_lookups) {
+              may_contain = std::any_of(
+                  lookup->second.begin(),
+                  lookup->second.end(),
+                  [&](uint64_t hash) {
+                    return frag_meta->tile_may_contain(lookup->first, t, hash);
+                  });
+              if (!may_contain) {
+                break;
+              }
+            }
+
+            if (!may_contain) {
+              skipped_tile_num++;
+            } else if (!kept.empty() && kept.back().second + 1 == t) {
+              kept.back().second = t;
+            } else {
+              kept.emplace_back(t, t);
+            }
+          }
+
+          tile_ranges.insert(tile_ranges.end(), kept.rbegin(), kept.rend());
+        }
+
+        result_tile_ranges_[f] = std::move(tile_ranges);
+        return Status::Ok();
+      });
+  RETURN_NOT_OK_ELSE(status, logger_->status(status));
+
+  stats_->add_counter("bloom_filter_skipped_tile_num", skipped_tile_num);
+
+  return Status::Ok();
+}
+
+void SparseIndexReaderBase::collect_condition_bloom_filter_lookups(
+    const tdb_unique_ptr<ASTNode>& node,
+    std::vector<std::pair<std::string, std::vector<std::string_view>>>&
+        lookups) const {
+  if (node->is_expr()) {
+    if (node->get_combination_op() == QueryConditionCombinationOp::AND) {
+      for (const auto& child : node->get_children()) {
+        collect_condition_bloom_filter_lookups(child, lookups);
+      }
+    }
+    return;
+  }
+
+  // Only non-null equality or set membership on fields that have Bloom
+  // filters.
+  const auto& name = node->get_field_name();
+  const auto& value = node->get_condition_value_view();
+  const auto op = node->get_op();
+  if ((op != QueryConditionOp::EQ && op != QueryConditionOp::IN) ||
+      value.content() == nullptr || !array_schema_.is_field(name)) {
+    return;
+  }
+
+  const auto var_size = array_schema_.var_size(name);
+  if (!TileMetadataGenerator::has_bloom_filter_metadata(
+          array_schema_.type(name),
+          var_size,
+          array_schema_.cell_val_num(name))) {
+    return;
+  }
+
+  std::vector<std::string_view> values;
+  if (op == QueryConditionOp::IN) {
+    values = node->get_value_set().members();
+  } else {
+    values.emplace_back(
+        static_cast<const char*>(value.content()), value.size());
+  }
+
+  // A value of the wrong size cannot be looked up in the filters.
+  if (!var_size) {
+    for (const auto& v : values) {
+      if (v.size() != array_schema_.cell_size(name)) {
+        return;
+      }
+    }
+  }
+
+  lookups.emplace_back(name, std::move(values));
+}
+
 Status SparseIndexReaderBase::read_and_unfilter_coords(
     bool include_coords, const std::vector<ResultTile*>& result_tiles) {
   auto timer_se = stats_->start_timer("read_and_unfilter_coords");
@@ -404,27 +845,70 @@ Status SparseIndexReaderBase::read_and_unfilter_coords(
 
   // Compute attributes to load.
   std::vector<std::string> attr_to_load;
-  attr_to_load.reserve(1 + use_timestamps_ + qc_loaded_attr_names_.size());
+  attr_to_load.reserve(
+      1 + use_timestamps_ + use_hilbert_values_ + qc_loaded_attr_names_.size());
   if (use_timestamps_) {
     attr_to_load.emplace_back(constants::timestamps);
   }
   attr_to_load.emplace_back(constants::delete_timestamps);
+  if (use_hilbert_values_) {
+    attr_to_load.emplace_back(constants::hilbert_values);
+  }
   std::copy(
       qc_loaded_attr_names_.begin(),
       qc_loaded_attr_names_.end(),
       std::back_inserter(attr_to_load));
 
-  // Read and unfilter attribute tiles.
+  // Read and unfilter attribute tiles. The query condition attributes that
+  // can be partially unfiltered are processed in apply_query_condition.
   RETURN_CANCEL_OR_ERROR(read_attribute_tiles(attr_to_load, result_tiles));
 
   for (const auto& name : attr_to_load) {
-    RETURN_CANCEL_OR_ERROR(unfilter_tiles(name, result_tiles));
+    if (!qc_partially_unfiltered(name)) {
+      RETURN_CANCEL_OR_ERROR(unfilter_tiles(name, result_tiles));
+    }
   }
 
   logger_->debug("Done reading and unfiltering coords tiles");
   return Status::Ok();
 }
 
+bool SparseIndexReaderBase::qc_partially_unfiltered(
+    const std::string& name) const {
+  return qc_loaded_attr_names_set_.count(name) != 0 &&
+         array_schema_.is_attr(name) && !array_schema_.var_size(name);
+}
+
+template <class BitmapType>
+std::vector<std::pair<uint64_t, uint64_t>>
+SparseIndexReaderBase::bitmap_cell_ranges(
+    const std::vector<BitmapType>& bitmap, uint64_t cell_num) {
+  std::vector<std::pair<uint64_t, uint64_t>> ranges;
+  if (bitmap.empty()) {
+    ranges.emplace_back(0, cell_num);
+    return ranges;
+  }
+
+  uint64_t c = 0;
+  while (c < cell_num) {
+    // Find the next run of cells in the bitmap.
+    while (c < cell_num && bitmap[c] == 0) {
+      c++;
+    }
+
+    const auto start = c;
+    while (c < cell_num && bitmap[c] != 0) {
+      c++;
+    }
+
+    if (c != start) {
+      ranges.emplace_back(start, c);
+    }
+  }
+
+  return ranges;
+}
+
 template <class BitmapType>
 Status SparseIndexReaderBase::compute_tile_bitmaps(
     std::vector<ResultTile*>& result_tiles) {
@@ -465,95 +949,113 @@ Status SparseIndexReaderBase::compute_tile_bitmaps(
     RETURN_NOT_OK_ELSE(status, logger_->status(status));
   }
 
-  // Process all tiles/cells in parallel.
-  auto status = parallel_for_2d(
-      storage_manager_->compute_tp(),
-      0,
-      result_tiles.size(),
-      0,
-      num_range_threads,
-      [&](uint64_t t, uint64_t range_thread_idx) {
-        // For easy reference.
-        auto rt = (ResultTileWithBitmap<BitmapType>*)result_tiles[t];
-        auto cell_num =
-            fragment_metadata_[rt->frag_idx()]->cell_num(rt->tile_idx());
-
-        // Allocate the bitmap if not preallocated.
-        if (num_range_threads == 1) {
-          rt->alloc_bitmap();
-        }
-
-        // Prevent processing past the end of the cells in case there are more
-        // threads than cells.
-        if (range_thread_idx > cell_num - 1) {
-          return Status::Ok();
-        }
-
-        // Get the MBR for this tile.
-        const auto& mbr =
-            fragment_metadata_[rt->frag_idx()]->mbr(rt->tile_idx());
-
-        // Compute bitmaps one dimension at a time.
-        for (unsigned d = 0; d < dim_num; d++) {
-          // For col-major cell ordering, iterate the dimensions
-          // in reverse.
-          const unsigned dim_idx =
-              cell_order == Layout::COL_MAJOR ? dim_num - d - 1 : d;
-
-          // No need to compute bitmaps for default dimensions.
-          if (subarray_.is_default(dim_idx))
-            continue;
-
-          auto& ranges_for_dim = subarray_.ranges_for_dim(dim_idx);
+  // Process all tiles/cells for a range thread of a tile, reusing the interval
+  // index scratch buffer of the calling task.
+  auto process_tile = [&](uint64_t t,
+                          uint64_t range_thread_idx,
+                          ResultTile::RangeIndexScratch& scratch) {
+    // For easy reference.
+    auto rt = (ResultTileWithBitmap<BitmapType>*)result_tiles[t];
+    auto cell_num =
+        fragment_metadata_[rt->frag_idx()]->cell_num(rt->tile_idx());
+
+    // Allocate the bitmap if not preallocated.
+    if (num_range_threads == 1) {
+      rt->alloc_bitmap();
+    }
 
-          // Compute the list of range index to process.
-          std::vector<uint64_t> relevant_ranges;
-          relevant_ranges.reserve(ranges_for_dim.size());
-          domain.dimension_ptr(dim_idx)->relevant_ranges(
-              ranges_for_dim, mbr[dim_idx], relevant_ranges);
+    // Prevent processing past the end of the cells in case there are more
+    // threads than cells.
+    if (range_thread_idx > cell_num - 1) {
+      return Status::Ok();
+    }
 
-          // For non overlapping ranges, if we have full overlap on any range
-          // there is no need to compute bitmaps.
-          const bool non_overlapping = std::is_same<BitmapType, uint8_t>::value;
-          if (non_overlapping) {
-            std::vector<bool> covered_bitmap =
-                domain.dimension_ptr(dim_idx)->covered_vec(
-                    ranges_for_dim, mbr[dim_idx], relevant_ranges);
+    // Get the MBR for this tile.
+    RTree::PinnedLeafPage pinned;
+    const auto& mbr =
+        fragment_metadata_[rt->frag_idx()]->mbr(rt->tile_idx(), &pinned);
 
-            // See if any range is covered.
-            uint64_t count = std::accumulate(
-                covered_bitmap.begin(), covered_bitmap.end(), 0);
+    // Compute bitmaps one dimension at a time.
+    for (unsigned d = 0; d < dim_num; d++) {
+      // For col-major cell ordering, iterate the dimensions
+      // in reverse.
+      const unsigned dim_idx =
+          cell_order == Layout::COL_MAJOR ? dim_num - d - 1 : d;
+
+      // No need to compute bitmaps for default dimensions.
+      if (subarray_.is_default(dim_idx))
+        continue;
+
+      auto& ranges_for_dim = subarray_.ranges_for_dim(dim_idx);
+
+      // Compute the list of range index to process.
+      std::vector<uint64_t> relevant_ranges;
+      relevant_ranges.reserve(ranges_for_dim.size());
+      domain.dimension_ptr(dim_idx)->relevant_ranges(
+          ranges_for_dim, mbr[dim_idx], relevant_ranges);
+
+      // For non overlapping ranges, if we have full overlap on any range
+      // there is no need to compute bitmaps.
+      const bool non_overlapping = std::is_same<BitmapType, uint8_t>::value;
+      if (non_overlapping) {
+        std::vector<bool> covered_bitmap =
+            domain.dimension_ptr(dim_idx)->covered_vec(
+                ranges_for_dim, mbr[dim_idx], relevant_ranges);
+
+        // See if any range is covered.
+        uint64_t count = std::accumulate(
+            covered_bitmap.begin(), covered_bitmap.end(), 0);
+
+        if (count != 0)
+          continue;
+      }
 
-            if (count != 0)
-              continue;
-          }
+      // Compute the cells to process.
+      auto part_num = std::min(cell_num, num_range_threads);
+      auto min = (range_thread_idx * cell_num + part_num - 1) / part_num;
+      auto max = std::min(
+          ((range_thread_idx + 1) * cell_num + part_num - 1) / part_num,
+          cell_num);
+
+      // Compute the bitmap for the cells.
+      {
+        auto timer_compute_results_count_sparse =
+            stats_->start_timer("compute_results_count_sparse");
+        RETURN_NOT_OK(rt->compute_results_count_sparse(
+            dim_idx,
+            ranges_for_dim,
+            relevant_ranges,
+            rt->bitmap(),
+            cell_order,
+            min,
+            max,
+            scratch));
+      }
+    }
 
-          // Compute the cells to process.
-          auto part_num = std::min(cell_num, num_range_threads);
-          auto min = (range_thread_idx * cell_num + part_num - 1) / part_num;
-          auto max = std::min(
-              ((range_thread_idx + 1) * cell_num + part_num - 1) / part_num,
-              cell_num);
-
-          // Compute the bitmap for the cells.
-          {
-            auto timer_compute_results_count_sparse =
-                stats_->start_timer("compute_results_count_sparse");
-            RETURN_NOT_OK(rt->compute_results_count_sparse(
-                dim_idx,
-                ranges_for_dim,
-                relevant_ranges,
-                rt->bitmap(),
-                cell_order,
-                min,
-                max));
-          }
-        }
+    // Only compute bitmap cells here if we are processing a single cell
+    // range. If not, it will be done below.
+    if (num_range_threads == 1) {
+      rt->count_cells();
+    }
 
-        // Only compute bitmap cells here if we are processing a single cell
-        // range. If not, it will be done below.
-        if (num_range_threads == 1) {
-          rt->count_cells();
+    return Status::Ok();
+  };
+
+  // Process all tiles/cells in parallel. The (tile, range thread) tasks are
+  // split in one contiguous chunk per thread, so that the scratch buffer is
+  // allocated once per thread rather than once per tile and dimension.
+  const uint64_t task_num = result_tiles.size() * num_range_threads;
+  const uint64_t chunk_num =
+      std::min<uint64_t>(std::max<uint64_t>(num_threads, 1), task_num);
+  auto status = parallel_for(
+      storage_manager_->compute_tp(), 0, chunk_num, [&](uint64_t chunk) {
+        ResultTile::RangeIndexScratch scratch;
+        const uint64_t begin = chunk * task_num / chunk_num;
+        const uint64_t end = (chunk + 1) * task_num / chunk_num;
+        for (uint64_t i = begin; i < end; i++) {
+          RETURN_NOT_OK(process_tile(
+              i / num_range_threads, i % num_range_threads, scratch));
         }
 
         return Status::Ok();
@@ -585,7 +1087,39 @@ Status SparseIndexReaderBase::apply_query_condition(
     std::vector<ResultTile*>& result_tiles) {
   auto timer_se = stats_->start_timer("apply_query_condition");
 
+  // Unfilter the query condition attributes, only decoding the chunks that
+  // hold cells in the tile bitmaps.
+  std::vector<std::string> names_to_unfilter;
+  for (const auto& name : qc_loaded_attr_names_) {
+    if (qc_partially_unfiltered(name)) {
+      names_to_unfilter.emplace_back(name);
+    }
+  }
+
+  if (!names_to_unfilter.empty()) {
+    std::vector<std::vector<std::pair<uint64_t, uint64_t>>> result_cell_ranges(
+        result_tiles.size());
+    auto status = parallel_for(
+        storage_manager_->compute_tp(),
+        0,
+        result_tiles.size(),
+        [&](uint64_t t) {
+          auto rt = static_cast<ResultTileType*>(result_tiles[t]);
+          result_cell_ranges[t] =
+              bitmap_cell_ranges(rt->bitmap(), rt->cell_num());
+          return Status::Ok();
+        });
+    RETURN_NOT_OK_ELSE(status, logger_->status(status));
+
+    for (const auto& name : names_to_unfilter) {
+      RETURN_CANCEL_OR_ERROR(
+          unfilter_tiles(name, result_tiles, &result_cell_ranges));
+    }
+  }
+
   if (!condition_.empty() || !delete_conditions_.empty() || use_timestamps_) {
+    std::atomic<uint64_t> skipped_delete_condition_num = 0;
+
     // Process all tiles in parallel.
     auto status = parallel_for(
         storage_manager_->compute_tp(),
@@ -642,46 +1176,53 @@ Status SparseIndexReaderBase::apply_query_condition(
               rt->allocate_per_cell_delete_condition_vector();
             }
 
-            for (uint64_t i = 0; i < delete_conditions_.size(); i++) {
-              if (!frag_meta->has_delete_meta() ||
-                  frag_meta->get_processed_conditions().count(
-                      delete_conditions_[i].condition_marker()) == 0) {
-                auto delete_timestamp =
-                    delete_conditions_[i].condition_timestamp();
-
-                // Check the delete condition timestamp is after the fragment
-                // start.
-                if (delete_timestamp >= frag_meta->timestamp_range().first) {
-                  // Apply timestamped condition or regular condition.
-                  if (!frag_meta->has_timestamps() ||
-                      delete_timestamp > frag_meta->timestamp_range().second) {
-                    RETURN_NOT_OK(
-                        delete_conditions_[i].apply_sparse<BitmapType>(
-                            *(frag_meta->array_schema().get()),
-                            *rt,
-                            rt->bitmap_with_qc()));
-                  } else {
-                    RETURN_NOT_OK(timestamped_delete_conditions_[i]
-                                      .apply_sparse<BitmapType>(
-                                          *(frag_meta->array_schema().get()),
-                                          *rt,
-                                          rt->bitmap_with_qc()));
-                  }
-
-                  if (deletes_consolidation_) {
-                    // This is a post processing step during deletes
-                    // consolidation to set the delete condition pointer to
-                    // the current delete condition if the cells was cleared
-                    // by this condition and not any previous conditions.
-                    rt->compute_per_cell_delete_condition(
-                        &delete_conditions_[i]);
-                  } else {
-                    // Count cells is dups are allowed as the regular bitmap was
-                    // modified.
-                    if (array_schema_.allows_dups()) {
-                      rt->count_cells();
-                    }
-                  }
+            // Apply the delete vector of the fragment, if any.
+            if (!delete_vectors_.empty() &&
+                delete_vectors_[rt->frag_idx()].has_value()) {
+              delete_vectors_[rt->frag_idx()]->apply(
+                  rt->tile_idx(), rt->bitmap_with_qc());
+              if (array_schema_.allows_dups()) {
+                rt->count_cells();
+              }
+            }
+
+            for (uint64_t i : fragment_delete_conditions_[rt->frag_idx()]) {
+              // Skip the tiles where the condition cannot delete any cell.
+              if (delete_condition_deletes_nothing(
+                      *frag_meta, rt->tile_idx(), delete_conditions_[i])) {
+                skipped_delete_condition_num++;
+                continue;
+              }
+
+              auto delete_timestamp =
+                  delete_conditions_[i].condition_timestamp();
+
+              // Apply timestamped condition or regular condition.
+              if (!frag_meta->has_timestamps() ||
+                  delete_timestamp > frag_meta->timestamp_range().second) {
+                RETURN_NOT_OK(delete_conditions_[i].apply_sparse<BitmapType>(
+                    *(frag_meta->array_schema().get()),
+                    *rt,
+                    rt->bitmap_with_qc()));
+              } else {
+                RETURN_NOT_OK(
+                    timestamped_delete_conditions_[i].apply_sparse<BitmapType>(
+                        *(frag_meta->array_schema().get()),
+                        *rt,
+                        rt->bitmap_with_qc()));
+              }
+
+              if (deletes_consolidation_) {
+                // This is a post processing step during deletes
+                // consolidation to set the delete condition pointer to
+                // the current delete condition if the cells was cleared
+                // by this condition and not any previous conditions.
+                rt->compute_per_cell_delete_condition(&delete_conditions_[i]);
+              } else {
+                // Count cells is dups are allowed as the regular bitmap was
+                // modified.
+                if (array_schema_.allows_dups()) {
+                  rt->count_cells();
                 }
               }
             }
@@ -690,6 +1231,8 @@ Status SparseIndexReaderBase::apply_query_condition(
           return Status::Ok();
         });
     RETURN_NOT_OK_ELSE(status, logger_->status(status));
+    stats_->add_counter(
+        "delete_condition_skipped_tile_num", skipped_delete_condition_num);
   }
 
   logger_->debug("Done applying query condition");
@@ -702,7 +1245,9 @@ SparseIndexReaderBase::read_and_unfilter_attributes(
     const std::vector<std::string>& names,
     const std::vector<uint64_t>& mem_usage_per_attr,
     uint64_t* buffer_idx,
-    std::vector<ResultTile*>& result_tiles) {
+    std::vector<ResultTile*>& result_tiles,
+    const std::vector<std::vector<std::pair<uint64_t, uint64_t>>>&
+        result_cell_ranges) {
   auto timer_se = stats_->start_timer("read_and_unfilter_attributes");
 
   std::vector<std::string> names_to_read;
@@ -730,8 +1275,16 @@ SparseIndexReaderBase::read_and_unfilter_attributes(
   RETURN_NOT_OK_TUPLE(
       read_attribute_tiles(names_to_read, result_tiles), nullopt);
 
-  for (auto& name : names_to_read)
-    RETURN_NOT_OK_TUPLE(unfilter_tiles(name, result_tiles), nullopt);
+  // Only the chunks holding cells to copy are unfiltered for fixed-sized
+  // attributes.
+  for (auto& name : names_to_read) {
+    const auto partial =
+        array_schema_.is_attr(name) && !array_schema_.var_size(name);
+    RETURN_NOT_OK_TUPLE(
+        unfilter_tiles(
+            name, result_tiles, partial ? &result_cell_ranges : nullptr),
+        nullopt);
+  }
 
   return {Status::Ok(), std::move(index_to_copy)};
 }
@@ -743,7 +1296,14 @@ Status SparseIndexReaderBase::resize_output_buffers(uint64_t cells_copied) {
     const auto size = *it.second.buffer_size_;
     uint64_t num_cells = 0;
 
-    if (array_schema_.var_size(name)) {
+    if (array_schema_.var_size(name) && views_mode_) {
+      // Views are not followed by var data, only keep the copied ones.
+      num_cells = size / constants::cell_var_view_size;
+      if (num_cells > cells_copied) {
+        *(it.second.buffer_size_) =
+            cells_copied * constants::cell_var_view_size;
+      }
+    } else if (array_schema_.var_size(name)) {
       // Get the current number of cells from the offsets buffer.
       num_cells = size / constants::cell_var_offset_size;
 
@@ -849,6 +1409,12 @@ template Status SparseIndexReaderBase::apply_query_condition<
 template Status SparseIndexReaderBase::apply_query_condition<
     GlobalOrderResultTile<uint8_t>,
     uint8_t>(std::vector<ResultTile*>&);
+template std::vector<std::pair<uint64_t, uint64_t>>
+SparseIndexReaderBase::bitmap_cell_ranges<uint64_t>(
+    const std::vector<uint64_t>&, uint64_t);
+template std::vector<std::pair<uint64_t, uint64_t>>
+SparseIndexReaderBase::bitmap_cell_ranges<uint8_t>(
+    const std::vector<uint8_t>&, uint64_t);
 template Status SparseIndexReaderBase::compute_tile_bitmaps<uint64_t>(
     std::vector<ResultTile*>&);
 template Status SparseIndexReaderBase::compute_tile_bitmaps<uint8_t>(
@@ -38,6 +38,7 @@
 #include "tiledb/common/common.h"
 #include "tiledb/common/status.h"
 #include "tiledb/sm/array_schema/dimension.h"
+#include "tiledb/sm/query/deletes_and_updates/delete_vector.h"
 #include "tiledb/sm/query/query_condition.h"
 #include "tiledb/sm/query/readers/result_cell_slab.h"
 
@@ -292,6 +293,9 @@ class SparseIndexReaderBase : public ReaderBase {
   /** Are we in elements mode. */
   bool elements_mode_;
 
+  /** Are we in views mode. */
+  bool views_mode_;
+
   /** Names of dim/attr loaded for query condition. */
   std::vector<std::string> qc_loaded_attr_names_;
 
@@ -304,6 +308,21 @@ class SparseIndexReaderBase : public ReaderBase {
   /** Are we doing deletes consolidation. */
   bool deletes_consolidation_;
 
+  /**
+   * The delete vectors materialized for the fragments, used instead of
+   * evaluating the delete conditions they cover.
+   */
+  std::vector<optional<DeleteVector>> delete_vectors_;
+
+  /**
+   * The indexes of the delete conditions to evaluate on the tiles of each
+   * fragment.
+   */
+  std::vector<std::vector<uint64_t>> fragment_delete_conditions_;
+
+  /** Load the persisted Hilbert values of the fragments that have them. */
+  bool use_hilbert_values_;
+
   /* ********************************* */
   /*         PROTECTED METHODS         */
   /* ********************************* */
@@ -329,6 +348,37 @@ class SparseIndexReaderBase : public ReaderBase {
    */
   uint64_t cells_copied(const std::vector<std::string>& names);
 
+  /**
+   * Converts the cell sizes copied to the offsets buffer of a var-sized
+   * field to views pointing into its var tiles, in the `views` offsets
+   * format. The size of the cell at index `first_cell + i` in the user
+   * buffers must have been copied to the 64-bit slot `2 * first_cell + i`
+   * of the offsets buffer, so that it is not overwritten by the views built
+   * before it.
+   *
+   * @param name Field name.
+   * @param result_tiles Result tiles holding the var data of the cells.
+   * @param first_cell Index of the first cell in the user buffers.
+   * @param cell_num Number of cells to convert.
+   * @param var_data Pointers to the var data of the cells.
+   * @return Status.
+   */
+  Status copy_views(
+      const std::string& name,
+      const std::vector<ResultTile*>& result_tiles,
+      const uint64_t first_cell,
+      const uint64_t cell_num,
+      const std::vector<void*>& var_data);
+
+  /**
+   * Returns `true` if the tiles kept for the views of the current submit use
+   * half of the memory budget, in which case no more cells are copied until
+   * the next submit.
+   */
+  bool view_tiles_over_budget() const {
+    return view_tiles_size_ > memory_budget_ / 2;
+  }
+
   /**
    * Get the coordinate tiles size for a dimension.
    *
@@ -352,7 +402,88 @@ class SparseIndexReaderBase : public ReaderBase {
   Status load_initial_data(bool include_coords);
 
   /**
-   * Read and unfilter coord tiles.
+   * Loads the delete vectors of the fragments. A delete vector is only used
+   * if all the delete conditions it covers are part of this read, the other
+   * conditions are evaluated on the tiles as usual.
+   *
+   * @return Status.
+   */
+  Status load_delete_vectors();
+
+  /**
+   * Computes the delete conditions to evaluate on the tiles of each fragment,
+   * i.e. the conditions that apply to the fragment, that are not covered by
+   * its delete vector and that might delete cells within its non-empty
+   * domain.
+   *
+   * @return Status.
+   */
+  Status compute_fragment_delete_conditions();
+
+  /**
+   * Loads, on the IO thread pool, the tile min/max values of the attributes
+   * used by the delete conditions of each fragment, to skip evaluating them
+   * on individual tiles. Fragments without result tiles are skipped.
+   *
+   * @return Status.
+   */
+  Status load_delete_condition_tile_min_max();
+
+  /**
+   * Returns `true` if the tile min/max values of an attribute can be used for
+   * a fragment.
+   *
+   * @param frag_meta Fragment metadata.
+   * @param name Attribute name.
+   * @return true if the tile min/max values are present.
+   */
+  bool has_tile_min_max(
+      FragmentMetadata& frag_meta, const std::string& name) const;
+
+  /**
+   * Returns `true` if a delete condition cannot delete any cell of a
+   * fragment, or of one of its tiles, based on the fragment non-empty domain
+   * and the tile min/max values.
+   *
+   * @param frag_meta Fragment metadata.
+   * @param t Tile index, or `nullopt` to check the whole fragment.
+   * @param delete_condition The delete condition.
+   * @return true if the condition can be skipped.
+   */
+  bool delete_condition_deletes_nothing(
+      FragmentMetadata& frag_meta,
+      optional<uint64_t> t,
+      const QueryCondition& delete_condition);
+
+  /**
+   * Removes from the result tile ranges the tiles that the per-tile Bloom
+   * filters prove cannot contain a result. The filters are checked for the
+   * dimensions where all the subarray ranges are points and, for arrays
+   * allowing duplicates, for the attributes tested for equality by the
+   * query condition.
+   *
+   * @return Status.
+   */
+  Status apply_tile_bloom_filters();
+
+  /**
+   * Collects the equality predicates of the query condition that every
+   * result must satisfy, i.e. the `EQ` and `IN` leaves that are only combined
+   * with `AND`.
+   *
+   * @param node The query condition node to process.
+   * @param lookups Per field, the values a result tile must possibly contain,
+   *     the tile is a result if it possibly contains any of the values.
+   */
+  void collect_condition_bloom_filter_lookups(
+      const tdb_unique_ptr<ASTNode>& node,
+      std::vector<std::pair<std::string, std::vector<std::string_view>>>&
+          lookups) const;
+
+  /**
+   * Read and unfilter coord tiles. The tiles of the fixed-sized attributes
+   * used by the query condition are only read, they are unfiltered by
+   * `apply_query_condition` once the tile bitmaps are known.
    *
    * @param include_coords Include coordinates or not.
    * @param result_tiles The result tiles to process.
@@ -362,6 +493,27 @@ class SparseIndexReaderBase : public ReaderBase {
   Status read_and_unfilter_coords(
       bool include_coords, const std::vector<ResultTile*>& result_tiles);
 
+  /**
+   * Returns whether the tiles of a query condition attribute are unfiltered
+   * only for the chunks holding cells in the tile bitmaps.
+   *
+   * @param name Attribute name.
+   * @return True if the unfiltering is deferred to `apply_query_condition`.
+   */
+  bool qc_partially_unfiltered(const std::string& name) const;
+
+  /**
+   * Computes the sorted ranges of cells holding results in a tile bitmap.
+   *
+   * @param bitmap The bitmap, empty if all cells hold results.
+   * @param cell_num The number of cells in the tile.
+   *
+   * @return The cell ranges, as [start, end) pairs.
+   */
+  template <class BitmapType>
+  static std::vector<std::pair<uint64_t, uint64_t>> bitmap_cell_ranges(
+      const std::vector<BitmapType>& bitmap, uint64_t cell_num);
+
   /**
    * Compute tile bitmaps.
    *
@@ -373,7 +525,8 @@ class SparseIndexReaderBase : public ReaderBase {
   Status compute_tile_bitmaps(std::vector<ResultTile*>& result_tiles);
 
   /**
-   * Apply query condition.
+   * Apply query condition. This first unfilters the chunks of the query
+   * condition attribute tiles holding cells in the tile bitmaps.
    *
    * @param result_tiles Result tiles to process.
    *
@@ -392,6 +545,9 @@ class SparseIndexReaderBase : public ReaderBase {
    * @param mem_usage_per_attr Computed per attribute memory usage.
    * @param buffer_idx Stores/return the current buffer index in process.
    * @param result_tiles Result tiles to process.
+   * @param result_cell_ranges Sorted ranges of cells to copy for each result
+   *     tile. Only the chunks of fixed-sized attribute tiles overlapping
+   *     these ranges are unfiltered.
    *
    * @return Status, index_to_copy.
    */
@@ -400,7 +556,9 @@ class SparseIndexReaderBase : public ReaderBase {
       const std::vector<std::string>& names,
       const std::vector<uint64_t>& mem_usage_per_attr,
       uint64_t* buffer_idx,
-      std::vector<ResultTile*>& result_tiles);
+      std::vector<ResultTile*>& result_tiles,
+      const std::vector<std::vector<std::pair<uint64_t, uint64_t>>>&
+          result_cell_ranges);
 
   /**
    * Adds an extra offset in the end of the offsets buffer indicating the
@@ -171,8 +171,10 @@ Status SparseUnorderedWithDupsReader<BitmapType>::dowork() {
   // This reader assumes ranges are sorted.
   assert(subarray_.ranges_sorted());
 
-  // Start with out buffer sizes as zero.
+  // Start with out buffer sizes as zero, and release the views of the
+  // previous submit.
   zero_out_buffer_sizes();
+  clear_views();
 
   // Handle empty array.
   if (fragment_metadata_.empty()) {
@@ -265,8 +267,9 @@ Status SparseUnorderedWithDupsReader<BitmapType>::dowork() {
       continue;
     }
 
-    // Copy tiles.
-    if (offsets_bitsize_ == 64) {
+    // Copy tiles. In views mode, the cell sizes are first copied as 64-bit
+    // values.
+    if (offsets_bitsize_ == 64 || views_mode_) {
       RETURN_NOT_OK(process_tiles<uint64_t>(names, result_tiles_loaded));
     } else {
       RETURN_NOT_OK(process_tiles<uint32_t>(names, result_tiles_loaded));
@@ -274,7 +277,7 @@ Status SparseUnorderedWithDupsReader<BitmapType>::dowork() {
 
     // End the iteration.
     RETURN_NOT_OK(end_iteration());
-  } while (!buffers_full_ && incomplete());
+  } while (!buffers_full_ && incomplete() && !view_tiles_over_budget());
 
   // Fix the output buffer sizes.
   RETURN_NOT_OK(resize_output_buffers(cells_copied(names)));
@@ -649,81 +652,6 @@ Status SparseUnorderedWithDupsReader<uint8_t>::copy_offsets_tile(
   return Status::Ok();
 }
 
-template <class BitmapType>
-template <class OffType>
-Status SparseUnorderedWithDupsReader<BitmapType>::copy_offsets_tiles(
-    const std::string& name,
-    const uint64_t num_range_threads,
-    const bool nullable,
-    const OffType offset_div,
-    const std::vector<ResultTile*>& result_tiles,
-    const std::vector<uint64_t>& cell_offsets,
-    QueryBuffer& query_buffer,
-    std::vector<void*>& var_data) {
-  auto timer_se = stats_->start_timer("copy_offsets_tiles");
-
-  // For easy reference.
-  auto buffer = (OffType*)query_buffer.buffer_;
-  auto val_buffer = query_buffer.validity_vector_.buffer();
-
-  // Process all tiles/cells in parallel.
-  auto status = parallel_for_2d(
-      storage_manager_->compute_tp(),
-      0,
-      result_tiles.size(),
-      0,
-      num_range_threads,
-      [&](uint64_t i, uint64_t range_thread_idx) {
-        // For easy reference.
-        auto rt = (UnorderedWithDupsResultTile<BitmapType>*)result_tiles[i];
-
-        // We might have a partially processed result tile from last run.
-        auto min_pos_tile = 0;
-        if (i == 0) {
-          min_pos_tile = read_state_.frag_idx_[rt->frag_idx()].cell_idx_;
-        }
-
-        auto max_pos_tile =
-            fragment_metadata_[rt->frag_idx()]->cell_num(rt->tile_idx());
-
-        // Adjust max cell if this is the last tile.
-        if (i == result_tiles.size() - 1) {
-          auto to_copy = cell_offsets[i + 1] - cell_offsets[i];
-          max_pos_tile =
-              rt->pos_with_given_result_sum(min_pos_tile, to_copy) + 1;
-        }
-
-        auto&& [skip_copy, src_min_pos, src_max_pos, dest_cell_offset] =
-            compute_parallelization_parameters(
-                range_thread_idx,
-                num_range_threads,
-                min_pos_tile,
-                max_pos_tile,
-                cell_offsets[i],
-                rt);
-        if (skip_copy) {
-          return Status::Ok();
-        }
-
-        // Copy tile.
-        RETURN_NOT_OK(copy_offsets_tile<OffType>(
-            name,
-            nullable,
-            offset_div,
-            &*rt,
-            src_min_pos,
-            src_max_pos,
-            buffer + dest_cell_offset,
-            val_buffer + dest_cell_offset,
-            &var_data[dest_cell_offset - cell_offsets[0]]));
-
-        return Status::Ok();
-      });
-  RETURN_NOT_OK_ELSE(status, logger_->status(status));
-
-  return Status::Ok();
-}
-
 /** Copy Var data. */
 template <class BitmapType>
 template <class OffType>
@@ -1085,21 +1013,52 @@ Status SparseUnorderedWithDupsReader<uint8_t>::copy_timestamp_data_tile(
 }
 
 template <class BitmapType>
-Status SparseUnorderedWithDupsReader<BitmapType>::copy_fixed_data_tiles(
-    const std::string& name,
+template <class OffType>
+Status
+SparseUnorderedWithDupsReader<BitmapType>::copy_fixed_data_and_offsets_tiles(
+    const std::vector<std::string>& names,
     const uint64_t num_range_threads,
-    const bool is_dim,
-    const bool nullable,
-    const uint64_t dim_idx,
-    const uint64_t cell_size,
     const std::vector<ResultTile*>& result_tiles,
     const std::vector<uint64_t>& cell_offsets,
-    QueryBuffer& query_buffer) {
-  auto timer_se = stats_->start_timer("copy_fixed_data_tiles");
+    std::vector<void*>& var_data) {
+  auto timer_se = stats_->start_timer("copy_fixed_data_and_offsets_tiles");
+
+  // Field parameters, computed once for all tiles.
+  struct FieldCopyParams {
+    const std::string* name_;
+    bool is_dim_;
+    bool var_sized_;
+    bool nullable_;
+    unsigned dim_idx_;
+    uint64_t cell_size_;
+    OffType offset_div_;
+    QueryBuffer* query_buffer_;
+  };
+
+  std::vector<FieldCopyParams> fields;
+  fields.reserve(names.size());
+  for (const auto& name : names) {
+    const auto is_dim = array_schema_.is_dim(name);
+
+    // Get dim idx for zipped coords copy.
+    unsigned dim_idx = 0;
+    if (is_dim) {
+      const auto& dim_names = array_schema_.dim_names();
+      while (name != dim_names[dim_idx])
+        dim_idx++;
+    }
 
-  // For easy reference.
-  auto buffer = (uint8_t*)query_buffer.buffer_;
-  auto val_buffer = query_buffer.validity_vector_.buffer();
+    fields.push_back(
+        {&name,
+         is_dim,
+         array_schema_.var_size(name),
+         array_schema_.is_nullable(name),
+         dim_idx,
+         array_schema_.cell_size(name),
+         elements_mode_ ? (OffType)datatype_size(array_schema_.type(name)) :
+                          (OffType)1,
+         &buffers_[name]});
+  }
 
   // Process all tiles/cells in parallel.
   auto status = parallel_for_2d(
@@ -1128,6 +1087,7 @@ Status SparseUnorderedWithDupsReader<BitmapType>::copy_fixed_data_tiles(
               rt->pos_with_given_result_sum(min_pos_tile, to_copy) + 1;
         }
 
+        // The cells to copy and their destination are shared by all fields.
         auto&& [skip_copy, src_min_pos, src_max_pos, dest_cell_offset] =
             compute_parallelization_parameters(
                 range_thread_idx,
@@ -1140,25 +1100,52 @@ Status SparseUnorderedWithDupsReader<BitmapType>::copy_fixed_data_tiles(
           return Status::Ok();
         }
 
-        if (name == constants::timestamps) {
-          RETURN_NOT_OK(copy_timestamp_data_tile(
-              &*rt,
-              src_min_pos,
-              src_max_pos,
-              buffer + dest_cell_offset * cell_size));
-        } else {
-          // Copy tile.
-          RETURN_NOT_OK(copy_fixed_data_tile(
-              name,
-              is_dim,
-              nullable,
-              dim_idx,
-              cell_size,
-              &*rt,
-              src_min_pos,
-              src_max_pos,
-              buffer + dest_cell_offset * cell_size,
-              val_buffer + dest_cell_offset));
+        for (uint64_t f = 0; f < fields.size(); f++) {
+          const auto& field = fields[f];
+          auto& query_buffer = *field.query_buffer_;
+          auto val_buffer =
+              query_buffer.validity_vector_.buffer() + dest_cell_offset;
+
+          if (field.var_sized_) {
+            // In views mode, the sizes are shifted so that they are not
+            // overwritten by the views of the previous cells.
+            auto offsets_buffer =
+                (OffType*)query_buffer.buffer_ + dest_cell_offset;
+            if (views_mode_) {
+              offsets_buffer += cell_offsets[0];
+            }
+
+            RETURN_NOT_OK(copy_offsets_tile<OffType>(
+                *field.name_,
+                field.nullable_,
+                field.offset_div_,
+                &*rt,
+                src_min_pos,
+                src_max_pos,
+                offsets_buffer,
+                val_buffer,
+                &var_data[dest_cell_offset - cell_offsets[0]]));
+          } else if (*field.name_ == constants::timestamps) {
+            RETURN_NOT_OK(copy_timestamp_data_tile(
+                &*rt,
+                src_min_pos,
+                src_max_pos,
+                (uint8_t*)query_buffer.buffer_ +
+                    dest_cell_offset * field.cell_size_));
+          } else {
+            RETURN_NOT_OK(copy_fixed_data_tile(
+                *field.name_,
+                field.is_dim_,
+                field.nullable_,
+                field.dim_idx_,
+                field.cell_size_,
+                &*rt,
+                src_min_pos,
+                src_max_pos,
+                (uint8_t*)query_buffer.buffer_ +
+                    dest_cell_offset * field.cell_size_,
+                val_buffer));
+          }
         }
 
         return Status::Ok();
@@ -1187,7 +1174,9 @@ SparseUnorderedWithDupsReader<BitmapType>::compute_fixed_results_to_copy(
     const auto& name = it.first;
     const auto size = it.second.original_buffer_size_;
     if (array_schema_.var_size(name)) {
-      auto temp_num_cells = size / constants::cell_var_offset_size;
+      auto temp_num_cells =
+          size / (views_mode_ ? constants::cell_var_view_size :
+                                constants::cell_var_offset_size);
 
       if (offsets_extra_element_ && temp_num_cells > 0)
         temp_num_cells--;
@@ -1426,114 +1415,148 @@ Status SparseUnorderedWithDupsReader<BitmapType>::process_tiles(
     num_range_threads = 1 + ((num_threads - 1) / result_tiles.size());
   }
 
+  // Compute the ranges of cells to copy for each tile, only the chunks
+  // overlapping them will be unfiltered.
+  std::vector<std::vector<std::pair<uint64_t, uint64_t>>> result_cell_ranges(
+      result_tiles.size());
+  auto status = parallel_for(
+      storage_manager_->compute_tp(), 0, result_tiles.size(), [&](uint64_t t) {
+        auto rt = static_cast<UnorderedWithDupsResultTile<BitmapType>*>(
+            result_tiles[t]);
+        result_cell_ranges[t] =
+            bitmap_cell_ranges(rt->bitmap(), rt->cell_num());
+        return Status::Ok();
+      });
+  RETURN_NOT_OK_ELSE(status, logger_->status(status));
+
   // Read a few attributes a a time.
   uint64_t buffer_idx = 0;
   while (buffer_idx < names.size()) {
     // Read and unfilter as many attributes as can fit in the budget.
     auto&& [st, index_to_copy] = read_and_unfilter_attributes(
-        memory_budget, names, *mem_usage_per_attr, &buffer_idx, result_tiles);
+        memory_budget,
+        names,
+        *mem_usage_per_attr,
+        &buffer_idx,
+        result_tiles,
+        result_cell_ranges);
     RETURN_NOT_OK(st);
 
-    // Copy one attribute at a time for buffers in memory.
-    for (const auto& idx : *index_to_copy) {
+    std::vector<std::string> names_to_copy;
+    std::vector<std::string> fixed_names_to_copy;
+    names_to_copy.reserve(index_to_copy->size());
+    for (uint64_t i = 0; i < index_to_copy->size(); i++) {
+      const auto& name = names[(*index_to_copy)[i]];
+      names_to_copy.emplace_back(name);
+      if (!array_schema_.var_size(name)) {
+        fixed_names_to_copy.emplace_back(name);
+      }
+    }
+
+    // Pointers to var size data, generated when offsets are processed. The
+    // array is reused for all var sized attributes, which are processed one
+    // at a time.
+    std::vector<void*> var_data;
+
+    // Copy the fixed data of all buffers in memory at once.
+    if (!fixed_names_to_copy.empty()) {
+      RETURN_NOT_OK(copy_fixed_data_and_offsets_tiles<OffType>(
+          fixed_names_to_copy,
+          num_range_threads,
+          result_tiles,
+          cell_offsets,
+          var_data));
+    }
+
+    // Copy the offsets and var data one attribute at a time, as each of them
+    // might reduce the number of result tiles that fit in the user buffers.
+    std::vector<uint64_t> var_buffer_sizes(names_to_copy.size(), 0);
+    for (uint64_t i = 0; i < names_to_copy.size(); i++) {
       // For easy reference.
-      const auto& name = names[idx];
-      const auto is_dim = array_schema_.is_dim(name);
-      const auto var_sized = array_schema_.var_size(name);
-      const auto nullable = array_schema_.is_nullable(name);
-      const auto cell_size = array_schema_.cell_size(name);
+      const auto& name = names_to_copy[i];
       auto& query_buffer = buffers_[name];
-
-      // Get dim idx for zipped coords copy.
-      auto dim_idx = 0;
-      if (is_dim) {
-        const auto& dim_names = array_schema_.dim_names();
-        while (name != dim_names[dim_idx])
-          dim_idx++;
+      if (!array_schema_.var_size(name)) {
+        continue;
       }
 
-      // Pointers to var size data, generated when offsets are processed.
-      std::vector<void*> var_data;
-      if (var_sized) {
-        var_data.resize(cell_offsets[result_tiles.size()] - cell_offsets[0]);
-      }
+      var_data.resize(cell_offsets[result_tiles.size()] - cell_offsets[0]);
+      RETURN_NOT_OK(copy_fixed_data_and_offsets_tiles<OffType>(
+          {name}, num_range_threads, result_tiles, cell_offsets, var_data));
 
-      // Process all fixed tiles in parallel.
-      OffType offset_div =
-          elements_mode_ ? datatype_size(array_schema_.type(name)) : 1;
-      if (var_sized) {
-        RETURN_NOT_OK(copy_offsets_tiles<OffType>(
+      // In views mode, no var data is copied, so all cells fit.
+      if (views_mode_) {
+        RETURN_NOT_OK(copy_views(
             name,
-            num_range_threads,
-            nullable,
-            offset_div,
             result_tiles,
-            cell_offsets,
-            query_buffer,
+            cell_offsets[0],
+            cell_offsets[result_tiles.size()] - cell_offsets[0],
             var_data));
-      } else {
-        RETURN_NOT_OK(copy_fixed_data_tiles(
-            name,
-            num_range_threads,
-            is_dim,
-            nullable,
-            dim_idx,
-            cell_size,
-            result_tiles,
-            cell_offsets,
-            query_buffer));
+        continue;
       }
 
-      uint64_t var_buffer_size = 0;
-
-      if (var_sized) {
-        auto first_tile_min_pos =
-            read_state_.frag_idx_[result_tiles[0]->frag_idx()].cell_idx_;
-
-        // Adjust the offsets buffer and make sure all data fits.
-        auto&& [buffers_full, new_var_buffer_size, new_result_tiles_size] =
-            compute_var_size_offsets<OffType>(
-                stats_,
-                fragment_metadata_,
-                result_tiles,
-                first_tile_min_pos,
-                cell_offsets,
-                query_buffer);
-        buffers_full_ |= buffers_full;
-
-        // Clear tiles from memory and adjust result_tiles.
-        for (const auto& idx : *index_to_copy) {
-          const auto& name_to_clear = names[idx];
-          const auto is_dim_to_clear = array_schema_.is_dim(name_to_clear);
-          if (qc_loaded_attr_names_set_.count(name_to_clear) == 0 &&
-              (!subarray_.is_set() || !is_dim_to_clear)) {
-            clear_tiles(name_to_clear, result_tiles, new_result_tiles_size);
-          }
+      auto first_tile_min_pos =
+          read_state_.frag_idx_[result_tiles[0]->frag_idx()].cell_idx_;
+
+      // Adjust the offsets buffer and make sure all data fits.
+      auto&& [buffers_full, new_var_buffer_size, new_result_tiles_size] =
+          compute_var_size_offsets<OffType>(
+              stats_,
+              fragment_metadata_,
+              result_tiles,
+              first_tile_min_pos,
+              cell_offsets,
+              query_buffer);
+      buffers_full_ |= buffers_full;
+
+      // Clear tiles from memory and adjust result_tiles.
+      for (const auto& name_to_clear : names_to_copy) {
+        const auto is_dim_to_clear = array_schema_.is_dim(name_to_clear);
+        if (qc_loaded_attr_names_set_.count(name_to_clear) == 0 &&
+            (!subarray_.is_set() || !is_dim_to_clear)) {
+          clear_tiles(name_to_clear, result_tiles, new_result_tiles_size);
         }
-        result_tiles.resize(new_result_tiles_size);
+      }
+      result_tiles.resize(new_result_tiles_size);
 
-        // Now copy the var size data.
-        RETURN_NOT_OK(copy_var_data_tiles(
-            num_range_threads,
-            offset_div,
-            new_var_buffer_size,
-            result_tiles,
-            cell_offsets,
-            query_buffer,
-            var_data));
+      // Now copy the var size data.
+      OffType offset_div =
+          elements_mode_ ? datatype_size(array_schema_.type(name)) : 1;
+      RETURN_NOT_OK(copy_var_data_tiles(
+          num_range_threads,
+          offset_div,
+          new_var_buffer_size,
+          result_tiles,
+          cell_offsets,
+          query_buffer,
+          var_data));
+
+      var_buffer_sizes[i] = new_var_buffer_size;
+    }
 
-        var_buffer_size = new_var_buffer_size;
-      }
+    for (uint64_t i = 0; i < names_to_copy.size(); i++) {
+      // For easy reference.
+      const auto& name = names_to_copy[i];
+      const auto is_dim = array_schema_.is_dim(name);
+      const auto var_sized = array_schema_.var_size(name);
+      const auto nullable = array_schema_.is_nullable(name);
+      const auto cell_size = array_schema_.cell_size(name);
+      auto& query_buffer = buffers_[name];
 
       // Adjust buffer sizes.
       auto total_cells = cell_offsets[result_tiles.size()];
-      if (var_sized) {
+      if (var_sized && views_mode_) {
+        *query_buffer.buffer_size_ =
+            total_cells * constants::cell_var_view_size;
+        *query_buffer.buffer_var_size_ = 0;
+      } else if (var_sized) {
         *query_buffer.buffer_size_ = total_cells * sizeof(OffType);
 
         if (offsets_extra_element_)
           (*query_buffer.buffer_size_) += sizeof(OffType);
 
-        *query_buffer.buffer_var_size_ = var_buffer_size * offset_div;
+        OffType offset_div =
+            elements_mode_ ? datatype_size(array_schema_.type(name)) : 1;
+        *query_buffer.buffer_var_size_ = var_buffer_sizes[i] * offset_div;
       } else {
         *query_buffer.buffer_size_ = total_cells * cell_size;
       }
@@ -1541,11 +1564,17 @@ Status SparseUnorderedWithDupsReader<BitmapType>::process_tiles(
       if (nullable)
         *query_buffer.validity_vector_.buffer_size() = total_cells;
 
-      // Clear tiles from memory.
+      // Clear tiles from memory. In views mode, the var tiles are kept until
+      // the next submit, after the result tiles still using them.
       if (qc_loaded_attr_names_set_.count(name) == 0 &&
           (!subarray_.is_set() || !is_dim) && name != constants::timestamps &&
           name != constants::delete_timestamps) {
+        if (views_mode_ && var_sized) {
+          retain_view_tiles(name, result_tiles);
+        }
         clear_tiles(name, result_tiles);
+      } else if (views_mode_ && var_sized) {
+        keep_view_result_tiles(result_tiles);
       }
     }
   }
@@ -1596,7 +1625,8 @@ Status SparseUnorderedWithDupsReader<BitmapType>::remove_result_tile(
     memory_used_qc_tiles_total_ -= tiles_size_qc;
   }
 
-  // Delete the tile.
+  // Delete the tile, keeping its var tiles pointed to by views.
+  release_view_result_tile(&*rt);
   result_tiles_.erase(rt);
 
   return Status::Ok();
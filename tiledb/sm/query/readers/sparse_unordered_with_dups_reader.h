@@ -153,6 +153,12 @@ class SparseUnorderedWithDupsReader : public SparseIndexReaderBase,
   /** Resets the reader object. */
   void reset();
 
+  /** Returns the buffers the views of a var-sized field point into. */
+  const std::vector<ConstBuffer>& view_buffers(
+      const std::string& name) const {
+    return field_view_buffers(name);
+  }
+
  private:
   /* ********************************* */
   /*         PRIVATE ATTRIBUTES        */
@@ -256,31 +262,6 @@ class SparseUnorderedWithDupsReader : public SparseIndexReaderBase,
       uint8_t* val_buffer,
       void** var_data);
 
-  /**
-   * Copy offsets tiles.
-   *
-   * @param name Name of the dimension/attribute.
-   * @param num_range_threads Total number of range threads.
-   * @param nullable Is this field nullable.
-   * @param offset_div Divisor used to convert offsets into element mode.
-   * @param result_tiles Result tiles to process.
-   * @param cell_offsets Cell offset per result tile.
-   * @param query_buffer Query buffer to operate on.
-   * @param var_data Stores pointers to var data cell values.
-   *
-   * @return Status.
-   */
-  template <class OffType>
-  Status copy_offsets_tiles(
-      const std::string& name,
-      const uint64_t num_range_threads,
-      const bool nullable,
-      const OffType offset_div,
-      const std::vector<ResultTile*>& result_tiles,
-      const std::vector<uint64_t>& cell_offsets,
-      QueryBuffer& query_buffer,
-      std::vector<void*>& var_data);
-
   /**
    * Copy var data tile.
    *
@@ -376,30 +357,27 @@ class SparseUnorderedWithDupsReader : public SparseIndexReaderBase,
       uint8_t* buffer);
 
   /**
-   * Copy fixed size data tiles.
+   * Copy the fixed size data and offsets tiles of multiple fields in a
+   * single pass over the result tiles, so that the cells to copy and their
+   * position in the user buffers are computed once for all fields.
    *
-   * @param name Name of the dimension/attribute.
+   * @param names Names of the dimensions/attributes to copy.
    * @param num_range_threads Total number of range threads.
-   * @param is_dim Is this field a dimension.
-   * @param nullable Is this field nullable.
-   * @param dim_idx Dimention index, used for zipped coords.
-   * @param cell_size Cell size.
    * @param result_tiles Result tiles to process.
    * @param cell_offsets Cell offset per result tile.
-   * @param query_buffer Query buffer to operate on.
+   * @param var_data Stores pointers to var data cell values, for the var
+   *     sized field in `names`, if any. At most one var sized field can be
+   *     copied per call.
    *
    * @return Status.
    */
-  Status copy_fixed_data_tiles(
-      const std::string& name,
+  template <class OffType>
+  Status copy_fixed_data_and_offsets_tiles(
+      const std::vector<std::string>& names,
       const uint64_t num_range_threads,
-      const bool is_dim,
-      const bool nullable,
-      const uint64_t dim_idx,
-      const uint64_t cell_size,
       const std::vector<ResultTile*>& result_tiles,
       const std::vector<uint64_t>& cell_offsets,
-      QueryBuffer& query_buffer);
+      std::vector<void*>& var_data);
 
   /**
    * Compute the maximum vector of result tiles to process and cell offsets for
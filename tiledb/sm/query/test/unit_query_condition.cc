@@ -4070,6 +4070,433 @@ TEST_CASE(
   }
 }
 
+/**
+ * @brief Function that creates set membership query conditions, with their
+ * expected results, on the array containing {0, 1, 2, 3, 4, 5, 6, 7, 8, 9}.
+ *
+ * @param field_name The field name of the query condition.
+ * @param result_tile The result tile of the array we're running the query on.
+ * @param tp_vec The vector that stores the test parameter structs.
+ */
+void populate_set_membership_test_params_vector(
+    const std::string& field_name,
+    ResultTile* result_tile,
+    std::vector<TestParams>& tp_vec) {
+  // Construct query condition `foo IN (2, 5, 6, 100)`.
+  {
+    std::vector<uint64_t> members = {2, 5, 6, 100};
+    std::vector<uint64_t> offsets = {0, 8, 16, 24};
+    QueryCondition query_condition;
+    REQUIRE(query_condition
+                .init_set_membership(
+                    std::string(field_name),
+                    members.data(),
+                    members.size() * sizeof(uint64_t),
+                    offsets.data(),
+                    offsets.size() * sizeof(uint64_t),
+                    QueryConditionOp::IN)
+                .ok());
+
+    std::vector<uint8_t> expected_bitmap = {0, 0, 1, 0, 0, 1, 1, 0, 0, 0};
+    std::vector<ResultCellSlab> expected_slabs = {
+        {result_tile, 2, 1}, {result_tile, 5, 2}};
+    TestParams tp(
+        std::move(query_condition),
+        std::move(expected_bitmap),
+        std::move(expected_slabs));
+    tp_vec.push_back(tp);
+  }
+
+  // Construct query condition `foo NOT IN (0, 1, 8, 9)`.
+  {
+    std::vector<uint64_t> members = {9, 0, 8, 1};
+    std::vector<uint64_t> offsets = {0, 8, 16, 24};
+    QueryCondition query_condition;
+    REQUIRE(query_condition
+                .init_set_membership(
+                    std::string(field_name),
+                    members.data(),
+                    members.size() * sizeof(uint64_t),
+                    offsets.data(),
+                    offsets.size() * sizeof(uint64_t),
+                    QueryConditionOp::NOT_IN)
+                .ok());
+
+    std::vector<uint8_t> expected_bitmap = {0, 0, 1, 1, 1, 1, 1, 1, 0, 0};
+    std::vector<ResultCellSlab> expected_slabs = {{result_tile, 2, 6}};
+    TestParams tp(
+        std::move(query_condition),
+        std::move(expected_bitmap),
+        std::move(expected_slabs));
+    tp_vec.push_back(tp);
+  }
+
+  // Construct query condition `foo IN (1, 3, 5, ..., 99)`, which is large
+  // enough to be probed by hashing.
+  {
+    std::vector<uint64_t> members;
+    std::vector<uint64_t> offsets;
+    for (uint64_t i = 1; i < 100; i += 2) {
+      offsets.push_back(members.size() * sizeof(uint64_t));
+      members.push_back(i);
+    }
+    QueryCondition query_condition;
+    REQUIRE(query_condition
+                .init_set_membership(
+                    std::string(field_name),
+                    members.data(),
+                    members.size() * sizeof(uint64_t),
+                    offsets.data(),
+                    offsets.size() * sizeof(uint64_t),
+                    QueryConditionOp::IN)
+                .ok());
+
+    std::vector<uint8_t> expected_bitmap = {0, 1, 0, 1, 0, 1, 0, 1, 0, 1};
+    std::vector<ResultCellSlab> expected_slabs = {
+        {result_tile, 1, 1},
+        {result_tile, 3, 1},
+        {result_tile, 5, 1},
+        {result_tile, 7, 1},
+        {result_tile, 9, 1}};
+    TestParams tp(
+        std::move(query_condition),
+        std::move(expected_bitmap),
+        std::move(expected_slabs));
+    tp_vec.push_back(tp);
+  }
+
+  // Construct query condition `foo IN ()`.
+  {
+    QueryCondition query_condition;
+    REQUIRE(query_condition
+                .init_set_membership(
+                    std::string(field_name),
+                    nullptr,
+                    0,
+                    nullptr,
+                    0,
+                    QueryConditionOp::IN)
+                .ok());
+
+    std::vector<uint8_t> expected_bitmap = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    std::vector<ResultCellSlab> expected_slabs = {};
+    TestParams tp(
+        std::move(query_condition),
+        std::move(expected_bitmap),
+        std::move(expected_slabs));
+    tp_vec.push_back(tp);
+  }
+
+  // Construct query condition `foo IN (3, 4) OR foo > 7`, negated into
+  // `foo NOT IN (3, 4) AND foo <= 7`.
+  {
+    std::vector<uint64_t> members = {3, 4};
+    std::vector<uint64_t> offsets = {0, 8};
+    QueryCondition query_condition_1;
+    REQUIRE(query_condition_1
+                .init_set_membership(
+                    std::string(field_name),
+                    members.data(),
+                    members.size() * sizeof(uint64_t),
+                    offsets.data(),
+                    offsets.size() * sizeof(uint64_t),
+                    QueryConditionOp::IN)
+                .ok());
+    uint64_t cmp_value = 7;
+    QueryCondition query_condition_2;
+    REQUIRE(query_condition_2
+                .init(
+                    std::string(field_name),
+                    &cmp_value,
+                    sizeof(uint64_t),
+                    QueryConditionOp::GT)
+                .ok());
+    QueryCondition query_condition_3;
+    REQUIRE(query_condition_1
+                .combine(
+                    query_condition_2,
+                    QueryConditionCombinationOp::OR,
+                    &query_condition_3)
+                .ok());
+
+    std::vector<uint8_t> expected_bitmap = {0, 0, 0, 1, 1, 0, 0, 0, 1, 1};
+    std::vector<ResultCellSlab> expected_slabs = {
+        {result_tile, 3, 2}, {result_tile, 8, 2}};
+    TestParams tp(
+        std::move(query_condition_3),
+        std::move(expected_bitmap),
+        std::move(expected_slabs));
+    tp_vec.push_back(tp);
+
+    std::vector<uint8_t> negated_expected_bitmap = {
+        1, 1, 1, 0, 0, 1, 1, 1, 0, 0};
+    std::vector<ResultCellSlab> negated_expected_slabs = {
+        {result_tile, 0, 3}, {result_tile, 5, 3}};
+    TestParams negated_tp(
+        tp_vec.back().qc_.negated_condition(),
+        std::move(negated_expected_bitmap),
+        std::move(negated_expected_slabs));
+    tp_vec.push_back(negated_tp);
+  }
+}
+
+TEST_CASE(
+    "QueryCondition: Test set membership",
+    "[QueryCondition][set_membership]") {
+  // Setup.
+  const std::string field_name = "foo";
+  const uint64_t cells = 10;
+  const Datatype type = Datatype::UINT64;
+
+  // Initialize the array schema.
+  ArraySchema array_schema;
+  Attribute attr(field_name, type);
+  REQUIRE(array_schema.add_attribute(tdb::make_shared<Attribute>(HERE(), &attr))
+              .ok());
+  Domain domain;
+  Dimension dim("dim1", Datatype::UINT32);
+  uint32_t bounds[2] = {1, cells};
+  Range range(bounds, 2 * sizeof(uint32_t));
+  REQUIRE(dim.set_domain(range).ok());
+  REQUIRE(
+      domain
+          .add_dimension(tdb::make_shared<tiledb::sm::Dimension>(HERE(), &dim))
+          .ok());
+  REQUIRE(
+      array_schema.set_domain(make_shared<tiledb::sm::Domain>(HERE(), &domain))
+          .ok());
+
+  // Initialize the result tile.
+  ResultTile result_tile(0, 0, array_schema);
+  result_tile.init_attr_tile(field_name, false, false);
+  ResultTile::TileTuple* const tile_tuple = result_tile.tile_tuple(field_name);
+  Tile* const tile = &tile_tuple->fixed_tile();
+
+  // Initialize and populate the data tile.
+  REQUIRE(tile->init_unfiltered(
+                  constants::format_version,
+                  type,
+                  cells * sizeof(uint64_t),
+                  sizeof(uint64_t),
+                  0)
+              .ok());
+
+  std::vector<uint64_t> values(cells);
+  for (uint64_t i = 0; i < cells; ++i) {
+    values[i] = i;
+  }
+  REQUIRE(tile->write(values.data(), 0, cells * sizeof(uint64_t)).ok());
+
+  std::vector<TestParams> tp_vec;
+  populate_set_membership_test_params_vector(field_name, &result_tile, tp_vec);
+
+  SECTION("Validate check.") {
+    for (auto& elem : tp_vec) {
+      CHECK(elem.qc_.check(array_schema).ok());
+    }
+
+    // Members must have the attribute cell size.
+    uint32_t members[] = {1, 2};
+    uint64_t offsets[] = {0, 4};
+    QueryCondition query_condition;
+    REQUIRE(query_condition
+                .init_set_membership(
+                    std::string(field_name),
+                    members,
+                    sizeof(members),
+                    offsets,
+                    sizeof(offsets),
+                    QueryConditionOp::IN)
+                .ok());
+    CHECK(!query_condition.check(array_schema).ok());
+
+    // Like for EQ, fixed-size string members may differ from the cell size.
+    Attribute str_attr("str", Datatype::CHAR);
+    REQUIRE(str_attr.set_cell_val_num(4).ok());
+    REQUIRE(array_schema
+                .add_attribute(tdb::make_shared<Attribute>(HERE(), &str_attr))
+                .ok());
+    const char str_members[] = "abcdab";
+    uint64_t str_offsets[] = {0, 4};
+    QueryCondition str_condition;
+    REQUIRE(str_condition
+                .init_set_membership(
+                    "str",
+                    str_members,
+                    6,
+                    str_offsets,
+                    sizeof(str_offsets),
+                    QueryConditionOp::IN)
+                .ok());
+    CHECK(str_condition.check(array_schema).ok());
+  }
+
+  SECTION("Validate init.") {
+    uint64_t members[] = {1, 2};
+    uint64_t offsets[] = {0, 8};
+    uint64_t bad_offsets[] = {8, 0};
+    QueryCondition query_condition;
+    CHECK(!query_condition
+               .init(
+                   std::string(field_name),
+                   members,
+                   sizeof(uint64_t),
+                   QueryConditionOp::IN)
+               .ok());
+    CHECK(!query_condition
+               .init_set_membership(
+                   std::string(field_name),
+                   members,
+                   sizeof(members),
+                   offsets,
+                   sizeof(offsets),
+                   QueryConditionOp::EQ)
+               .ok());
+    CHECK(!query_condition
+               .init_set_membership(
+                   std::string(field_name),
+                   members,
+                   sizeof(members),
+                   bad_offsets,
+                   sizeof(bad_offsets),
+                   QueryConditionOp::IN)
+               .ok());
+  }
+
+  SECTION("Validate apply.") {
+    for (auto& elem : tp_vec) {
+      validate_qc_apply(elem, cells, array_schema, result_tile);
+    }
+  }
+
+  SECTION("Validate apply_sparse.") {
+    for (auto& elem : tp_vec) {
+      validate_qc_apply_sparse(elem, cells, array_schema, result_tile);
+    }
+  }
+
+  SECTION("Validate apply_dense.") {
+    for (auto& elem : tp_vec) {
+      validate_qc_apply_dense(elem, cells, array_schema, result_tile);
+    }
+  }
+}
+
+TEST_CASE(
+    "QueryCondition: Test set membership, string",
+    "[QueryCondition][set_membership][string]") {
+  // Setup.
+  const std::string field_name = "foo";
+  const uint64_t cells = 10;
+  const Datatype type = Datatype::STRING_ASCII;
+
+  // Initialize the array schema.
+  ArraySchema array_schema;
+  Attribute attr(field_name, type);
+  REQUIRE(attr.set_nullable(false).ok());
+  REQUIRE(attr.set_cell_val_num(constants::var_num).ok());
+  REQUIRE(attr.set_fill_value("ac", 2 * sizeof(char)).ok());
+
+  REQUIRE(
+      array_schema.add_attribute(make_shared<Attribute>(HERE(), &attr)).ok());
+  Domain domain;
+  Dimension dim("dim1", Datatype::UINT32);
+  uint32_t bounds[2] = {1, cells};
+  Range range(bounds, 2 * sizeof(uint32_t));
+  REQUIRE(dim.set_domain(range).ok());
+  REQUIRE(domain.add_dimension(make_shared<Dimension>(HERE(), &dim)).ok());
+  REQUIRE(array_schema.set_domain(make_shared<Domain>(HERE(), &domain)).ok());
+
+  // Initialize the result tile.
+  ResultTile result_tile(0, 0, array_schema);
+  result_tile.init_attr_tile(field_name, true, false);
+
+  ResultTile::TileTuple* const tile_tuple = result_tile.tile_tuple(field_name);
+  Tile* const tile = &tile_tuple->var_tile();
+
+  std::string data = "alicebobcraigdaveerinfrankgraceheidiivanjudy";
+  std::vector<uint64_t> offsets = {0, 5, 8, 13, 17, 21, 26, 31, 36, 40};
+
+  REQUIRE(tile->init_unfiltered(
+                  constants::format_version,
+                  type,
+                  data.size(),
+                  constants::var_num,
+                  0)
+              .ok());
+
+  REQUIRE(tile->write(data.c_str(), 0, data.size()).ok());
+
+  // Write the tile offsets.
+  Tile* const tile_offsets = &tile_tuple->fixed_tile();
+  REQUIRE(tile_offsets
+              ->init_unfiltered(
+                  constants::format_version,
+                  constants::cell_var_offset_type,
+                  10 * constants::cell_var_offset_size,
+                  constants::cell_var_offset_size,
+                  0)
+              .ok());
+
+  REQUIRE(
+      tile_offsets->write(offsets.data(), 0, cells * sizeof(uint64_t)).ok());
+
+  // Construct query conditions `foo IN ("bob", "dave", "ivan", "bo", "")`
+  // and `foo NOT IN ("bob", "dave", "ivan", "bo", "")`.
+  std::string members = "bobdaveivanbo";
+  std::vector<uint64_t> member_offsets = {0, 3, 7, 11, 13};
+  std::vector<TestParams> tp_vec;
+  for (auto op : {QueryConditionOp::IN, QueryConditionOp::NOT_IN}) {
+    QueryCondition query_condition;
+    REQUIRE(query_condition
+                .init_set_membership(
+                    std::string(field_name),
+                    members.data(),
+                    members.size(),
+                    member_offsets.data(),
+                    member_offsets.size() * sizeof(uint64_t),
+                    op)
+                .ok());
+    REQUIRE(query_condition.check(array_schema).ok());
+
+    std::vector<uint8_t> expected_bitmap = {0, 1, 0, 1, 0, 0, 0, 0, 1, 0};
+    std::vector<ResultCellSlab> expected_slabs = {
+        {&result_tile, 1, 1}, {&result_tile, 3, 1}, {&result_tile, 8, 1}};
+    if (op == QueryConditionOp::NOT_IN) {
+      expected_bitmap = {1, 0, 1, 0, 1, 1, 1, 1, 0, 1};
+      expected_slabs = {
+          {&result_tile, 0, 1},
+          {&result_tile, 2, 1},
+          {&result_tile, 4, 4},
+          {&result_tile, 9, 1}};
+    }
+
+    TestParams tp(
+        std::move(query_condition),
+        std::move(expected_bitmap),
+        std::move(expected_slabs));
+    tp_vec.push_back(tp);
+  }
+
+  SECTION("Validate apply.") {
+    for (auto& elem : tp_vec) {
+      validate_qc_apply(elem, cells, array_schema, result_tile);
+    }
+  }
+
+  SECTION("Validate apply_sparse.") {
+    for (auto& elem : tp_vec) {
+      validate_qc_apply_sparse(elem, cells, array_schema, result_tile);
+    }
+  }
+
+  SECTION("Validate apply_dense.") {
+    for (auto& elem : tp_vec) {
+      validate_qc_apply_dense(elem, cells, array_schema, result_tile);
+    }
+  }
+}
+
 /**
  * @brief Function that takes a selection of QueryConditions, with their
  * expected results, and combines them together. This function is
@@ -4516,4 +4943,78 @@ TEST_CASE(
       ++expected_iter;
     }
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE(
+    "QueryCondition: Test always satisfied",
+    "[QueryCondition][always_satisfied]") {
+  // Initialize the array schema.
+  ArraySchema array_schema;
+  Attribute attr("a", Datatype::INT32);
+  REQUIRE(
+      array_schema.add_attribute(make_shared<Attribute>(HERE(), &attr)).ok());
+  Domain domain;
+  Dimension dim("d", Datatype::UINT64);
+  uint64_t bounds[2] = {1, 100};
+  Range range(bounds, 2 * sizeof(uint64_t));
+  REQUIRE(dim.set_domain(range).ok());
+  REQUIRE(domain.add_dimension(make_shared<Dimension>(HERE(), &dim)).ok());
+  REQUIRE(array_schema.set_domain(make_shared<Domain>(HERE(), &domain)).ok());
+
+  // The attribute values are within [10, 20], the dimension range is unknown.
+  int32_t min = 10, max = 20;
+  auto field_range = [&](const std::string& field_name)
+      -> optional<std::pair<const void*, const void*>> {
+    if (field_name == "a") {
+      return std::pair<const void*, const void*>(&min, &max);
+    }
+    return nullopt;
+  };
+
+  auto make_condition = [](const std::string& field_name,
+                           int32_t val,
+                           QueryConditionOp op) {
+    QueryCondition query_condition;
+    REQUIRE(query_condition
+                .init(std::string(field_name), &val, sizeof(int32_t), op)
+                .ok());
+    return query_condition;
+  };
+
+  CHECK(make_condition("a", 5, QueryConditionOp::GT)
+            .always_satisfied(array_schema, field_range));
+  CHECK(make_condition("a", 10, QueryConditionOp::GE)
+            .always_satisfied(array_schema, field_range));
+  CHECK(make_condition("a", 21, QueryConditionOp::LT)
+            .always_satisfied(array_schema, field_range));
+  CHECK(make_condition("a", 20, QueryConditionOp::LE)
+            .always_satisfied(array_schema, field_range));
+  CHECK(make_condition("a", 30, QueryConditionOp::NE)
+            .always_satisfied(array_schema, field_range));
+  CHECK(!make_condition("a", 15, QueryConditionOp::NE)
+             .always_satisfied(array_schema, field_range));
+  CHECK(!make_condition("a", 10, QueryConditionOp::GT)
+             .always_satisfied(array_schema, field_range));
+  CHECK(!make_condition("a", 15, QueryConditionOp::EQ)
+             .always_satisfied(array_schema, field_range));
+  CHECK(!make_condition("d", 15, QueryConditionOp::NE)
+             .always_satisfied(array_schema, field_range));
+
+  // Combinations.
+  QueryCondition combined;
+  REQUIRE(make_condition("a", 5, QueryConditionOp::GT)
+              .combine(
+                  make_condition("a", 15, QueryConditionOp::LT),
+                  QueryConditionCombinationOp::OR,
+                  &combined)
+              .ok());
+  CHECK(combined.always_satisfied(array_schema, field_range));
+
+  REQUIRE(make_condition("a", 5, QueryConditionOp::GT)
+              .combine(
+                  make_condition("a", 15, QueryConditionOp::LT),
+                  QueryConditionCombinationOp::AND,
+                  &combined)
+              .ok());
+  CHECK(!combined.always_satisfied(array_schema, field_range));
+}
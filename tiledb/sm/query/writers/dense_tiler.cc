@@ -519,6 +519,17 @@ Status DenseTiler<T>::copy_tile(
   auto dim_num = (int64_t)dim_ranges.size();
   assert(dim_num > 0);
 
+  // Check once that all the slabs fit in the tile, so that the copy loop
+  // can write to the tile data directly
+  auto tile_end = tile_offset + copy_nbytes;
+  for (int64_t i = 0; i < dim_num; ++i)
+    tile_end += (dim_ranges[i][1] - dim_ranges[i][0]) *
+                tile_strides_nbytes[i + first_d];
+  if (tile_end > tile.size())
+    return LOG_STATUS(Status_DenseTilerError(
+        "Cannot copy tile; Copy plan exceeds the tile size"));
+  auto tile_buff = static_cast<uint8_t*>(tile.data());
+
   // Auxiliary information needed in the copy loop
   std::vector<uint64_t> tile_offsets(dim_num);
   for (int64_t i = 0; i < dim_num; ++i)
@@ -530,15 +541,26 @@ Status DenseTiler<T>::copy_tile(
   for (int64_t i = 0; i < dim_num; ++i)
     cell_coords[i] = dim_ranges[i][0];
 
-  // Perform the tile copy (always in row-major order)
+  // The slabs along the innermost dimension of the copy loop are copied
+  // in a tight loop
   auto d = dim_num - 1;
+  const auto slab_num = dim_ranges[d][1] - dim_ranges[d][0] + 1;
+  const auto tile_slab_stride = tile_strides_nbytes[d + first_d];
+  const auto sub_slab_stride = sub_strides_nbytes[d + first_d];
+
+  // Perform the tile copy (always in row-major order)
   while (true) {
-    // Copy a slab
-    RETURN_NOT_OK(
-        tile.write(&buff[sub_offsets[d]], tile_offsets[d], copy_nbytes));
+    // Copy the slabs of the innermost dimension
+    copy_slabs(
+        &buff[sub_offsets[d]],
+        sub_slab_stride,
+        &tile_buff[tile_offsets[d]],
+        tile_slab_stride,
+        copy_nbytes,
+        slab_num);
 
     // Advance cell coordinates, tile and buffer offsets
-    auto last_dim_changed = d;
+    auto last_dim_changed = d - 1;
     for (; last_dim_changed >= 0; --last_dim_changed) {
       ++cell_coords[last_dim_changed];
       if (cell_coords[last_dim_changed] > dim_ranges[last_dim_changed][1])
@@ -565,6 +587,41 @@ Status DenseTiler<T>::copy_tile(
   return Status::Ok();
 }
 
+template <class T>
+void DenseTiler<T>::copy_slabs(
+    const uint8_t* src,
+    uint64_t src_stride,
+    uint8_t* dst,
+    uint64_t dst_stride,
+    uint64_t slab_nbytes,
+    uint64_t slab_num) {
+  // Contiguous slabs on both sides, copy them at once
+  if (src_stride == slab_nbytes && dst_stride == slab_nbytes) {
+    std::memcpy(dst, src, slab_num * slab_nbytes);
+    return;
+  }
+
+  // Single cells of the common sizes are copied with fixed size copies
+  switch (slab_nbytes) {
+    case 1:
+      for (uint64_t i = 0; i < slab_num; ++i)
+        dst[i * dst_stride] = src[i * src_stride];
+      return;
+    case 2:
+      copy_fixed_slabs<2>(src, src_stride, dst, dst_stride, slab_num);
+      return;
+    case 4:
+      copy_fixed_slabs<4>(src, src_stride, dst, dst_stride, slab_num);
+      return;
+    case 8:
+      copy_fixed_slabs<8>(src, src_stride, dst, dst_stride, slab_num);
+      return;
+    default:
+      for (uint64_t i = 0; i < slab_num; ++i)
+        std::memcpy(dst + i * dst_stride, src + i * src_stride, slab_nbytes);
+  }
+}
+
 // Explicit template instantiations
 template class DenseTiler<int8_t>;
 template class DenseTiler<uint8_t>;
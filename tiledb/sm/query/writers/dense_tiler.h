@@ -34,6 +34,7 @@
 #define TILEDB_DENSE_TILER_H
 
 #include <atomic>
+#include <cstring>
 #include <functional>
 #include <unordered_map>
 
@@ -319,6 +320,40 @@ class DenseTiler {
    */
   Status copy_tile(
       uint64_t id, uint64_t cell_size, uint8_t* buff, Tile& tile) const;
+
+  /**
+   * Copies `slab_num` slabs of `slab_nbytes` bytes from `src` to `dst`,
+   * advancing by the input strides after each slab.
+   *
+   * @param src The buffer to copy from.
+   * @param src_stride The number of bytes between two slabs in `src`.
+   * @param dst The buffer to copy to.
+   * @param dst_stride The number of bytes between two slabs in `dst`.
+   * @param slab_nbytes The number of bytes in a slab.
+   * @param slab_num The number of slabs to copy.
+   */
+  static void copy_slabs(
+      const uint8_t* src,
+      uint64_t src_stride,
+      uint8_t* dst,
+      uint64_t dst_stride,
+      uint64_t slab_nbytes,
+      uint64_t slab_num);
+
+  /**
+   * Copies `slab_num` slabs of a fixed number of bytes, known at compile
+   * time, so that each slab copy is a single load and store.
+   */
+  template <uint64_t N>
+  static void copy_fixed_slabs(
+      const uint8_t* src,
+      uint64_t src_stride,
+      uint8_t* dst,
+      uint64_t dst_stride,
+      uint64_t slab_num) {
+    for (uint64_t i = 0; i < slab_num; ++i)
+      std::memcpy(dst + i * dst_stride, src + i * src_stride, N);
+  }
 };
 
 }  // namespace sm
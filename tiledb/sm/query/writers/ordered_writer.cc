@@ -211,84 +211,40 @@ Status OrderedWriter::ordered_write() {
   auto attr_num = buffers_.size();
   auto compute_tp = storage_manager_->compute_tp();
   auto thread_num = compute_tp->concurrency_level();
-  std::unordered_map<std::string, std::vector<WriterTileVector>> tiles;
+  std::vector<std::string> names;
+  names.reserve(attr_num);
   for (const auto& buff : buffers_) {
-    tiles.emplace(buff.first, std::vector<WriterTileVector>());
+    names.emplace_back(buff.first);
   }
-
-  if (attr_num > tile_num) {  // Parallelize over attributes
-    auto st = parallel_for(compute_tp, 0, attr_num, [&](uint64_t i) {
-      auto buff_it = buffers_.begin();
-      std::advance(buff_it, i);
-      const auto& attr = buff_it->first;
-      auto& attr_tile_batches = tiles[attr];
-      return prepare_filter_and_write_tiles<T>(
-          attr, attr_tile_batches, frag_meta, &dense_tiler, 1);
-    });
-    RETURN_NOT_OK_ELSE(st, storage_manager_->vfs()->remove_dir(uri));
-  } else {  // Parallelize over tiles
-    for (const auto& buff : buffers_) {
-      const auto& attr = buff.first;
-      auto& attr_tile_batches = tiles[attr];
-      try {
-        RETURN_NOT_OK_ELSE(
-            prepare_filter_and_write_tiles<T>(
-                attr, attr_tile_batches, frag_meta, &dense_tiler, thread_num),
-            storage_manager_->vfs()->remove_dir(uri));
-      } catch (const std::logic_error& le) {
-        storage_manager_->vfs()->remove_dir(uri);
-        return Status_WriterError(le.what());
-      }
-    }
+  std::vector<std::vector<WriterTileVector>> tiles(attr_num);
+  try {
+    RETURN_NOT_OK_ELSE(
+        prepare_filter_and_write_tiles<T>(
+            names, tiles, frag_meta, &dense_tiler, thread_num),
+        storage_manager_->vfs()->remove_dir(uri));
+  } catch (const std::logic_error& le) {
+    storage_manager_->vfs()->remove_dir(uri);
+    return Status_WriterError(le.what());
   }
 
   // Fix the tile metadata for var size attributes.
-  if (attr_num > tile_num) {  // Parallelize over attributes
-    auto st = parallel_for(compute_tp, 0, attr_num, [&](uint64_t i) {
-      auto buff_it = buffers_.begin();
-      std::advance(buff_it, i);
-      const auto& attr = buff_it->first;
-      const auto var_size = array_schema_.var_size(attr);
-      if (has_min_max_metadata(attr, var_size) &&
-          array_schema_.var_size(attr)) {
-        auto& attr_tile_batches = tiles[attr];
-        frag_meta->convert_tile_min_max_var_sizes_to_offsets(attr);
-        for (auto& batch : attr_tile_batches) {
-          uint64_t idx = 0;
-          for (auto& tile : batch) {
-            frag_meta->set_tile_min_var(attr, idx, tile.min());
-            frag_meta->set_tile_max_var(attr, idx, tile.max());
-            idx++;
-          }
+  auto status = parallel_for(compute_tp, 0, attr_num, [&](uint64_t a) {
+    const auto& attr = names[a];
+    const auto var_size = array_schema_.var_size(attr);
+    if (has_min_max_metadata(attr, var_size) && var_size) {
+      frag_meta->convert_tile_min_max_var_sizes_to_offsets(attr);
+      uint64_t idx = 0;
+      for (auto& batch : tiles[a]) {
+        for (auto& tile : batch) {
+          frag_meta->set_tile_min_var(attr, idx, tile.min());
+          frag_meta->set_tile_max_var(attr, idx, tile.max());
+          idx++;
         }
       }
-      return Status::Ok();
-    });
-    RETURN_NOT_OK_ELSE(st, storage_manager_->vfs()->remove_dir(uri));
-  } else {  // Parallelize over tiles
-    for (const auto& buff : buffers_) {
-      const auto& attr = buff.first;
-      auto& attr_tile_batches = tiles[attr];
-      const auto var_size = array_schema_.var_size(attr);
-      if (has_min_max_metadata(attr, var_size) &&
-          array_schema_.var_size(attr)) {
-        frag_meta->convert_tile_min_max_var_sizes_to_offsets(attr);
-        auto st = parallel_for(
-            compute_tp, 0, attr_tile_batches.size(), [&](uint64_t b) {
-              const auto& attr = buff.first;
-              auto& batch = tiles[attr][b];
-              auto idx = b * thread_num;
-              for (auto& tile : batch) {
-                frag_meta->set_tile_min_var(attr, idx, tile.min());
-                frag_meta->set_tile_max_var(attr, idx, tile.max());
-                idx++;
-              }
-              return Status::Ok();
-            });
-        RETURN_NOT_OK_ELSE(st, storage_manager_->vfs()->remove_dir(uri));
-      }
     }
-  }
+    return Status::Ok();
+  });
+  RETURN_NOT_OK_ELSE(status, storage_manager_->vfs()->remove_dir(uri));
 
   // Compute fragment min/max/sum/null count
   RETURN_NOT_OK_ELSE(
@@ -316,58 +272,76 @@ Status OrderedWriter::ordered_write() {
 
 template <class T>
 Status OrderedWriter::prepare_filter_and_write_tiles(
-    const std::string& name,
-    std::vector<WriterTileVector>& tile_batches,
+    const std::vector<std::string>& names,
+    std::vector<std::vector<WriterTileVector>>& tile_batches,
     shared_ptr<FragmentMetadata> frag_meta,
     DenseTiler<T>* dense_tiler,
     uint64_t thread_num) {
   auto timer_se = stats_->start_timer("prepare_filter_and_write_tiles");
 
   // For easy reference
-  const auto type = array_schema_.type(name);
-  const auto is_dim = array_schema_.is_dim(name);
-  const bool var = array_schema_.var_size(name);
-  const auto cell_size = array_schema_.cell_size(name);
-  const auto cell_val_num = array_schema_.cell_val_num(name);
-  const bool nullable = array_schema_.is_nullable(name);
-
-  // Initialization
+  const uint64_t attr_num = names.size();
+  std::vector<Datatype> types(attr_num);
+  std::vector<bool> is_dims(attr_num), vars(attr_num), nullables(attr_num);
+  std::vector<uint64_t> cell_sizes(attr_num);
+  std::vector<unsigned> cell_val_nums(attr_num);
+  for (uint64_t a = 0; a < attr_num; ++a) {
+    types[a] = array_schema_.type(names[a]);
+    is_dims[a] = array_schema_.is_dim(names[a]);
+    vars[a] = array_schema_.var_size(names[a]);
+    cell_sizes[a] = array_schema_.cell_size(names[a]);
+    cell_val_nums[a] = array_schema_.cell_val_num(names[a]);
+    nullables[a] = array_schema_.is_nullable(names[a]);
+  }
+
+  // Initialization. A batch holds enough tiles to give at least
+  // `thread_num` (tile, attribute) pairs to process in parallel.
   auto tile_num = dense_tiler->tile_num();
   assert(tile_num > 0);
-  uint64_t batch_num = tile_num / thread_num;
-  uint64_t last_batch_size = tile_num % thread_num;
-  batch_num += (last_batch_size > 0);
-  last_batch_size = (last_batch_size == 0) ? thread_num : last_batch_size;
+  const uint64_t batch_tile_num =
+      std::max<uint64_t>(1, (thread_num + attr_num - 1) / attr_num);
+  const uint64_t batch_num = (tile_num + batch_tile_num - 1) / batch_tile_num;
+  for (auto& attr_tile_batches : tile_batches) {
+    attr_tile_batches.resize(batch_num);
+  }
 
   // Process batches
   uint64_t frag_tile_id = 0;
-  bool close_files = false;
-  tile_batches.resize(batch_num);
   for (uint64_t b = 0; b < batch_num; ++b) {
-    auto batch_size = (b == batch_num - 1) ? last_batch_size : thread_num;
+    auto batch_size = std::min(batch_tile_num, tile_num - frag_tile_id);
     assert(batch_size > 0);
-    tile_batches[b].reserve(batch_size);
-    for (uint64_t i = 0; i < batch_size; i++) {
-      tile_batches[b].emplace_back(WriterTile(
-          array_schema_,
-          coords_info_.has_coords_,
-          var,
-          nullable,
-          cell_size,
-          type));
+    for (uint64_t a = 0; a < attr_num; ++a) {
+      auto& batch = tile_batches[a][b];
+      batch.reserve(batch_size);
+      for (uint64_t i = 0; i < batch_size; i++) {
+        batch.emplace_back(WriterTile(
+            array_schema_,
+            coords_info_.has_coords_,
+            vars[a],
+            nullables[a],
+            cell_sizes[a],
+            types[a]));
+      }
     }
+
+    // Prepare and filter the tiles of all attributes in parallel
     auto st = parallel_for(
-        storage_manager_->compute_tp(), 0, batch_size, [&](uint64_t i) {
-          // Prepare and filter tiles
-          auto& writer_tile = tile_batches[b][i];
+        storage_manager_->compute_tp(),
+        0,
+        attr_num * batch_size,
+        [&](uint64_t p) {
+          const auto a = p / batch_size;
+          const auto i = p % batch_size;
+          const auto& name = names[a];
+          auto& writer_tile = tile_batches[a][b][i];
           TileMetadataGenerator md_generator(
-              type, is_dim, var, cell_size, cell_val_num);
+              types[a], is_dims[a], vars[a], cell_sizes[a], cell_val_nums[a]);
 
           RETURN_NOT_OK(
               dense_tiler->get_tile(frag_tile_id + i, name, writer_tile));
           md_generator.process_tile(writer_tile);
 
-          if (!var) {
+          if (!vars[a]) {
             RETURN_NOT_OK(filter_tile(
                 name, &writer_tile.fixed_tile(), nullptr, false, false));
           } else {
@@ -376,7 +350,7 @@ Status OrderedWriter::prepare_filter_and_write_tiles(
                 name, &writer_tile.var_tile(), offset_tile, false, false));
             RETURN_NOT_OK(filter_tile(name, offset_tile, nullptr, true, false));
           }
-          if (nullable) {
+          if (nullables[a]) {
             RETURN_NOT_OK(filter_tile(
                 name, &writer_tile.validity_tile(), nullptr, false, true));
           }
@@ -385,9 +359,17 @@ Status OrderedWriter::prepare_filter_and_write_tiles(
     RETURN_NOT_OK(st);
 
     // Write tiles
-    close_files = (b == batch_num - 1);
-    RETURN_NOT_OK(write_tiles(
-        name, frag_meta, frag_tile_id, &tile_batches[b], close_files));
+    const bool close_files = (b == batch_num - 1);
+    st = parallel_for(
+        storage_manager_->compute_tp(), 0, attr_num, [&](uint64_t a) {
+          return write_tiles(
+              names[a],
+              frag_meta,
+              frag_tile_id,
+              &tile_batches[a][b],
+              close_files);
+        });
+    RETURN_NOT_OK(st);
 
     frag_tile_id += batch_size;
   }
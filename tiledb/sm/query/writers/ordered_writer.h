@@ -110,20 +110,21 @@ class OrderedWriter : public WriterBase {
   Status ordered_write();
 
   /**
-   * Prepares, filters and writes dense tiles for the given attribute.
+   * Prepares, filters and writes dense tiles for the given attributes. The
+   * tiles are processed in batches, and the (tile, attribute) pairs of a
+   * batch are processed in parallel.
    *
    * @tparam T The array domain datatype.
-   * @param name The attribute name.
-   * @param tile_batches The attribute tile batches.
+   * @param names The attribute names.
+   * @param tile_batches The tile batches, for each attribute.
    * @param frag_meta The metadata of the new fragment.
    * @param dense_tiler The dense tiler that will prepare the tiles.
    * @param thread_num The number of threads to be used for the function.
-   * @param stats Statistics to gather in the function.
    */
   template <class T>
   Status prepare_filter_and_write_tiles(
-      const std::string& name,
-      std::vector<WriterTileVector>& tile_batches,
+      const std::vector<std::string>& names,
+      std::vector<std::vector<WriterTileVector>>& tile_batches,
       shared_ptr<FragmentMetadata> frag_meta,
       DenseTiler<T>* dense_tiler,
       uint64_t thread_num);
@@ -34,6 +34,7 @@
 #include "tiledb/common/common.h"
 #include "tiledb/common/heap_memory.h"
 #include "tiledb/common/logger.h"
+#include "tiledb/common/scoped_executor.h"
 #include "tiledb/sm/array/array.h"
 #include "tiledb/sm/array_schema/array_schema.h"
 #include "tiledb/sm/array_schema/dimension.h"
@@ -61,6 +62,13 @@ using namespace tiledb::sm::stats;
 namespace tiledb {
 namespace sm {
 
+class UnorderedWriterStatusException : public StatusException {
+ public:
+  explicit UnorderedWriterStatusException(const std::string& message)
+      : StatusException("UnorderedWriter", message) {
+  }
+};
+
 /* ****************************** */
 /*   CONSTRUCTORS & DESTRUCTORS   */
 /* ****************************** */
@@ -91,7 +99,24 @@ UnorderedWriter::UnorderedWriter(
           false,
           coords_info,
           fragment_uri,
-          skip_checks_serialization) {
+          skip_checks_serialization)
+    , persist_hilbert_values_(false)
+    , hilbert_values_size_(0) {
+  bool found = false;
+  if (!config_
+           .get<bool>(
+               "sm.persist_hilbert_values", &persist_hilbert_values_, &found)
+           .ok()) {
+    throw UnorderedWriterStatusException("Cannot get setting");
+  }
+  assert(found);
+
+  // Hilbert values are stored only for Hilbert cell order, and only in
+  // fragments with a format version that supports them.
+  persist_hilbert_values_ =
+      persist_hilbert_values_ &&
+      array_schema_.cell_order() == Layout::HILBERT &&
+      array_schema_.write_version() >= constants::hilbert_values_min_version;
 }
 
 UnorderedWriter::~UnorderedWriter() {
@@ -571,7 +596,7 @@ Status UnorderedWriter::prepare_tiles_var(
   return Status::Ok();
 }
 
-Status UnorderedWriter::sort_coords(std::vector<uint64_t>& cell_pos) const {
+Status UnorderedWriter::sort_coords(std::vector<uint64_t>& cell_pos) {
   auto timer_se = stats_->start_timer("sort_coords");
 
   // Populate cell_pos
@@ -590,13 +615,13 @@ Status UnorderedWriter::sort_coords(std::vector<uint64_t>& cell_pos) const {
         cell_pos.end(),
         GlobalCmpQB(domain, domain_buffs));
   } else {  // Hilbert order
-    std::vector<uint64_t> hilbert_values(coords_info_.coords_num_);
-    RETURN_NOT_OK(calculate_hilbert_values(domain_buffs, hilbert_values));
+    hilbert_values_.resize(coords_info_.coords_num_);
+    RETURN_NOT_OK(calculate_hilbert_values(domain_buffs, hilbert_values_));
     parallel_sort(
         storage_manager_->compute_tp(),
         cell_pos.begin(),
         cell_pos.end(),
-        HilbertCmpQB(domain, domain_buffs, hilbert_values));
+        HilbertCmpQB(domain, domain_buffs, hilbert_values_));
   }
 
   return Status::Ok();
@@ -609,8 +634,23 @@ Status UnorderedWriter::unordered_write() {
 
   // Sort coordinates first
   std::vector<uint64_t> cell_pos;
+  ScopedExecutor clear_hilbert_values([this]() {
+    buffers_.erase(constants::hilbert_values);
+    hilbert_values_.clear();
+    hilbert_values_.shrink_to_fit();
+  });
   RETURN_CANCEL_OR_ERROR(sort_coords(cell_pos));
 
+  // The Hilbert values computed for sorting are written like any other
+  // attribute, through an internal buffer that is removed once done.
+  if (persist_hilbert_values_) {
+    hilbert_values_size_ = hilbert_values_.size() * sizeof(uint64_t);
+    QueryBuffer buff;
+    buff.buffer_ = hilbert_values_.data();
+    buff.buffer_size_ = &hilbert_values_size_;
+    buffers_[constants::hilbert_values] = std::move(buff);
+  }
+
   // Check for coordinate duplicates
   RETURN_CANCEL_OR_ERROR(check_coord_dups(cell_pos));
 
@@ -90,6 +90,21 @@ class UnorderedWriter : public WriterBase {
   /*         PRIVATE ATTRIBUTES        */
   /* ********************************* */
 
+  /**
+   * True if the Hilbert values of the cells are stored with the fragment.
+   * Applicable only to arrays with Hilbert cell order.
+   */
+  bool persist_hilbert_values_;
+
+  /**
+   * The Hilbert values of the cells in the user buffers, computed when
+   * sorting the coordinates in Hilbert cell order.
+   */
+  std::vector<uint64_t> hilbert_values_;
+
+  /** The size in bytes of `hilbert_values_`, used by its query buffer. */
+  uint64_t hilbert_values_size_;
+
   /* ********************************* */
   /*           PRIVATE METHODS         */
   /* ********************************* */
@@ -202,12 +217,13 @@ class UnorderedWriter : public WriterBase {
 
   /**
    * Sorts the coordinates of the user buffers, creating a vector with
-   * the sorted positions.
+   * the sorted positions. For Hilbert cell order, this also computes
+   * `hilbert_values_`.
    *
    * @param cell_pos The sorted cell positions to be created.
    * @return Status
    */
-  Status sort_coords(std::vector<uint64_t>& cell_pos) const;
+  Status sort_coords(std::vector<uint64_t>& cell_pos);
 
   /**
    * Writes in unordered layout. Applicable to both dense and sparse arrays.
@@ -102,6 +102,7 @@ WriterBase::WriterBase(
     , check_coord_oob_(false)
     , check_global_order_(false)
     , dedup_coords_(false)
+    , bloom_filter_bits_per_cell_(0)
     , written_fragment_info_(written_fragment_info) {
   fragment_uri_ = fragment_uri;
 
@@ -183,6 +184,16 @@ WriterBase::WriterBase(
         "configuration");
   }
 
+  if (!config_
+           .get<uint64_t>(
+               "sm.bloom_filter_bits_per_cell",
+               &bloom_filter_bits_per_cell_,
+               &found)
+           .ok()) {
+    throw WriterBaseStatusException("Cannot get setting");
+  }
+  assert(found);
+
   // Set a default subarray
   if (!subarray_.is_set()) {
     subarray_ = Subarray(array_, layout_, stats_, logger_);
@@ -308,20 +319,26 @@ Status WriterBase::calculate_hilbert_values(
   auto bits = h.bits();
   auto max_bucket_val = ((uint64_t)1 << bits) - 1;
 
-  // Calculate Hilbert values in parallel
+  // Calculate Hilbert values in parallel, one batch of cells per task so
+  // that the conversion itself runs on whole blocks of coordinates.
   assert(hilbert_values.size() >= coords_info_.coords_num_);
+  const uint64_t batch_size = Hilbert::HC_BATCH_SIZE;
+  const uint64_t batch_num =
+      (coords_info_.coords_num_ + batch_size - 1) / batch_size;
   auto status = parallel_for(
-      storage_manager_->compute_tp(),
-      0,
-      coords_info_.coords_num_,
-      [&](uint64_t c) {
-        std::vector<uint64_t> coords(dim_num);
+      storage_manager_->compute_tp(), 0, batch_num, [&](uint64_t b) {
+        const uint64_t start = b * batch_size;
+        const uint64_t len =
+            std::min(batch_size, coords_info_.coords_num_ - start);
+        uint64_t coords[Hilbert::HC_MAX_DIM * Hilbert::HC_BATCH_SIZE];
         for (uint32_t d = 0; d < dim_num; ++d) {
           auto dim{array_schema_.dimension_ptr(d)};
-          coords[d] = hilbert_order::map_to_uint64(
-              *dim, domain_buffers[d], c, bits, max_bucket_val);
+          for (uint64_t i = 0; i < len; ++i) {
+            coords[d * len + i] = hilbert_order::map_to_uint64(
+                *dim, domain_buffers[d], start + i, bits, max_bucket_val);
+          }
         }
-        hilbert_values[c] = h.coords_to_hilbert(&coords[0]);
+        h.coords_to_hilbert(coords, len, &hilbert_values[start]);
 
         return Status::Ok();
       });
@@ -560,6 +577,8 @@ Status WriterBase::compute_tiles_metadata(
     std::unordered_map<std::string, WriterTileVector>& tiles) const {
   auto attr_num = buffers_.size();
   auto compute_tp = storage_manager_->compute_tp();
+  const auto bloom_filter_bits_per_cell =
+      coords_info_.has_coords_ ? bloom_filter_bits_per_cell_ : 0;
 
   // Parallelize over attributes?
   if (attr_num > tile_num) {
@@ -574,7 +593,12 @@ Status WriterBase::compute_tiles_metadata(
       const auto cell_size = array_schema_.cell_size(attr);
       const auto cell_val_num = array_schema_.cell_val_num(attr);
       TileMetadataGenerator md_generator(
-          type, is_dim, var_size, cell_size, cell_val_num);
+          type,
+          is_dim,
+          var_size,
+          cell_size,
+          cell_val_num,
+          bloom_filter_bits_per_cell);
       for (auto& tile : attr_tiles) {
         md_generator.process_tile(tile);
       }
@@ -593,7 +617,12 @@ Status WriterBase::compute_tiles_metadata(
       const auto cell_val_num = array_schema_.cell_val_num(attr);
       auto st = parallel_for(compute_tp, 0, tile_num, [&](uint64_t t) {
         TileMetadataGenerator md_generator(
-            type, is_dim, var_size, cell_size, cell_val_num);
+            type,
+            is_dim,
+            var_size,
+            cell_size,
+            cell_val_num,
+            bloom_filter_bits_per_cell);
         md_generator.process_tile(attr_tiles[t]);
 
         return Status::Ok();
@@ -647,6 +676,8 @@ Status WriterBase::create_fragment(
   const bool has_timestamps = buffers_.count(constants::timestamps) != 0;
   const bool has_delete_metadata =
       buffers_.count(constants::delete_timestamps) != 0;
+  const bool has_hilbert_values =
+      buffers_.count(constants::hilbert_values) != 0;
   frag_meta = make_shared<FragmentMetadata>(
       HERE(),
       storage_manager_,
@@ -656,7 +687,8 @@ Status WriterBase::create_fragment(
       timestamp_range,
       dense,
       has_timestamps,
-      has_delete_metadata);
+      has_delete_metadata,
+      has_hilbert_values);
 
   RETURN_NOT_OK((frag_meta)->init(subarray_.ndrange(0)));
   return storage_manager_->create_dir(uri);
@@ -1021,6 +1053,10 @@ Status WriterBase::write_tiles(
           name, tile_id, t_val.filtered_buffer().size());
       frag_meta->set_tile_null_count(name, tile_id, null_count);
     }
+
+    if (!tile.bloom_filter().empty()) {
+      frag_meta->set_tile_bloom_filter(name, tile_id, tile.bloom_filter());
+    }
   }
 
   // Close files, except in the case of global order
@@ -176,6 +176,12 @@ class WriterBase : public StrategyBase, public IQueryStrategy {
    */
   bool dedup_coords_;
 
+  /**
+   * The number of bits per cell of the per-tile Bloom filters built for
+   * sparse writes, 0 if no Bloom filters are built.
+   */
+  uint64_t bloom_filter_bits_per_cell_;
+
   /** The name of the new fragment to be created. */
   URI fragment_uri_;
 
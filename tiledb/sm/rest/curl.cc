@@ -250,14 +250,90 @@ size_t write_header_callback(
   return size * count;
 }
 
-Curl::Curl(const std::shared_ptr<Logger>& logger)
+CurlHandlePool::CurlHandlePool(const uint64_t max_idle_handles)
+    : max_idle_handles_(max_idle_handles)
+    , share_(curl_share_init()) {
+  if (share_ != nullptr) {
+    curl_share_setopt(share_, CURLSHOPT_LOCKFUNC, share_lock);
+    curl_share_setopt(share_, CURLSHOPT_UNLOCKFUNC, share_unlock);
+    curl_share_setopt(share_, CURLSHOPT_USERDATA, this);
+    curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+  }
+}
+
+CurlHandlePool::~CurlHandlePool() {
+  // The handles must be cleaned up before the share they are attached to.
+  for (auto curl : idle_handles_)
+    curl_easy_cleanup(curl);
+  if (share_ != nullptr)
+    curl_share_cleanup(share_);
+}
+
+CURL* CurlHandlePool::acquire() {
+  {
+    std::unique_lock<std::mutex> lck(mtx_);
+    if (!idle_handles_.empty()) {
+      CURL* curl = idle_handles_.back();
+      idle_handles_.pop_back();
+      return curl;
+    }
+  }
+
+  CURL* curl = curl_easy_init();
+  if (curl != nullptr && share_ != nullptr)
+    curl_easy_setopt(curl, CURLOPT_SHARE, share_);
+  return curl;
+}
+
+void CurlHandlePool::release(CURL* const curl) {
+  if (curl == nullptr)
+    return;
+
+  // Resetting the options keeps the open connections and the shared caches.
+  curl_easy_reset(curl);
+  {
+    std::unique_lock<std::mutex> lck(mtx_);
+    if (idle_handles_.size() < max_idle_handles_) {
+      idle_handles_.push_back(curl);
+      return;
+    }
+  }
+
+  curl_easy_cleanup(curl);
+}
+
+uint64_t CurlHandlePool::idle_handle_num() const {
+  std::unique_lock<std::mutex> lck(mtx_);
+  return idle_handles_.size();
+}
+
+void CurlHandlePool::share_lock(
+    CURL*, curl_lock_data data, curl_lock_access, void* userptr) {
+  static_cast<CurlHandlePool*>(userptr)->share_mtx_[data].lock();
+}
+
+void CurlHandlePool::share_unlock(
+    CURL*, curl_lock_data data, void* userptr) {
+  static_cast<CurlHandlePool*>(userptr)->share_mtx_[data].unlock();
+}
+
+Curl::Curl(
+    const std::shared_ptr<Logger>& logger, CurlHandlePool* const handle_pool)
     : config_(nullptr)
+    , handle_pool_(handle_pool)
     , curl_(nullptr, curl_easy_cleanup)
     , retry_count_(0)
     , retry_delay_factor_(0)
     , retry_initial_delay_ms_(0)
     , logger_(logger->clone("curl ", ++logger_id_))
-    , verbose_(false) {
+    , verbose_(false)
+    , http2_(false) {
+}
+
+Curl::~Curl() {
+  if (handle_pool_ != nullptr)
+    handle_pool_->release(curl_.release());
 }
 
 Status Curl::init(
@@ -270,7 +346,15 @@ Status Curl::init(
         Status_RestError("Error initializing libcurl; config is null."));
 
   config_ = config;
-  curl_.reset(curl_easy_init());
+  if (handle_pool_ != nullptr) {
+    handle_pool_->release(curl_.release());
+    curl_.reset(handle_pool_->acquire());
+  } else {
+    curl_.reset(curl_easy_init());
+  }
+  if (curl_ == nullptr)
+    return LOG_STATUS(Status_RestError(
+        "Error initializing libcurl; failed to create a curl handle"));
   extra_headers_ = extra_headers;
   headerData.redirect_uri_map = res_headers;
   headerData.redirect_uri_map_lock = res_mtx;
@@ -348,6 +432,24 @@ Status Curl::init(
       "rest.curl.buffer_size", &curl_buffer_size_, &found));
   assert(found);
 
+  RETURN_NOT_OK(config_->get<bool>("rest.curl.http2", &http2_, &found));
+  assert(found);
+
+  // Ask for HTTP/2 over TLS, falling back to HTTP/1.1 if the server does not
+  // negotiate it or libcurl was built without HTTP/2 support.
+  if (http2_) {
+    rc = curl_easy_setopt(
+        curl_.get(), CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+    if (rc != CURLE_OK)
+      logger_->warn(
+          "HTTP/2 is not supported by libcurl; falling back to HTTP/1.1");
+  }
+
+  // Pooled handles keep their connections open between requests, so ask the
+  // OS to probe idle connections to keep them alive.
+  if (handle_pool_ != nullptr)
+    curl_easy_setopt(curl_.get(), CURLOPT_TCP_KEEPALIVE, 1L);
+
   return Status::Ok();
 }
 
@@ -557,6 +659,16 @@ Status Curl::make_curl_request_common(
     /* fetch the url */
     CURLcode tmp_curl_code = curl_easy_perform_instrumented(url, i);
 
+    /* record whether the request reused an open connection */
+    long connect_num = 0;
+    if (curl_easy_getinfo(curl, CURLINFO_NUM_CONNECTS, &connect_num) ==
+        CURLE_OK) {
+      if (connect_num > 0)
+        stats->add_counter("rest_http_connections_opened", connect_num);
+      else if (tmp_curl_code == CURLE_OK)
+        stats->add_counter("rest_http_connections_reused", 1);
+    }
+
     bool retry;
     RETURN_NOT_OK(should_retry(&retry));
     /* If Curl call was successful (not http status, but no socket error, etc)
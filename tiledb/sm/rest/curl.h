@@ -46,6 +46,7 @@
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "tiledb/common/dynamic_memory/dynamic_memory.h"
 #include "tiledb/common/logger_public.h"
@@ -98,13 +99,92 @@ struct HeaderCbData {
 size_t write_header_callback(
     void* res_data, size_t size, size_t count, void* userdata);
 
+/**
+ * A threadsafe pool of reusable libcurl easy handles.
+ *
+ * A handle returned to the pool keeps its open connections, so a later
+ * request to the same server can skip the TCP and TLS handshakes. All the
+ * handles created by the pool also share a DNS cache and a TLS session cache
+ * through a `curl_share` object, so a handle opening a new connection can
+ * still resume an earlier TLS session.
+ *
+ * The connection cache itself is not shared between handles, because libcurl
+ * does not support using a shared connection cache from concurrent threads.
+ */
+class CurlHandlePool {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param max_idle_handles The maximum number of idle handles kept in the
+   *     pool. Handles released when the pool is full are cleaned up, which
+   *     closes their connections.
+   */
+  explicit CurlHandlePool(uint64_t max_idle_handles);
+
+  /** Destructor. */
+  ~CurlHandlePool();
+
+  DISABLE_COPY_AND_COPY_ASSIGN(CurlHandlePool);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(CurlHandlePool);
+
+  /**
+   * Returns an idle handle from the pool, or a new handle if the pool is
+   * empty. Apart from the shared caches, returned handles have all their
+   * options at the defaults. May return `nullptr` if a new handle cannot be
+   * created.
+   */
+  CURL* acquire();
+
+  /**
+   * Returns a handle to the pool. The options of the handle are reset, so
+   * that it keeps no pointers to the state of the previous request.
+   */
+  void release(CURL* curl);
+
+  /** Returns the number of idle handles in the pool. */
+  uint64_t idle_handle_num() const;
+
+ private:
+  /** The maximum number of idle handles kept in the pool. */
+  const uint64_t max_idle_handles_;
+
+  /** The DNS and TLS session caches shared by all the handles. */
+  CURLSH* share_;
+
+  /** One mutex per type of data shared through `share_`. */
+  std::mutex share_mtx_[CURL_LOCK_DATA_LAST];
+
+  /** The idle handles. */
+  std::vector<CURL*> idle_handles_;
+
+  /** Protects `idle_handles_`. */
+  mutable std::mutex mtx_;
+
+  /** Locks the shared data of the given type, see `CURLSHOPT_LOCKFUNC`. */
+  static void share_lock(
+      CURL* curl, curl_lock_data data, curl_lock_access access, void* userptr);
+
+  /** Unlocks the shared data of the given type, see `CURLSHOPT_UNLOCKFUNC`. */
+  static void share_unlock(CURL* curl, curl_lock_data data, void* userptr);
+};
+
 class Curl {
  public:
-  /** Constructor. */
-  explicit Curl(const std::shared_ptr<Logger>& logger);
+  /**
+   * Constructor.
+   *
+   * @param logger The parent logger.
+   * @param handle_pool The pool to take the curl handle from and return it
+   *     to on destruction. If `nullptr`, a new handle is created and cleaned up
+   *     on destruction.
+   */
+  explicit Curl(
+      const std::shared_ptr<Logger>& logger,
+      CurlHandlePool* handle_pool = nullptr);
 
   /** Destructor. */
-  ~Curl() = default;
+  ~Curl();
 
   DISABLE_COPY_AND_COPY_ASSIGN(Curl);
   DISABLE_MOVE_AND_MOVE_ASSIGN(Curl);
@@ -338,6 +418,9 @@ class Curl {
   /** TileDB config parameters. */
   const Config* config_;
 
+  /** The pool the curl instance is taken from, may be `nullptr`. */
+  CurlHandlePool* handle_pool_;
+
   /** Underlying C curl instance. */
   std::unique_ptr<CURL, decltype(&curl_easy_cleanup)> curl_;
 
@@ -374,6 +457,9 @@ class Curl {
   /** Max curl buffer size for received data. */
   uint64_t curl_buffer_size_;
 
+  /** Whether to negotiate HTTP/2 with the server. */
+  bool http2_;
+
   /**
    * Populates the curl slist with authorization (token or username+password),
    * and any extra headers.
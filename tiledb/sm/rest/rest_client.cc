@@ -113,6 +113,12 @@ Status RestClient::init(
   RETURN_NOT_OK(config_->get<bool>(
       "rest.resubmit_incomplete", &resubmit_incomplete_, &found));
 
+  uint64_t curl_pool_size = 0;
+  RETURN_NOT_OK(config_->get<uint64_t>(
+      "rest.curl.pool_size", &curl_pool_size, &found));
+  assert(found);
+  curl_handle_pool_ = make_shared<CurlHandlePool>(HERE(), curl_pool_size);
+
   return Status::Ok();
 }
 
@@ -125,7 +131,7 @@ Status RestClient::set_header(
 tuple<Status, std::optional<bool>> RestClient::check_array_exists_from_rest(
     const URI& uri) {
   // Init curl and form the URL
-  Curl curlc(logger_);
+  Curl curlc(logger_, curl_handle_pool_.get());
   std::string array_ns, array_uri;
   RETURN_NOT_OK_TUPLE(uri.get_rest_components(&array_ns, &array_uri), nullopt);
   const std::string cache_key = array_ns + ":" + array_uri;
@@ -162,7 +168,7 @@ tuple<Status, std::optional<bool>> RestClient::check_array_exists_from_rest(
 tuple<Status, std::optional<bool>> RestClient::check_group_exists_from_rest(
     const URI& uri) {
   // Init curl and form the URL
-  Curl curlc(logger_);
+  Curl curlc(logger_, curl_handle_pool_.get());
   std::string group_ns, group_uri;
   RETURN_NOT_OK_TUPLE(uri.get_rest_components(&group_ns, &group_uri), nullopt);
   const std::string cache_key = group_ns + ":" + group_uri;
@@ -199,7 +205,7 @@ tuple<Status, std::optional<bool>> RestClient::check_group_exists_from_rest(
 tuple<Status, optional<shared_ptr<ArraySchema>>>
 RestClient::get_array_schema_from_rest(const URI& uri) {
   // Init curl and form the URL
-  Curl curlc(logger_);
+  Curl curlc(logger_, curl_handle_pool_.get());
   std::string array_ns, array_uri;
   RETURN_NOT_OK_TUPLE(uri.get_rest_components(&array_ns, &array_uri), nullopt);
   const std::string cache_key = array_ns + ":" + array_uri;
@@ -249,7 +255,7 @@ Status RestClient::post_array_schema_to_rest(
         creation_access_credentials_name));
 
   // Init curl and form the URL
-  Curl curlc(logger_);
+  Curl curlc(logger_, curl_handle_pool_.get());
   std::string array_ns, array_uri;
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
@@ -282,7 +288,7 @@ Status RestClient::post_array_from_rest(const URI& uri, Array* array) {
   RETURN_NOT_OK(serialized.add_buffer(std::move(buff)));
 
   // Init curl and form the URL
-  Curl curlc(logger_);
+  Curl curlc(logger_, curl_handle_pool_.get());
   std::string array_ns, array_uri;
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
@@ -316,7 +322,7 @@ Status RestClient::post_array_from_rest(const URI& uri, Array* array) {
 
 Status RestClient::deregister_array_from_rest(const URI& uri) {
   // Init curl and form the URL
-  Curl curlc(logger_);
+  Curl curlc(logger_, curl_handle_pool_.get());
   std::string array_ns, array_uri;
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
@@ -340,7 +346,7 @@ Status RestClient::get_array_non_empty_domain(
         "Cannot get array non-empty domain; array URI is empty"));
 
   // Init curl and form the URL
-  Curl curlc(logger_);
+  Curl curlc(logger_, curl_handle_pool_.get());
   std::string array_ns, array_uri;
   RETURN_NOT_OK(array->array_uri().get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
@@ -383,7 +389,7 @@ Status RestClient::get_array_max_buffer_sizes(
       subarray_str.empty() ? "" : ("?subarray=" + subarray_str);
 
   // Init curl and form the URL
-  Curl curlc(logger_);
+  Curl curlc(logger_, curl_handle_pool_.get());
   std::string array_ns, array_uri;
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
@@ -421,7 +427,7 @@ Status RestClient::get_array_metadata_from_rest(
         "Error getting array metadata from REST; array is null."));
 
   // Init curl and form the URL
-  Curl curlc(logger_);
+  Curl curlc(logger_, curl_handle_pool_.get());
   std::string array_ns, array_uri;
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
@@ -464,7 +470,7 @@ Status RestClient::post_array_metadata_to_rest(
   RETURN_NOT_OK(serialized.add_buffer(std::move(buff)));
 
   // Init curl and form the URL
-  Curl curlc(logger_);
+  Curl curlc(logger_, curl_handle_pool_.get());
   std::string array_ns, array_uri;
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
@@ -520,7 +526,7 @@ Status RestClient::post_query_submit(
       query, serialization_type_, true, &serialized));
 
   // Init curl and form the URL
-  Curl curlc(logger_);
+  Curl curlc(logger_, curl_handle_pool_.get());
   std::string array_ns, array_uri;
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
@@ -612,14 +618,44 @@ size_t RestClient::query_post_call_back(
     copy_state->clear();
   }
 
+  // If there is no partial serialized query left from a previous callback,
+  // deserialize the complete serialized queries directly from 'contents',
+  // and only copy the unprocessed bytes at the end into 'scratch'. This
+  // avoids copying every response into 'scratch' when the serialized
+  // queries fit in the libcurl receive buffer.
+  if (scratch->size() == 0 && content_nbytes > 0) {
+    Buffer in_place(contents, content_nbytes);
+    Status st = deserialize_queries(&in_place, query, copy_state);
+
+    // On error, keep all of 'contents' in 'scratch' so that the failed
+    // serialized query can be processed again on resubmission, exactly as
+    // if it had been deserialized from 'scratch'.
+    const uint64_t remaining_offset = st.ok() ? in_place.offset() : 0;
+    scratch->reset_offset();
+    Status write_st = scratch->write(
+        static_cast<char*>(contents) + remaining_offset,
+        content_nbytes - remaining_offset);
+    if (!write_st.ok()) {
+      LOG_ERROR(
+          "Cannot copy libcurl response data; buffer write failed: " +
+          write_st.to_string());
+      return return_wrapper(bytes_processed);
+    }
+
+    if (!st.ok()) {
+      scratch->set_offset(in_place.offset());
+      return return_wrapper(in_place.offset());
+    }
+
+    return return_wrapper(content_nbytes);
+  }
+
   // If the current scratch size is non-empty, we must subtract its size
   // from 'bytes_processed' so that we do not count bytes processed from
   // a previous callback.
   bytes_processed -= scratch->size();
 
-  // Copy 'contents' to the end of 'scratch'. As a future optimization, if
-  // 'scratch' is empty, we could attempt to process 'contents' in-place and
-  // only copy the remaining, unprocessed bytes into 'scratch'.
+  // Copy 'contents' to the end of 'scratch'.
   scratch->set_offset(scratch->size());
   Status st = scratch->write(contents, content_nbytes);
   if (!st.ok()) {
@@ -631,76 +667,21 @@ size_t RestClient::query_post_call_back(
 
   // Process all of the serialized queries contained within 'scratch'.
   scratch->reset_offset();
-  while (scratch->offset() < scratch->size()) {
-    // We need at least 8 bytes to determine the size of the next
-    // serialized query.
-    if (scratch->offset() + 8 > scratch->size()) {
-      break;
-    }
-
-    // Decode the query size. We could cache this from the previous
-    // callback to prevent decoding the same prefix multiple times.
-    const uint64_t query_size =
-        utils::endianness::decode_le<uint64_t>(scratch->cur_data());
-
-    // We must have the full serialized query before attempting to
-    // deserialize it.
-    if (scratch->offset() + 8 + query_size > scratch->size()) {
-      break;
-    }
-
-    // At this point of execution, we know that we the next serialized
-    // query is entirely in 'scratch'. For convenience, we will advance
-    // the offset to point to the start of the serialized query.
-    scratch->advance_offset(8);
-
-    // We can only deserialize the query if it is 8-byte aligned. If the
-    // offset is 8-byte aligned, we can deserialize the query in-place.
-    // Otherwise, we must make a copy to an auxiliary buffer.
-    if (scratch->offset() % 8 != 0) {
-      // Copy the entire serialized buffer to a newly allocated, 8-byte
-      // aligned auxiliary buffer.
-      Buffer aux;
-      st = aux.write(scratch->cur_data(), query_size);
-      if (!st.ok()) {
-        scratch->set_offset(scratch->offset() - 8);
-        return return_wrapper(bytes_processed);
-      }
-
-      // Deserialize the buffer and store it in 'copy_state'. If
-      // the user buffers are too small to accomodate the attribute
-      // data when deserializing read queries, this will return an
-      // error status.
-      aux.reset_offset();
-      st = serialization::query_deserialize(
-          aux, serialization_type_, true, copy_state, query, compute_tp_);
-      if (!st.ok()) {
-        scratch->set_offset(scratch->offset() - 8);
-        return return_wrapper(bytes_processed);
-      }
-    } else {
-      // Deserialize the buffer and store it in 'copy_state'. If
-      // the user buffers are too small to accomodate the attribute
-      // data when deserializing read queries, this will return an
-      // error status.
-      st = serialization::query_deserialize(
-          *scratch, serialization_type_, true, copy_state, query, compute_tp_);
-      if (!st.ok()) {
-        scratch->set_offset(scratch->offset() - 8);
-        return return_wrapper(bytes_processed);
-      }
-    }
-
-    scratch->advance_offset(query_size);
-    bytes_processed += (query_size + 8);
+  st = deserialize_queries(scratch.get(), query, copy_state);
+  bytes_processed += scratch->offset();
+  if (!st.ok()) {
+    return return_wrapper(bytes_processed);
   }
 
   // If there are unprocessed bytes left in the scratch space, copy them
   // to the beginning of 'scratch'. The intent is to reduce memory
   // consumption by overwriting the serialized query objects that we
-  // have already processed.
+  // have already processed. If all the bytes were processed, 'scratch'
+  // is emptied so that they are not processed again by a later callback.
   const uint64_t length = scratch->size() - scratch->offset();
-  if (scratch->offset() != 0 && length != 0) {
+  if (length == 0) {
+    scratch->reset_size();
+  } else if (scratch->offset() != 0) {
     const uint64_t offset = scratch->offset();
     scratch->reset_offset();
 
@@ -738,6 +719,46 @@ size_t RestClient::query_post_call_back(
   return return_wrapper(bytes_processed);
 }
 
+Status RestClient::deserialize_queries(
+    Buffer* const data, Query* query, serialization::CopyState* copy_state) {
+  while (data->offset() < data->size()) {
+    // We need at least 8 bytes to determine the size of the next
+    // serialized query.
+    if (data->offset() + 8 > data->size()) {
+      break;
+    }
+
+    // Decode the query size.
+    const uint64_t query_size =
+        utils::endianness::decode_le<uint64_t>(data->cur_data());
+
+    // We must have the full serialized query before attempting to
+    // deserialize it.
+    if (data->offset() + 8 + query_size > data->size()) {
+      break;
+    }
+
+    // Deserialize the serialized query in place and store it in
+    // 'copy_state'. The serialized query does not need to be 8-byte
+    // aligned, as only its CapnP message is copied to an aligned buffer
+    // while the attribute data is copied directly into the user buffers.
+    // If the user buffers are too small to accomodate the attribute data
+    // when deserializing read queries, this will return an error status
+    // and leave the offset at the start of the serialized query.
+    data->advance_offset(8);
+    const Status st = serialization::query_deserialize(
+        *data, serialization_type_, true, copy_state, query, compute_tp_);
+    if (!st.ok()) {
+      data->set_offset(data->offset() - 8);
+      return st;
+    }
+
+    data->advance_offset(query_size);
+  }
+
+  return Status::Ok();
+}
+
 Status RestClient::finalize_query_to_rest(const URI& uri, Query* query) {
   // Serialize data to send
   BufferList serialized;
@@ -745,7 +766,7 @@ Status RestClient::finalize_query_to_rest(const URI& uri, Query* query) {
       query, serialization_type_, true, &serialized));
 
   // Init curl and form the URL
-  Curl curlc(logger_);
+  Curl curlc(logger_, curl_handle_pool_.get());
   std::string array_ns, array_uri;
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
@@ -902,7 +923,7 @@ Status RestClient::get_query_est_result_sizes(const URI& uri, Query* query) {
       query, serialization_type_, true, &serialized));
 
   // Init curl and form the URL
-  Curl curlc(logger_);
+  Curl curlc(logger_, curl_handle_pool_.get());
   std::string array_ns, array_uri;
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
@@ -957,7 +978,7 @@ Status RestClient::post_array_schema_evolution_to_rest(
   RETURN_NOT_OK(serialized.add_buffer(std::move(buff)));
 
   // Init curl and form the URL
-  Curl curlc(logger_);
+  Curl curlc(logger_, curl_handle_pool_.get());
   std::string array_ns, array_uri;
   RETURN_NOT_OK(uri.get_rest_components(&array_ns, &array_uri));
   const std::string cache_key = array_ns + ":" + array_uri;
@@ -990,7 +1011,7 @@ Status RestClient::post_group_metadata_from_rest(const URI& uri, Group* group) {
   RETURN_NOT_OK(serialized.add_buffer(std::move(buff)));
 
   // Init curl and form the URL
-  Curl curlc(logger_);
+  Curl curlc(logger_, curl_handle_pool_.get());
   std::string group_ns, group_uri;
   RETURN_NOT_OK(uri.get_rest_components(&group_ns, &group_uri));
   const std::string cache_key = group_ns + ":" + group_uri;
@@ -1033,7 +1054,7 @@ Status RestClient::put_group_metadata_to_rest(const URI& uri, Group* group) {
   RETURN_NOT_OK(serialized.add_buffer(std::move(buff)));
 
   // Init curl and form the URL
-  Curl curlc(logger_);
+  Curl curlc(logger_, curl_handle_pool_.get());
   std::string group_ns, group_uri;
   RETURN_NOT_OK(uri.get_rest_components(&group_ns, &group_uri));
   const std::string cache_key = group_ns + ":" + group_uri;
@@ -1062,7 +1083,7 @@ Status RestClient::post_group_create_to_rest(const URI& uri, Group* group) {
   RETURN_NOT_OK(serialized.add_buffer(std::move(buff)));
 
   // Init curl and form the URL
-  Curl curlc(logger_);
+  Curl curlc(logger_, curl_handle_pool_.get());
   std::string group_ns, group_uri;
   RETURN_NOT_OK(uri.get_rest_components(&group_ns, &group_uri));
   const std::string cache_key = group_ns + ":" + group_uri;
@@ -1090,7 +1111,7 @@ Status RestClient::post_group_from_rest(const URI& uri, Group* group) {
   RETURN_NOT_OK(serialized.add_buffer(std::move(buff)));
 
   // Init curl and form the URL
-  Curl curlc(logger_);
+  Curl curlc(logger_, curl_handle_pool_.get());
   std::string group_ns, group_uri;
   RETURN_NOT_OK(uri.get_rest_components(&group_ns, &group_uri));
   const std::string cache_key = group_ns + ":" + group_uri;
@@ -1134,7 +1155,7 @@ Status RestClient::patch_group_to_rest(const URI& uri, Group* group) {
   RETURN_NOT_OK(serialized.add_buffer(std::move(buff)));
 
   // Init curl and form the URL
-  Curl curlc(logger_);
+  Curl curlc(logger_, curl_handle_pool_.get());
   std::string group_ns, group_uri;
   RETURN_NOT_OK(uri.get_rest_components(&group_ns, &group_uri));
   const std::string cache_key = group_ns + ":" + group_uri;
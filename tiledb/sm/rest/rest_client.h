@@ -50,6 +50,7 @@ namespace sm {
 
 class ArraySchema;
 class Config;
+class CurlHandlePool;
 class Query;
 
 enum class SerializationType : uint8_t;
@@ -304,6 +305,12 @@ class RestClient {
   /** Mutex for thread-safety. */
   mutable std::mutex redirect_mtx_;
 
+  /**
+   * The pool of curl handles used for the requests, which keeps connections
+   * to the REST server open across requests.
+   */
+  shared_ptr<CurlHandlePool> curl_handle_pool_;
+
   /** The class logger. */
   shared_ptr<Logger> logger_;
 
@@ -365,6 +372,22 @@ class RestClient {
       Query* query,
       serialization::CopyState* copy_state);
 
+  /**
+   * Deserializes the complete serialized queries in 'data', starting at its
+   * current offset, into the same query object. Each serialized query is
+   * prefixed by its size as a little-endian 64-bit integer. On return, the
+   * offset of 'data' points to the first serialized query that is either
+   * incomplete or failed to deserialize.
+   *
+   * @param data Serialized queries.
+   * @param query Query to store the results in, this will be modified.
+   * @param copy_state Map of copy state per attribute, see
+   *    'query_post_call_back'.
+   * @return Status
+   */
+  Status deserialize_queries(
+      Buffer* data, Query* query, serialization::CopyState* copy_state);
+
   /**
    * Returns a string representation of the given subarray. The format is:
    *
@@ -35,6 +35,8 @@
 #include "tiledb/sm/array_schema/dimension.h"
 #include "tiledb/sm/buffer/buffer.h"
 #include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/misc/hilbert.h"
+#include "tiledb/sm/misc/parallel_functions.h"
 #include "tiledb/sm/misc/tdb_math.h"
 #include "tiledb/sm/misc/utils.h"
 #include "tiledb/storage_format/serialization/serializers.h"
@@ -43,6 +45,7 @@
 #include <cmath>
 #include <iostream>
 #include <list>
+#include <numeric>
 
 using namespace tiledb::common;
 
@@ -56,12 +59,17 @@ namespace sm {
 RTree::RTree() {
   domain_ = nullptr;
   fanout_ = 0;
+  leaf_page_size_ = 0;
+  paged_leaf_num_ = 0;
   deserialized_buffer_size_ = 0;
 }
 
 RTree::RTree(const Domain* domain, unsigned fanout)
     : domain_(domain)
-    , fanout_(fanout) {
+    , fanout_(fanout)
+    , leaf_page_size_(0)
+    , paged_leaf_num_(0)
+    , deserialized_buffer_size_(0) {
 }
 
 RTree::~RTree() = default;
@@ -94,7 +102,7 @@ RTree& RTree::operator=(RTree&& rtree) noexcept {
 /*               API              */
 /* ****************************** */
 
-void RTree::build_tree() {
+void RTree::build_tree(Packing packing) {
   if (levels_.empty()) {
     return;
   }
@@ -103,10 +111,15 @@ void RTree::build_tree() {
 
   auto leaf_num = levels_[0].size();
   assert(leaf_num >= 1);
+  leaf_tile_ids_.clear();
+  tile_leaf_idx_.clear();
   if (leaf_num == 1) {
     return;
   }
 
+  if (packing != Packing::SEQUENTIAL)
+    pack_leaves(packing);
+
   // Build the tree bottom up
   auto height = (size_t)std::ceil(utils::math::log(fanout_, leaf_num)) + 1;
   for (size_t i = 0; i < height - 1; ++i) {
@@ -121,6 +134,11 @@ void RTree::build_tree() {
 uint64_t RTree::free_memory() {
   auto ret = deserialized_buffer_size_;
   levels_.clear();
+  leaf_page_size_ = 0;
+  paged_leaf_num_ = 0;
+  leaf_page_offsets_.clear();
+  leaf_tile_ids_.clear();
+  tile_leaf_idx_.clear();
   deserialized_buffer_size_ = 0;
   return ret;
 }
@@ -144,14 +162,15 @@ TileOverlap RTree::get_tile_overlap(
   // This will keep track of the traversal
   std::list<Entry> traversal;
   traversal.push_front({0, 0});
-  auto leaf_num = levels_.back().size();
+  auto leaf_num = this->leaf_num();
   auto height = this->height();
+  PinnedLeafPage pinned;
 
   while (!traversal.empty()) {
     // Get next entry
     auto entry = traversal.front();
     traversal.pop_front();
-    const auto& mbr = levels_[entry.level_][entry.mbr_idx_];
+    const auto& mbr = this->mbr(entry.level_, entry.mbr_idx_, &pinned);
 
     // Get overlap ratio
     auto ratio = domain_->overlap_ratio(range, is_default, mbr);
@@ -173,7 +192,9 @@ TileOverlap RTree::get_tile_overlap(
               std::pair<uint64_t, double>(entry.mbr_idx_, ratio);
           overlap.tiles_.emplace_back(mbr_idx_ratio);
         } else {  // Insert all "children" to traversal
-          auto next_mbr_num = (uint64_t)levels_[entry.level_ + 1].size();
+          auto next_mbr_num = (entry.level_ + 1 == height - 1) ?
+                                  leaf_num :
+                                  (uint64_t)levels_[entry.level_ + 1].size();
           auto start = entry.mbr_idx_ * fanout_;
           auto end = std::min(start + fanout_ - 1, next_mbr_num - 1);
           for (uint64_t i = start; i <= end; ++i)
@@ -183,9 +204,132 @@ TileOverlap RTree::get_tile_overlap(
     }
   }
 
+  to_tile_ids(&overlap);
+
   return overlap;
 }
 
+std::vector<TileOverlap> RTree::get_tile_overlap(
+    const std::vector<NDRange>& ranges,
+    std::vector<bool>& is_default,
+    uint64_t* visited_node_num) const {
+  std::vector<const Range*> range_ptrs;
+  range_ptrs.reserve(ranges.size() * is_default.size());
+  for (const auto& range : ranges) {
+    for (const auto& r : range)
+      range_ptrs.emplace_back(&r);
+  }
+
+  return get_tile_overlap(range_ptrs, is_default, nullptr, visited_node_num);
+}
+
+std::vector<TileOverlap> RTree::get_tile_overlap(
+    const std::vector<const Range*>& ranges,
+    std::vector<bool>& is_default,
+    ThreadPool* compute_tp,
+    uint64_t* visited_node_num) const {
+  const auto range_num =
+      is_default.empty() ? 0 : ranges.size() / is_default.size();
+  std::vector<TileOverlap> tile_overlaps(range_num);
+
+  // Empty tree
+  if (domain_ == nullptr || levels_.empty() || range_num == 0)
+    return tile_overlaps;
+
+  // The tile overlaps are computed by rank, and all ranges are candidates
+  // for the root
+  auto batch = sort_ranges(ranges, is_default);
+  std::vector<TileOverlap> rank_overlaps(range_num);
+  std::vector<uint64_t> all_ranges(range_num);
+  std::iota(all_ranges.begin(), all_ranges.end(), 0);
+
+  uint64_t node_num = 0;
+  auto height = this->height();
+  if (compute_tp == nullptr || height == 1) {
+    std::vector<std::vector<uint64_t>> partial_ranges(height);
+    PinnedLeafPage pinned;
+    node_num = get_tile_overlap(
+        0,
+        0,
+        batch,
+        all_ranges,
+        partial_ranges,
+        &pinned,
+        rank_overlaps.data(),
+        0);
+  } else {
+    // Visit the root, then its subtrees in parallel. Each subtree computes
+    // the overlaps of the contiguous ranks of its candidate ranges, which
+    // are then appended in subtree order.
+    std::vector<uint64_t> root_partial;
+    PinnedLeafPage pinned;
+    visit_node(
+        0,
+        0,
+        batch,
+        all_ranges,
+        root_partial,
+        &pinned,
+        rank_overlaps.data(),
+        0);
+    node_num = 1;
+
+    if (!root_partial.empty()) {
+      const auto child_num = std::min<uint64_t>(
+          fanout_, height == 2 ? leaf_num() : levels_[1].size());
+      std::vector<uint64_t> base(child_num, 0);
+      std::vector<std::vector<TileOverlap>> child_overlaps(child_num);
+      std::vector<uint64_t> child_node_num(child_num, 0);
+      auto status = parallel_for(compute_tp, 0, child_num, [&](uint64_t c) {
+        PinnedLeafPage pinned;
+        auto [first, last] =
+            candidate_ranges(batch, root_partial, this->mbr(1, c, &pinned));
+        if (first < last) {
+          base[c] = root_partial[first];
+          child_overlaps[c].resize(root_partial[last - 1] - base[c] + 1);
+        }
+
+        std::vector<std::vector<uint64_t>> partial_ranges(height);
+        child_node_num[c] = get_tile_overlap(
+            1,
+            c,
+            batch,
+            root_partial,
+            partial_ranges,
+            &pinned,
+            child_overlaps[c].data(),
+            base[c]);
+        return Status::Ok();
+      });
+      throw_if_not_ok(status);
+
+      for (uint64_t c = 0; c < child_num; ++c) {
+        node_num += child_node_num[c];
+        for (uint64_t i = 0; i < child_overlaps[c].size(); ++i) {
+          auto& to = rank_overlaps[base[c] + i];
+          auto& from = child_overlaps[c][i];
+          to.tiles_.insert(
+              to.tiles_.end(), from.tiles_.begin(), from.tiles_.end());
+          to.tile_ranges_.insert(
+              to.tile_ranges_.end(),
+              from.tile_ranges_.begin(),
+              from.tile_ranges_.end());
+        }
+      }
+    }
+  }
+
+  for (uint64_t k = 0; k < range_num; ++k) {
+    auto& tile_overlap = tile_overlaps[batch.order_[k]];
+    tile_overlap = std::move(rank_overlaps[k]);
+    to_tile_ids(&tile_overlap);
+  }
+  if (visited_node_num != nullptr)
+    *visited_node_num += node_num;
+
+  return tile_overlaps;
+}
+
 void RTree::compute_tile_bitmap(
     const Range& range, unsigned d, std::vector<uint8_t>* tile_bitmap) const {
   // Empty tree
@@ -195,14 +339,18 @@ void RTree::compute_tile_bitmap(
   // This will keep track of the traversal
   std::list<Entry> traversal;
   traversal.push_front({0, 0});
-  auto leaf_num = levels_.back().size();
+  auto leaf_num = this->leaf_num();
   auto height = this->height();
+  PinnedLeafPage pinned;
+  auto tile_id = [&](uint64_t leaf_idx) {
+    return leaf_tile_ids_.empty() ? leaf_idx : leaf_tile_ids_[leaf_idx];
+  };
 
   while (!traversal.empty()) {
     // Get next entry
     auto entry = traversal.front();
     traversal.pop_front();
-    const auto& mbr = levels_[entry.level_][entry.mbr_idx_];
+    const auto& mbr = this->mbr(entry.level_, entry.mbr_idx_, &pinned);
 
     // If there is overlap
     if (domain_->dimension_ptr(d)->overlap(range, mbr[d])) {
@@ -213,14 +361,16 @@ void RTree::compute_tile_bitmap(
         uint64_t start = entry.mbr_idx_ * subtree_leaf_num;
         uint64_t end = start + std::min(subtree_leaf_num, leaf_num - start);
         for (uint64_t i = start; i < end; i++) {
-          tile_bitmap->at(i) = 1;
+          tile_bitmap->at(tile_id(i)) = 1;
         }
       } else {  // Partial overlap
         // If this is the leaf level, insert into results
         if (entry.level_ == height - 1) {
-          tile_bitmap->at(entry.mbr_idx_) = 1;
+          tile_bitmap->at(tile_id(entry.mbr_idx_)) = 1;
         } else {  // Insert all "children" to traversal
-          auto next_mbr_num = (uint64_t)levels_[entry.level_ + 1].size();
+          auto next_mbr_num = (entry.level_ + 1 == height - 1) ?
+                                  leaf_num :
+                                  (uint64_t)levels_[entry.level_ + 1].size();
           auto start = entry.mbr_idx_ * fanout_;
           auto end = std::min(start + fanout_ - 1, next_mbr_num - 1);
           for (uint64_t i = start; i <= end; ++i)
@@ -235,14 +385,31 @@ unsigned RTree::height() const {
   return (unsigned)levels_.size();
 }
 
-const NDRange& RTree::leaf(uint64_t leaf_idx) const {
-  assert(leaf_idx < levels_.back().size());
-  return levels_.back()[leaf_idx];
+NDRange RTree::leaf(uint64_t leaf_idx) const {
+  PinnedLeafPage pinned;
+  return leaf(leaf_idx, &pinned);
+}
+
+const NDRange& RTree::leaf(uint64_t leaf_idx, PinnedLeafPage* pinned) const {
+  assert(leaf_idx < leaf_num());
+  if (!tile_leaf_idx_.empty())
+    leaf_idx = tile_leaf_idx_[leaf_idx];
+  return mbr(levels_.size() - 1, leaf_idx, pinned);
+}
+
+uint64_t RTree::leaf_num() const {
+  if (leaf_page_size_ != 0)
+    return paged_leaf_num_;
+
+  return levels_.empty() ? 0 : levels_.back().size();
+}
+
+bool RTree::paged() const {
+  return leaf_page_size_ != 0;
 }
 
-const std::vector<NDRange>& RTree::leaves() const {
-  assert(!levels_.empty());
-  return levels_.back();
+bool RTree::packed() const {
+  return !leaf_tile_ids_.empty();
 }
 
 uint64_t RTree::subtree_leaf_num(uint64_t level) const {
@@ -261,27 +428,68 @@ uint64_t RTree::subtree_leaf_num(uint64_t level) const {
 void RTree::serialize(Serializer& serializer) const {
   serializer.write<uint32_t>(fanout_);
   auto level_num = (unsigned)levels_.size();
-  serializer.write<uint32_t>(level_num);
-  auto dim_num = domain_->dim_num();
+  serializer.write<uint32_t>(
+      packed() ? level_num | PACKED_LEVEL_NUM_FLAG : level_num);
 
   for (unsigned l = 0; l < level_num; ++l) {
     auto mbr_num = (uint64_t)levels_[l].size();
     serializer.write<uint64_t>(mbr_num);
-    for (uint64_t m = 0; m < mbr_num; ++m) {
-      for (unsigned d = 0; d < dim_num; ++d) {
-        const auto& r = levels_[l][m][d];
-        if (!domain_->dimension_ptr(d)->var_size()) {  // Fixed-sized
-          // Just write the plain range
-          serializer.write(r.data(), r.size());
-        } else {  // Var-sized
-          // range_size | start_size | range
-          serializer.write<uint64_t>(r.size());
-          serializer.write<uint64_t>(r.start_size());
-          serializer.write(r.data(), r.size());
-        }
-      }
-    }
+    serialize_mbrs(serializer, levels_[l], 0, mbr_num);
+  }
+
+  // Tile ids of the leaves
+  for (auto tile_id : leaf_tile_ids_)
+    serializer.write<uint64_t>(tile_id);
+}
+
+void RTree::serialize_paged(
+    Serializer& serializer,
+    uint64_t leaf_page_size,
+    const std::vector<uint64_t>& leaf_page_offsets) const {
+  assert(!levels_.empty() && leaf_page_size_ == 0);
+  serializer.write<uint32_t>(fanout_);
+  auto level_num = (unsigned)levels_.size();
+  auto flags = PAGED_LEVEL_NUM_FLAG;
+  if (packed())
+    flags |= PACKED_LEVEL_NUM_FLAG;
+  serializer.write<uint32_t>(level_num | flags);
+
+  // Upper levels
+  for (unsigned l = 0; l < level_num - 1; ++l) {
+    auto mbr_num = (uint64_t)levels_[l].size();
+    serializer.write<uint64_t>(mbr_num);
+    serialize_mbrs(serializer, levels_[l], 0, mbr_num);
   }
+
+  // Leaf page directory
+  serializer.write<uint64_t>(levels_.back().size());
+  serializer.write<uint64_t>(leaf_page_size);
+  serializer.write<uint64_t>(leaf_page_offsets.size());
+  for (auto offset : leaf_page_offsets)
+    serializer.write<uint64_t>(offset);
+
+  // Tile ids of the leaves
+  for (auto tile_id : leaf_tile_ids_)
+    serializer.write<uint64_t>(tile_id);
+}
+
+void RTree::serialize_leaves(
+    Serializer& serializer, uint64_t start, uint64_t num) const {
+  assert(!levels_.empty() && start + num <= levels_.back().size());
+  serializer.write<uint64_t>(num);
+  serialize_mbrs(serializer, levels_.back(), start, num);
+}
+
+std::vector<NDRange> RTree::deserialize_leaves(
+    Deserializer& deserializer, const Domain* domain) {
+  Level leaves;
+  auto mbr_num = deserializer.read<uint64_t>();
+  deserialize_mbrs(deserializer, domain, mbr_num, &leaves);
+  return leaves;
+}
+
+void RTree::set_leaf_page_loader(LeafPageLoader leaf_page_loader) {
+  leaf_page_loader_ = std::move(leaf_page_loader);
 }
 
 Status RTree::set_leaf(uint64_t leaf_id, const NDRange& mbr) {
@@ -298,6 +506,9 @@ Status RTree::set_leaf(uint64_t leaf_id, const NDRange& mbr) {
 }
 
 Status RTree::set_leaves(const std::vector<NDRange>& mbrs) {
+  leaf_page_size_ = 0;
+  leaf_tile_ids_.clear();
+  tile_leaf_idx_.clear();
   levels_.clear();
   levels_.resize(1);
   levels_[0] = mbrs;
@@ -306,6 +517,9 @@ Status RTree::set_leaves(const std::vector<NDRange>& mbrs) {
 
 Status RTree::set_leaf_num(uint64_t num) {
   // There should be exactly one level (the leaf level)
+  leaf_page_size_ = 0;
+  leaf_tile_ids_.clear();
+  tile_leaf_idx_.clear();
   if (levels_.size() != 1)
     levels_.resize(1);
 
@@ -347,11 +561,417 @@ RTree::Level RTree::build_level(const Level& level) {
   return new_level;
 }
 
+void RTree::pack_leaves(Packing packing) {
+  auto& leaves = levels_[0];
+  auto leaf_num = (uint64_t)leaves.size();
+  auto dim_num = domain_->dim_num();
+  std::vector<uint64_t> order(leaf_num);
+  std::iota(order.begin(), order.end(), 0);
+
+  if (packing == Packing::HILBERT && dim_num < Hilbert::HC_MAX_DIM) {
+    Hilbert h(dim_num);
+    auto centers = leaf_centers(h.bits());
+    std::vector<uint64_t> hilbert_values(leaf_num);
+    std::vector<uint64_t> coords(dim_num);
+    for (uint64_t i = 0; i < leaf_num; ++i) {
+      std::copy_n(&centers[i * dim_num], dim_num, coords.begin());
+      hilbert_values[i] = h.coords_to_hilbert(coords.data());
+    }
+    std::stable_sort(order.begin(), order.end(), [&](uint64_t a, uint64_t b) {
+      return hilbert_values[a] < hilbert_values[b];
+    });
+  } else {  // STR, also used with too many dimensions for Hilbert values
+    auto centers = leaf_centers(sizeof(uint64_t) * 8 - 1);
+    str_sort(order, 0, leaf_num, 0, centers);
+  }
+
+  // Keep the tile order if packing does not change it
+  bool sorted = true;
+  for (uint64_t i = 0; i < leaf_num && sorted; ++i)
+    sorted = order[i] == i;
+  if (sorted)
+    return;
+
+  Level packed(leaf_num);
+  for (uint64_t i = 0; i < leaf_num; ++i)
+    packed[i] = std::move(leaves[order[i]]);
+  leaves.swap(packed);
+
+  leaf_tile_ids_ = std::move(order);
+  tile_leaf_idx_.resize(leaf_num);
+  for (uint64_t i = 0; i < leaf_num; ++i)
+    tile_leaf_idx_[leaf_tile_ids_[i]] = i;
+}
+
+std::vector<uint64_t> RTree::leaf_centers(int bits) const {
+  const auto& leaves = levels_[0];
+  auto leaf_num = (uint64_t)leaves.size();
+  auto dim_num = domain_->dim_num();
+  auto max_bucket_val = ((uint64_t)1 << bits) - 1;
+  std::vector<uint64_t> centers(leaf_num * dim_num);
+
+  for (unsigned d = 0; d < dim_num; ++d) {
+    auto dim{domain_->dimension_ptr(d)};
+    auto var = dim->var_size();
+    for (uint64_t i = 0; i < leaf_num; ++i) {
+      const auto& r = leaves[i][d];
+      uint64_t low, high;
+      if (var) {
+        auto start = r.start_str();
+        auto end = r.end_str();
+        low = dim->map_to_uint64(
+            start.data(), start.size(), bits, max_bucket_val);
+        high = dim->map_to_uint64(end.data(), end.size(), bits, max_bucket_val);
+      } else {
+        // Note: coord_size is ignored for fixed size in map_to_uint64.
+        low = dim->map_to_uint64(r.start_fixed(), 0, bits, max_bucket_val);
+        high = dim->map_to_uint64(r.end_fixed(), 0, bits, max_bucket_val);
+      }
+      centers[i * dim_num + d] = low / 2 + high / 2 + (low & high & 1);
+    }
+  }
+
+  return centers;
+}
+
+void RTree::str_sort(
+    std::vector<uint64_t>& order,
+    uint64_t begin,
+    uint64_t end,
+    unsigned d,
+    const std::vector<uint64_t>& centers) const {
+  auto dim_num = domain_->dim_num();
+  std::stable_sort(
+      order.begin() + begin,
+      order.begin() + end,
+      [&](uint64_t a, uint64_t b) {
+        return centers[a * dim_num + d] < centers[b * dim_num + d];
+      });
+  if (d + 1 == dim_num)
+    return;
+
+  // Cut into as many slices of whole nodes as there will be slices along
+  // each of the remaining dimensions
+  auto node_num = utils::math::ceil(end - begin, fanout_);
+  auto slice_num = (uint64_t)std::ceil(
+      std::pow((double)node_num, 1.0 / (double)(dim_num - d)));
+  auto slice_size = utils::math::ceil(node_num, slice_num) * fanout_;
+  for (uint64_t s = begin; s < end; s += slice_size)
+    str_sort(order, s, std::min(s + slice_size, end), d + 1, centers);
+}
+
+void RTree::to_tile_ids(TileOverlap* tile_overlap) const {
+  if (leaf_tile_ids_.empty())
+    return;
+
+  auto& tiles = tile_overlap->tiles_;
+  for (auto& tile : tiles)
+    tile.first = leaf_tile_ids_[tile.first];
+  std::sort(tiles.begin(), tiles.end());
+
+  auto& tile_ranges = tile_overlap->tile_ranges_;
+  if (tile_ranges.empty())
+    return;
+
+  // Split the leaf ranges at the leaves whose tile id does not follow the
+  // tile id of the previous leaf
+  std::vector<std::pair<uint64_t, uint64_t>> id_ranges;
+  id_ranges.reserve(tile_ranges.size());
+  for (const auto& tile_range : tile_ranges) {
+    auto start = tile_range.first;
+    for (auto i = tile_range.first; i <= tile_range.second; ++i) {
+      if (i == tile_range.second ||
+          leaf_tile_ids_[i + 1] != leaf_tile_ids_[i] + 1) {
+        id_ranges.emplace_back(leaf_tile_ids_[start], leaf_tile_ids_[i]);
+        start = i + 1;
+      }
+    }
+  }
+  std::sort(id_ranges.begin(), id_ranges.end());
+
+  // Coalesce the adjacent tile id ranges
+  tile_ranges.clear();
+  for (const auto& id_range : id_ranges) {
+    if (!tile_ranges.empty() &&
+        tile_ranges.back().second + 1 == id_range.first)
+      tile_ranges.back().second = id_range.second;
+    else
+      tile_ranges.emplace_back(id_range);
+  }
+}
+
+RTree::RangeBatch RTree::sort_ranges(
+    const std::vector<const Range*>& ranges,
+    const std::vector<bool>& is_default) const {
+  const auto dim_num = this->dim_num();
+  const auto range_num = ranges.size() / dim_num;
+  RangeBatch batch{ranges, is_default, dim_num, {}, {}, {}, false};
+  batch.order_.resize(range_num);
+  std::iota(batch.order_.begin(), batch.order_.end(), 0);
+
+  // Sort the ranges on every non-default dimension, keeping the dimension
+  // with the most distinct range starts
+  uint64_t max_distinct_num = 0;
+  std::vector<uint64_t> order(range_num), start_keys(range_num);
+  for (unsigned d = 0; d < dim_num; ++d) {
+    if (is_default[d])
+      continue;
+
+    for (uint64_t r = 0; r < range_num; ++r)
+      start_keys[r] = range_key(d, *ranges[r * dim_num + d], false);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](uint64_t a, uint64_t b) {
+      return start_keys[a] < start_keys[b];
+    });
+
+    uint64_t distinct_num = 1;
+    for (uint64_t k = 1; k < range_num; ++k)
+      distinct_num += start_keys[order[k]] != start_keys[order[k - 1]];
+    if (distinct_num > max_distinct_num) {
+      max_distinct_num = distinct_num;
+      batch.dim_ = d;
+      batch.order_ = order;
+    }
+  }
+
+  if (batch.dim_ == dim_num)
+    return batch;
+
+  // Store the keys by rank
+  batch.start_keys_.resize(range_num);
+  batch.end_keys_.resize(range_num);
+  batch.ends_sorted_ = true;
+  for (uint64_t k = 0; k < range_num; ++k) {
+    const auto& range = *ranges[batch.order_[k] * dim_num + batch.dim_];
+    batch.start_keys_[k] = range_key(batch.dim_, range, false);
+    batch.end_keys_[k] = range_key(batch.dim_, range, true);
+    if (k > 0 && batch.end_keys_[k] < batch.end_keys_[k - 1])
+      batch.ends_sorted_ = false;
+  }
+
+  return batch;
+}
+
+uint64_t RTree::range_key(unsigned d, const Range& range, bool end) const {
+  // The mapping used for the Hilbert values is order-preserving
+  const int bits = sizeof(uint64_t) * 8 - 1;
+  const uint64_t max_bucket_val = ((uint64_t)1 << bits) - 1;
+  auto dim{domain_->dimension_ptr(d)};
+  if (dim->var_size()) {
+    auto value = end ? range.end_str() : range.start_str();
+    return dim->map_to_uint64(value.data(), value.size(), bits, max_bucket_val);
+  }
+
+  // Note: coord_size is ignored for fixed size in map_to_uint64.
+  return dim->map_to_uint64(
+      end ? range.end_fixed() : range.start_fixed(), 0, bits, max_bucket_val);
+}
+
+void RTree::visit_node(
+    unsigned level,
+    uint64_t mbr_idx,
+    const RangeBatch& batch,
+    const std::vector<uint64_t>& parent_ranges,
+    std::vector<uint64_t>& partial,
+    PinnedLeafPage* pinned,
+    TileOverlap* tile_overlaps,
+    uint64_t base) const {
+  partial.clear();
+  const auto& mbr = this->mbr(level, mbr_idx, pinned);
+  auto [first, last] = candidate_ranges(batch, parent_ranges, mbr);
+  for (auto i = first; i < last; ++i) {
+    auto k = parent_ranges[i];
+    auto ratio = overlap_ratio(batch, k, mbr);
+    if (ratio == 0.0)
+      continue;
+
+    if (ratio == 1.0) {  // Full overlap
+      auto subtree_leaf_num = this->subtree_leaf_num(level);
+      assert(subtree_leaf_num > 0);
+      uint64_t start = mbr_idx * subtree_leaf_num;
+      uint64_t end = start + std::min(subtree_leaf_num, leaf_num() - start) - 1;
+      tile_overlaps[k - base].tile_ranges_.emplace_back(start, end);
+    } else if (level == height() - 1) {  // Partial overlap with a leaf
+      tile_overlaps[k - base].tiles_.emplace_back(mbr_idx, ratio);
+    } else {  // Partial overlap with an internal node
+      partial.emplace_back(k);
+    }
+  }
+}
+
+uint64_t RTree::get_tile_overlap(
+    unsigned level,
+    uint64_t mbr_idx,
+    const RangeBatch& batch,
+    const std::vector<uint64_t>& parent_ranges,
+    std::vector<std::vector<uint64_t>>& partial_ranges,
+    PinnedLeafPage* pinned,
+    TileOverlap* tile_overlaps,
+    uint64_t base) const {
+  // Visiting the subtrees in order appends the results of each range in
+  // the same order as the single range traversal
+  auto& partial = partial_ranges[level];
+  visit_node(
+      level,
+      mbr_idx,
+      batch,
+      parent_ranges,
+      partial,
+      pinned,
+      tile_overlaps,
+      base);
+  if (partial.empty())
+    return 1;
+
+  uint64_t node_num = 1;
+  auto next_mbr_num = (level + 1 == height() - 1) ?
+                          leaf_num() :
+                          (uint64_t)levels_[level + 1].size();
+  auto start = mbr_idx * fanout_;
+  auto end = std::min(start + fanout_ - 1, next_mbr_num - 1);
+  for (uint64_t i = start; i <= end; ++i) {
+    node_num += get_tile_overlap(
+        level + 1,
+        i,
+        batch,
+        partial,
+        partial_ranges,
+        pinned,
+        tile_overlaps,
+        base);
+  }
+
+  return node_num;
+}
+
+std::pair<uint64_t, uint64_t> RTree::candidate_ranges(
+    const RangeBatch& batch,
+    const std::vector<uint64_t>& ranges,
+    const NDRange& mbr) const {
+  if (batch.dim_ == dim_num())
+    return {0, ranges.size()};
+
+  // The ranges starting after the end of the MBR cannot overlap it, and
+  // neither can the ranges ending before its start if the range ends are
+  // sorted too. The keys are only weakly ordered, the exact overlap is
+  // checked on the candidates.
+  const auto& mbr_range = mbr[batch.dim_];
+  const auto mbr_end = range_key(batch.dim_, mbr_range, true);
+  auto first = ranges.begin();
+  auto last = std::upper_bound(
+      first, ranges.end(), mbr_end, [&](uint64_t key, uint64_t k) {
+        return key < batch.start_keys_[k];
+      });
+  if (batch.ends_sorted_) {
+    const auto mbr_start = range_key(batch.dim_, mbr_range, false);
+    first = std::lower_bound(
+        first, last, mbr_start, [&](uint64_t k, uint64_t key) {
+          return batch.end_keys_[k] < key;
+        });
+  }
+
+  return {first - ranges.begin(), last - ranges.begin()};
+}
+
+double RTree::overlap_ratio(
+    const RangeBatch& batch, uint64_t rank, const NDRange& mbr) const {
+  const auto dim_num = this->dim_num();
+  const auto* range = &batch.ranges_[batch.order_[rank] * dim_num];
+  double ratio = 1.0;
+  for (unsigned d = 0; d < dim_num; ++d) {
+    if (batch.is_default_[d])
+      continue;
+
+    auto dim{domain_->dimension_ptr(d)};
+    if (!dim->overlap(*range[d], mbr[d]))
+      return 0.0;
+
+    ratio *= dim->overlap_ratio(*range[d], mbr[d]);
+
+    // If ratio goes to 0, then the subarray overlap is much smaller than the
+    // volume of the MBR. Since we have already guaranteed that there is an
+    // overlap above, we should set the ratio to epsilon.
+    if (ratio == 0)
+      ratio = std::nextafter(0, std::numeric_limits<double>::max());
+  }
+
+  return ratio;
+}
+
+const NDRange& RTree::mbr(
+    uint64_t level, uint64_t mbr_idx, PinnedLeafPage* pinned) const {
+  if (leaf_page_size_ == 0 || level != levels_.size() - 1)
+    return levels_[level][mbr_idx];
+
+  auto page_idx = mbr_idx / leaf_page_size_;
+  if (pinned->idx_ != page_idx) {
+    assert(leaf_page_loader_);
+    pinned->page_ = leaf_page_loader_(leaf_page_offsets_[page_idx]);
+    pinned->idx_ = page_idx;
+  }
+
+  return (*pinned->page_)[mbr_idx % leaf_page_size_];
+}
+
+void RTree::serialize_mbrs(
+    Serializer& serializer,
+    const Level& level,
+    uint64_t start,
+    uint64_t num) const {
+  auto dim_num = domain_->dim_num();
+  for (uint64_t m = start; m < start + num; ++m) {
+    for (unsigned d = 0; d < dim_num; ++d) {
+      const auto& r = level[m][d];
+      if (!domain_->dimension_ptr(d)->var_size()) {  // Fixed-sized
+        // Just write the plain range
+        serializer.write(r.data(), r.size());
+      } else {  // Var-sized
+        // range_size | start_size | range
+        serializer.write<uint64_t>(r.size());
+        serializer.write<uint64_t>(r.start_size());
+        serializer.write(r.data(), r.size());
+      }
+    }
+  }
+}
+
+void RTree::deserialize_mbrs(
+    Deserializer& deserializer,
+    const Domain* domain,
+    uint64_t mbr_num,
+    Level* level) {
+  auto dim_num = domain->dim_num();
+  level->resize(mbr_num);
+  for (uint64_t m = 0; m < mbr_num; ++m) {
+    (*level)[m].resize(dim_num);
+    for (unsigned d = 0; d < dim_num; ++d) {
+      auto dim{domain->dimension_ptr(d)};
+      if (!dim->var_size()) {  // Fixed-sized
+        auto r_size = 2 * dim->coord_size();
+        auto data = deserializer.get_ptr<void>(r_size);
+        (*level)[m][d].set_range(data, r_size);
+      } else {  // Var-sized
+        // range_size | start_size | range
+        auto r_size = deserializer.read<uint64_t>();
+        auto start_size = deserializer.read<uint64_t>();
+        auto data = deserializer.get_ptr<void>(r_size);
+        (*level)[m][d].set_range(data, r_size, start_size);
+      }
+    }
+  }
+}
+
 RTree RTree::clone() const {
   RTree clone;
   clone.domain_ = domain_;
   clone.fanout_ = fanout_;
   clone.levels_ = levels_;
+  clone.leaf_page_size_ = leaf_page_size_;
+  clone.paged_leaf_num_ = paged_leaf_num_;
+  clone.leaf_page_offsets_ = leaf_page_offsets_;
+  clone.leaf_page_loader_ = leaf_page_loader_;
+  clone.leaf_tile_ids_ = leaf_tile_ids_;
+  clone.tile_leaf_idx_ = tile_leaf_idx_;
 
   return clone;
 }
@@ -373,6 +993,9 @@ void RTree::deserialize_v1_v4(
   auto level_num = deserializer.read<unsigned>();
   levels_.clear();
   levels_.resize(level_num);
+  leaf_page_size_ = 0;
+  leaf_tile_ids_.clear();
+  tile_leaf_idx_.clear();
   auto dim_num = domain->dim_num();
   for (unsigned l = 0; l < level_num; ++l) {
     auto mbr_num = deserializer.read<uint64_t>();
@@ -395,31 +1018,48 @@ void RTree::deserialize_v5(Deserializer& deserializer, const Domain* domain) {
 
   fanout_ = deserializer.read<unsigned>();
   auto level_num = deserializer.read<unsigned>();
+  bool paged = (level_num & PAGED_LEVEL_NUM_FLAG) != 0;
+  bool packed = (level_num & PACKED_LEVEL_NUM_FLAG) != 0;
+  level_num &= ~(PAGED_LEVEL_NUM_FLAG | PACKED_LEVEL_NUM_FLAG);
 
   levels_.clear();
   levels_.resize(level_num);
-  auto dim_num = domain->dim_num();
-
-  for (unsigned l = 0; l < level_num; ++l) {
+  leaf_page_size_ = 0;
+  paged_leaf_num_ = 0;
+  leaf_page_offsets_.clear();
+  leaf_tile_ids_.clear();
+  tile_leaf_idx_.clear();
+
+  // The leaf level of paged R-trees is only described by its leaf pages
+  auto loaded_level_num = paged ? level_num - 1 : level_num;
+  for (unsigned l = 0; l < loaded_level_num; ++l) {
     auto mbr_num = deserializer.read<uint64_t>();
-    levels_[l].resize(mbr_num);
+    deserialize_mbrs(deserializer, domain, mbr_num, &levels_[l]);
+  }
 
-    for (uint64_t m = 0; m < mbr_num; ++m) {
-      levels_[l][m].resize(dim_num);
-      for (unsigned d = 0; d < dim_num; ++d) {
-        auto dim{domain->dimension_ptr(d)};
-        if (!dim->var_size()) {  // Fixed-sized
-          auto r_size = 2 * dim->coord_size();
-          auto data = deserializer.get_ptr<void>(r_size);
-          levels_[l][m][d].set_range(data, r_size);
-        } else {  // Var-sized
-          // range_size | start_size | range
-          auto r_size = deserializer.read<uint64_t>();
-          auto start_size = deserializer.read<uint64_t>();
-          auto data = deserializer.get_ptr<void>(r_size);
-          levels_[l][m][d].set_range(data, r_size, start_size);
-        }
-      }
+  if (paged) {
+    paged_leaf_num_ = deserializer.read<uint64_t>();
+    leaf_page_size_ = deserializer.read<uint64_t>();
+    auto page_num = deserializer.read<uint64_t>();
+    if (leaf_page_size_ == 0 ||
+        page_num != utils::math::ceil(paged_leaf_num_, leaf_page_size_))
+      throw std::logic_error(
+          "Cannot deserialize R-tree; Invalid leaf page directory");
+    leaf_page_offsets_.resize(page_num);
+    for (uint64_t p = 0; p < page_num; ++p)
+      leaf_page_offsets_[p] = deserializer.read<uint64_t>();
+  }
+
+  if (packed) {
+    auto leaf_num = this->leaf_num();
+    leaf_tile_ids_.resize(leaf_num);
+    tile_leaf_idx_.resize(leaf_num);
+    for (uint64_t i = 0; i < leaf_num; ++i) {
+      leaf_tile_ids_[i] = deserializer.read<uint64_t>();
+      if (leaf_tile_ids_[i] >= leaf_num)
+        throw std::logic_error(
+            "Cannot deserialize R-tree; Invalid leaf tile id");
+      tile_leaf_idx_[leaf_tile_ids_[i]] = i;
     }
   }
 
@@ -430,6 +1070,12 @@ void RTree::swap(RTree& rtree) {
   std::swap(domain_, rtree.domain_);
   std::swap(fanout_, rtree.fanout_);
   std::swap(levels_, rtree.levels_);
+  std::swap(leaf_page_size_, rtree.leaf_page_size_);
+  std::swap(paged_leaf_num_, rtree.paged_leaf_num_);
+  std::swap(leaf_page_offsets_, rtree.leaf_page_offsets_);
+  std::swap(leaf_page_loader_, rtree.leaf_page_loader_);
+  std::swap(leaf_tile_ids_, rtree.leaf_tile_ids_);
+  std::swap(tile_leaf_idx_, rtree.tile_leaf_idx_);
 }
 
 }  // namespace sm
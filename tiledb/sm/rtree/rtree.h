@@ -33,10 +33,13 @@
 #ifndef TILEDB_RTREE_H
 #define TILEDB_RTREE_H
 
+#include <functional>
+#include <limits>
 #include <vector>
 
 #include "tiledb/common/common.h"
 #include "tiledb/common/status.h"
+#include "tiledb/common/thread_pool.h"
 #include "tiledb/sm/array_schema/domain.h"
 #include "tiledb/sm/misc/tile_overlap.h"
 #include "tiledb/storage_format/serialization/serializers.h"
@@ -59,6 +62,38 @@ enum class Layout : uint8_t;
  */
 class RTree {
  public:
+  /* ********************************* */
+  /*         TYPE DEFINITIONS          */
+  /* ********************************* */
+
+  /**
+   * Loads the leaf MBRs of a leaf page of a paged R-tree, given the page
+   * offset recorded in the serialized R-tree. It throws on failure.
+   */
+  typedef std::function<shared_ptr<const std::vector<NDRange>>(uint64_t)>
+      LeafPageLoader;
+
+  /** Defines how the leaf MBRs are grouped into nodes by `build_tree`. */
+  enum class Packing : uint8_t {
+    /** Consecutive leaves are grouped in tile order. */
+    SEQUENTIAL,
+    /** Leaves are packed with Sort-Tile-Recursive on their centers. */
+    STR,
+    /** Leaves are sorted on the Hilbert value of their centers. */
+    HILBERT
+  };
+
+  /**
+   * A leaf page of a paged R-tree, kept alive while its leaves are
+   * accessed.
+   */
+  struct PinnedLeafPage {
+    /** The index of the pinned leaf page. */
+    uint64_t idx_ = std::numeric_limits<uint64_t>::max();
+    /** The pinned leaf page. */
+    shared_ptr<const std::vector<NDRange>> page_;
+  };
+
   /* ********************************* */
   /*     CONSTRUCTORS & DESTRUCTORS    */
   /* ********************************* */
@@ -88,8 +123,13 @@ class RTree {
   /*                 API               */
   /* ********************************* */
 
-  /** Builds the RTree bottom-up on the current leaf level. */
-  void build_tree();
+  /**
+   * Builds the RTree bottom-up on the current leaf level. With a packing
+   * other than `SEQUENTIAL`, the leaves are first reordered so that
+   * spatially close MBRs share nodes. The leaves remain addressed by their
+   * original index (tile id) in the API.
+   */
+  void build_tree(Packing packing = Packing::SEQUENTIAL);
 
   /** Frees the memory associated with the rtree. */
   uint64_t free_memory();
@@ -112,6 +152,49 @@ class RTree {
   TileOverlap get_tile_overlap(
       const NDRange& range, std::vector<bool>& is_default) const;
 
+  /**
+   * Returns the tile overlap of each of the input ranges with the MBRs
+   * stored in the RTree, computed in a single traversal of the tree (see
+   * the overload taking the ranges by reference).
+   *
+   * @param ranges The input ranges.
+   * @param is_default Whether the input ranges are default per dimension.
+   * @param visited_node_num If not `nullptr`, it is incremented by the
+   *     number of tree nodes visited.
+   * @return The tile overlap of each input range.
+   */
+  std::vector<TileOverlap> get_tile_overlap(
+      const std::vector<NDRange>& ranges,
+      std::vector<bool>& is_default,
+      uint64_t* visited_node_num = nullptr) const;
+
+  /**
+   * Returns the tile overlap of each of the input ranges with the MBRs
+   * stored in the RTree, computed in a single traversal of the tree.
+   *
+   * The ranges are sorted on the dimension along which they are the most
+   * spread out. Each node binary searches the sorted ranges it was visited
+   * with for the ones that may overlap its MBR, and its subtree is only
+   * visited with the ranges that partially overlap it. The subtrees of the
+   * root are traversed in parallel on `compute_tp`. The result for range
+   * `r` is identical to the single range `get_tile_overlap`.
+   *
+   * @param ranges The 1D ranges of the input ranges, referenced rather than
+   *     copied: `ranges[r * dim_num + d]` is the range of input range `r` on
+   *     dimension `d`.
+   * @param is_default Whether the input ranges are default per dimension.
+   * @param compute_tp The thread pool for traversing the subtrees of the
+   *     root, or `nullptr` for a serial traversal.
+   * @param visited_node_num If not `nullptr`, it is incremented by the
+   *     number of tree nodes visited.
+   * @return The tile overlap of each input range.
+   */
+  std::vector<TileOverlap> get_tile_overlap(
+      const std::vector<const Range*>& ranges,
+      std::vector<bool>& is_default,
+      ThreadPool* compute_tp,
+      uint64_t* visited_node_num = nullptr) const;
+
   /**
    * Compute tile bitmap for the curent range.
    */
@@ -121,11 +204,27 @@ class RTree {
   /** Returns the tree height. */
   unsigned height() const;
 
-  /** Returns the leaf MBR with the input index. */
-  const NDRange& leaf(uint64_t leaf_idx) const;
+  /**
+   * Returns the leaf MBR with the input index. For paged R-trees, this
+   * loads the leaf page holding the MBR if needed.
+   */
+  NDRange leaf(uint64_t leaf_idx) const;
 
-  /** Returns the leaves of the tree. */
-  const std::vector<NDRange>& leaves() const;
+  /**
+   * Returns the leaf MBR with the input index without copying it. For paged
+   * R-trees, the leaf page holding the MBR is loaded if needed and kept in
+   * `pinned`, the returned reference is valid as long as it stays pinned.
+   */
+  const NDRange& leaf(uint64_t leaf_idx, PinnedLeafPage* pinned) const;
+
+  /** Returns the number of leaves of the tree. */
+  uint64_t leaf_num() const;
+
+  /** Returns true if the leaf level is loaded on demand in pages. */
+  bool paged() const;
+
+  /** Returns true if the leaves are stored in a different order than tiles. */
+  bool packed() const;
 
   /**
    * Returns the number of leaves that are stored in a (full) subtree
@@ -139,6 +238,39 @@ class RTree {
    */
   void serialize(Serializer& serializer) const;
 
+  /**
+   * Serializes the tree in the paged format, where the leaf level is
+   * stored in separate leaf pages (see `serialize_leaves`) and only the
+   * upper levels and the offsets of the leaf pages are serialized in the
+   * input buffer.
+   *
+   * @param serializer The serializer.
+   * @param leaf_page_size The number of leaves per leaf page.
+   * @param leaf_page_offsets The offsets of the leaf pages, passed back to
+   *     the leaf page loader on deserialization.
+   */
+  void serialize_paged(
+      Serializer& serializer,
+      uint64_t leaf_page_size,
+      const std::vector<uint64_t>& leaf_page_offsets) const;
+
+  /**
+   * Serializes `num` leaves starting at leaf `start`, forming a leaf page
+   * of a paged R-tree.
+   */
+  void serialize_leaves(
+      Serializer& serializer, uint64_t start, uint64_t num) const;
+
+  /** Deserializes a leaf page serialized with `serialize_leaves`. */
+  static std::vector<NDRange> deserialize_leaves(
+      Deserializer& deserializer, const Domain* domain);
+
+  /**
+   * Sets the function loading the leaf pages of a paged R-tree. It must be
+   * set before the tree is queried.
+   */
+  void set_leaf_page_loader(LeafPageLoader leaf_page_loader);
+
   /**
    * Sets the RTree domain.
    */
@@ -218,6 +350,39 @@ class RTree {
     uint64_t mbr_idx_;
   };
 
+  /**
+   * The input ranges of a batched tile overlap computation, sorted on one
+   * dimension. A range is referred to by its rank in the sorted order.
+   */
+  struct RangeBatch {
+    /** The 1D ranges, `ranges_[r * dim_num + d]` for input range `r`. */
+    const std::vector<const Range*>& ranges_;
+    /** Whether the input ranges are default per dimension. */
+    const std::vector<bool>& is_default_;
+    /** The dimension the ranges are sorted on, `dim_num` if none. */
+    unsigned dim_;
+    /** The input range index of each rank. */
+    std::vector<uint64_t> order_;
+    /**
+     * The order-preserving keys of the range starts on `dim_`, by rank.
+     * They are non-decreasing.
+     */
+    std::vector<uint64_t> start_keys_;
+    /** The order-preserving keys of the range ends on `dim_`, by rank. */
+    std::vector<uint64_t> end_keys_;
+    /** True if `end_keys_` is non-decreasing as well. */
+    bool ends_sorted_;
+  };
+
+  /** Flag set on the serialized level number of paged R-trees. */
+  static constexpr uint32_t PAGED_LEVEL_NUM_FLAG = 0x80000000;
+
+  /**
+   * Flag set on the serialized level number of R-trees whose leaves are
+   * not stored in tile order.
+   */
+  static constexpr uint32_t PACKED_LEVEL_NUM_FLAG = 0x40000000;
+
   /* ********************************* */
   /*         PRIVATE ATTRIBUTES        */
   /* ********************************* */
@@ -239,6 +404,31 @@ class RTree {
    */
   std::vector<Level> levels_;
 
+  /**
+   * The number of leaves per leaf page for paged R-trees, and 0 if the
+   * leaf level is held in `levels_`. For paged R-trees, the last level in
+   * `levels_` is left empty.
+   */
+  uint64_t leaf_page_size_;
+
+  /** The number of leaves of a paged R-tree. */
+  uint64_t paged_leaf_num_;
+
+  /** The offsets of the leaf pages of a paged R-tree. */
+  std::vector<uint64_t> leaf_page_offsets_;
+
+  /** Loads the leaf pages of a paged R-tree. */
+  LeafPageLoader leaf_page_loader_;
+
+  /**
+   * The tile id of each leaf, in leaf order, if the leaves were reordered
+   * by `build_tree`. Empty if the leaves are in tile order.
+   */
+  std::vector<uint64_t> leaf_tile_ids_;
+
+  /** The leaf index of each tile id, the inverse of `leaf_tile_ids_`. */
+  std::vector<uint64_t> tile_leaf_idx_;
+
   /**
    * Stores the size of the buffer used to deserialize the data, used for
    * memory tracking pusposes on reads.
@@ -252,6 +442,144 @@ class RTree {
   /** Builds a single tree level on top of the input level. */
   Level build_level(const Level& level);
 
+  /**
+   * Reorders the leaf level with the input packing, recording the tile id
+   * of each leaf in `leaf_tile_ids_`.
+   */
+  void pack_leaves(Packing packing);
+
+  /**
+   * Computes the center of each leaf MBR, mapped to `bits` bits per
+   * dimension. The result holds `dim_num` values per leaf.
+   */
+  std::vector<uint64_t> leaf_centers(int bits) const;
+
+  /**
+   * Sorts the leaves in `order[begin, end)` with Sort-Tile-Recursive on
+   * dimension `d` and then recursively on the following dimensions within
+   * each slice.
+   */
+  void str_sort(
+      std::vector<uint64_t>& order,
+      uint64_t begin,
+      uint64_t end,
+      unsigned d,
+      const std::vector<uint64_t>& centers) const;
+
+  /**
+   * Converts the leaf indexes in the input tile overlap to tile ids,
+   * sorting and coalescing them as if the leaves were in tile order. The
+   * fully overlapping leaf ranges are split into the ranges of leaves with
+   * consecutive tile ids, without expanding them into single tile ids.
+   */
+  void to_tile_ids(TileOverlap* tile_overlap) const;
+
+  /**
+   * Sorts the input ranges of a batch on the dimension with the most
+   * distinct range starts.
+   */
+  RangeBatch sort_ranges(
+      const std::vector<const Range*>& ranges,
+      const std::vector<bool>& is_default) const;
+
+  /**
+   * Maps the start (or end) of `range` on dimension `d` to a key, such
+   * that the keys of ordered values are ordered.
+   */
+  uint64_t range_key(unsigned d, const Range& range, bool end) const;
+
+  /**
+   * Computes the tile overlap of the ranges in `parent_ranges` with the
+   * node with the input MBR, without visiting its subtree. The ranges
+   * partially overlapping an internal node are stored in `partial`.
+   *
+   * @param level The level of the node.
+   * @param mbr_idx The index of the node in its level.
+   * @param batch The input ranges.
+   * @param parent_ranges The ascending ranks of the ranges partially
+   *     overlapping the parent of the node.
+   * @param partial The ascending ranks of the ranges partially overlapping
+   *     the node.
+   * @param pinned The pinned leaf page.
+   * @param tile_overlaps The tile overlap of the ranges, by rank starting
+   *     at rank `base`.
+   * @param base The rank of the first range in `tile_overlaps`.
+   */
+  void visit_node(
+      unsigned level,
+      uint64_t mbr_idx,
+      const RangeBatch& batch,
+      const std::vector<uint64_t>& parent_ranges,
+      std::vector<uint64_t>& partial,
+      PinnedLeafPage* pinned,
+      TileOverlap* tile_overlaps,
+      uint64_t base) const;
+
+  /**
+   * Computes the tile overlap of the ranges in `parent_ranges` with the
+   * subtree rooted at the input MBR, appending it to `tile_overlaps`.
+   *
+   * @param level The level of the subtree root.
+   * @param mbr_idx The index of the subtree root in its level.
+   * @param batch The input ranges.
+   * @param parent_ranges The ascending ranks of the ranges partially
+   *     overlapping the parent of the subtree root.
+   * @param partial_ranges Per-level scratch space for the ranks of the
+   *     ranges partially overlapping the nodes under traversal.
+   * @param pinned The pinned leaf page.
+   * @param tile_overlaps The tile overlap of the ranges, by rank starting
+   *     at rank `base`.
+   * @param base The rank of the first range in `tile_overlaps`.
+   * @return The number of nodes visited in the subtree.
+   */
+  uint64_t get_tile_overlap(
+      unsigned level,
+      uint64_t mbr_idx,
+      const RangeBatch& batch,
+      const std::vector<uint64_t>& parent_ranges,
+      std::vector<std::vector<uint64_t>>& partial_ranges,
+      PinnedLeafPage* pinned,
+      TileOverlap* tile_overlaps,
+      uint64_t base) const;
+
+  /**
+   * Returns the part of the ascending ranks `ranges` whose ranges may
+   * overlap `mbr`, found by binary search on the sorted dimension.
+   */
+  std::pair<uint64_t, uint64_t> candidate_ranges(
+      const RangeBatch& batch,
+      const std::vector<uint64_t>& ranges,
+      const NDRange& mbr) const;
+
+  /**
+   * Returns the ratio of the overlap of the input range with rank `rank` and
+   * `mbr` over `mbr`, like `Domain::overlap_ratio`.
+   */
+  double overlap_ratio(
+      const RangeBatch& batch, uint64_t rank, const NDRange& mbr) const;
+
+  /**
+   * Returns the MBR with the input index at the input level. For the leaf
+   * level of paged R-trees, the leaf page holding the MBR is loaded into
+   * `pinned` if it is not already pinned there.
+   */
+  const NDRange& mbr(
+      uint64_t level, uint64_t mbr_idx, PinnedLeafPage* pinned) const;
+
+  /** Serializes the MBRs of `level` in [start, start + num). */
+  void serialize_mbrs(
+      Serializer& serializer,
+      const Level& level,
+      uint64_t start,
+      uint64_t num) const;
+
+  /** Deserializes `mbr_num` MBRs into `level`. */
+  static void deserialize_mbrs(
+      Deserializer& deserializer,
+      const Domain* domain,
+      uint64_t mbr_num,
+      Level* level);
+
   /** Returns a deep copy of this RTree. */
   RTree clone() const;
 
@@ -50,6 +50,7 @@
 #include "tiledb/sm/enums/layout.h"
 #include "tiledb/sm/enums/serialization_type.h"
 #include "tiledb/sm/filter/bit_width_reduction_filter.h"
+#include "tiledb/sm/filter/bitmap_filter.h"
 #include "tiledb/sm/filter/bitshuffle_filter.h"
 #include "tiledb/sm/filter/byteshuffle_filter.h"
 #include "tiledb/sm/filter/checksum_md5_filter.h"
@@ -126,6 +127,7 @@ Status filter_to_capnp(
     case FilterType::FILTER_NONE:
     case FilterType::FILTER_BITSHUFFLE:
     case FilterType::FILTER_BYTESHUFFLE:
+    case FilterType::FILTER_BITMAP:
     case FilterType::FILTER_CHECKSUM_MD5:
     case FilterType::FILTER_CHECKSUM_SHA256:
     case FilterType::INTERNAL_FILTER_AES_256_GCM:
@@ -213,6 +215,9 @@ tuple<Status, optional<shared_ptr<Filter>>> filter_from_capnp(
       return {Status::Ok(),
               tiledb::common::make_shared<ByteshuffleFilter>(HERE())};
     }
+    case FilterType::FILTER_BITMAP: {
+      return {Status::Ok(), tiledb::common::make_shared<BitmapFilter>(HERE())};
+    }
     case FilterType::FILTER_CHECKSUM_MD5: {
       return {Status::Ok(),
               tiledb::common::make_shared<ChecksumMD5Filter>(HERE())};
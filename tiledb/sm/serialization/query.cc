@@ -58,6 +58,7 @@
 #include "tiledb/sm/enums/query_type.h"
 #include "tiledb/sm/enums/serialization_type.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
+#include "tiledb/sm/misc/endian.h"
 #include "tiledb/sm/misc/hash.h"
 #include "tiledb/sm/misc/parse_argument.h"
 #include "tiledb/sm/query/readers/dense_reader.h"
@@ -664,6 +665,13 @@ static Status condition_ast_to_capnp(
     ensure_qc_field_name_is_valid(field_name);
     ast_builder->setFieldName(field_name);
 
+    // Set membership values are not part of the serialization format.
+    if (is_set_membership_op(node->get_op())) {
+      throw std::runtime_error(
+          "condition_ast_to_capnp: Set membership operators are not "
+          "supported");
+    }
+
     // Copy the condition value into a capnp vector of bytes.
     const UntypedDatumView& value = node->get_condition_value_view();
     auto capnpValue = kj::Vector<uint8_t>();
@@ -1972,6 +1980,42 @@ Status query_serialize(
   return Status::Ok();
 }
 
+/**
+ * Computes the size in bytes of the Cap'n Proto flat array message at the
+ * start of the given (possibly unaligned) data, from its segment table.
+ *
+ * @param data The serialized message, followed by any attribute buffer data.
+ * @param size The size of `data`.
+ * @param message_size Set to the size of the message.
+ * @return Status
+ */
+static Status capnp_message_size(
+    const char* const data, const uint64_t size, uint64_t* message_size) {
+  // The segment table is the segment count minus one, followed by the size
+  // in words of each segment, as 32-bit integers padded to a full word.
+  if (size < sizeof(uint32_t))
+    return LOG_STATUS(Status_SerializationError(
+        "Could not deserialize query; truncated message segment table."));
+  const uint64_t segment_num =
+      uint64_t(utils::endianness::decode_le<uint32_t>(data)) + 1;
+  const uint64_t table_size = (segment_num / 2 + 1) * sizeof(::capnp::word);
+  if (table_size > size)
+    return LOG_STATUS(Status_SerializationError(
+        "Could not deserialize query; truncated message segment table."));
+
+  uint64_t word_num = 0;
+  for (uint64_t i = 0; i < segment_num; i++)
+    word_num += utils::endianness::decode_le<uint32_t>(
+        data + (i + 1) * sizeof(uint32_t));
+
+  *message_size = table_size + word_num * sizeof(::capnp::word);
+  if (*message_size > size)
+    return LOG_STATUS(Status_SerializationError(
+        "Could not deserialize query; truncated message."));
+
+  return Status::Ok();
+}
+
 Status do_query_deserialize(
     const Buffer& serialized_buffer,
     SerializationType serialize_type,
@@ -1999,28 +2043,48 @@ Status do_query_deserialize(
             query_reader, context, nullptr, copy_state, query, compute_tp);
       }
       case SerializationType::CAPNP: {
-        // Capnp FlatArrayMessageReader requires 64-bit alignment.
-        if (!utils::is_aligned<sizeof(uint64_t)>(serialized_buffer.cur_data()))
+        auto data = static_cast<char*>(serialized_buffer.cur_data());
+        const uint64_t size =
+            serialized_buffer.size() - serialized_buffer.offset();
+
+        // Capnp FlatArrayMessageReader requires 64-bit alignment. On the
+        // client, the attribute buffer data is only copied out of, so for an
+        // unaligned buffer we copy just the CapnP message to an aligned
+        // array and read the attribute buffer data in place. On the server,
+        // the query buffers point into the serialized buffer, which must
+        // therefore be aligned itself.
+        kj::Array<::capnp::word> aligned_message;
+        kj::ArrayPtr<const ::capnp::word> message_words;
+        if (utils::is_aligned<sizeof(uint64_t)>(data)) {
+          message_words = kj::arrayPtr(
+              reinterpret_cast<const ::capnp::word*>(data),
+              size / sizeof(::capnp::word));
+        } else if (context == SerializationContext::CLIENT) {
+          uint64_t message_size = 0;
+          RETURN_NOT_OK(capnp_message_size(data, size, &message_size));
+          aligned_message = kj::heapArray<::capnp::word>(
+              message_size / sizeof(::capnp::word));
+          std::memcpy(aligned_message.begin(), data, message_size);
+          message_words = kj::arrayPtr(
+              static_cast<const ::capnp::word*>(aligned_message.begin()),
+              aligned_message.size());
+        } else {
           return LOG_STATUS(Status_SerializationError(
               "Could not deserialize query; buffer is not 8-byte aligned."));
+        }
 
         // Set traversal limit to 10GI (TODO: make this a config option)
         ::capnp::ReaderOptions readerOptions;
         readerOptions.traversalLimitInWords = uint64_t(1024) * 1024 * 1024 * 10;
-        ::capnp::FlatArrayMessageReader reader(
-            kj::arrayPtr(
-                reinterpret_cast<const ::capnp::word*>(
-                    serialized_buffer.cur_data()),
-                (serialized_buffer.size() - serialized_buffer.offset()) /
-                    sizeof(::capnp::word)),
-            readerOptions);
+        ::capnp::FlatArrayMessageReader reader(message_words, readerOptions);
 
         capnp::Query::Reader query_reader = reader.getRoot<capnp::Query>();
 
         // Get a pointer to the start of the attribute buffer data (which
         // was concatenated after the CapnP message on serialization).
-        auto attribute_buffer_start = reader.getEnd();
-        auto buffer_start = const_cast<::capnp::word*>(attribute_buffer_start);
+        const uint64_t message_size =
+            (reader.getEnd() - message_words.begin()) * sizeof(::capnp::word);
+        auto buffer_start = data + message_size;
         return query_from_capnp(
             query_reader, context, buffer_start, copy_state, query, compute_tp);
       }
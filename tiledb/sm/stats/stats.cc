@@ -186,6 +186,15 @@ void Stats::add_counter(const std::string& stat, uint64_t count) {
   }
 }
 
+void Stats::set_counter(const std::string& stat, uint64_t value) {
+  if (!enabled_)
+    return;
+
+  std::string new_stat = prefix_ + stat;
+  std::unique_lock<std::mutex> lck(mtx_);
+  counters_[new_stat] = value;
+}
+
 ScopedExecutor Stats::start_timer(const std::string& stat) {
   if (!enabled_)
     return ScopedExecutor();
@@ -248,6 +257,11 @@ void Stats::add_counter(const std::string& stat, uint64_t count) {
   (void)stat;
   (void)count;
 }
+
+void Stats::set_counter(const std::string& stat, uint64_t value) {
+  (void)stat;
+  (void)value;
+}
 ScopedExecutor Stats::start_timer(const std::string& stat) {
   (void)stat;
   return ScopedExecutor();
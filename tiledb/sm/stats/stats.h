@@ -84,6 +84,9 @@ class Stats {
   /** Adds `count` to the input counter stat. */
   void add_counter(const std::string& stat, uint64_t count);
 
+  /** Sets the input counter stat to `value`, used for levels. */
+  void set_counter(const std::string& stat, uint64_t value);
+
   /** Returns true if statistics are currently enabled. */
   bool enabled() const;
 
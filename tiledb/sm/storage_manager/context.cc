@@ -61,6 +61,11 @@ Context::Context(const Config& config)
   }
 }
 
+Context::~Context() {
+  // The io thread pool is destroyed first, stop lending its workers.
+  compute_tp_.borrow_idle_workers(nullptr);
+}
+
 /* ****************************** */
 /*                API             */
 /* ****************************** */
@@ -100,6 +105,22 @@ stats::Stats* Context::stats() const {
 Status Context::init(const Config& config) {
   RETURN_NOT_OK(init_loggers(config));
 
+  // Set up the adaptive io concurrency control, which also lets the compute
+  // thread pool borrow idle io workers.
+  bool found = false;
+  bool io_concurrency_adaptive = false;
+  RETURN_NOT_OK(config.get<bool>(
+      "sm.io_concurrency_adaptive", &io_concurrency_adaptive, &found));
+  assert(found);
+  if (io_concurrency_adaptive) {
+    uint64_t io_concurrency_level_min = 0;
+    RETURN_NOT_OK(config.get<uint64_t>(
+        "sm.io_concurrency_level_min", &io_concurrency_level_min, &found));
+    assert(found);
+    io_tp_.enable_adaptive_concurrency(io_concurrency_level_min);
+    compute_tp_.borrow_idle_workers(&io_tp_);
+  }
+
   // Register stats.
   stats::all_stats.register_stats(stats_);
 
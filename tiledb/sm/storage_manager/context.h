@@ -58,7 +58,7 @@ class Context {
   Context(const Config& = Config());
 
   /** Destructor. */
-  ~Context() = default;
+  ~Context();
 
   /* ********************************* */
   /*                API                */
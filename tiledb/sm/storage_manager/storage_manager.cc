@@ -47,6 +47,7 @@
 #include "tiledb/sm/array_schema/array_schema.h"
 #include "tiledb/sm/array_schema/array_schema_evolution.h"
 #include "tiledb/sm/cache/buffer_lru_cache.h"
+#include "tiledb/sm/cache/rtree_page_cache.h"
 #include "tiledb/sm/consolidator/consolidator.h"
 #include "tiledb/sm/consolidator/fragment_consolidator.h"
 #include "tiledb/sm/enums/array_type.h"
@@ -1350,6 +1351,14 @@ Status StorageManager::init(const Config& config) {
   tile_cache_ =
       tdb_unique_ptr<BufferLRUCache>(tdb_new(BufferLRUCache, tile_cache_size));
 
+  uint64_t rtree_page_cache_size = 0;
+  RETURN_NOT_OK(config_.get<uint64_t>(
+      "sm.rtree_page_cache_size", &rtree_page_cache_size, &found));
+  assert(found);
+
+  rtree_page_cache_ = tdb_unique_ptr<RTreePageCache>(
+      tdb_new(RTreePageCache, rtree_page_cache_size));
+
   // GlobalState must be initialized before `vfs->init` because S3::init calls
   // GetGlobalState
   auto& global_state = global_state::GlobalState::GetGlobalState();
@@ -1376,6 +1385,10 @@ ThreadPool* StorageManager::io_tp() const {
   return io_tp_;
 }
 
+RTreePageCache* StorageManager::rtree_page_cache() const {
+  return rtree_page_cache_.get();
+}
+
 RestClient* StorageManager::rest_client() const {
   return rest_client_.get();
 }
@@ -1666,6 +1679,118 @@ Status StorageManager::object_type(const URI& uri, ObjectType* type) const {
   return Status::Ok();
 }
 
+Status StorageManager::object_types(
+    const std::vector<URI>& uris,
+    const ObjectType parent_type,
+    std::vector<ObjectType>* types,
+    std::vector<std::vector<URI>>* contents) const {
+  types->assign(uris.size(), ObjectType::INVALID);
+  contents->assign(uris.size(), std::vector<URI>());
+  auto status = parallel_for(io_tp_, 0, uris.size(), [&](size_t i) {
+    if (is_object_internal_dir(uris[i]))
+      return Status::Ok();
+
+    if (parent_type != ObjectType::ARRAY)
+      return object_type_from_contents(
+          uris[i], &(*types)[i], &(*contents)[i]);
+
+    // Arrays may hold many fragment directories of older format versions,
+    // probe them rather than listing them. The rare objects found are listed
+    // for their expansion.
+    RETURN_NOT_OK(object_type(uris[i], &(*types)[i]));
+    if ((*types)[i] != ObjectType::INVALID && !uris[i].is_tiledb())
+      RETURN_NOT_OK(vfs_->ls(uris[i], &(*contents)[i]));
+    return Status::Ok();
+  });
+  RETURN_NOT_OK(status);
+
+  return Status::Ok();
+}
+
+ObjectType StorageManager::object_type_from_listing(
+    const std::vector<URI>& contents) {
+  // An array is identified by its schema directory or legacy schema file,
+  // and a group by its details directory or legacy group file. Arrays take
+  // precedence, as in `object_type`.
+  bool is_group = false;
+  for (const auto& content : contents) {
+    const auto name = content.remove_trailing_slash().last_path_part();
+    if (name == constants::array_schema_dir_name ||
+        name == constants::array_schema_filename)
+      return ObjectType::ARRAY;
+    if (name == constants::group_detail_dir_name ||
+        name == constants::group_filename)
+      is_group = true;
+  }
+
+  return is_group ? ObjectType::GROUP : ObjectType::INVALID;
+}
+
+bool StorageManager::is_object_internal_dir(const URI& uri) {
+  const auto name = uri.remove_trailing_slash().last_path_part();
+  return name == constants::array_schema_dir_name ||
+         name == constants::array_metadata_dir_name ||
+         name == constants::array_fragment_meta_dir_name ||
+         name == constants::array_fragments_dir_name ||
+         name == constants::array_commits_dir_name ||
+         name == constants::array_dimension_labels_dir_name ||
+         name == constants::group_detail_dir_name ||
+         name == constants::group_metadata_dir_name;
+}
+
+Status StorageManager::object_type_from_contents(
+    const URI& uri, ObjectType* type, std::vector<URI>* contents) const {
+  // Remote objects cannot be listed, they are classified by the REST server.
+  if (uri.is_tiledb())
+    return object_type(uri, type);
+
+  URI dir_uri = uri;
+  if (uri.is_s3() || uri.is_azure() || uri.is_gcs()) {
+    // Always add a trailing '/' in the S3/Azure/GCS case so that listing the
+    // URI as a directory will work as expected. Listing a non-directory object
+    // is not an error for S3/Azure/GCS.
+    auto uri_str = uri.to_string();
+    dir_uri =
+        URI(utils::parse::ends_with(uri_str, "/") ? uri_str : (uri_str + "/"));
+  } else {
+    // For non public cloud backends, listing a non-directory is an error.
+    bool is_dir = false;
+    RETURN_NOT_OK(vfs_->is_dir(uri, &is_dir));
+    if (!is_dir) {
+      *type = ObjectType::INVALID;
+      return Status::Ok();
+    }
+  }
+
+  RETURN_NOT_OK(vfs_->ls(dir_uri, contents));
+  *type = object_type_from_listing(*contents);
+  return Status::Ok();
+}
+
+Status StorageManager::object_iter_push_front(
+    ObjectIter* obj_iter,
+    const std::vector<URI>& uris,
+    const ObjectType parent_type) const {
+  std::vector<ObjectType> types;
+  std::vector<std::vector<URI>> contents;
+  RETURN_NOT_OK(object_types(uris, parent_type, &types, &contents));
+
+  // Push the new TileDB objects in the front of the iterator's list
+  for (uint64_t i = uris.size(); i-- > 0;) {
+    if (types[i] == ObjectType::INVALID)
+      continue;
+
+    obj_iter->objs_.push_front(uris[i]);
+    obj_iter->types_.push_front(types[i]);
+    obj_iter->contents_.push_front(
+        obj_iter->recursive_ ? std::move(contents[i]) : std::vector<URI>());
+    if (obj_iter->order_ == WalkOrder::POSTORDER)
+      obj_iter->expanded_.push_front(false);
+  }
+
+  return Status::Ok();
+}
+
 Status StorageManager::object_iter_begin(
     ObjectIter** obj_iter, const char* path, WalkOrder order) {
   // Sanity check
@@ -1685,15 +1810,9 @@ Status StorageManager::object_iter_begin(
   (*obj_iter)->recursive_ = true;
 
   // Include the uris that are TileDB objects in the iterator state
-  ObjectType obj_type;
-  for (auto& uri : uris) {
-    RETURN_NOT_OK_ELSE(object_type(uri, &obj_type), tdb_delete(*obj_iter));
-    if (obj_type != ObjectType::INVALID) {
-      (*obj_iter)->objs_.push_back(uri);
-      if (order == WalkOrder::POSTORDER)
-        (*obj_iter)->expanded_.push_back(false);
-    }
-  }
+  RETURN_NOT_OK_ELSE(
+      object_iter_push_front(*obj_iter, uris, object_type_from_listing(uris)),
+      tdb_delete(*obj_iter));
 
   return Status::Ok();
 }
@@ -1717,12 +1836,9 @@ Status StorageManager::object_iter_begin(
   (*obj_iter)->recursive_ = false;
 
   // Include the uris that are TileDB objects in the iterator state
-  ObjectType obj_type;
-  for (auto& uri : uris) {
-    RETURN_NOT_OK(object_type(uri, &obj_type));
-    if (obj_type != ObjectType::INVALID)
-      (*obj_iter)->objs_.push_back(uri);
-  }
+  RETURN_NOT_OK_ELSE(
+      object_iter_push_front(*obj_iter, uris, object_type_from_listing(uris)),
+      tdb_delete(*obj_iter));
 
   return Status::Ok();
 }
@@ -1755,36 +1871,30 @@ Status StorageManager::object_iter_next(
 Status StorageManager::object_iter_next_postorder(
     ObjectIter* obj_iter, const char** path, ObjectType* type, bool* has_next) {
   // Get all contents of the next URI recursively till the bottom,
-  // if the front of the list has not been expanded
+  // if the front of the list has not been expanded. The contents were
+  // listed when the URI was classified.
   if (obj_iter->expanded_.front() == false) {
     uint64_t obj_num;
     do {
       obj_num = obj_iter->objs_.size();
-      std::vector<URI> uris;
-      RETURN_NOT_OK(vfs_->ls(obj_iter->objs_.front(), &uris));
+      std::vector<URI> uris = std::move(obj_iter->contents_.front());
+      obj_iter->contents_.front().clear();
       obj_iter->expanded_.front() = true;
-
-      // Push the new TileDB objects in the front of the iterator's list
-      ObjectType obj_type;
-      for (auto it = uris.rbegin(); it != uris.rend(); ++it) {
-        RETURN_NOT_OK(object_type(*it, &obj_type));
-        if (obj_type != ObjectType::INVALID) {
-          obj_iter->objs_.push_front(*it);
-          obj_iter->expanded_.push_front(false);
-        }
-      }
+      RETURN_NOT_OK(
+          object_iter_push_front(obj_iter, uris, obj_iter->types_.front()));
     } while (obj_num != obj_iter->objs_.size());
   }
 
   // Prepare the values to be returned
-  URI front_uri = obj_iter->objs_.front();
-  obj_iter->next_ = front_uri.to_string();
-  RETURN_NOT_OK(object_type(front_uri, type));
+  obj_iter->next_ = obj_iter->objs_.front().to_string();
+  *type = obj_iter->types_.front();
   *path = obj_iter->next_.c_str();
   *has_next = true;
 
   // Pop the front (next URI) of the iterator's object list
   obj_iter->objs_.pop_front();
+  obj_iter->types_.pop_front();
+  obj_iter->contents_.pop_front();
   obj_iter->expanded_.pop_front();
 
   return Status::Ok();
@@ -1793,30 +1903,24 @@ Status StorageManager::object_iter_next_postorder(
 Status StorageManager::object_iter_next_preorder(
     ObjectIter* obj_iter, const char** path, ObjectType* type, bool* has_next) {
   // Prepare the values to be returned
-  URI front_uri = obj_iter->objs_.front();
-  obj_iter->next_ = front_uri.to_string();
-  RETURN_NOT_OK(object_type(front_uri, type));
+  obj_iter->next_ = obj_iter->objs_.front().to_string();
+  *type = obj_iter->types_.front();
   *path = obj_iter->next_.c_str();
   *has_next = true;
 
-  // Pop the front (next URI) of the iterator's object list
+  // Pop the front (next URI) of the iterator's object list, keeping its
+  // contents that were listed when it was classified.
+  std::vector<URI> uris = std::move(obj_iter->contents_.front());
   obj_iter->objs_.pop_front();
+  obj_iter->types_.pop_front();
+  obj_iter->contents_.pop_front();
 
   // Return if no recursion is needed
   if (!obj_iter->recursive_)
     return Status::Ok();
 
-  // Get all contents of the next URI
-  std::vector<URI> uris;
-  RETURN_NOT_OK(vfs_->ls(front_uri, &uris));
-
   // Push the new TileDB objects in the front of the iterator's list
-  ObjectType obj_type;
-  for (auto it = uris.rbegin(); it != uris.rend(); ++it) {
-    RETURN_NOT_OK(object_type(*it, &obj_type));
-    if (obj_type != ObjectType::INVALID)
-      obj_iter->objs_.push_front(*it);
-  }
+  RETURN_NOT_OK(object_iter_push_front(obj_iter, uris, *type));
 
   return Status::Ok();
 }
@@ -1826,6 +1930,13 @@ Status StorageManager::query_submit(Query* query) {
   QueryInProgress in_progress(this);
   auto st = query->process();
 
+  // Report the thread pool levels, which may change under the adaptive
+  // concurrency control.
+  stats_->set_counter(
+      "io_concurrency_level", io_tp_->active_concurrency_level());
+  stats_->set_counter(
+      "compute_borrowed_io_task_num", compute_tp_->borrowed_task_num());
+
   return st;
 }
 
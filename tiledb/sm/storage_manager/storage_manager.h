@@ -81,6 +81,7 @@ class MemoryTracker;
 class Query;
 class QueryCondition;
 class RestClient;
+class RTreePageCache;
 class VFS;
 
 enum class EncryptionType : uint8_t;
@@ -107,6 +108,17 @@ class StorageManager {
     std::string next_;
     /** The next objects to be visited. */
     std::list<URI> objs_;
+    /**
+     * The object types of the `objs_` paths, in one-to-one correspondence
+     * with `objs_`.
+     */
+    std::list<ObjectType> types_;
+    /**
+     * The contents of the `objs_` paths, in one-to-one correspondence with
+     * `objs_`, as listed when the paths were classified. They are used to
+     * expand the paths in a recursive traversal without listing them again.
+     */
+    std::list<std::vector<URI>> contents_;
     /** The traversal order of the iterator. */
     WalkOrder order_;
     /** `True` if the iterator will recursively visit the directory tree. */
@@ -666,6 +678,9 @@ class StorageManager {
   /** Returns the thread pool for io-bound tasks. */
   ThreadPool* io_tp() const;
 
+  /** Returns the cache of the leaf pages of paged R-trees. */
+  RTreePageCache* rtree_page_cache() const;
+
   /**
    * If the storage manager was configured with a REST server, return the
    * client instance. Else, return nullptr.
@@ -1154,6 +1169,9 @@ class StorageManager {
   /** A tile cache. */
   tdb_unique_ptr<BufferLRUCache> tile_cache_;
 
+  /** A cache of the leaf pages of paged R-trees. */
+  tdb_unique_ptr<RTreePageCache> rtree_page_cache_;
+
   /**
    * Virtual filesystem handler. It directs queries to the appropriate
    * filesystem backend. Note that this is stateful.
@@ -1173,6 +1191,70 @@ class StorageManager {
   /** Increment the count of in-progress queries. */
   void increment_in_progress();
 
+  /**
+   * Classifies the given URIs as TileDB objects, listing them concurrently
+   * on the IO thread pool. Each URI is classified from the listing of its own
+   * contents, by looking for the array schema or group marker entries, rather
+   * than probing for each marker separately.
+   *
+   * The internal directories of arrays and groups are never TileDB objects
+   * and are skipped without being listed. The other entries of an array,
+   * such as the fragments of older format versions, are classified by
+   * probing for the markers, as listing them would be costly.
+   *
+   * @param uris The URIs to classify.
+   * @param parent_type The object type of the directory holding the URIs.
+   * @param types Set to the object type of each URI.
+   * @param contents Set to the contents of each URI that is a TileDB object,
+   *     or left empty if the URI could not be listed.
+   * @return Status
+   */
+  Status object_types(
+      const std::vector<URI>& uris,
+      ObjectType parent_type,
+      std::vector<ObjectType>* types,
+      std::vector<std::vector<URI>>* contents) const;
+
+  /**
+   * Returns the object type of a directory given its contents, i.e. whether
+   * they hold the array schema or group marker entries.
+   *
+   * @param contents The contents of the directory.
+   * @return The object type.
+   */
+  static ObjectType object_type_from_listing(const std::vector<URI>& contents);
+
+  /**
+   * Returns true if the URI is one of the internal directories of an array
+   * or group, which are never TileDB objects.
+   */
+  static bool is_object_internal_dir(const URI& uri);
+
+  /**
+   * Classifies a single URI as a TileDB object, see `object_types`.
+   *
+   * @param uri The URI to classify.
+   * @param type Set to the object type.
+   * @param contents Set to the contents of the URI.
+   * @return Status
+   */
+  Status object_type_from_contents(
+      const URI& uri, ObjectType* type, std::vector<URI>* contents) const;
+
+  /**
+   * Pushes the given URIs that are TileDB objects to the front of the
+   * iterator's list, preserving their order, after classifying them.
+   *
+   * @param obj_iter The object iterator.
+   * @param uris The URIs to push.
+   * @param parent_type The object type of the directory holding the URIs.
+   * @return Status
+   */
+  Status object_iter_push_front(
+      ObjectIter* obj_iter,
+      const std::vector<URI>& uris,
+      ObjectType parent_type) const;
+
   /**
    * Loads the fragment metadata of an open array given a vector of
    * fragment URIs `fragments_to_load`.
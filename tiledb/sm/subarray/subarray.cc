@@ -3120,15 +3120,38 @@ Status Subarray::compute_relevant_fragment_tile_overlap(
     const auto r_start = fn_ctx->range_idx_offset_ + (t * ranges_per_thread);
     const auto r_end = fn_ctx->range_idx_offset_ +
                        std::min((t + 1) * ranges_per_thread - 1, range_num - 1);
-    for (uint64_t r = r_start; r <= r_end; ++r) {
-      if (dense) {  // Dense fragment
+    if (r_start > r_end)
+      return Status::Ok();
+
+    if (dense) {  // Dense fragment
+      for (uint64_t r = r_start; r <= r_end; ++r) {
         *tile_overlap->at(frag_idx, r) =
             compute_tile_overlap(r + tile_overlap->range_idx_start(), frag_idx);
-      } else {  // Sparse fragment
-        const auto& range = this->ndrange(r + tile_overlap->range_idx_start());
-        RETURN_NOT_OK(meta->get_tile_overlap(
-            range, is_default_, tile_overlap->at(frag_idx, r)));
       }
+    } else {  // Sparse fragment
+      // Traverse the R-tree once for all the ranges of this thread. The
+      // ranges are passed by reference to the 1D ranges of each dimension.
+      const auto dim_num = this->dim_num();
+      std::vector<const Range*> ranges;
+      ranges.reserve((r_end - r_start + 1) * dim_num);
+      for (uint64_t r = r_start; r <= r_end; ++r) {
+        const auto range_idx = r + tile_overlap->range_idx_start();
+        const auto range_coords = this->range_num() == 1 ?
+                                      std::vector<uint64_t>(dim_num, 0) :
+                                      get_range_coords(range_idx);
+        for (unsigned d = 0; d < dim_num; ++d)
+          ranges.emplace_back(&range_subset_[d][range_coords[d]]);
+      }
+
+      std::vector<TileOverlap> overlaps;
+      uint64_t visited_node_num = 0;
+      RETURN_NOT_OK(meta->get_tile_overlap(
+          ranges, is_default_, compute_tp, &overlaps, &visited_node_num));
+      for (uint64_t r = r_start; r <= r_end; ++r)
+        *tile_overlap->at(frag_idx, r) = std::move(overlaps[r - r_start]);
+      stats_->add_counter(
+          "compute_relevant_tile_overlap.rtree_visited_node_num",
+          visited_node_num);
     }
 
     return Status::Ok();
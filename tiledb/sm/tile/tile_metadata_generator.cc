@@ -30,6 +30,7 @@
  * This file implements class TileMetadataGenerator.
  */
 
+#include "tiledb/sm/misc/bloom_filter.h"
 #include "tiledb/sm/tile/tile_metadata_generator.h"
 #include "tiledb/sm/tile/writer_tile.h"
 
@@ -282,6 +283,25 @@ bool TileMetadataGenerator::has_sum_metadata(
   }
 }
 
+bool TileMetadataGenerator::has_bloom_filter_metadata(
+    const Datatype type, const bool var_size, const uint64_t cell_val_num) {
+  // Fixed size cells must have a single value.
+  if (!var_size && cell_val_num != 1)
+    return false;
+
+  // No Bloom filters for floating point values, where different bytes can
+  // compare equal (e.g. 0.0 and -0.0).
+  switch (type) {
+    case Datatype::ANY:
+    case Datatype::FLOAT32:
+    case Datatype::FLOAT64:
+      return false;
+
+    default:
+      return true;
+  }
+}
+
 template <class T>
 const tuple<void*, void*> TileMetadataGenerator::min_max(
     const Tile& tile, const uint64_t cell_size) {
@@ -396,7 +416,8 @@ TileMetadataGenerator::TileMetadataGenerator(
     const bool is_dim,
     const bool var_size,
     const uint64_t cell_size,
-    const uint64_t cell_val_num)
+    const uint64_t cell_val_num,
+    const uint64_t bloom_filter_bits_per_cell)
     : type_(type)
     , min_(nullptr)
     , min_size_(0)
@@ -406,6 +427,10 @@ TileMetadataGenerator::TileMetadataGenerator(
     , cell_size_(cell_size) {
   has_min_max_ = has_min_max_metadata(type, is_dim, var_size, cell_val_num);
   has_sum_ = has_sum_metadata(type, var_size, cell_val_num);
+  bloom_filter_bits_per_cell_ =
+      has_bloom_filter_metadata(type, var_size, cell_val_num) ?
+          bloom_filter_bits_per_cell :
+          0;
 
   sum_.resize(sizeof(uint64_t));
 }
@@ -492,6 +517,10 @@ void TileMetadataGenerator::process_tile(WriterTile& tile) {
   } else {
     process_tile_var(tile);
   }
+
+  if (bloom_filter_bits_per_cell_ != 0) {
+    tile.set_bloom_filter(bloom_filter(tile));
+  }
 }
 
 /* ****************************** */
@@ -637,5 +666,35 @@ inline void TileMetadataGenerator::min_max_var(
   }
 }
 
+ByteVec TileMetadataGenerator::bloom_filter(const WriterTile& tile) const {
+  const auto cell_num = tile.cell_num();
+  const uint8_t* validity_value =
+      tile.nullable() ? tile.validity_tile().data_as<uint8_t>() : nullptr;
+  BloomFilter filter(cell_num, bloom_filter_bits_per_cell_);
+
+  if (!tile.var_size()) {
+    auto value = tile.fixed_tile().data_as<char>();
+    for (uint64_t c = 0; c < cell_num; c++) {
+      if (validity_value == nullptr || validity_value[c] != 0) {
+        filter.insert(value, cell_size_);
+      }
+      value += cell_size_;
+    }
+  } else {
+    const auto& var_tile = tile.var_tile();
+    auto offset_value = tile.offset_tile().data_as<uint64_t>();
+    auto var_data = var_tile.data_as<char>();
+    for (uint64_t c = 0; c < cell_num; c++) {
+      if (validity_value == nullptr || validity_value[c] != 0) {
+        auto size = c == cell_num - 1 ? var_tile.size() - offset_value[c] :
+                                        offset_value[c + 1] - offset_value[c];
+        filter.insert(var_data + offset_value[c], size);
+      }
+    }
+  }
+
+  return filter.serialize();
+}
+
 }  // namespace sm
 }  // namespace tiledb
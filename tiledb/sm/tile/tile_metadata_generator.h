@@ -158,6 +158,20 @@ class TileMetadataGenerator {
   static bool has_sum_metadata(
       const Datatype type, const bool var_size, const uint64_t cell_val_num);
 
+  /**
+   * Does this datatype have Bloom filter metadata. Bloom filters hash the
+   * raw bytes of the cell values, so they are only built for types where
+   * byte equality is value equality.
+   *
+   * @param type Data type.
+   * @param var_size Is the attribute/dimension var size?
+   * @param cell_val_num Number of values per cell.
+   *
+   * @return bool.
+   */
+  static bool has_bloom_filter_metadata(
+      const Datatype type, const bool var_size, const uint64_t cell_val_num);
+
   /**
    * Returns the min and max of a fixed data tile.
    *
@@ -195,13 +209,16 @@ class TileMetadataGenerator {
    * @param var_size Is the attribute/dimension var size?
    * @param cell_size Cell size.
    * @param cell_val_num Number of values per cell.
+   * @param bloom_filter_bits_per_cell Number of Bloom filter bits per cell,
+   *     0 disables the Bloom filters.
    */
   TileMetadataGenerator(
       const Datatype type,
       const bool is_dim,
       const bool var_size,
       const uint64_t cell_size,
-      const uint64_t cell_val_num);
+      const uint64_t cell_val_num,
+      const uint64_t bloom_filter_bits_per_cell = 0);
 
   /* ********************************* */
   /*                API                */
@@ -249,6 +266,9 @@ class TileMetadataGenerator {
   /** This metadata stores sums. */
   bool has_sum_;
 
+  /** Number of Bloom filter bits per cell, 0 if there are no Bloom filters. */
+  uint64_t bloom_filter_bits_per_cell_;
+
   /* ********************************* */
   /*          PRIVATE METHODS          */
   /* ********************************* */
@@ -277,6 +297,14 @@ class TileMetadataGenerator {
    * @param size Value size.
    */
   void min_max_var(const char* value, const uint64_t size);
+
+  /**
+   * Builds the Bloom filter of the non-null values of a tile.
+   *
+   * @param tile The tile.
+   * @return The serialized Bloom filter.
+   */
+  ByteVec bloom_filter(const WriterTile& tile) const;
 };
 
 }  // namespace sm
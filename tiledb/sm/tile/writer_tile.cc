@@ -170,6 +170,7 @@ void WriterTile::swap(WriterTile& tile) {
   std::swap(max_size_, tile.max_size_);
   std::swap(sum_, tile.sum_);
   std::swap(null_count_, tile.null_count_);
+  std::swap(bloom_filter_, tile.bloom_filter_);
 }
 
 }  // namespace sm
@@ -169,6 +169,24 @@ class WriterTile {
     return sum_;
   }
 
+  /**
+   * Returns the serialized tile Bloom filter, empty if there is none.
+   *
+   * @return tile Bloom filter.
+   */
+  inline const ByteVec& bloom_filter() const {
+    return bloom_filter_;
+  }
+
+  /**
+   * Sets the serialized tile Bloom filter.
+   *
+   * @param bloom_filter Serialized Bloom filter.
+   */
+  inline void set_bloom_filter(ByteVec&& bloom_filter) {
+    bloom_filter_ = std::move(bloom_filter);
+  }
+
   /**
    * Sets the tile metadata.
    *
@@ -261,6 +279,9 @@ class WriterTile {
 
   /** Count of null values. */
   uint64_t null_count_;
+
+  /** Serialized Bloom filter of the tile values, empty if there is none. */
+  ByteVec bloom_filter_;
 };
 
 }  // namespace sm